@@ -32,6 +32,7 @@
 #include "config/hardware_config.h"
 // SSOT communication config (used by device test and comm helpers)
 #include "config/comm_config.h"
+#include "hal_abstraction/hal_abstraction.h"
 /* USER CODE END Includes */
 
 /* Private typedef
@@ -98,6 +99,8 @@ int main(void) {
     SystemClock_Config();
 
     /* USER CODE BEGIN SysInit */
+    // Microsecond delays spin on DWT->CYCCNT; start it before any driver
+    HAL_Abstraction_InitCycleCounter();
 
     /* USER CODE END SysInit */
 
@@ -74,6 +74,9 @@
  *  - USARTx_IRQHandler (vector) -> HAL_UART_IRQHandler(&huartX) ->
  *      HAL_UART_RxCpltCallback / HAL_UART_TxCpltCallback ->
  *      comm_uart_rx_complete_callback / comm_uart_tx_complete_callback
+ *  - Circular command RX DMA (idle line, half/full transfer) ->
+ *      HAL_UARTEx_RxEventCallback (hal_abstraction_stm32h7.c) ->
+ *      comm_uart_rx_event_callback
  *
  *  - TIM6_DAC_IRQHandler -> HAL_TIM_IRQHandler(&htim6) ->
  *      HAL_TIM_PeriodElapsedCallback -> application timer handlers
@@ -12,6 +12,13 @@
 from pathlib import Path
 from typing import Dict, List, Any, Optional
 import re
+from fractions import Fraction
+
+
+def fixed_point_ratio(config: Dict[str, Any], fp: Dict[str, Any]) -> Fraction:
+    """Register value per host unit: 2^shift / (tick_hz^order * user_scale)"""
+    return Fraction(2 ** fp['shift'],
+                    config['tick_hz'] ** fp['tick_order'] * config.get('user_scale', 1))
 
 
 class SchemaValidator:
@@ -40,6 +47,9 @@ def validate_schema(self, schema: Dict[str, Any]) -> bool:
             
         if 'validation' in schema:
             self._validate_safety_rules(schema['validation'])
+
+        if 'registers' in schema:
+            self._validate_fixed_point(schema)
             
         return len(self.errors) == 0
         
@@ -81,6 +91,28 @@ def _validate_registers(self, registers: Dict[str, Any]):
                 if 'valid_range' not in reg_def and 'fields' not in reg_def:
                     self.warnings.append(f"Register {reg_name}: configuration register without validation")
                     
+    def _validate_fixed_point(self, schema: Dict[str, Any]):
+        """Check fixed-point conversions fit the generated 64-bit math"""
+        for reg_name, reg_def in schema['registers'].items():
+            if 'fixed_point' not in reg_def:
+                continue
+            if 'fixed_point' not in schema:
+                self.errors.append(f"Register {reg_name}: fixed_point without top-level fixed_point section")
+                return
+            fp = reg_def['fixed_point']
+            if 'tick_order' not in fp or 'shift' not in fp:
+                self.errors.append(f"Register {reg_name}: fixed_point needs tick_order and shift")
+                continue
+            ratio = fixed_point_ratio(schema['fixed_point'], fp)
+            # encode: x * num over the uint32_t input range;
+            # decode: value * den over the register mask, result in uint32_t
+            if (0xFFFFFFFF * ratio.numerator) >> 64:
+                self.errors.append(f"Register {reg_name}: fixed_point encode overflows 64 bits")
+            if (reg_def['mask'] * ratio.denominator) >> 64:
+                self.errors.append(f"Register {reg_name}: fixed_point decode overflows 64 bits")
+            if (reg_def['mask'] / ratio) > 0xFFFFFFFF:
+                self.errors.append(f"Register {reg_name}: fixed_point decode exceeds uint32_t")
+
     def _validate_safety_rules(self, validation: Dict[str, Any]):
         """Validate safety validation rules"""
         if 'critical_registers' not in validation:
@@ -189,6 +221,10 @@ def _generate_header_content(self, schema: Dict[str, Any]) -> str:
         if 'validation' in schema:
             lines.extend(self._generate_validation_constants(schema['validation'], chip_prefix, alias_lines))
 
+        # Fixed-point unit conversions
+        if 'fixed_point' in schema:
+            lines.extend(self._generate_fixed_point_conversions(schema, chip_prefix))
+
         # Function declarations for register access
         lines.extend(self._generate_function_declarations(schema, chip))
 
@@ -436,6 +472,52 @@ def _generate_validation_constants(self, validation: Dict[str, Any], chip_prefix
             
         return lines
         
+    def _generate_fixed_point_conversions(self, schema: Dict[str, Any], chip_prefix: str) -> List[str]:
+        """Generate exact integer encode/decode helpers for scaled registers"""
+        config = schema['fixed_point']
+        lines = [
+            "/* ========================================================================== */",
+            f"/* Fixed-Point Unit Conversions                                              */",
+            "/* ========================================================================== */",
+            f"/* value = round(x * ENC_NUM / ENC_DEN), x = round(value * ENC_DEN / ENC_NUM) */",
+            f"/* tick = {config['tick_hz']} Hz, host units scaled by {config.get('user_scale', 1)} */",
+            ""
+        ]
+
+        for reg_name, reg_def in schema['registers'].items():
+            if 'fixed_point' not in reg_def:
+                continue
+            fp = reg_def['fixed_point']
+            ratio = fixed_point_ratio(config, fp)
+            sanitized_reg = self._sanitize_identifier(reg_name).upper()
+            pref = f"{chip_prefix}_{sanitized_reg}"
+            func = f"{chip_prefix.lower()}_{sanitized_reg.lower()}"
+            units = fp.get('units', 'host units')
+            order = "" if fp['tick_order'] == 1 else f"^{fp['tick_order']}"
+
+            lines.extend([
+                f"/* {reg_name}: {units} <-> value * 2^-{fp['shift']} / tick{order} */",
+                f"#define {pref}_ENC_NUM    {ratio.numerator}ULL",
+                f"#define {pref}_ENC_DEN    {ratio.denominator}ULL",
+                "",
+                f"/** @brief {units} to {reg_name} register value (saturates at the mask) */",
+                f"static inline uint32_t {func}_encode(uint32_t x) {{",
+                f"    uint64_t value = ((uint64_t)x * {pref}_ENC_NUM + {pref}_ENC_DEN / 2U) /",
+                f"                     {pref}_ENC_DEN;",
+                f"    return (value > {pref}_MASK) ? {pref}_MASK : (uint32_t)value;",
+                "}",
+                "",
+                f"/** @brief {reg_name} register value to {units} */",
+                f"static inline uint32_t {func}_decode(uint32_t value) {{",
+                f"    return (uint32_t)(((uint64_t)(value & {pref}_MASK) * {pref}_ENC_DEN +",
+                f"                       {pref}_ENC_NUM / 2U) /",
+                f"                      {pref}_ENC_NUM);",
+                "}",
+                ""
+            ])
+
+        return lines
+
     def _generate_function_declarations(self, schema: Dict[str, Any], chip: str) -> List[str]:
         """Generate function declarations for register access"""
         chip = chip.lower()
@@ -0,0 +1,219 @@
+/**
+ * @file comm_ascii.c
+ * @brief ASCII command tokenizer and perfect-hash verb dispatch
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_ascii.h"
+#include "config/motor_config.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static bool is_separator(char c);
+static SystemError_t parse_argument(char type, const CommAsciiToken_t *token,
+                                    int32_t *value);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Split a line into space-separated tokens in place
+ */
+uint8_t comm_ascii_tokenize(const char *line, CommAsciiToken_t *tokens,
+                            uint8_t max_tokens) {
+    uint8_t count = 0;
+    const char *cursor = line;
+
+    for (;;) {
+        while (is_separator(*cursor)) {
+            cursor++;
+        }
+        if (*cursor == '\0' || count == UINT8_MAX) {
+            return count;
+        }
+
+        const char *start = cursor;
+        while (*cursor != '\0' && !is_separator(*cursor)) {
+            cursor++;
+        }
+        if (count < max_tokens) {
+            tokens[count].text = start;
+            tokens[count].length = (uint16_t)(cursor - start);
+        }
+        count++;
+    }
+}
+
+/**
+ * @brief Look up a verb
+ */
+const CommAsciiVerb_t *comm_ascii_find_verb(const CommAsciiVerb_t *table,
+                                            const CommAsciiToken_t *verb) {
+    if (verb->length == 0) {
+        return NULL;
+    }
+
+    const CommAsciiVerb_t *entry =
+        &table[COMM_ASCII_VERB_SLOT(verb->text[0], verb->text[verb->length - 1],
+                                    verb->length)];
+
+    // One compare confirms the slot holds this verb
+    if (entry->name == NULL || strncmp(entry->name, verb->text,
+                                       verb->length) != 0 ||
+        entry->name[verb->length] != '\0') {
+        return NULL;
+    }
+    return entry;
+}
+
+/**
+ * @brief Check that every verb sits in its own hash slot
+ */
+SystemError_t comm_ascii_check_table(const CommAsciiVerb_t *table) {
+    for (uint32_t slot = 0; slot < COMM_ASCII_VERB_SLOTS; slot++) {
+        const char *name = table[slot].name;
+        if (name == NULL) {
+            continue;
+        }
+        size_t length = strlen(name);
+        if (length == 0 || table[slot].handler == NULL ||
+            COMM_ASCII_VERB_SLOT(name[0], name[length - 1], length) != slot) {
+            return ERROR_INVALID_PARAMETER;
+        }
+    }
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Convert a token to a signed 32-bit integer
+ */
+bool comm_ascii_parse_int32(const CommAsciiToken_t *token, int32_t *value) {
+    const char *text = token->text;
+    uint16_t length = token->length;
+    bool negative = false;
+
+    if (length > 0 && (text[0] == '-' || text[0] == '+')) {
+        negative = (text[0] == '-');
+        text++;
+        length--;
+    }
+    if (length == 0) {
+        return false;
+    }
+
+    // Accumulate as a magnitude so INT32_MIN is reachable
+    uint32_t limit = negative ? 2147483648U : 2147483647U;
+    uint32_t magnitude = 0;
+    for (uint16_t i = 0; i < length; i++) {
+        uint32_t digit = (uint32_t)(text[i] - '0');
+        if (digit > 9U || magnitude > (limit - digit) / 10U) {
+            return false;
+        }
+        magnitude = magnitude * 10U + digit;
+    }
+
+    *value = negative ? (int32_t)(0U - magnitude) : (int32_t)magnitude;
+    return true;
+}
+
+/**
+ * @brief Tokenize a line, find its verb and convert its arguments
+ */
+SystemError_t comm_ascii_parse(const CommAsciiVerb_t *table, const char *line,
+                               const CommAsciiVerb_t **verb,
+                               CommAsciiArgs_t *args) {
+    if (table == NULL || line == NULL || verb == NULL || args == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    CommAsciiToken_t tokens[COMM_ASCII_MAX_TOKENS];
+    uint8_t count = comm_ascii_tokenize(line, tokens, COMM_ASCII_MAX_TOKENS);
+    if (count == 0 || count > COMM_ASCII_MAX_TOKENS) {
+        return ERROR_COMM_INVALID_COMMAND;
+    }
+
+    const CommAsciiVerb_t *entry = comm_ascii_find_verb(table, &tokens[0]);
+    if (entry == NULL) {
+        return ERROR_COMM_INVALID_COMMAND;
+    }
+
+    // Walk the type string alongside the argument tokens
+    const char *type = entry->args;
+    char repeated = '\0';
+    args->count = 0;
+    for (uint8_t i = 1; i < count; i++) {
+        if (*type == '*') {
+            repeated = type[-1];
+            type++;
+        }
+        char current = (*type != '\0') ? *type++ : repeated;
+        if (current == '\0') {
+            return ERROR_COMM_INVALID_COMMAND; // Too many arguments
+        }
+
+        SystemError_t result = parse_argument(
+            current, &tokens[i], &args->values[args->count]);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+        args->count++;
+    }
+    if (*type != '\0' && *type != '*') {
+        return ERROR_COMM_INVALID_COMMAND; // Too few arguments
+    }
+
+    *verb = entry;
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Parse a line and run its verb's handler
+ */
+SystemError_t comm_ascii_dispatch(const CommAsciiVerb_t *table,
+                                  const char *line) {
+    const CommAsciiVerb_t *verb;
+    CommAsciiArgs_t args;
+
+    SystemError_t result = comm_ascii_parse(table, line, &verb, &args);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return verb->handler(verb, &args);
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Token separators
+ */
+static bool is_separator(char c) {
+    return c == ' ' || c == '\t';
+}
+
+/**
+ * @brief Convert one argument according to its type character
+ */
+static SystemError_t parse_argument(char type, const CommAsciiToken_t *token,
+                                    int32_t *value) {
+    if (!comm_ascii_parse_int32(token, value)) {
+        return ERROR_COMM_INVALID_COMMAND;
+    }
+    if (type == 'm' && (*value < 0 || *value >= (int32_t)MAX_MOTORS)) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+    return SYSTEM_OK;
+}
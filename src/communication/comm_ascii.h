@@ -0,0 +1,130 @@
+/**
+ * @file comm_ascii.h
+ * @brief ASCII command tokenizer and perfect-hash verb dispatch
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details A command line is split in place into tokens (pointer and
+ *          length into the line, nothing copied or terminated). The verb
+ *          is found in a table indexed by a perfect hash of its first and
+ *          last character and its length, so lookup costs one slot probe
+ *          and one compare whatever the number of verbs. Arguments are
+ *          converted by the verb's type string before its handler runs:
+ *
+ *          - 'm' motor index, checked against MAX_MOTORS
+ *          - 'i' signed 32-bit integer
+ *          - '*' any number (including none) of the preceding type
+ *
+ *          A new verb is one table line:
+ *          @code
+ *          [COMM_ASCII_VERB_SLOT('M', 'E', 4)] = {"MOVE", "mii", code, fn},
+ *          @endcode
+ *          comm_ascii_check_table() rejects a verb in the wrong slot. It
+ *          cannot see two verbs that hash to the same slot: the later
+ *          initializer replaces the earlier one, which only the compiler
+ *          reports (-Woverride-init, part of -Wextra).
+ */
+
+#ifndef COMM_ASCII_H
+#define COMM_ASCII_H
+
+#include "common/error_codes.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COMM_ASCII_MAX_TOKENS 8U
+#define COMM_ASCII_MAX_ARGS (COMM_ASCII_MAX_TOKENS - 1U)
+
+// Verb table size (power of two) and its perfect hash
+#define COMM_ASCII_VERB_SLOTS 32U
+#define COMM_ASCII_VERB_SLOT(first, last, length)                             \
+    (((unsigned)(first) + (unsigned)(last) + (unsigned)(length)) &            \
+     (COMM_ASCII_VERB_SLOTS - 1U))
+
+/**
+ * @brief A token inside the command line (not NUL-terminated)
+ */
+typedef struct {
+    const char *text; ///< First character
+    uint16_t length;  ///< Characters in the token
+} CommAsciiToken_t;
+
+/**
+ * @brief Converted verb arguments
+ */
+typedef struct {
+    int32_t values[COMM_ASCII_MAX_ARGS]; ///< In command-line order
+    uint8_t count;                       ///< Number of arguments
+} CommAsciiArgs_t;
+
+typedef struct CommAsciiVerb CommAsciiVerb_t;
+
+/**
+ * @brief Verb handler, called with validated arguments
+ */
+typedef SystemError_t (*CommAsciiHandler_t)(const CommAsciiVerb_t *verb,
+                                            const CommAsciiArgs_t *args);
+
+/**
+ * @brief Verb table entry
+ */
+struct CommAsciiVerb {
+    const char *name;           ///< Verb, as typed (case-sensitive)
+    const char *args;           ///< Argument types ("mii", "i*", ...)
+    uint8_t code;               ///< Handler-specific code (command type)
+    CommAsciiHandler_t handler; ///< Called by comm_ascii_dispatch
+};
+
+/**
+ * @brief Split a line into space-separated tokens in place
+ * @param line NUL-terminated command line
+ * @param tokens Output tokens
+ * @param max_tokens Capacity of tokens
+ * @return Number of tokens in the line; may exceed max_tokens, in which
+ *         case only the first max_tokens are stored
+ */
+uint8_t comm_ascii_tokenize(const char *line, CommAsciiToken_t *tokens,
+                            uint8_t max_tokens);
+
+/**
+ * @brief Look up a verb
+ * @param table COMM_ASCII_VERB_SLOTS entries indexed by verb slot
+ * @param verb Verb token
+ * @return Table entry, or NULL for an unknown verb
+ */
+const CommAsciiVerb_t *comm_ascii_find_verb(const CommAsciiVerb_t *table,
+                                            const CommAsciiToken_t *verb);
+
+/**
+ * @brief Check that every verb sits in the slot its name hashes to
+ * @return ERROR_INVALID_PARAMETER for a misplaced verb or a missing handler
+ */
+SystemError_t comm_ascii_check_table(const CommAsciiVerb_t *table);
+
+/**
+ * @brief Convert a token to a signed 32-bit integer
+ * @return false if the token is not a decimal integer or out of range
+ */
+bool comm_ascii_parse_int32(const CommAsciiToken_t *token, int32_t *value);
+
+/**
+ * @brief Tokenize a line, find its verb and convert its arguments
+ * @param table Verb table
+ * @param line NUL-terminated command line
+ * @param verb Output: matched verb
+ * @param args Output: converted arguments
+ * @return ERROR_COMM_INVALID_COMMAND for an unknown verb or malformed
+ *         arguments, ERROR_MOTOR_INVALID_ID for a bad motor index
+ */
+SystemError_t comm_ascii_parse(const CommAsciiVerb_t *table, const char *line,
+                               const CommAsciiVerb_t **verb,
+                               CommAsciiArgs_t *args);
+
+/**
+ * @brief Parse a line and run its verb's handler
+ * @return Parse error, or the handler's result
+ */
+SystemError_t comm_ascii_dispatch(const CommAsciiVerb_t *table,
+                                  const char *line);
+
+#endif // COMM_ASCII_H
@@ -0,0 +1,69 @@
+/**
+ * @file comm_can_bus.h
+ * @brief CAN frame type, transmit hook and host loopback bus
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details CAN services (telemetry, time sync, ...) transmit through a
+ *          CommCanSend_t hook instead of calling the FDCAN HAL directly.
+ *          On target the hook queues to the FDCAN TX FIFO; on the host the
+ *          loopback bus below stands in for it, so the services can be
+ *          exercised and inspected without a bus.
+ */
+
+#ifndef COMM_CAN_BUS_H
+#define COMM_CAN_BUS_H
+
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COMM_CAN_LOOPBACK_DEPTH 16U
+
+/**
+ * @brief One CAN / CAN-FD frame
+ */
+typedef struct {
+    uint32_t id;                        ///< Standard identifier
+    uint32_t timestamp_us;              ///< Receive time (microsecond tick)
+    uint8_t length;                     ///< Data bytes (0..64)
+    uint8_t data[CAN_MAX_MESSAGE_SIZE]; ///< Frame data
+} CommCanFrame_t;
+
+/**
+ * @brief Queue one frame for transmission
+ * @param context Transport context (FDCAN handle, loopback bus, ...)
+ * @return ERROR_COMM_BUSY if the transmit FIFO is full
+ */
+typedef SystemError_t (*CommCanSend_t)(void *context, uint32_t id,
+                                       const uint8_t *data, uint8_t length);
+
+/**
+ * @brief Loopback bus: frames sent are queued for comm_can_loopback_receive
+ */
+typedef struct {
+    CommCanFrame_t frames[COMM_CAN_LOOPBACK_DEPTH];
+    uint32_t head;      ///< Frames sent, free-running
+    uint32_t tail;      ///< Frames received, free-running
+    uint32_t overflows; ///< Frames refused: bus queue full
+} CommCanLoopback_t;
+
+/**
+ * @brief Empty a loopback bus
+ */
+void comm_can_loopback_init(CommCanLoopback_t *bus);
+
+/**
+ * @brief CommCanSend_t for a loopback bus (context is the bus)
+ */
+SystemError_t comm_can_loopback_send(void *context, uint32_t id,
+                                     const uint8_t *data, uint8_t length);
+
+/**
+ * @brief Take the oldest frame off a loopback bus
+ * @return false if no frame is waiting
+ */
+bool comm_can_loopback_receive(CommCanLoopback_t *bus, CommCanFrame_t *frame);
+
+#endif // COMM_CAN_BUS_H
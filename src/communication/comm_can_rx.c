@@ -0,0 +1,121 @@
+/**
+ * @file comm_can_rx.c
+ * @brief CAN receive routing: acceptance filters and per-handler queues
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_can_rx.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Set up a router over a route table
+ */
+SystemError_t comm_can_rx_init(CommCanRx_t *rx, const CommCanRoute_t *routes,
+                               uint8_t route_count) {
+    if (rx == NULL || routes == NULL || route_count == 0 ||
+        route_count > COMM_CAN_RX_ROUTES) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    for (uint8_t i = 0; i < route_count; i++) {
+        if (routes[i].handler == NULL ||
+            routes[i].first_id > routes[i].last_id ||
+            routes[i].last_id > COMM_CAN_RX_MAX_STD_ID) {
+            return ERROR_INVALID_PARAMETER;
+        }
+    }
+
+    memset(rx, 0, sizeof(*rx));
+    rx->routes = routes;
+    rx->route_count = route_count;
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Queue a frame accepted by a filter (RX FIFO ISR)
+ */
+bool comm_can_rx_dispatch(CommCanRx_t *rx, uint32_t filter_index, uint32_t id,
+                          const uint8_t *data, uint8_t length,
+                          uint32_t timestamp_us) {
+    if (filter_index >= rx->route_count || length > CAN_MAX_MESSAGE_SIZE) {
+        rx->unrouted++;
+        return false;
+    }
+
+    CommCanRxQueue_t *queue = &rx->queues[filter_index];
+    uint32_t head = queue->head;
+    if (head - __atomic_load_n(&queue->tail, __ATOMIC_ACQUIRE) >=
+        COMM_CAN_RX_QUEUE_DEPTH) {
+        queue->overflows++;
+        return false;
+    }
+
+    CommCanFrame_t *frame =
+        &queue->frames[head & (COMM_CAN_RX_QUEUE_DEPTH - 1U)];
+    frame->id = id;
+    frame->timestamp_us = timestamp_us;
+    frame->length = length;
+    if (length != 0) {
+        memcpy(frame->data, data, length);
+    }
+
+    // Publish the frame only once it is complete
+    __atomic_store_n(&queue->head, head + 1U, __ATOMIC_RELEASE);
+    return true;
+}
+
+/**
+ * @brief Run the handlers for every queued frame (task context)
+ */
+uint32_t comm_can_rx_process(CommCanRx_t *rx) {
+    uint32_t handled = 0;
+
+    for (uint8_t i = 0; i < rx->route_count; i++) {
+        CommCanRxQueue_t *queue = &rx->queues[i];
+        uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_ACQUIRE);
+
+        // Frames arriving meanwhile wait for the next call
+        while (queue->tail != head) {
+            const CommCanFrame_t *frame =
+                &queue->frames[queue->tail & (COMM_CAN_RX_QUEUE_DEPTH - 1U)];
+            if (rx->routes[i].handler(frame) != SYSTEM_OK) {
+                queue->errors++;
+            }
+            __atomic_store_n(&queue->tail, queue->tail + 1U,
+                             __ATOMIC_RELEASE);
+            handled++;
+        }
+    }
+
+    return handled;
+}
+
+/**
+ * @brief Filter element that accepts an identifier
+ */
+int32_t comm_can_rx_match(const CommCanRx_t *rx, uint32_t id) {
+    // Lowest matching element wins, as in the FDCAN filter list
+    for (uint8_t i = 0; i < rx->route_count; i++) {
+        if (id >= rx->routes[i].first_id && id <= rx->routes[i].last_id) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Payload length of a CAN-FD DLC code
+ */
+uint8_t comm_can_dlc_to_length(uint8_t dlc) {
+    static const uint8_t lengths[16] = {0,  1,  2,  3,  4,  5,  6,  7,
+                                        8,  12, 16, 20, 24, 32, 48, 64};
+    return lengths[dlc & 0x0FU];
+}
@@ -0,0 +1,116 @@
+/**
+ * @file comm_can_rx.h
+ * @brief CAN receive routing: acceptance filters and per-handler queues
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details A route table maps standard ID ranges from the comm_config.h ID
+ *          map to handlers. Route i is programmed into FDCAN acceptance
+ *          filter i, and everything no filter accepts is rejected by the
+ *          global filter, so frames for other nodes never raise an
+ *          interrupt. The RX FIFO ISR then routes by the filter index the
+ *          hardware reports with each frame: one table lookup, no ID
+ *          compares. Frames wait in the route's own queue until
+ *          comm_can_rx_process runs the handlers from task context, so a
+ *          burst of one message type cannot starve another.
+ */
+
+#ifndef COMM_CAN_RX_H
+#define COMM_CAN_RX_H
+
+#include "comm_can_bus.h"
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COMM_CAN_RX_ROUTES CAN_FILTER_COUNT ///< One route per filter element
+#define COMM_CAN_RX_QUEUE_DEPTH 4U          ///< Frames queued per route
+#define COMM_CAN_RX_MAX_STD_ID 0x7FFU       ///< 11-bit identifiers
+
+#if (COMM_CAN_RX_QUEUE_DEPTH & (COMM_CAN_RX_QUEUE_DEPTH - 1U)) != 0
+#error "COMM_CAN_RX_QUEUE_DEPTH must be a power of two"
+#endif
+
+/**
+ * @brief Handle one received frame (task context)
+ */
+typedef SystemError_t (*CommCanRxHandler_t)(const CommCanFrame_t *frame);
+
+/**
+ * @brief Standard ID range accepted by one filter, and its handler
+ */
+typedef struct {
+    uint16_t first_id;          ///< Lowest accepted identifier
+    uint16_t last_id;           ///< Highest accepted identifier
+    CommCanRxHandler_t handler; ///< Runs for every accepted frame
+} CommCanRoute_t;
+
+/**
+ * @brief Frames waiting for one route's handler (ISR in, task out)
+ */
+typedef struct {
+    CommCanFrame_t frames[COMM_CAN_RX_QUEUE_DEPTH];
+    uint32_t head;      ///< Frames queued, free-running (ISR)
+    uint32_t tail;      ///< Frames handled, free-running (task)
+    uint32_t overflows; ///< Frames dropped: queue full
+    uint32_t errors;    ///< Frames the handler refused
+} CommCanRxQueue_t;
+
+/**
+ * @brief Receive router state
+ */
+typedef struct {
+    const CommCanRoute_t *routes;                ///< Indexed by filter
+    uint8_t route_count;                         ///< Filters in use
+    CommCanRxQueue_t queues[COMM_CAN_RX_ROUTES]; ///< One per route
+    uint32_t unrouted;                           ///< Filter index unknown
+} CommCanRx_t;
+
+/**
+ * @brief Set up a router over a route table
+ * @param rx Router state
+ * @param routes Route table; route i is filter i. Must outlive the router.
+ * @param route_count Entries in routes (1..COMM_CAN_RX_ROUTES)
+ * @return ERROR_INVALID_PARAMETER for an empty, oversized or malformed
+ *         table (reversed or out of range IDs, missing handler)
+ */
+SystemError_t comm_can_rx_init(CommCanRx_t *rx, const CommCanRoute_t *routes,
+                               uint8_t route_count);
+
+/**
+ * @brief Queue a frame accepted by a filter (RX FIFO ISR)
+ * @param rx Router state
+ * @param filter_index Filter element that accepted the frame
+ * @param id Frame identifier
+ * @param data Frame data
+ * @param length Data bytes (0..CAN_MAX_MESSAGE_SIZE)
+ * @param timestamp_us Receive time, taken in the ISR (time sync needs it)
+ * @return false if the frame was dropped (no route or queue full)
+ */
+bool comm_can_rx_dispatch(CommCanRx_t *rx, uint32_t filter_index, uint32_t id,
+                          const uint8_t *data, uint8_t length,
+                          uint32_t timestamp_us);
+
+/**
+ * @brief Run the handlers for every queued frame (task context)
+ * @return Frames handled
+ */
+uint32_t comm_can_rx_process(CommCanRx_t *rx);
+
+/**
+ * @brief Filter element that accepts an identifier
+ * @details Software model of the acceptance filters, for transports
+ *          without them (host loopback). On target the FDCAN does this.
+ * @return Filter index, or -1 if the frame would be rejected
+ */
+int32_t comm_can_rx_match(const CommCanRx_t *rx, uint32_t id);
+
+/**
+ * @brief Payload length of a CAN-FD DLC code
+ * @param dlc DLC code (0..15)
+ * @return Data bytes (0..8, 12, 16, 20, 24, 32, 48 or 64)
+ */
+uint8_t comm_can_dlc_to_length(uint8_t dlc);
+
+#endif // COMM_CAN_RX_H
@@ -0,0 +1,121 @@
+/**
+ * @file comm_can_telemetry.c
+ * @brief Periodic CAN-FD telemetry: all motors packed into 64-byte frames
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_can_telemetry.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Set up a publisher
+ */
+SystemError_t comm_can_telemetry_init(CommCanTelemetry_t *telemetry,
+                                      uint32_t rate_hz,
+                                      CommCanTelemetrySource_t source,
+                                      CommCanSend_t send, void *context) {
+    if (telemetry == NULL || source == NULL || send == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    memset(telemetry, 0, sizeof(*telemetry));
+    telemetry->source = source;
+    telemetry->send = send;
+    telemetry->context = context;
+
+    return comm_can_telemetry_set_rate(telemetry, rate_hz);
+}
+
+/**
+ * @brief Change the publication rate
+ */
+SystemError_t comm_can_telemetry_set_rate(CommCanTelemetry_t *telemetry,
+                                          uint32_t rate_hz) {
+    if (telemetry == NULL || rate_hz == 0 ||
+        rate_hz > CAN_TELEMETRY_MAX_RATE_HZ) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    telemetry->period_us = 1000000U / rate_hz;
+    telemetry->started = false; // Next poll publishes and rephases
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Publish if a period has elapsed
+ */
+bool comm_can_telemetry_poll(CommCanTelemetry_t *telemetry, uint32_t now_us) {
+    if (telemetry->started &&
+        (int32_t)(now_us - telemetry->next_us) < 0) {
+        return false;
+    }
+
+    if (!telemetry->started) {
+        telemetry->next_us = now_us;
+        telemetry->started = true;
+    }
+
+    // Keep the schedule on its grid; drop whole periods polled too late
+    uint32_t late = now_us - telemetry->next_us;
+    uint32_t periods = late / telemetry->period_us;
+    telemetry->missed += periods;
+    telemetry->next_us += (periods + 1U) * telemetry->period_us;
+
+    comm_can_telemetry_publish(telemetry, now_us);
+    return true;
+}
+
+/**
+ * @brief Sample every motor and send the frames now
+ */
+SystemError_t comm_can_telemetry_publish(CommCanTelemetry_t *telemetry,
+                                         uint32_t now_us) {
+    uint8_t data[CAN_MAX_MESSAGE_SIZE];
+    CommCanTelemetryFrame_t *frame = (CommCanTelemetryFrame_t *)data;
+    SystemError_t result = SYSTEM_OK;
+    uint8_t motor_id = 0;
+
+    for (uint8_t index = 0; index < COMM_CAN_TELEMETRY_FRAMES; index++) {
+        // Unused bytes and records are zero / INVALID_DEVICE_ID
+        memset(data, 0, sizeof(data));
+        frame->sequence = telemetry->sequence++;
+        frame->frame_index = index;
+        frame->frame_count = (uint8_t)COMM_CAN_TELEMETRY_FRAMES;
+        frame->timestamp_us = now_us;
+
+        for (uint8_t slot = 0; slot < COMM_CAN_TELEMETRY_MOTORS_PER_FRAME;
+             slot++) {
+            CommCanTelemetryMotor_t sample = {0};
+            if (motor_id >= MAX_MOTORS) {
+                sample.motor_id = INVALID_DEVICE_ID;
+            } else {
+                if (telemetry->source(motor_id, &sample) != SYSTEM_OK) {
+                    memset(&sample, 0, sizeof(sample));
+                    sample.status_flags = CAN_TELEMETRY_STATUS_STALE;
+                }
+                sample.motor_id = motor_id++;
+            }
+            frame->motors[slot] = sample;
+        }
+
+        // CAN-FD lengths above 8 come in steps; always send the full 64
+        if (telemetry->send(telemetry->context, CAN_ID_TELEMETRY, data,
+                            CAN_MAX_MESSAGE_SIZE) == SYSTEM_OK) {
+            telemetry->frames_sent++;
+        } else {
+            telemetry->send_errors++;
+            result = ERROR_COMM_BUSY;
+        }
+    }
+
+    telemetry->publications++;
+    return result;
+}
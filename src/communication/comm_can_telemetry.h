@@ -0,0 +1,132 @@
+/**
+ * @file comm_can_telemetry.h
+ * @brief Periodic CAN-FD telemetry: all motors packed into 64-byte frames
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details Each publication samples every motor and packs position,
+ *          velocity, state, status and fault words into CAN-FD frames on
+ *          CAN_ID_TELEMETRY, COMM_CAN_TELEMETRY_MOTORS_PER_FRAME motors per
+ *          frame. Every frame carries a sequence number (per frame, so a
+ *          receiver can count losses) and the sample timestamp. Fields are
+ *          little-endian, as the packed structures below lay them out.
+ *
+ *          One 64-byte frame at 2 Mbit/s data phase takes about 0.2 ms on
+ *          the bus, against four classic 8-byte frames for the same two
+ *          motors' data.
+ */
+
+#ifndef COMM_CAN_TELEMETRY_H
+#define COMM_CAN_TELEMETRY_H
+
+#include "comm_can_bus.h"
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include "config/motor_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COMM_CAN_TELEMETRY_MOTORS_PER_FRAME 3U
+#define COMM_CAN_TELEMETRY_FRAMES                                             \
+    ((MAX_MOTORS + COMM_CAN_TELEMETRY_MOTORS_PER_FRAME - 1U) /                \
+     COMM_CAN_TELEMETRY_MOTORS_PER_FRAME)
+
+// CommCanTelemetryMotor_t status_flags
+#define CAN_TELEMETRY_STATUS_ENABLED 0x0001U ///< Position control enabled
+#define CAN_TELEMETRY_STATUS_HOMED 0x0002U   ///< Homing completed
+#define CAN_TELEMETRY_STATUS_SETTLED 0x0004U ///< At target position
+#define CAN_TELEMETRY_STATUS_STALE 0x8000U   ///< Sample could not be read
+
+/**
+ * @brief One motor's sample
+ */
+typedef struct {
+    int32_t position_steps;         ///< Measured position
+    int32_t velocity_steps_per_sec; ///< Measured velocity
+    uint32_t fault_flags;           ///< Active motor fault bits
+    uint8_t motor_id;               ///< Motor, INVALID_DEVICE_ID if unused
+    uint8_t state;                  ///< MotorState_t
+    uint16_t status_flags;          ///< CAN_TELEMETRY_STATUS_* bits
+} __attribute__((packed)) CommCanTelemetryMotor_t;
+
+/**
+ * @brief Telemetry frame payload
+ */
+typedef struct {
+    uint16_t sequence;     ///< Frame counter, wraps
+    uint8_t frame_index;   ///< Frame within this publication
+    uint8_t frame_count;   ///< Frames per publication
+    uint32_t timestamp_us; ///< Sample time (microsecond tick)
+    CommCanTelemetryMotor_t motors[COMM_CAN_TELEMETRY_MOTORS_PER_FRAME];
+} __attribute__((packed)) CommCanTelemetryFrame_t;
+
+_Static_assert(sizeof(CommCanTelemetryFrame_t) <= CAN_MAX_MESSAGE_SIZE,
+               "telemetry frame must fit one CAN-FD frame");
+
+/**
+ * @brief Read one motor's sample
+ * @return Anything but SYSTEM_OK marks the record stale
+ */
+typedef SystemError_t (*CommCanTelemetrySource_t)(
+    uint8_t motor_id, CommCanTelemetryMotor_t *sample);
+
+/**
+ * @brief Publisher state
+ */
+typedef struct {
+    CommCanTelemetrySource_t source; ///< Motor sampler
+    CommCanSend_t send;              ///< Frame transmit hook
+    void *context;                   ///< Passed to send
+    uint32_t period_us;              ///< Publication period
+    uint32_t next_us;                ///< Next publication due
+    bool started;                    ///< next_us is valid
+    uint16_t sequence;               ///< Next frame sequence number
+    uint32_t publications;           ///< Publications made
+    uint32_t frames_sent;            ///< Frames accepted by the transport
+    uint32_t send_errors;            ///< Frames refused (TX FIFO full)
+    uint32_t missed;                 ///< Periods skipped (polled too late)
+} CommCanTelemetry_t;
+
+/**
+ * @brief Set up a publisher
+ * @param telemetry Publisher state
+ * @param rate_hz Publications per second (1..CAN_TELEMETRY_MAX_RATE_HZ)
+ * @param source Motor sampler
+ * @param send Frame transmit hook
+ * @param context Passed to send
+ * @return ERROR_INVALID_PARAMETER for a bad rate or missing hook
+ */
+SystemError_t comm_can_telemetry_init(CommCanTelemetry_t *telemetry,
+                                      uint32_t rate_hz,
+                                      CommCanTelemetrySource_t source,
+                                      CommCanSend_t send, void *context);
+
+/**
+ * @brief Change the publication rate
+ * @return ERROR_INVALID_PARAMETER for a rate outside
+ *         1..CAN_TELEMETRY_MAX_RATE_HZ
+ */
+SystemError_t comm_can_telemetry_set_rate(CommCanTelemetry_t *telemetry,
+                                          uint32_t rate_hz);
+
+/**
+ * @brief Publish if a period has elapsed
+ * @details Call at least as often as the publication rate. A late call
+ *          publishes once and skips the missed periods rather than
+ *          bursting to catch up.
+ * @param telemetry Publisher state
+ * @param now_us Microsecond tick
+ * @return true if a publication was made
+ */
+bool comm_can_telemetry_poll(CommCanTelemetry_t *telemetry, uint32_t now_us);
+
+/**
+ * @brief Sample every motor and send the frames now
+ * @param telemetry Publisher state
+ * @param now_us Timestamp for the frames
+ * @return ERROR_COMM_BUSY if any frame was refused by the transport
+ */
+SystemError_t comm_can_telemetry_publish(CommCanTelemetry_t *telemetry,
+                                         uint32_t now_us);
+
+#endif // COMM_CAN_TELEMETRY_H
@@ -0,0 +1,254 @@
+/**
+ * @file comm_can_time_sync.c
+ * @brief Distributed clock synchronisation over CAN_ID_TIME_SYNC
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_can_time_sync.h"
+#include <stddef.h>
+#include <string.h>
+
+#define PPB 1000000000LL
+
+// Drift estimate: each new measurement moves it 1/DRIFT_FILTER of the way
+#define DRIFT_FILTER 4
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static void send_message(CommCanTimeSync_t *sync, uint8_t type,
+                         uint32_t master_us);
+static void add_pair(CommCanTimeSync_t *sync, uint32_t local_us,
+                     uint32_t master_us);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Set up the service
+ */
+SystemError_t comm_can_time_sync_init(CommCanTimeSync_t *sync, bool master,
+                                      CommCanSend_t send, void *context) {
+    if (sync == NULL || (master && send == NULL)) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    memset(sync, 0, sizeof(*sync));
+    sync->master = master;
+    sync->send = send;
+    sync->context = context;
+    sync->period_us = CAN_TIME_SYNC_PERIOD_MS * 1000U;
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Periodic service
+ */
+void comm_can_time_sync_poll(CommCanTimeSync_t *sync, uint32_t now_us) {
+    if (!sync->master) {
+        if (sync->samples != 0 && now_us - sync->ref_local_us >
+                                      CAN_TIME_SYNC_TIMEOUT_MS * 1000U) {
+            sync->samples = 0;
+            sync->sync_seen = false;
+        }
+        return;
+    }
+
+    // sent() runs in the transmit complete ISR
+    if (__atomic_load_n(&sync->follow_up_pending, __ATOMIC_ACQUIRE)) {
+        send_message(sync, CAN_TIME_SYNC_MSG_FOLLOW_UP, sync->sync_tx_us);
+        sync->follow_up_pending = false;
+    }
+
+    if (sync->started && (int32_t)(now_us - sync->next_us) < 0) {
+        return;
+    }
+    if (!sync->started) {
+        sync->next_us = now_us;
+        sync->started = true;
+    }
+    sync->next_us += sync->period_us;
+    if ((int32_t)(now_us - sync->next_us) >= 0) {
+        sync->next_us = now_us + sync->period_us; // Polled late: rephase
+    }
+
+    // An untimed SYNC is abandoned; its FOLLOW_UP is never sent
+    sync->sequence++;
+    sync->awaiting_sent = true;
+    send_message(sync, CAN_TIME_SYNC_MSG_SYNC, 0U);
+    sync->syncs++;
+}
+
+/**
+ * @brief Master: the last SYNC frame left the controller
+ */
+void comm_can_time_sync_sent(CommCanTimeSync_t *sync, uint32_t tx_us) {
+    if (!sync->awaiting_sent) {
+        return;
+    }
+
+    sync->awaiting_sent = false;
+    sync->sync_tx_us = tx_us;
+    __atomic_store_n(&sync->follow_up_pending, true, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Slave: handle a CAN_ID_TIME_SYNC frame
+ */
+SystemError_t comm_can_time_sync_receive(CommCanTimeSync_t *sync,
+                                         const CommCanFrame_t *frame) {
+    CommCanTimeSyncMsg_t msg;
+
+    if (frame->length < sizeof(msg)) {
+        sync->discarded++;
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    memcpy(&msg, frame->data, sizeof(msg));
+
+    if (sync->master || msg.master_node != CAN_TIME_SYNC_MASTER_NODE) {
+        sync->discarded++;
+        return SYSTEM_OK;
+    }
+
+    switch (msg.type) {
+    case CAN_TIME_SYNC_MSG_SYNC:
+        sync->sequence = msg.sequence;
+        sync->sync_rx_us = frame->timestamp_us;
+        sync->sync_seen = true;
+        return SYSTEM_OK;
+
+    case CAN_TIME_SYNC_MSG_FOLLOW_UP:
+        // Only the FOLLOW_UP of the SYNC we timed forms a pair
+        if (!sync->sync_seen || msg.sequence != sync->sequence) {
+            sync->discarded++;
+            return SYSTEM_OK;
+        }
+        sync->sync_seen = false;
+        add_pair(sync, sync->sync_rx_us, msg.master_us);
+        return SYSTEM_OK;
+
+    default:
+        sync->discarded++;
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+}
+
+/**
+ * @brief Synchronised time at a local tick
+ */
+bool comm_can_time_sync_get_time(const CommCanTimeSync_t *sync,
+                                 uint32_t local_us, uint32_t *sync_us) {
+    if (sync->master) {
+        *sync_us = local_us;
+        return true;
+    }
+    if (sync->samples < 2) {
+        return false;
+    }
+
+    int32_t elapsed = (int32_t)(local_us - sync->ref_local_us);
+    *sync_us = sync->ref_sync_us + (uint32_t)elapsed +
+               (uint32_t)(int32_t)((int64_t)elapsed * sync->drift_ppb / PPB);
+    return true;
+}
+
+/**
+ * @brief Local tick at which the synchronised timebase reaches a time
+ */
+bool comm_can_time_sync_to_local(const CommCanTimeSync_t *sync,
+                                 uint32_t sync_us, uint32_t *local_us) {
+    if (sync->master) {
+        *local_us = sync_us;
+        return true;
+    }
+    if (sync->samples < 2) {
+        return false;
+    }
+
+    // First order inverse of get_time; the error is elapsed * drift^2
+    int32_t elapsed = (int32_t)(sync_us - sync->ref_sync_us);
+    *local_us = sync->ref_local_us + (uint32_t)elapsed -
+                (uint32_t)(int32_t)((int64_t)elapsed * sync->drift_ppb / PPB);
+    return true;
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Queue one time sync frame on CAN_ID_TIME_SYNC
+ */
+static void send_message(CommCanTimeSync_t *sync, uint8_t type,
+                         uint32_t master_us) {
+    CommCanTimeSyncMsg_t msg = {.type = type,
+                                .master_node = CAN_NODE_ID,
+                                .sequence = sync->sequence,
+                                .master_us = master_us};
+
+    if (sync->send(sync->context, CAN_ID_TIME_SYNC, (const uint8_t *)&msg,
+                   sizeof(msg)) != SYSTEM_OK) {
+        sync->send_errors++;
+    }
+}
+
+/**
+ * @brief Update drift and offset from one (local, master) time pair
+ */
+static void add_pair(CommCanTimeSync_t *sync, uint32_t local_us,
+                     uint32_t master_us) {
+    sync->syncs++;
+
+    if (sync->samples == 0) {
+        sync->ref_local_us = local_us;
+        sync->ref_sync_us = master_us;
+        sync->offset_us = 0;
+        sync->samples = 1;
+        sync->steps++;
+        return;
+    }
+
+    // Rate over the interval since the reference, against the estimate
+    int32_t local_elapsed = (int32_t)(local_us - sync->ref_local_us);
+    uint32_t predicted =
+        sync->ref_sync_us + (uint32_t)local_elapsed +
+        (uint32_t)(int32_t)((int64_t)local_elapsed * sync->drift_ppb / PPB);
+    int32_t offset = (int32_t)(master_us - predicted);
+    sync->offset_us = offset;
+
+    if (offset > CAN_TIME_SYNC_STEP_US || offset < -CAN_TIME_SYNC_STEP_US ||
+        local_elapsed <= 0) {
+        // Master restarted or a sync was badly timed: start over
+        sync->ref_local_us = local_us;
+        sync->ref_sync_us = master_us;
+        sync->drift_ppb = 0;
+        sync->samples = 1;
+        sync->steps++;
+        return;
+    }
+
+    // The reference is re-anchored on the master time every pair, so the
+    // whole offset accrued over local_elapsed: it is the rate error left
+    // in the drift estimate
+    int32_t rate_error = (int32_t)((int64_t)offset * PPB / local_elapsed);
+    if (sync->samples == 1) {
+        sync->drift_ppb += rate_error;
+    } else {
+        sync->drift_ppb += rate_error / DRIFT_FILTER;
+    }
+
+    sync->ref_local_us = local_us;
+    sync->ref_sync_us = master_us;
+    if (sync->samples < 2) {
+        sync->samples++;
+    }
+}
@@ -0,0 +1,138 @@
+/**
+ * @file comm_can_time_sync.h
+ * @brief Distributed clock synchronisation over CAN_ID_TIME_SYNC
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details Two-step sync, as in IEEE 1588: every CAN_TIME_SYNC_PERIOD_MS
+ *          the master (CAN_TIME_SYNC_MASTER_NODE) broadcasts a SYNC frame,
+ *          takes its own microsecond tick when the frame has left the
+ *          controller (comm_can_time_sync_sent), then broadcasts that tick
+ *          in a FOLLOW_UP with the same sequence number. Each slave pairs
+ *          the FOLLOW_UP time with the tick at which it received the SYNC.
+ *
+ *          Successive pairs give the slave clock's drift against the
+ *          master (filtered, in parts per billion) and its offset. The
+ *          synchronised timebase is the master's microsecond tick,
+ *          extrapolated from the last pair using the drift, so between
+ *          syncs it only wanders by the residual drift (a few
+ *          microseconds). An offset above CAN_TIME_SYNC_STEP_US (master
+ *          restart, lost frames) restarts the estimate.
+ *
+ *          Both timestamps are taken at end-of-frame interrupts, so the
+ *          bus propagation delay (well under a microsecond on a 40 m bus)
+ *          is ignored. The master's timebase is simply its own tick.
+ */
+
+#ifndef COMM_CAN_TIME_SYNC_H
+#define COMM_CAN_TIME_SYNC_H
+
+#include "comm_can_bus.h"
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// CommCanTimeSyncMsg_t type
+#define CAN_TIME_SYNC_MSG_SYNC 0x01U      ///< Take your receive time now
+#define CAN_TIME_SYNC_MSG_FOLLOW_UP 0x02U ///< Master time of that SYNC
+
+/**
+ * @brief CAN_ID_TIME_SYNC frame payload (classic 8-byte frame)
+ */
+typedef struct {
+    uint8_t type;        ///< CAN_TIME_SYNC_MSG_*
+    uint8_t master_node; ///< Sending node
+    uint16_t sequence;   ///< SYNC number, repeated in its FOLLOW_UP
+    uint32_t master_us;  ///< FOLLOW_UP: master tick at SYNC transmission
+} __attribute__((packed)) CommCanTimeSyncMsg_t;
+
+_Static_assert(sizeof(CommCanTimeSyncMsg_t) == 8,
+               "time sync message must fit a classic CAN frame");
+
+/**
+ * @brief Time sync service state (master or slave)
+ */
+typedef struct {
+    bool master;            ///< This node broadcasts the timebase
+    CommCanSend_t send;     ///< Frame transmit hook
+    void *context;          ///< Passed to send
+    uint32_t period_us;     ///< SYNC period (master)
+    uint32_t next_us;       ///< Next SYNC due (master)
+    bool started;           ///< next_us is valid (master)
+    uint16_t sequence;      ///< Last SYNC sent or received
+    bool awaiting_sent;     ///< SYNC queued, transmission time unknown
+    bool follow_up_pending; ///< SYNC sent, FOLLOW_UP not yet queued
+    uint32_t sync_tx_us;    ///< Master tick at SYNC transmission
+    bool sync_seen;         ///< SYNC received, waiting for FOLLOW_UP
+    uint32_t sync_rx_us;    ///< Local tick at SYNC reception (slave)
+    uint8_t samples;        ///< Pairs since the last step (slave)
+    uint32_t ref_local_us;  ///< Local tick of the reference point
+    uint32_t ref_sync_us;   ///< Synchronised time at the reference point
+    int32_t drift_ppb;      ///< Filtered master/local rate error
+    int32_t offset_us;      ///< Last measured offset (master - estimate)
+    uint32_t syncs;         ///< SYNC frames sent (master) or paired (slave)
+    uint32_t steps;         ///< Timebase steps (first sync, large offsets)
+    uint32_t discarded;     ///< Frames ignored (unmatched, malformed)
+    uint32_t send_errors;   ///< Frames refused by the transport
+} CommCanTimeSync_t;
+
+/**
+ * @brief Set up the service
+ * @param sync Service state
+ * @param master true on the node that broadcasts the timebase
+ * @param send Frame transmit hook (used by the master only)
+ * @param context Passed to send
+ * @return ERROR_INVALID_PARAMETER if a master has no transmit hook
+ */
+SystemError_t comm_can_time_sync_init(CommCanTimeSync_t *sync, bool master,
+                                      CommCanSend_t send, void *context);
+
+/**
+ * @brief Periodic service
+ * @details Master: broadcast SYNC when due, FOLLOW_UP once it is timed.
+ *          Slave: drop the lock after CAN_TIME_SYNC_TIMEOUT_MS unsynced.
+ * @param sync Service state
+ * @param now_us Local microsecond tick
+ */
+void comm_can_time_sync_poll(CommCanTimeSync_t *sync, uint32_t now_us);
+
+/**
+ * @brief Master: the last SYNC frame left the controller
+ * @param sync Service state
+ * @param tx_us Local tick at the transmit complete interrupt
+ */
+void comm_can_time_sync_sent(CommCanTimeSync_t *sync, uint32_t tx_us);
+
+/**
+ * @brief Slave: handle a CAN_ID_TIME_SYNC frame
+ * @param sync Service state
+ * @param frame Frame, timestamp_us taken when it was received
+ * @return ERROR_COMM_INVALID_MESSAGE for a malformed frame
+ */
+SystemError_t comm_can_time_sync_receive(CommCanTimeSync_t *sync,
+                                         const CommCanFrame_t *frame);
+
+/**
+ * @brief Synchronised time at a local tick
+ * @param sync Service state
+ * @param local_us Local microsecond tick (normally now)
+ * @param sync_us Synchronised time
+ * @return false while not locked: fewer than two pairs since the last
+ *         step or the timeout
+ */
+bool comm_can_time_sync_get_time(const CommCanTimeSync_t *sync,
+                                 uint32_t local_us, uint32_t *sync_us);
+
+/**
+ * @brief Local tick at which the synchronised timebase reaches a time
+ * @details Used to schedule an action for a synchronised start time.
+ * @param sync Service state
+ * @param sync_us Synchronised time
+ * @param local_us Local microsecond tick
+ * @return false while not locked
+ */
+bool comm_can_time_sync_to_local(const CommCanTimeSync_t *sync,
+                                 uint32_t sync_us, uint32_t *local_us);
+
+#endif // COMM_CAN_TIME_SYNC_H
@@ -0,0 +1,200 @@
+/**
+ * @file comm_frame_decoder.c
+ * @brief Incremental decoder for length-prefixed binary protocol frames
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_frame_decoder.h"
+#include "crc16.h"
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static uint16_t read_u16(const CommRxRing_t *ring, uint32_t position);
+static void restart(CommFrameDecoder_t *decoder, uint32_t start);
+static void drop(CommFrameDecoder_t *decoder, CommRxRing_t *ring,
+                 uint32_t count);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Reset a decoder
+ */
+SystemError_t comm_frame_decoder_init(CommFrameDecoder_t *decoder,
+                                      uint32_t magic, uint16_t max_payload,
+                                      const CommRxRing_t *ring) {
+    if (decoder == NULL || ring == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    memset(decoder, 0, sizeof(*decoder));
+    decoder->magic = magic;
+    decoder->max_payload = max_payload;
+    restart(decoder, ring->tail);
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Decode the next complete frame from the ring
+ */
+bool comm_frame_decoder_poll(CommFrameDecoder_t *decoder, CommRxRing_t *ring,
+                             uint8_t *scratch, CommFrame_t *frame) {
+    const uint32_t mask = ring->size - 1U;
+
+    // The previous frame has been processed: hand its bytes back
+    if (decoder->held != 0) {
+        comm_rx_ring_consume(ring, decoder->held);
+        decoder->held = 0;
+        restart(decoder, ring->tail);
+    }
+
+    uint32_t pending = comm_rx_ring_available(ring);
+    if (ring->tail != decoder->start) {
+        // The ring dropped data (overrun or DMA restart): start over
+        restart(decoder, ring->tail);
+    }
+
+    for (;;) {
+        uint32_t offset = decoder->offset;
+
+        if (offset < COMM_FRAME_HEADER_SIZE) {
+            if (offset >= pending) {
+                return false;
+            }
+
+            uint8_t byte = ring->buffer[(decoder->start + offset) & mask];
+            if (offset < COMM_FRAME_MAGIC_SIZE &&
+                byte != (uint8_t)(decoder->magic >> (8U * offset))) {
+                // Not a frame start; skip runs of non-magic bytes at once
+                uint32_t skip = 1U;
+                if (offset == 0) {
+                    while (skip < pending &&
+                           ring->buffer[(decoder->start + skip) & mask] !=
+                               (uint8_t)decoder->magic) {
+                        skip++;
+                    }
+                }
+                decoder->skipped += skip;
+                drop(decoder, ring, skip);
+                pending -= skip;
+                continue;
+            }
+
+            // The checksum and timestamp fields are not covered
+            if (offset < COMM_FRAME_CHECKSUM_OFFSET) {
+                decoder->crc = crc16_update_sw(decoder->crc, &byte, 1U);
+            }
+            decoder->offset = ++offset;
+
+            if (offset == COMM_FRAME_HEADER_SIZE) {
+                decoder->payload_length =
+                    read_u16(ring, decoder->start + COMM_FRAME_LENGTH_OFFSET);
+                if (decoder->payload_length > decoder->max_payload) {
+                    decoder->length_errors++;
+                    drop(decoder, ring, 1U);
+                    pending--;
+                }
+            }
+            continue;
+        }
+
+        // Payload: checksum whatever has arrived in contiguous spans
+        uint32_t size = COMM_FRAME_HEADER_SIZE + decoder->payload_length;
+        uint32_t end = (pending < size) ? pending : size;
+        while (offset < end) {
+            uint32_t index = (decoder->start + offset) & mask;
+            uint32_t span = end - offset;
+            if (span > ring->size - index) {
+                span = ring->size - index;
+            }
+            decoder->crc =
+                crc16_update(decoder->crc, &ring->buffer[index], span);
+            offset += span;
+        }
+        decoder->offset = offset;
+        if (offset < size) {
+            return false;
+        }
+
+        if (crc16_final(decoder->crc) !=
+            read_u16(ring, decoder->start + COMM_FRAME_CHECKSUM_OFFSET)) {
+            decoder->crc_errors++;
+            drop(decoder, ring, 1U);
+            pending--;
+            continue;
+        }
+
+        uint32_t index = decoder->start & mask;
+        if (index + size <= ring->size) {
+            frame->data = &ring->buffer[index];
+        } else {
+            // Straddles the buffer end: the only case that is copied
+            uint32_t first = ring->size - index;
+            memcpy(scratch, &ring->buffer[index], first);
+            memcpy(scratch + first, ring->buffer, size - first);
+            frame->data = scratch;
+        }
+        frame->payload_length = decoder->payload_length;
+
+        decoder->held = size;
+        decoder->frames++;
+        return true;
+    }
+}
+
+/**
+ * @brief CRC16 of a frame, as carried in its header checksum field
+ */
+uint16_t comm_frame_checksum(const uint8_t *header, const uint8_t *payload,
+                             uint16_t payload_length) {
+    uint16_t crc = crc16_init();
+
+    crc = crc16_update(crc, header, COMM_FRAME_CHECKSUM_OFFSET);
+    crc = crc16_update(crc, payload, payload_length);
+
+    return crc16_final(crc);
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Little-endian 16-bit field at a ring byte count
+ */
+static uint16_t read_u16(const CommRxRing_t *ring, uint32_t position) {
+    const uint32_t mask = ring->size - 1U;
+    return (uint16_t)(ring->buffer[position & mask] |
+                      (ring->buffer[(position + 1U) & mask] << 8));
+}
+
+/**
+ * @brief Begin searching for a frame at a ring byte count
+ */
+static void restart(CommFrameDecoder_t *decoder, uint32_t start) {
+    decoder->start = start;
+    decoder->offset = 0;
+    decoder->payload_length = 0;
+    decoder->crc = crc16_init();
+}
+
+/**
+ * @brief Drop bytes at the frame start and search again after them
+ */
+static void drop(CommFrameDecoder_t *decoder, CommRxRing_t *ring,
+                 uint32_t count) {
+    comm_rx_ring_consume(ring, count);
+    restart(decoder, ring->tail);
+}
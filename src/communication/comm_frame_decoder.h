@@ -0,0 +1,104 @@
+/**
+ * @file comm_frame_decoder.h
+ * @brief Incremental decoder for length-prefixed binary protocol frames
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details A binary frame is a packed MessageHeader_t followed by
+ *          payload_length payload bytes; the header carries the framing
+ *          (magic and length), so no byte stuffing is needed. The decoder
+ *          reads frames straight out of a CommRxRing_t and keeps its place
+ *          between calls, so a frame may arrive over any number of DMA
+ *          events without its bytes being scanned again:
+ *
+ *          - magic: bytes must match MESSAGE_HEADER_MAGIC, otherwise they
+ *            are dropped until a candidate start is found
+ *          - header: the length is checked once the header is complete
+ *          - payload: counted until the frame is complete
+ *
+ *          The CRC16 is updated as bytes are examined. On a bad length or
+ *          checksum a single byte is dropped and the search resumes, so a
+ *          corrupt frame costs no valid frame that follows it.
+ *
+ *          A validated frame is handed out in place in the ring and is only
+ *          copied when it straddles the end of the buffer.
+ */
+
+#ifndef COMM_FRAME_DECODER_H
+#define COMM_FRAME_DECODER_H
+
+#include "comm_rx_ring.h"
+#include "common/error_codes.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Wire layout of MessageHeader_t (little-endian, packed); comm_protocol.c
+// checks these against the struct
+#define COMM_FRAME_MAGIC_SIZE 4U
+#define COMM_FRAME_LENGTH_OFFSET 6U
+#define COMM_FRAME_CHECKSUM_OFFSET 10U
+#define COMM_FRAME_HEADER_SIZE 16U
+
+/**
+ * @brief Decoder state, resumable across calls
+ */
+typedef struct {
+    uint32_t magic;          ///< Expected frame magic
+    uint16_t max_payload;    ///< Longest accepted payload (bytes)
+    uint16_t payload_length; ///< Payload length of the current frame
+    uint32_t start;          ///< Ring byte count at the frame start
+    uint32_t offset;         ///< Frame bytes examined so far
+    uint16_t crc;            ///< CRC16 of the examined bytes
+    uint32_t held;           ///< Bytes of the frame handed out last
+    uint32_t frames;         ///< Frames delivered
+    uint32_t crc_errors;     ///< Frames rejected by checksum
+    uint32_t length_errors;  ///< Headers rejected by length
+    uint32_t skipped;        ///< Bytes dropped while searching for magic
+} CommFrameDecoder_t;
+
+/**
+ * @brief A validated frame
+ */
+typedef struct {
+    const uint8_t *data;     ///< Header followed by the payload
+    uint16_t payload_length; ///< Payload size (bytes)
+} CommFrame_t;
+
+/**
+ * @brief Reset a decoder
+ * @param decoder Decoder state
+ * @param magic Frame magic (MESSAGE_HEADER_MAGIC)
+ * @param max_payload Longest accepted payload (bytes)
+ * @param ring Ring the decoder reads from
+ * @return ERROR_INVALID_PARAMETER for a NULL decoder or ring
+ */
+SystemError_t comm_frame_decoder_init(CommFrameDecoder_t *decoder,
+                                      uint32_t magic, uint16_t max_payload,
+                                      const CommRxRing_t *ring);
+
+/**
+ * @brief Decode the next complete frame from the ring
+ * @param decoder Decoder state
+ * @param ring Ring holding the received bytes
+ * @param scratch Buffer for a frame that wraps the ring end
+ *        (COMM_FRAME_HEADER_SIZE + max_payload bytes)
+ * @param frame Output: validated frame, valid until the next call; its
+ *        bytes stay reserved in the ring until then
+ * @return true if a frame was decoded, false if none is complete yet
+ * @note Never waits: only the bytes already received are examined.
+ */
+bool comm_frame_decoder_poll(CommFrameDecoder_t *decoder, CommRxRing_t *ring,
+                             uint8_t *scratch, CommFrame_t *frame);
+
+/**
+ * @brief CRC16 of a frame, as carried in its header checksum field
+ * @details Covers the header up to the checksum field and the payload;
+ *          for building frames to send.
+ * @param header Frame header (COMM_FRAME_HEADER_SIZE bytes)
+ * @param payload Payload bytes
+ * @param payload_length Payload size (bytes)
+ */
+uint16_t comm_frame_checksum(const uint8_t *header, const uint8_t *payload,
+                             uint16_t payload_length);
+
+#endif // COMM_FRAME_DECODER_H
@@ -14,9 +14,22 @@
  */
 
 #include "comm_protocol.h"
+#include "comm_ascii.h"
+#include "comm_can_rx.h"
+#include "comm_can_telemetry.h"
+#include "comm_can_time_sync.h"
+#include "comm_frame_decoder.h"
+#include "comm_rx_ring.h"
+#include "comm_tx_queue.h"
 #include "config/comm_config.h"
 #include "config/motor_config.h"
+#include "controllers/motion_lookahead.h"
+#include "controllers/motion_profile.h"
+#include "controllers/motion_pvt.h"
 #include "controllers/motor_controller.h"
+#include "controllers/multi_motor_coordinator.h"
+#include "controllers/position_control.h"
+#include "controllers/position_safety.h"
 #include "hal_abstraction/hal_abstraction.h"
 #include "safety/fault_monitor.h"
 #include <stdio.h>
@@ -73,22 +86,72 @@ static CommChannelConfig_t comm_channels[7] = {
 // place exact MX file references in `docs/README-peripherals.md`.
 static UART_HandleTypeDef *debug_uart_handle = NULL;
 static uint8_t uart_rx_buffer[UART_RX_BUFFER_SIZE] = {0};
-static uint8_t uart_tx_buffer[UART_TX_BUFFER_SIZE] = {0};
-static volatile bool uart_rx_complete = false;
-static volatile bool uart_tx_complete = true;
-static uint32_t uart_rx_length = 0;
+
+// The RX DMA runs circular over uart_rx_buffer; commands are parsed in
+// place from the ring
+static CommRxRing_t uart_rx_ring;
+_Static_assert((UART_RX_BUFFER_SIZE & (UART_RX_BUFFER_SIZE - 1)) == 0,
+               "UART_RX_BUFFER_SIZE must be a power of two");
+
+// Transmit messages queue per priority lane; each DMA completion starts
+// the next queued message
+static CommTxQueue_t uart_tx_queue;
+
+// The UART carries either ASCII lines or binary frames (comm_uart_init)
+static CommProtocol_t uart_rx_protocol = PROTOCOL_UART_ASCII;
+static CommFrameDecoder_t uart_frame_decoder;
+static uint8_t
+    uart_frame_buffer[COMM_FRAME_HEADER_SIZE + MAX_MESSAGE_PAYLOAD] = {0};
+_Static_assert(sizeof(MessageHeader_t) == COMM_FRAME_HEADER_SIZE &&
+                   offsetof(MessageHeader_t, payload_length) ==
+                       COMM_FRAME_LENGTH_OFFSET &&
+                   offsetof(MessageHeader_t, checksum) ==
+                       COMM_FRAME_CHECKSUM_OFFSET,
+               "frame decoder layout must match MessageHeader_t");
 
 // CAN communication state
 static FDCAN_HandleTypeDef *fdcan_handle = NULL;
 static FDCAN_TxHeaderTypeDef fdcan_tx_header = {0};
-static FDCAN_RxHeaderTypeDef __attribute__((unused)) fdcan_rx_header = {0};
-static uint8_t __attribute__((unused)) fdcan_tx_data[8] = {0};
-static uint8_t __attribute__((unused)) fdcan_rx_data[8] = {0};
 static uint32_t __attribute__((unused)) fdcan_tx_mailbox = 0;
 
-// Message processing
+// Frames accepted by the FDCAN filters, queued per route by the RX ISR
+static CommCanRx_t can_rx;
+
+// Packed CAN-FD telemetry, published from comm_protocol_task
+static CommCanTelemetry_t can_telemetry;
+
+// Distributed timebase; the TX buffer of the last SYNC is watched for its
+// transmit complete interrupt
+static CommCanTimeSync_t can_time_sync;
+static volatile uint32_t time_sync_tx_buffer = 0;
+
+// Message processing: only a command straddling the ring end is copied
 static char ascii_command_buffer[ASCII_COMMAND_MAX_LENGTH] = {0};
-static uint32_t ascii_command_length = 0;
+
+// MOTOR_CMD_BATCH handoff: staged by the comm task, applied by the control
+// task within one tick, then reported by the comm task. Whoever moves a
+// pending batch to APPLYING (the control task, or a stop cancelling it)
+// owns it until APPLIED.
+typedef enum {
+    BATCH_IDLE,
+    BATCH_PENDING,
+    BATCH_APPLYING,
+    BATCH_APPLIED
+} BatchState_t;
+static MotorCommand_t batch_commands[COMM_BATCH_MAX_COMMANDS];
+static uint8_t batch_count = 0;
+static SystemError_t batch_result = SYSTEM_OK;
+static uint8_t batch_state = BATCH_IDLE;
+static bool batch_scheduled = false; // Wait for batch_start_us
+static uint32_t batch_start_us = 0;  // Local tick of a synchronised start
+static uint16_t batch_message_id = 0; // Frame the batch arrived in
+static uint8_t batch_protocol = PROTOCOL_UART_BINARY; // Where to report it
+
+// Per-axis ramps for moves that carry none (SSOT)
+static const uint32_t default_acceleration[MAX_MOTORS] = {
+    MOTOR1_ACCELERATION, MOTOR2_ACCELERATION};
+static const uint32_t default_deceleration[MAX_MOTORS] = {
+    MOTOR1_DECELERATION, MOTOR2_DECELERATION};
 
 /* ==========================================================================
  */
@@ -97,11 +160,84 @@ static uint32_t ascii_command_length = 0;
  */
 
 static SystemError_t process_motor_command(const MotorCommand_t *command);
+static SystemError_t execute_motor_command(const MotorCommand_t *command);
 static SystemError_t validate_motor_command(const MotorCommand_t *command);
+static SystemError_t ascii_motor_command(const CommAsciiVerb_t *verb,
+                                         const CommAsciiArgs_t *args);
+static SystemError_t ascii_queue_command(const CommAsciiVerb_t *verb,
+                                         const CommAsciiArgs_t *args);
+static void build_ascii_motor_command(const CommAsciiVerb_t *verb,
+                                      const CommAsciiArgs_t *args,
+                                      MotorCommand_t *command);
+static SystemError_t process_pvt_batch(uint16_t message_id,
+                                       const MotorCommand_t *command,
+                                       const uint8_t *points,
+                                       uint16_t points_length);
+static SystemError_t process_command_batch(uint16_t message_id,
+                                           uint8_t protocol,
+                                           const MotorCommand_t *command,
+                                           const uint8_t *entries,
+                                           uint16_t entries_length);
+static SystemError_t validate_batch_entry(const MotorCommand_t *command,
+                                          uint8_t *motors_seen);
+static SystemError_t apply_batch_entry(const MotorCommand_t *command);
+static void send_batch_ack(uint16_t message_id, uint8_t protocol,
+                           uint8_t count, SystemError_t result);
+static void report_batch_result(void);
 static uint16_t calculate_message_checksum(const MessageHeader_t *header,
                                            const uint8_t *payload);
-static SystemError_t send_uart_message(const uint8_t *data, uint32_t length);
+static SystemError_t dispatch_message(const MessageHeader_t *header,
+                                      const uint8_t *payload);
+static SystemError_t process_binary_frame(const CommFrame_t *frame);
+static SystemError_t send_uart_message(uint8_t priority, const uint8_t *data,
+                                       uint32_t length);
+static void send_ascii_response(SystemError_t result, const char *response);
+static void send_binary_ack(uint16_t message_id, const CommAck_t *ack);
+static SystemError_t uart_tx_start(void *context, const uint8_t *data,
+                                   uint16_t length);
 static SystemError_t process_uart_received_data(void);
+static SystemError_t fdcan_send(void *context, uint32_t id,
+                                const uint8_t *data, uint8_t length);
+static SystemError_t fdcan_send_time_sync(void *context, uint32_t id,
+                                          const uint8_t *data,
+                                          uint8_t length);
+static SystemError_t sample_motor_telemetry(uint8_t motor_id,
+                                            CommCanTelemetryMotor_t *sample);
+static SystemError_t configure_can_filters(FDCAN_HandleTypeDef *hfdcan);
+static SystemError_t can_move_command(const CommCanFrame_t *frame);
+static SystemError_t can_stop_command(const CommCanFrame_t *frame);
+static SystemError_t can_time_sync_frame(const CommCanFrame_t *frame);
+
+// ASCII verbs, indexed by their perfect-hash slot (see comm_ascii.h)
+static const CommAsciiVerb_t ascii_verbs[COMM_ASCII_VERB_SLOTS] = {
+    [COMM_ASCII_VERB_SLOT('M', 'E', 4)] = {"MOVE", "mii",
+                                           MOTOR_CMD_MOVE_ABSOLUTE,
+                                           ascii_motor_command},
+    [COMM_ASCII_VERB_SLOT('S', 'P', 4)] = {"STOP", "m", MOTOR_CMD_STOP,
+                                           ascii_motor_command},
+    [COMM_ASCII_VERB_SLOT('E', 'P', 5)] = {"ESTOP", "m",
+                                           MOTOR_CMD_EMERGENCY_STOP,
+                                           ascii_motor_command},
+    [COMM_ASCII_VERB_SLOT('H', 'E', 4)] = {"HOME", "m", MOTOR_CMD_HOME,
+                                           ascii_motor_command},
+    [COMM_ASCII_VERB_SLOT('S', 'S', 6)] = {"STATUS", "m",
+                                           MOTOR_CMD_GET_STATUS,
+                                           ascii_motor_command},
+    [COMM_ASCII_VERB_SLOT('Q', 'E', 5)] = {"QUEUE", "i*", 0,
+                                           ascii_queue_command},
+};
+
+// CAN receive routes from the comm_config.h ID map; route i is FDCAN
+// filter element i (see comm_can_rx.h). Anything else is rejected in
+// hardware.
+static const CommCanRoute_t can_routes[] = {
+    {CAN_ID_MOVE_COMMAND, CAN_ID_MOVE_COMMAND, can_move_command},
+    {CAN_ID_STOP_COMMAND, CAN_ID_STOP_COMMAND, can_stop_command},
+    {CAN_ID_TIME_SYNC, CAN_ID_TIME_SYNC, can_time_sync_frame},
+};
+_Static_assert(sizeof(can_routes) / sizeof(can_routes[0]) <=
+                   CAN_FILTER_COUNT,
+               "CAN routes exceed CAN_FILTER_COUNT filter elements");
 
 /* ==========================================================================
  */
@@ -120,6 +256,11 @@ SystemError_t comm_protocol_init(void) {
     // SAFETY-CRITICAL: Check safety system before communication init
     COMM_SAFETY_CHECK();
 
+    // A verb in the wrong slot would silently never match
+    if (comm_ascii_check_table(ascii_verbs) != SYSTEM_OK) {
+        return ERROR_INVALID_STATE;
+    }
+
     // Initialize communication channel configurations
     for (int i = 0; i < 7; i++) {
         comm_channels[i].protocol = (CommProtocol_t)i;
@@ -134,14 +275,15 @@ SystemError_t comm_protocol_init(void) {
 
     // Initialize UART buffers
     memset(uart_rx_buffer, 0, sizeof(uart_rx_buffer));
-    memset(uart_tx_buffer, 0, sizeof(uart_tx_buffer));
-    uart_rx_complete = false;
-    uart_tx_complete = true;
-    uart_rx_length = 0;
+    comm_tx_queue_init(&uart_tx_queue, uart_tx_start, NULL);
+    comm_rx_ring_init(&uart_rx_ring, uart_rx_buffer, UART_RX_BUFFER_SIZE);
 
-    // Initialize ASCII command processing
+    // Initialize ASCII command and binary frame processing
     memset(ascii_command_buffer, 0, sizeof(ascii_command_buffer));
-    ascii_command_length = 0;
+    uart_rx_protocol = PROTOCOL_UART_ASCII;
+    batch_state = BATCH_IDLE;
+    comm_frame_decoder_init(&uart_frame_decoder, MESSAGE_HEADER_MAGIC,
+                            MAX_MESSAGE_PAYLOAD, &uart_rx_ring);
 
     comm_protocol_initialized = true;
 
@@ -177,9 +319,28 @@ SystemError_t comm_uart_init(UART_HandleTypeDef *huart,
     channel->timeout_ms = UART_TIMEOUT_MS;
     channel->last_activity = HAL_Abstraction_GetTick();
 
-    // Start UART DMA reception
-    if (HAL_UART_Receive_DMA(huart, uart_rx_buffer, UART_RX_BUFFER_SIZE) !=
-        HAL_OK) {
+    // Start circular DMA reception; idle-line, half and full transfer
+    // events all report the DMA position (comm_uart_rx_event_callback)
+    comm_rx_ring_init(&uart_rx_ring, uart_rx_buffer, UART_RX_BUFFER_SIZE);
+    comm_frame_decoder_init(&uart_frame_decoder, MESSAGE_HEADER_MAGIC,
+                            MAX_MESSAGE_PAYLOAD, &uart_rx_ring);
+    uart_rx_protocol = protocol;
+
+    // The ring only works over a circular stream; do not rely on the MX
+    // configuration for it
+    if (huart->hdmarx == NULL) {
+        return ERROR_COMM_DMA_FAILED;
+    }
+    if (huart->hdmarx->Init.Mode != DMA_CIRCULAR) {
+        huart->hdmarx->Init.Mode = DMA_CIRCULAR;
+        if (HAL_DMA_Init(huart->hdmarx) != HAL_OK) {
+            fault_monitor_record_system_fault(SYSTEM_FAULT_UART_FAULT,
+                                              FAULT_SEVERITY_ERROR, 0);
+            return ERROR_COMM_DMA_FAILED;
+        }
+    }
+    if (HAL_UARTEx_ReceiveToIdle_DMA(huart, uart_rx_buffer,
+                                     UART_RX_BUFFER_SIZE) != HAL_OK) {
         fault_monitor_record_system_fault(SYSTEM_FAULT_UART_FAULT,
                                           FAULT_SEVERITY_ERROR, 0);
         return ERROR_COMM_DMA_FAILED;
@@ -250,6 +411,14 @@ SystemError_t comm_can_init(FDCAN_HandleTypeDef *hfdcan) {
     channel->timeout_ms = CAN_TIMEOUT_MS;
     channel->last_activity = HAL_Abstraction_GetTick();
 
+    // Filters can only be written before the FDCAN is started
+    SystemError_t result = configure_can_filters(hfdcan);
+    if (result != SYSTEM_OK) {
+        fault_monitor_record_system_fault(SYSTEM_FAULT_CAN_FAULT,
+                                          FAULT_SEVERITY_CRITICAL, 2);
+        return result;
+    }
+
     // Start FDCAN
     if (HAL_FDCAN_Start(hfdcan) != HAL_OK) {
         fault_monitor_record_system_fault(SYSTEM_FAULT_CAN_FAULT,
@@ -265,7 +434,91 @@ SystemError_t comm_can_init(FDCAN_HandleTypeDef *hfdcan) {
         return ERROR_COMM_INIT_FAILED;
     }
 
-    return SYSTEM_OK;
+    result = comm_can_time_sync_init(
+        &can_time_sync, CAN_NODE_ID == CAN_TIME_SYNC_MASTER_NODE,
+        fdcan_send_time_sync, hfdcan);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    return comm_can_telemetry_init(&can_telemetry, CAN_TELEMETRY_RATE_HZ,
+                                   sample_motor_telemetry, fdcan_send, hfdcan);
+}
+
+/**
+ * @brief Set the CAN-FD telemetry publication rate
+ */
+SystemError_t comm_can_set_telemetry_rate(uint32_t rate_hz) {
+    if (fdcan_handle == NULL) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    return comm_can_telemetry_set_rate(&can_telemetry, rate_hz);
+}
+
+/**
+ * @brief Process received CAN messages (FDCAN RX FIFO 0 ISR)
+ */
+void comm_can_rx_callback(FDCAN_HandleTypeDef *hfdcan) {
+    FDCAN_RxHeaderTypeDef header;
+    uint8_t data[CAN_MAX_MESSAGE_SIZE];
+
+    if (hfdcan == NULL || hfdcan != fdcan_handle) {
+        return;
+    }
+
+    // Only filter-accepted frames reach the FIFO; route by filter index
+    while (HAL_FDCAN_GetRxFifoFillLevel(hfdcan, FDCAN_RX_FIFO0) > 0 &&
+           HAL_FDCAN_GetRxMessage(hfdcan, FDCAN_RX_FIFO0, &header, data) ==
+               HAL_OK) {
+        // Stamped here for time sync, before any queueing delay
+        uint32_t now_us = HAL_Abstraction_GetMicroseconds();
+
+        // Older HAL releases keep the DLC code in bits 16..19
+        uint32_t dlc = header.DataLength;
+        if (dlc > 0x0FU) {
+            dlc >>= 16;
+        }
+
+        if (comm_can_rx_dispatch(&can_rx, header.FilterIndex,
+                                 header.Identifier, data,
+                                 comm_can_dlc_to_length((uint8_t)dlc),
+                                 now_us)) {
+            comm_channels[PROTOCOL_CAN_MOTOR].rx_count++;
+        } else {
+            comm_channels[PROTOCOL_CAN_MOTOR].error_count++;
+        }
+    }
+
+    comm_channels[PROTOCOL_CAN_MOTOR].last_activity =
+        HAL_Abstraction_GetTick();
+}
+
+/**
+ * @brief Process CAN transmit complete (FDCAN TX buffer complete ISR)
+ */
+void comm_can_tx_complete_callback(FDCAN_HandleTypeDef *hfdcan,
+                                   uint32_t buffer_indexes) {
+    if (hfdcan == NULL || hfdcan != fdcan_handle ||
+        (buffer_indexes & time_sync_tx_buffer) == 0) {
+        return;
+    }
+
+    // The SYNC frame has just left the controller: that is its master time
+    time_sync_tx_buffer = 0;
+    comm_can_time_sync_sent(&can_time_sync, HAL_Abstraction_GetMicroseconds());
+}
+
+/**
+ * @brief Get the synchronised microsecond timebase
+ */
+bool comm_can_get_sync_microseconds(uint32_t *sync_us) {
+    if (sync_us == NULL || fdcan_handle == NULL) {
+        return false;
+    }
+
+    return comm_can_time_sync_get_time(
+        &can_time_sync, HAL_Abstraction_GetMicroseconds(), sync_us);
 }
 
 /**
@@ -291,29 +544,7 @@ SystemError_t comm_process_message(const Message_t *message) {
         return ERROR_COMM_CHECKSUM_FAILED;
     }
 
-    // Process based on protocol type
-    switch (message->header.protocol_type) {
-    case PROTOCOL_UART_BINARY: {
-        if (message->header.payload_length >= sizeof(MotorCommand_t)) {
-            MotorCommand_t *command = (MotorCommand_t *)message->payload;
-            return process_motor_command(command);
-        }
-        break;
-    }
-
-    case PROTOCOL_CAN_MOTOR: {
-        if (message->header.payload_length >= sizeof(MotorCommand_t)) {
-            MotorCommand_t *command = (MotorCommand_t *)message->payload;
-            return process_motor_command(command);
-        }
-        break;
-    }
-
-    default:
-        return ERROR_COMM_UNSUPPORTED_PROTOCOL;
-    }
-
-    return ERROR_COMM_INVALID_MESSAGE;
+    return dispatch_message(&message->header, message->payload);
 }
 
 /**
@@ -326,25 +557,7 @@ SystemError_t comm_process_ascii_command(const char *command_string) {
 
     COMM_SAFETY_CHECK();
 
-    MotorCommand_t motor_command = {0};
-    SystemError_t result =
-        comm_parse_ascii_motor_command(command_string, &motor_command);
-
-    if (result == SYSTEM_OK) {
-        result = process_motor_command(&motor_command);
-
-        // Send response
-        char response[128];
-        if (result == SYSTEM_OK) {
-            snprintf(response, sizeof(response), "OK: Command executed\r\n");
-        } else {
-            snprintf(response, sizeof(response), "ERROR: %d\r\n", result);
-        }
-
-        comm_send_text_message(PROTOCOL_UART_ASCII, response);
-    }
-
-    return result;
+    return comm_ascii_dispatch(ascii_verbs, command_string);
 }
 
 /**
@@ -363,44 +576,18 @@ SystemError_t comm_parse_ascii_motor_command(const char *ascii_command,
     // "STOP 1" - Stop motor 1
     // "HOME 0" - Home motor 0
     // "STATUS 1" - Get status of motor 1
-
-    char command[16], param1[16], param2[16], param3[16];
-    int params = sscanf(ascii_command, "%15s %15s %15s %15s", command, param1,
-                        param2, param3);
-
-    if (params < 2) {
-        return ERROR_COMM_INVALID_COMMAND;
-    }
-
-    // Parse motor ID
-    motor_command->motor_id = (uint8_t)atoi(param1);
-    if (motor_command->motor_id >= MAX_MOTORS) {
-        return ERROR_MOTOR_INVALID_ID;
+    const CommAsciiVerb_t *verb;
+    CommAsciiArgs_t args;
+    SystemError_t result =
+        comm_ascii_parse(ascii_verbs, ascii_command, &verb, &args);
+    if (result != SYSTEM_OK) {
+        return result;
     }
-
-    // Parse command type
-    if (strcmp(command, "MOVE") == 0) {
-        if (params >= 4) {
-            motor_command->command = MOTOR_CMD_MOVE_ABSOLUTE;
-            motor_command->data.move.position_steps = atoi(param2);
-            motor_command->data.move.speed_steps_per_sec = atoi(param3);
-            motor_command->data.move.acceleration =
-                MOTOR1_ACCELERATION; // Default from SSOT
-        } else {
-            return ERROR_COMM_INVALID_COMMAND;
-        }
-    } else if (strcmp(command, "STOP") == 0) {
-        motor_command->command = MOTOR_CMD_STOP;
-    } else if (strcmp(command, "ESTOP") == 0) {
-        motor_command->command = MOTOR_CMD_EMERGENCY_STOP;
-    } else if (strcmp(command, "HOME") == 0) {
-        motor_command->command = MOTOR_CMD_HOME;
-    } else if (strcmp(command, "STATUS") == 0) {
-        motor_command->command = MOTOR_CMD_GET_STATUS;
-    } else {
-        return ERROR_COMM_INVALID_COMMAND;
+    if (verb->handler != ascii_motor_command) {
+        return ERROR_COMM_INVALID_COMMAND; // Not a single-motor command
     }
 
+    build_ascii_motor_command(verb, &args, motor_command);
     return SYSTEM_OK;
 }
 
@@ -422,7 +609,62 @@ SystemError_t comm_send_text_message(CommProtocol_t protocol,
         length = UART_TX_BUFFER_SIZE;
     }
 
-    return send_uart_message((const uint8_t *)message, length);
+    return send_uart_message(MSG_PRIORITY_NORMAL, (const uint8_t *)message,
+                             length);
+}
+
+/**
+ * @brief Send a binary message on its header's priority lane
+ */
+SystemError_t comm_send_message(CommProtocol_t protocol,
+                                const MessageHeader_t *header,
+                                const uint8_t *payload) {
+    if (!comm_protocol_initialized || header == NULL ||
+        (payload == NULL && header->payload_length != 0)) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if (protocol != PROTOCOL_UART_BINARY || debug_uart_handle == NULL) {
+        return ERROR_COMM_UNSUPPORTED_PROTOCOL;
+    }
+
+    if (header->payload_length > MAX_MESSAGE_PAYLOAD) {
+        return ERROR_COMM_MESSAGE_TOO_LARGE;
+    }
+
+    // Build the frame in its transmit slot, checksum filled in on the way
+    uint16_t length = (uint16_t)(sizeof(MessageHeader_t) +
+                                 header->payload_length);
+    CommTxSlot_t *slot =
+        comm_tx_queue_claim(&uart_tx_queue, header->priority, length);
+    if (slot == NULL) {
+        return ERROR_COMM_BUSY;
+    }
+
+    MessageHeader_t frame_header = *header;
+    frame_header.magic = MESSAGE_HEADER_MAGIC;
+    frame_header.protocol_type = (uint8_t)protocol;
+    frame_header.checksum = calculate_message_checksum(&frame_header, payload);
+    memcpy(slot->data, &frame_header, sizeof(frame_header));
+    if (header->payload_length != 0) {
+        memcpy(slot->data + sizeof(frame_header), payload,
+               header->payload_length);
+    }
+    comm_tx_queue_commit(&uart_tx_queue, slot);
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Get UART transmit queue counters for one priority lane
+ */
+SystemError_t comm_get_uart_tx_stats(uint8_t priority,
+                                     CommTxLaneStats_t *stats) {
+    if (!comm_protocol_initialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    return comm_tx_queue_get_stats(&uart_tx_queue, priority, stats);
 }
 
 /**
@@ -435,10 +677,15 @@ SystemError_t comm_protocol_task(void) {
 
     SystemError_t result = SYSTEM_OK;
 
-    // Process UART received data
-    if (uart_rx_complete) {
-        result = process_uart_received_data();
-        uart_rx_complete = false;
+    // Process UART received data (in place, straight from the DMA ring)
+    result = process_uart_received_data();
+    report_batch_result();
+
+    if (fdcan_handle != NULL) {
+        uint32_t now_us = HAL_Abstraction_GetMicroseconds();
+        comm_can_rx_process(&can_rx);
+        comm_can_time_sync_poll(&can_time_sync, now_us);
+        comm_can_telemetry_poll(&can_telemetry, now_us);
     }
 
     // Check communication timeouts
@@ -534,15 +781,24 @@ SystemError_t comm_protocol_self_test(void) {
  */
 void comm_uart_rx_complete_callback(UART_HandleTypeDef *huart) {
     if (huart == debug_uart_handle) {
-        uart_rx_length =
-            UART_RX_BUFFER_SIZE - __HAL_DMA_GET_COUNTER(huart->hdmarx);
-        uart_rx_complete = true;
-        comm_channels[PROTOCOL_UART_ASCII].rx_count++;
+        // Circular DMA keeps running; only the position is recorded
+        uint32_t remaining = __HAL_DMA_GET_COUNTER(huart->hdmarx);
+        comm_rx_ring_dma_event(&uart_rx_ring,
+                               (uint16_t)(UART_RX_BUFFER_SIZE - remaining));
         comm_channels[PROTOCOL_UART_ASCII].last_activity =
             HAL_Abstraction_GetTick();
+    }
+}
 
-        // Restart DMA reception
-        HAL_UART_Receive_DMA(huart, uart_rx_buffer, UART_RX_BUFFER_SIZE);
+/**
+ * @brief Process UART RX event (idle line, half or full transfer)
+ */
+void comm_uart_rx_event_callback(UART_HandleTypeDef *huart,
+                                 uint16_t position) {
+    if (huart == debug_uart_handle) {
+        comm_rx_ring_dma_event(&uart_rx_ring, position);
+        comm_channels[PROTOCOL_UART_ASCII].last_activity =
+            HAL_Abstraction_GetTick();
     }
 }
 
@@ -551,10 +807,12 @@ void comm_uart_rx_complete_callback(UART_HandleTypeDef *huart) {
  */
 void comm_uart_tx_complete_callback(UART_HandleTypeDef *huart) {
     if (huart == debug_uart_handle) {
-        uart_tx_complete = true;
         comm_channels[PROTOCOL_UART_ASCII].tx_count++;
         comm_channels[PROTOCOL_UART_ASCII].last_activity =
             HAL_Abstraction_GetTick();
+
+        // Chain the next queued message straight from the interrupt
+        comm_tx_queue_dma_complete(&uart_tx_queue);
     }
 }
 
@@ -567,9 +825,68 @@ void comm_uart_error_callback(UART_HandleTypeDef *huart) {
         fault_monitor_record_system_fault(
             SYSTEM_FAULT_UART_FAULT, FAULT_SEVERITY_WARNING, huart->ErrorCode);
 
-        // Restart UART reception
-        HAL_UART_Receive_DMA(huart, uart_rx_buffer, UART_RX_BUFFER_SIZE);
+        // A DMA error ends the transfer in flight; move on to the next
+        if ((huart->ErrorCode & HAL_UART_ERROR_DMA) != 0U) {
+            comm_tx_queue_dma_complete(&uart_tx_queue);
+        }
+
+        // Restart UART reception; the DMA starts over at index 0
+        comm_rx_ring_dma_restart(&uart_rx_ring);
+        HAL_UARTEx_ReceiveToIdle_DMA(huart, uart_rx_buffer,
+                                     UART_RX_BUFFER_SIZE);
+    }
+}
+
+/**
+ * @brief Apply a validated MOTOR_CMD_BATCH, if one is pending
+ */
+void comm_apply_pending_batch(void) {
+    if (__atomic_load_n(&batch_state, __ATOMIC_ACQUIRE) != BATCH_PENDING) {
+        return;
+    }
+
+    // A synchronised start waits for its tick on every node; the skew left
+    // is the phase of each node's control tick
+    if (batch_scheduled &&
+        (int32_t)(HAL_Abstraction_GetMicroseconds() - batch_start_us) < 0) {
+        return;
+    }
+
+    uint8_t expected = BATCH_PENDING;
+    if (!__atomic_compare_exchange_n(&batch_state, &expected, BATCH_APPLYING,
+                                     false, __ATOMIC_ACQUIRE,
+                                     __ATOMIC_RELAXED)) {
+        return; // Cancelled by a stop
+    }
+
+    // Entries were validated when staged; a run-time failure does not hold
+    // back the other axes
+    SystemError_t result = SYSTEM_OK;
+    for (uint8_t i = 0; i < batch_count; i++) {
+        SystemError_t entry_result = apply_batch_entry(&batch_commands[i]);
+        if (entry_result != SYSTEM_OK && result == SYSTEM_OK) {
+            result = entry_result;
+        }
+    }
+
+    batch_result = result;
+    __atomic_store_n(&batch_state, BATCH_APPLIED, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Drop a staged MOTOR_CMD_BATCH that has not been applied yet
+ */
+void comm_cancel_pending_batch(void) {
+    uint8_t expected = BATCH_PENDING;
+    if (!__atomic_compare_exchange_n(&batch_state, &expected, BATCH_APPLYING,
+                                     false, __ATOMIC_ACQUIRE,
+                                     __ATOMIC_RELAXED)) {
+        return; // Nothing pending, or already being applied
     }
+
+    batch_scheduled = false;
+    batch_result = ERROR_MOTOR_MOVE_ABORTED;
+    __atomic_store_n(&batch_state, BATCH_APPLIED, __ATOMIC_RELEASE);
 }
 
 /* ==========================================================================
@@ -591,13 +908,26 @@ static SystemError_t process_motor_command(const MotorCommand_t *command) {
         return result;
     }
 
+    return execute_motor_command(command);
+}
+
+/**
+ * @brief Execute a validated motor command
+ */
+static SystemError_t execute_motor_command(const MotorCommand_t *command) {
+    SystemError_t result;
+
     // Execute command based on type
     switch (command->command) {
     case MOTOR_CMD_STOP:
+        comm_cancel_pending_batch();
+        motion_pvt_abort(command->motor_id);
         result = motor_controller_stop_motor(command->motor_id);
         break;
 
     case MOTOR_CMD_EMERGENCY_STOP:
+        comm_cancel_pending_batch();
+        motion_pvt_abort(command->motor_id);
         result = motor_controller_emergency_stop(command->motor_id);
         break;
 
@@ -627,6 +957,318 @@ static SystemError_t process_motor_command(const MotorCommand_t *command) {
     return result;
 }
 
+/**
+ * @brief Run a single-motor ASCII verb and report the result
+ */
+static SystemError_t ascii_motor_command(const CommAsciiVerb_t *verb,
+                                         const CommAsciiArgs_t *args) {
+    MotorCommand_t motor_command = {0};
+    build_ascii_motor_command(verb, args, &motor_command);
+
+    SystemError_t result = process_motor_command(&motor_command);
+
+    // Send response
+    char response[128];
+    if (result == SYSTEM_OK) {
+        snprintf(response, sizeof(response), "OK: Command executed\r\n");
+    } else {
+        snprintf(response, sizeof(response), "ERROR: %d\r\n", result);
+    }
+    send_ascii_response(result, response);
+
+    return result;
+}
+
+/**
+ * @brief Fill a motor command from a parsed single-motor verb
+ * @details The argument types have been checked against the verb: the
+ *          motor index first, then MOVE's position and speed.
+ */
+static void build_ascii_motor_command(const CommAsciiVerb_t *verb,
+                                      const CommAsciiArgs_t *args,
+                                      MotorCommand_t *command) {
+    command->command = (MotorCommandType_t)verb->code;
+    command->motor_id = (uint8_t)args->values[0];
+
+    if (command->command == MOTOR_CMD_MOVE_ABSOLUTE) {
+        command->data.move.position_steps = args->values[1];
+        command->data.move.speed_steps_per_sec = (uint32_t)args->values[2];
+        command->data.move.acceleration =
+            default_acceleration[command->motor_id];
+    }
+}
+
+/**
+ * @brief Queue a blended path segment
+ * @param args "<pos0> ... <posN-1> <speed>" - one absolute target per
+ *        motor, then the per-axis speed limit
+ */
+static SystemError_t ascii_queue_command(const CommAsciiVerb_t *verb,
+                                         const CommAsciiArgs_t *args) {
+    CoordinatedMoveCommand_t move = {0};
+    (void)verb;
+
+    if (args->count != MAX_MOTORS + 1U) {
+        return ERROR_COMM_INVALID_COMMAND;
+    }
+    int32_t speed = args->values[MAX_MOTORS];
+    if (speed <= 0) {
+        return ERROR_COMM_INVALID_COMMAND;
+    }
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        move.motor_targets[i].enabled = true;
+        move.motor_targets[i].target_position = args->values[i];
+        move.motor_targets[i].max_velocity = (uint32_t)speed;
+        move.motor_targets[i].acceleration = default_acceleration[i];
+        move.motor_targets[i].deceleration = default_deceleration[i];
+    }
+
+    SystemError_t result = multi_motor_queue_move(&move);
+
+    // Report remaining ring space so the host can pace its stream
+    char response[64];
+    if (result == SYSTEM_OK) {
+        snprintf(response, sizeof(response), "OK: Queued %u\r\n",
+                 (unsigned)motion_lookahead_free_slots());
+    } else {
+        snprintf(response, sizeof(response), "ERROR: %d\r\n", result);
+    }
+    send_ascii_response(result, response);
+
+    return result;
+}
+
+/**
+ * @brief Append a streamed PVT batch to a motor's ring
+ * @param message_id Frame identifier, echoed in the CommAck_t reply
+ * @param command Batch command (motor, point count, flags)
+ * @param points Packed PvtPoint_t entries following the command
+ * @param points_length Payload bytes available for the points
+ */
+static SystemError_t process_pvt_batch(uint16_t message_id,
+                                       const MotorCommand_t *command,
+                                       const uint8_t *points,
+                                       uint16_t points_length) {
+    PvtPoint_t batch[MOTION_PVT_DEPTH];
+    uint8_t count = command->data.pvt.point_count;
+    SystemError_t result = SYSTEM_OK;
+
+    if (command->motor_id >= MAX_MOTORS) {
+        result = ERROR_MOTOR_INVALID_ID;
+    } else if (count == 0 || count > MOTION_PVT_DEPTH ||
+               (uint32_t)count * sizeof(PvtPoint_t) > points_length) {
+        result = ERROR_COMM_INVALID_MESSAGE;
+    } else {
+        // Payload offsets are not aligned for direct access
+        memcpy(batch, points, (size_t)count * sizeof(PvtPoint_t));
+
+        if (command->data.pvt.flags & PVT_BATCH_FLAG_BEGIN) {
+            PositionControlStatus_t pos_status;
+            result =
+                position_control_get_status(command->motor_id, &pos_status);
+            if (result == SYSTEM_OK) {
+                result = motion_pvt_begin(command->motor_id,
+                                          pos_status.target_position);
+            }
+        }
+        if (result == SYSTEM_OK) {
+            result = motion_pvt_push(command->motor_id, batch, count);
+        }
+    }
+
+    // Fill level and underruns let the host pace its stream
+    PvtStatus_t status = {0};
+    CommAck_t ack = {.command = MOTOR_CMD_PVT_POINTS,
+                     .motor_id = command->motor_id,
+                     .result = result};
+    if (motion_pvt_get_status(command->motor_id, &status) == SYSTEM_OK) {
+        ack.queued = status.queued;
+        ack.free = status.free;
+        ack.underruns = status.underruns;
+    }
+    send_binary_ack(message_id, &ack);
+
+    return result;
+}
+
+/**
+ * @brief Stage a MOTOR_CMD_BATCH for the control task
+ * @details All or nothing: no entry is applied unless every entry is valid.
+ * @param message_id Frame to acknowledge (binary UART)
+ * @param protocol Origin of the batch, which decides how it is answered
+ */
+static SystemError_t process_command_batch(uint16_t message_id,
+                                           uint8_t protocol,
+                                           const MotorCommand_t *command,
+                                           const uint8_t *entries,
+                                           uint16_t entries_length) {
+    uint8_t count = command->data.batch.command_count;
+    SystemError_t result = SYSTEM_OK;
+
+    if (count == 0 || count > COMM_BATCH_MAX_COMMANDS ||
+        (uint32_t)count * sizeof(MotorCommand_t) > entries_length) {
+        result = ERROR_COMM_INVALID_MESSAGE;
+    } else if (__atomic_load_n(&batch_state, __ATOMIC_ACQUIRE) !=
+               BATCH_IDLE) {
+        result = ERROR_COMM_BUSY; // Previous batch not applied yet
+    } else {
+        // Payload offsets are not aligned for direct access
+        memcpy(batch_commands, entries, (size_t)count * sizeof(MotorCommand_t));
+
+        uint8_t motors_seen = 0;
+        for (uint8_t i = 0; i < count && result == SYSTEM_OK; i++) {
+            result = validate_batch_entry(&batch_commands[i], &motors_seen);
+        }
+    }
+
+    // A synchronised start time is converted to this node's tick once. The
+    // control task compares ticks as int32_t, so a start more than
+    // INT32_MAX us ahead cannot be told from one already passed.
+    bool scheduled = false;
+    uint32_t start_us = 0;
+    if (result == SYSTEM_OK &&
+        (command->data.batch.flags & BATCH_FLAG_SYNC_START)) {
+        if (!comm_can_time_sync_to_local(&can_time_sync,
+                                         command->data.batch.start_sync_us,
+                                         &start_us)) {
+            result = ERROR_NOT_INITIALIZED; // Timebase not locked
+        } else {
+            uint32_t lead_us = start_us - HAL_Abstraction_GetMicroseconds();
+            if (lead_us == 0 || lead_us > (uint32_t)INT32_MAX) {
+                result = ERROR_TIMEOUT; // Passed, or beyond the horizon
+            } else {
+                scheduled = true;
+            }
+        }
+    }
+
+    if (result != SYSTEM_OK) {
+        send_batch_ack(message_id, protocol, count, result);
+        return result;
+    }
+
+    // Only an accepted batch touches the schedule of the pending one
+    batch_count = count;
+    batch_scheduled = scheduled;
+    batch_start_us = start_us;
+    batch_message_id = message_id;
+    batch_protocol = protocol;
+    __atomic_store_n(&batch_state, BATCH_PENDING, __ATOMIC_RELEASE);
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Check one batch entry against what the control task can apply
+ * @details The control task only touches the motion profiles: absolute
+ *          moves and stops, at most one per motor. Driver and encoder
+ *          commands would block the tick on SPI/I2C and are refused.
+ * @param motors_seen Motors commanded by earlier entries (bit per motor)
+ */
+static SystemError_t validate_batch_entry(const MotorCommand_t *command,
+                                          uint8_t *motors_seen) {
+    SystemError_t result = validate_motor_command(command);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    if (command->command != MOTOR_CMD_MOVE_ABSOLUTE &&
+        command->command != MOTOR_CMD_STOP) {
+        return ERROR_COMM_UNSUPPORTED_COMMAND;
+    }
+    if (*motors_seen & (1U << command->motor_id)) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    *motors_seen |= (uint8_t)(1U << command->motor_id);
+
+    if (command->command != MOTOR_CMD_MOVE_ABSOLUTE) {
+        return SYSTEM_OK;
+    }
+    if (command->data.move.speed_steps_per_sec == 0 ||
+        command->data.move.speed_steps_per_sec > MOTOR_MAX_SPEED) {
+        return ERROR_MOTOR_SPEED_LIMIT;
+    }
+    if (command->data.move.acceleration > MOTOR_MAX_ACCELERATION) {
+        return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    PositionValidationResult_t validation;
+    result = position_safety_validate_target(
+        command->motor_id,
+        (float)command->data.move.position_steps * STEPS_TO_DEGREES,
+        &validation);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return validation.position_valid ? SYSTEM_OK
+                                     : ERROR_POSITION_LIMIT_EXCEEDED;
+}
+
+/**
+ * @brief Apply one validated batch entry from the control task
+ * @details A move replaces the motor's profile or PVT stream with a
+ *          trapezoid from the current setpoint. Nothing here waits on a
+ *          bus: position control drives the motor from the next setpoint.
+ */
+static SystemError_t apply_batch_entry(const MotorCommand_t *command) {
+    uint8_t motor_id = command->motor_id;
+
+    motion_pvt_abort(motor_id);
+    if (command->command == MOTOR_CMD_STOP) {
+        return motion_profile_stop(motor_id);
+    }
+
+    PositionControlStatus_t pos_status;
+    SystemError_t result = position_control_get_status(motor_id, &pos_status);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    uint32_t acceleration = command->data.move.acceleration;
+    if (acceleration == 0) {
+        acceleration = default_acceleration[motor_id];
+    }
+
+    MotionProfile_t profile;
+    result = motion_profile_generate_trapezoidal(
+        &profile, pos_status.target_position,
+        command->data.move.position_steps,
+        command->data.move.speed_steps_per_sec, acceleration);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return motion_profile_start(motor_id, &profile);
+}
+
+/**
+ * @brief Acknowledge a MOTOR_CMD_BATCH in the framing it arrived in
+ * @details Binary UART batches get a CommAck_t; CAN batches are not
+ *          answered on the UART.
+ */
+static void send_batch_ack(uint16_t message_id, uint8_t protocol,
+                           uint8_t count, SystemError_t result) {
+    if (protocol != PROTOCOL_UART_BINARY) {
+        return;
+    }
+
+    CommAck_t ack = {
+        .command = MOTOR_CMD_BATCH, .motor_id = count, .result = result};
+    send_binary_ack(message_id, &ack);
+}
+
+/**
+ * @brief Report an applied batch and accept the next one
+ */
+static void report_batch_result(void) {
+    if (__atomic_load_n(&batch_state, __ATOMIC_ACQUIRE) != BATCH_APPLIED) {
+        return;
+    }
+
+    send_batch_ack(batch_message_id, batch_protocol, batch_count,
+                   batch_result);
+
+    __atomic_store_n(&batch_state, BATCH_IDLE, __ATOMIC_RELEASE);
+}
+
 /**
  * @brief Validate motor command
  */
@@ -678,50 +1320,166 @@ static SystemError_t validate_motor_command(const MotorCommand_t *command) {
  */
 static uint16_t calculate_message_checksum(const MessageHeader_t *header,
                                            const uint8_t *payload) {
-    // Simple CRC16 implementation
-    uint16_t crc = CRC16_INIT_VALUE;
-
-    // Include header in checksum (excluding checksum field itself)
-    const uint8_t *data = (const uint8_t *)header;
-    for (size_t i = 0; i < offsetof(MessageHeader_t, checksum); i++) {
-        crc ^= data[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ CRC16_POLYNOMIAL;
-            } else {
-                crc >>= 1;
-            }
+    return comm_frame_checksum((const uint8_t *)header, payload,
+                               header->payload_length);
+}
+
+/**
+ * @brief Act on a validated message
+ */
+static SystemError_t dispatch_message(const MessageHeader_t *header,
+                                      const uint8_t *payload) {
+    MotorCommand_t command;
+
+    if (header->protocol_type != PROTOCOL_UART_BINARY &&
+        header->protocol_type != PROTOCOL_CAN_MOTOR) {
+        return ERROR_COMM_UNSUPPORTED_PROTOCOL;
+    }
+    if (header->payload_length < sizeof(MotorCommand_t)) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    // Payload offsets are not aligned for direct access
+    memcpy(&command, payload, sizeof(command));
+
+    switch (header->protocol_type) {
+    case PROTOCOL_UART_BINARY:
+        if (command.command == MOTOR_CMD_PVT_POINTS) {
+            return process_pvt_batch(
+                header->message_id, &command,
+                payload + sizeof(MotorCommand_t),
+                header->payload_length - sizeof(MotorCommand_t));
         }
+        if (command.command == MOTOR_CMD_BATCH) {
+            return process_command_batch(
+                header->message_id, header->protocol_type, &command,
+                payload + sizeof(MotorCommand_t),
+                header->payload_length - sizeof(MotorCommand_t));
+        }
+        return process_motor_command(&command);
+
+    case PROTOCOL_CAN_MOTOR:
+        return process_motor_command(&command);
+
+    default:
+        return ERROR_COMM_UNSUPPORTED_PROTOCOL;
     }
+}
 
-    // Include payload in checksum
-    for (uint16_t i = 0; i < header->payload_length; i++) {
-        crc ^= payload[i];
-        for (int j = 0; j < 8; j++) {
-            if (crc & 1) {
-                crc = (crc >> 1) ^ CRC16_POLYNOMIAL;
-            } else {
-                crc >>= 1;
-            }
-        }
+/**
+ * @brief Act on a frame validated by the decoder
+ */
+static SystemError_t process_binary_frame(const CommFrame_t *frame) {
+    COMM_SAFETY_CHECK();
+
+    // The frame sits at an arbitrary ring offset; copy the header out
+    MessageHeader_t header;
+    memcpy(&header, frame->data, sizeof(header));
+
+    return dispatch_message(&header, frame->data + COMM_FRAME_HEADER_SIZE);
+}
+
+/**
+ * @brief Queue a UART message on a priority lane
+ */
+static SystemError_t send_uart_message(uint8_t priority, const uint8_t *data,
+                                       uint32_t length) {
+    if (debug_uart_handle == NULL || data == NULL) {
+        return ERROR_COMM_BUSY;
     }
 
-    return crc;
+    if (length > COMM_TX_SLOT_SIZE) {
+        return ERROR_COMM_MESSAGE_TOO_LARGE;
+    }
+
+    return comm_tx_queue_push(&uart_tx_queue, priority, data,
+                              (uint16_t)length);
+}
+
+/**
+ * @brief Send an ASCII command response; errors overtake status traffic
+ */
+static void send_ascii_response(SystemError_t result, const char *response) {
+    uint8_t priority =
+        (result == SYSTEM_OK) ? MSG_PRIORITY_NORMAL : MSG_PRIORITY_HIGH;
+
+    send_uart_message(priority, (const uint8_t *)response, strlen(response));
+}
+
+/**
+ * @brief Reply to a binary command frame; errors overtake status traffic
+ */
+static void send_binary_ack(uint16_t message_id, const CommAck_t *ack) {
+    MessageHeader_t header = {
+        .message_id = message_id,
+        .payload_length = sizeof(*ack),
+        .priority = (ack->result == SYSTEM_OK) ? MSG_PRIORITY_NORMAL
+                                               : MSG_PRIORITY_HIGH,
+        .timestamp_ms = HAL_Abstraction_GetTick()};
+
+    comm_send_message(PROTOCOL_UART_BINARY, &header, (const uint8_t *)ack);
 }
 
 /**
- * @brief Send UART message
+ * @brief Start a UART transmit DMA for the transmit queue
  */
-static SystemError_t send_uart_message(const uint8_t *data, uint32_t length) {
-    if (debug_uart_handle == NULL || data == NULL || !uart_tx_complete) {
+static SystemError_t uart_tx_start(void *context, const uint8_t *data,
+                                   uint16_t length) {
+    (void)context;
+
+    if (debug_uart_handle == NULL ||
+        HAL_UART_Transmit_DMA(debug_uart_handle, (uint8_t *)data, length) !=
+            HAL_OK) {
+        return ERROR_COMM_SEND_FAILED;
+    }
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Queue a CAN frame to the FDCAN TX FIFO
+ * @details 8-byte frames go out as classic CAN, 64-byte frames as CAN-FD
+ *          with bit rate switching. No service sends other lengths.
+ */
+static SystemError_t fdcan_send(void *context, uint32_t id,
+                                const uint8_t *data, uint8_t length) {
+    FDCAN_TxHeaderTypeDef header = fdcan_tx_header;
+
+    header.Identifier = id;
+    if (length == CAN_MAX_MESSAGE_SIZE) {
+        header.DataLength = FDCAN_DLC_BYTES_64;
+        header.BitRateSwitch = FDCAN_BRS_ON;
+        header.FDFormat = FDCAN_FD_CAN;
+    } else if (length != 8U) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if (HAL_FDCAN_AddMessageToTxFifoQ((FDCAN_HandleTypeDef *)context, &header,
+                                      (uint8_t *)data) != HAL_OK) {
         return ERROR_COMM_BUSY;
     }
 
-    uart_tx_complete = false;
+    comm_channels[PROTOCOL_CAN_MOTOR].tx_count++;
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Queue a time sync frame; watch a SYNC for its transmission
+ */
+static SystemError_t fdcan_send_time_sync(void *context, uint32_t id,
+                                          const uint8_t *data,
+                                          uint8_t length) {
+    FDCAN_HandleTypeDef *hfdcan = (FDCAN_HandleTypeDef *)context;
+
+    SystemError_t result = fdcan_send(context, id, data, length);
+    if (result != SYSTEM_OK || data[0] != CAN_TIME_SYNC_MSG_SYNC) {
+        return result;
+    }
 
-    if (HAL_UART_Transmit_DMA(debug_uart_handle, (uint8_t *)data, length) !=
-        HAL_OK) {
-        uart_tx_complete = true;
+    // comm_can_tx_complete_callback takes the time when this buffer is sent
+    uint32_t buffer = HAL_FDCAN_GetLatestTxFifoQRequestBuffer(hfdcan);
+    time_sync_tx_buffer = buffer;
+    if (HAL_FDCAN_ActivateNotification(hfdcan, FDCAN_IT_TX_COMPLETE,
+                                       buffer) != HAL_OK) {
         return ERROR_COMM_SEND_FAILED;
     }
 
@@ -729,37 +1487,135 @@ static SystemError_t send_uart_message(const uint8_t *data, uint32_t length) {
 }
 
 /**
- * @brief Process UART received data
+ * @brief Read one motor's telemetry from cached controller state
  */
-static SystemError_t process_uart_received_data(void) {
-    if (uart_rx_length == 0) {
-        return SYSTEM_OK;
+static SystemError_t sample_motor_telemetry(uint8_t motor_id,
+                                            CommCanTelemetryMotor_t *sample) {
+    PositionControlStatus_t status;
+    MotorState_t state = MOTOR_STATE_IDLE;
+
+    SystemError_t result = position_control_get_status(motor_id, &status);
+    if (result != SYSTEM_OK) {
+        return result;
     }
+    motor_controller_get_state(motor_id, &state);
 
-    // Process received bytes looking for complete commands
-    for (uint32_t i = 0; i < uart_rx_length; i++) {
-        char received_char = (char)uart_rx_buffer[i];
+    sample->position_steps = status.current_position;
+    sample->velocity_steps_per_sec = (int32_t)status.velocity;
+    sample->fault_flags = fault_monitor_get_motor_faults(motor_id);
+    sample->state = (uint8_t)state;
+    sample->status_flags = (uint16_t)(
+        (status.enabled ? CAN_TELEMETRY_STATUS_ENABLED : 0U) |
+        (status.homed ? CAN_TELEMETRY_STATUS_HOMED : 0U) |
+        (status.position_settled ? CAN_TELEMETRY_STATUS_SETTLED : 0U));
 
-        if (received_char == ASCII_COMMAND_DELIMITER ||
-            received_char == ASCII_END_OF_LINE) {
-            // Complete command received
-            if (ascii_command_length > 0) {
-                ascii_command_buffer[ascii_command_length] = '\0';
-                comm_process_ascii_command(ascii_command_buffer);
-                ascii_command_length = 0;
-            }
-        } else if (ascii_command_length < (ASCII_COMMAND_MAX_LENGTH - 1)) {
-            // Add character to command buffer
-            ascii_command_buffer[ascii_command_length++] = received_char;
-        } else {
-            // Command too long, reset buffer
-            ascii_command_length = 0;
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Program one acceptance filter per CAN route, reject the rest
+ * @note The FDCAN init must reserve at least CAN_FILTER_COUNT standard
+ *       filter elements (StdFiltersNbr) in message RAM.
+ */
+static SystemError_t configure_can_filters(FDCAN_HandleTypeDef *hfdcan) {
+    const uint8_t route_count =
+        (uint8_t)(sizeof(can_routes) / sizeof(can_routes[0]));
+
+    SystemError_t result = comm_can_rx_init(&can_rx, can_routes, route_count);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    for (uint8_t i = 0; i < route_count; i++) {
+        FDCAN_FilterTypeDef filter = {0};
+        filter.IdType = FDCAN_STANDARD_ID;
+        filter.FilterIndex = i;
+        filter.FilterType = FDCAN_FILTER_RANGE;
+        filter.FilterConfig = FDCAN_FILTER_TO_RXFIFO0;
+        filter.FilterID1 = can_routes[i].first_id;
+        filter.FilterID2 = can_routes[i].last_id;
+
+        if (HAL_FDCAN_ConfigFilter(hfdcan, &filter) != HAL_OK) {
+            return ERROR_COMM_INIT_FAILED;
+        }
+    }
+
+    // Frames no filter accepts (other nodes' traffic) are dropped unseen
+    if (HAL_FDCAN_ConfigGlobalFilter(hfdcan, FDCAN_REJECT, FDCAN_REJECT,
+                                     FDCAN_REJECT_REMOTE,
+                                     FDCAN_REJECT_REMOTE) != HAL_OK) {
+        return ERROR_COMM_INIT_FAILED;
+    }
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief CAN_ID_MOVE_COMMAND: payload is a MOTOR_CMD_MOVE_ABSOLUTE or a
+ *        MOTOR_CMD_BATCH of moves, laid out as in binary UART frames
+ */
+static SystemError_t can_move_command(const CommCanFrame_t *frame) {
+    MotorCommand_t command;
+
+    if (frame->length < sizeof(command)) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    memcpy(&command, frame->data, sizeof(command));
+
+    if (command.command == MOTOR_CMD_BATCH) {
+        return process_command_batch(0, PROTOCOL_CAN_MOTOR, &command,
+                                     frame->data + sizeof(command),
+                                     frame->length - sizeof(command));
+    }
+    if (command.command != MOTOR_CMD_MOVE_ABSOLUTE) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    return process_motor_command(&command);
+}
+
+/**
+ * @brief CAN_ID_TIME_SYNC: SYNC and FOLLOW_UP from the time sync master
+ */
+static SystemError_t can_time_sync_frame(const CommCanFrame_t *frame) {
+    return comm_can_time_sync_receive(&can_time_sync, frame);
+}
+
+/**
+ * @brief CAN_ID_STOP_COMMAND: payload byte 0 is the motor ID
+ */
+static SystemError_t can_stop_command(const CommCanFrame_t *frame) {
+    if (frame->length < 1U) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+
+    MotorCommand_t command = {.motor_id = frame->data[0],
+                              .command = MOTOR_CMD_STOP};
+    return process_motor_command(&command);
+}
+
+/**
+ * @brief Process UART received data
+ */
+static SystemError_t process_uart_received_data(void) {
+    const char *command;
+
+    if (uart_rx_protocol == PROTOCOL_UART_BINARY) {
+        CommFrame_t frame;
+        while (comm_frame_decoder_poll(&uart_frame_decoder, &uart_rx_ring,
+                                       uart_frame_buffer, &frame)) {
+            comm_channels[PROTOCOL_UART_BINARY].rx_count++;
+            process_binary_frame(&frame);
         }
+        return SYSTEM_OK;
     }
 
-    // Clear receive buffer
-    memset(uart_rx_buffer, 0, uart_rx_length);
-    uart_rx_length = 0;
+    // Each complete line is processed where the DMA wrote it
+    while (comm_rx_ring_next_line(&uart_rx_ring, ascii_command_buffer,
+                                  sizeof(ascii_command_buffer),
+                                  &command) > 0) {
+        comm_channels[PROTOCOL_UART_ASCII].rx_count++;
+        comm_process_ascii_command(command);
+    }
 
     return SYSTEM_OK;
 }
@@ -16,12 +16,12 @@
 #define COMM_PROTOCOL_H
 
 #include "common/data_types.h"
+#include "communication/comm_tx_queue.h"
 #include "config/comm_config.h"
 #include "config/safety_config.h"
 #include "safety/safety_system.h"
-#ifndef UNITY_TESTING
+// On the host this is the mock HAL (tests/mocks)
 #include "stm32h7xx_hal.h"
-#endif
 #include <stdbool.h>
 #include <stdint.h>
 // Shared SSOT constants
@@ -128,13 +128,15 @@ typedef enum {
     MOTOR_CMD_MOVE_ABSOLUTE = 0x10,   ///< Move to absolute position
     MOTOR_CMD_MOVE_RELATIVE = 0x11,   ///< Move relative to current position
     MOTOR_CMD_MOVE_CONTINUOUS = 0x12, ///< Continuous motion
+    MOTOR_CMD_PVT_POINTS = 0x13,      ///< Streamed PVT point batch
     MOTOR_CMD_HOME = 0x20,            ///< Home motor
     MOTOR_CMD_CALIBRATE = 0x21,       ///< Calibrate position
     MOTOR_CMD_SET_POSITION = 0x22,    ///< Set current position
     MOTOR_CMD_GET_STATUS = 0x30,      ///< Get motor status
     MOTOR_CMD_GET_POSITION = 0x31,    ///< Get current position
     MOTOR_CMD_SET_PARAMETERS = 0x40,  ///< Set motor parameters
-    MOTOR_CMD_SELF_TEST = 0x50        ///< Perform self-test
+    MOTOR_CMD_SELF_TEST = 0x50,       ///< Perform self-test
+    MOTOR_CMD_BATCH = 0x60            ///< Commands applied in one tick
 } MotorCommandType_t;
 
 /**
@@ -154,10 +156,61 @@ typedef struct {
             uint32_t acceleration; ///< Acceleration parameter
             uint32_t current_ma;   ///< Motor current in mA
         } parameters;
+        struct {
+            uint8_t point_count; ///< PvtPoint_t entries after the command
+            uint8_t flags;       ///< PVT_BATCH_FLAG_* bits
+        } pvt;
+        struct {
+            uint8_t command_count;  ///< MotorCommand_t entries after this one
+            uint8_t flags;          ///< BATCH_FLAG_* bits
+            uint32_t start_sync_us; ///< Synchronised start time
+        } batch;
         uint32_t raw_data; ///< Raw command data
     } data;
 } MotorCommand_t;
 
+/**
+ * @brief MOTOR_CMD_PVT_POINTS flags
+ * @details A PVT batch message carries the MotorCommand_t followed by
+ *          data.pvt.point_count PvtPoint_t entries in the same payload.
+ *          Each batch is answered with a CommAck_t carrying the ring fill
+ *          level.
+ */
+#define PVT_BATCH_FLAG_BEGIN 0x01U ///< Start a new stream at the setpoint
+
+/*
+ * MOTOR_CMD_BATCH: the MotorCommand_t is followed by data.batch.command_count
+ * (1..COMM_BATCH_MAX_COMMANDS) MotorCommand_t entries in the same payload.
+ * Entries are MOTOR_CMD_MOVE_ABSOLUTE or MOTOR_CMD_STOP, at most one per
+ * motor. Every entry is validated (soft limits included) before any is
+ * applied; the control task then starts or stops the motion profiles
+ * within one tick (comm_apply_pending_batch), so axes commanded together
+ * start together. A binary UART batch is answered with a CommAck_t once
+ * applied or refused; a CAN batch is not answered.
+ *
+ * With BATCH_FLAG_SYNC_START the batch is held until the CAN synchronised
+ * timebase (comm_can_get_sync_microseconds) reaches data.batch.start_sync_us,
+ * so controllers sent the same start time start within a control tick of
+ * each other. It is refused while the timebase is not locked, once the
+ * start time has passed, or if it lies more than INT32_MAX us ahead. A
+ * stop cancels a batch still waiting (comm_cancel_pending_batch).
+ */
+#define BATCH_FLAG_SYNC_START 0x01U ///< Start at data.batch.start_sync_us
+
+/**
+ * @brief Binary reply to a MOTOR_CMD_PVT_POINTS or MOTOR_CMD_BATCH frame
+ * @details Payload of a PROTOCOL_UART_BINARY frame whose header echoes the
+ *          command frame's message_id. Errors go on MSG_PRIORITY_HIGH.
+ */
+typedef struct {
+    uint8_t command;    ///< MotorCommandType_t acknowledged
+    uint8_t motor_id;   ///< PVT: motor; batch: number of entries
+    uint8_t queued;     ///< PVT: points queued after this batch
+    uint8_t free;       ///< PVT: free ring slots
+    int32_t result;     ///< SYSTEM_OK or the SystemError_t refusing it
+    uint32_t underruns; ///< PVT: streams cut by an empty ring
+} __attribute__((packed)) CommAck_t;
+
 /**
  * @brief Motor status response structure
  */
@@ -232,6 +285,28 @@ SystemError_t comm_send_motor_status(CommProtocol_t protocol,
 SystemError_t comm_send_text_message(CommProtocol_t protocol,
                                      const char *message);
 
+/**
+ * @brief Send a binary message
+ * @details Queued on the lane of header->priority; the magic, protocol
+ *          type and checksum fields are filled in.
+ * @param protocol PROTOCOL_UART_BINARY
+ * @param header Message header (payload_length, priority, ...)
+ * @param payload Message payload
+ * @return ERROR_COMM_BUSY if the priority lane is full
+ */
+SystemError_t comm_send_message(CommProtocol_t protocol,
+                                const MessageHeader_t *header,
+                                const uint8_t *payload);
+
+/**
+ * @brief Get UART transmit queue counters for one priority lane
+ * @param priority Lane (MSG_PRIORITY_EMERGENCY .. MSG_PRIORITY_LOW)
+ * @param stats Output: occupancy, high water, accepted and dropped
+ * @return System error code
+ */
+SystemError_t comm_get_uart_tx_stats(uint8_t priority,
+                                     CommTxLaneStats_t *stats);
+
 /**
  * @brief Process UART ASCII command
  * @param command_string ASCII command string
@@ -314,6 +389,14 @@ SystemError_t debug_uart_init(UART_HandleTypeDef *huart);
  */
 void comm_uart_rx_complete_callback(UART_HandleTypeDef *huart);
 
+/**
+ * @brief Process UART RX event callback (idle line, half or full transfer)
+ * @param huart UART handle
+ * @param position DMA write index (Size of HAL_UARTEx_RxEventCallback)
+ */
+void comm_uart_rx_event_callback(UART_HandleTypeDef *huart,
+                                 uint16_t position);
+
 /**
  * @brief Process UART TX complete callback
  * @param huart UART handle
@@ -326,6 +409,25 @@ void comm_uart_tx_complete_callback(UART_HandleTypeDef *huart);
  */
 void comm_uart_error_callback(UART_HandleTypeDef *huart);
 
+/**
+ * @brief Apply a validated MOTOR_CMD_BATCH, if one is pending
+ * @note Called by the control task once per tick, before the motion
+ *       profiles are stepped. Only profile state is touched, no bus I/O;
+ *       the result is reported by comm_protocol_task.
+ */
+void comm_apply_pending_batch(void);
+
+/**
+ * @brief Drop a MOTOR_CMD_BATCH that is staged but not yet applied
+ * @details A pending batch (in particular one waiting for its synchronised
+ *          start) would otherwise still run after a stop. It is reported
+ *          as ERROR_MOTOR_MOVE_ABORTED. A batch already being applied is
+ *          left alone; the stop that follows overrides it.
+ * @note Safe from any task; called on STOP, EMERGENCY_STOP, coordinated
+ *       stop and the safety system's emergency stop.
+ */
+void comm_cancel_pending_batch(void);
+
 /* ==========================================================================
  */
 /* CAN Protocol Functions                                                    */
@@ -343,10 +445,41 @@ SystemError_t comm_can_send_motor_command(uint8_t motor_id,
 
 /**
  * @brief Process received CAN message
- * @param hcan CAN handle
+ * @param hfdcan FDCAN handle
+ * @note Call from HAL_FDCAN_RxFifo0Callback. Frames are queued by route
+ *       (comm_can_rx.h) and handled by comm_protocol_task.
  */
 void comm_can_rx_callback(FDCAN_HandleTypeDef *hfdcan);
 
+/**
+ * @brief Process CAN transmit complete
+ * @param hfdcan FDCAN handle
+ * @param buffer_indexes Completed TX buffers
+ * @note Call from HAL_FDCAN_TxBufferCompleteCallback. Times the SYNC
+ *       frames of the CAN time sync master.
+ */
+void comm_can_tx_complete_callback(FDCAN_HandleTypeDef *hfdcan,
+                                   uint32_t buffer_indexes);
+
+/**
+ * @brief Get the synchronised microsecond timebase
+ * @details The time sync master's HAL_Abstraction_GetMicroseconds tick,
+ *          as estimated on this node from CAN_ID_TIME_SYNC broadcasts
+ *          (comm_can_time_sync.h). On the master it is its own tick.
+ * @param sync_us Synchronised time
+ * @return false until CAN is up and the timebase is locked
+ */
+bool comm_can_get_sync_microseconds(uint32_t *sync_us);
+
+/**
+ * @brief Set the CAN-FD telemetry publication rate
+ * @param rate_hz Publications per second (1..CAN_TELEMETRY_MAX_RATE_HZ)
+ * @return System error code
+ * @note Publications are made by comm_protocol_task, which must run at
+ *       least this often.
+ */
+SystemError_t comm_can_set_telemetry_rate(uint32_t rate_hz);
+
 /* ==========================================================================
  */
 /* Safety Integration Macros                                                 */
@@ -393,11 +526,10 @@ void comm_can_rx_callback(FDCAN_HandleTypeDef *hfdcan);
 
 /* Local buffer sizing derived from SSOT values. These are safe compile-time
  * calculations and document whether they are runtime-changeable.
- * - UART_TX_BUFFER_SIZE: static buffer -> requires rebuild to change size
+ * - UART_TX_BUFFER_SIZE (comm_config.h): TX queue slot -> requires rebuild
  * - ASCII_COMMAND_MAX_LENGTH: small command buffer -> can be overridden
  *   at runtime if the receiver supports dynamic allocation (not used here).
  */
-#define UART_TX_BUFFER_SIZE ((size_t)512U)
 #define ASCII_COMMAND_MAX_LENGTH ((size_t)128U)
 
 // ASCII command delimiters
@@ -0,0 +1,188 @@
+/**
+ * @file comm_rx_ring.c
+ * @brief Circular-DMA receive ring with in-place line extraction
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_rx_ring.h"
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Attach a ring to its DMA buffer
+ */
+SystemError_t comm_rx_ring_init(CommRxRing_t *ring, uint8_t *buffer,
+                                uint16_t size) {
+    if (ring == NULL || buffer == NULL || size == 0 ||
+        (size & (size - 1U)) != 0) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    memset(ring, 0, sizeof(*ring));
+    ring->buffer = buffer;
+    ring->size = size;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Record the DMA write index (idle, half or full transfer event)
+ */
+void comm_rx_ring_dma_event(CommRxRing_t *ring, uint16_t dma_position) {
+    uint16_t mask = (uint16_t)(ring->size - 1U);
+    uint16_t position = dma_position & mask;
+
+    // Events come at least every half buffer, so this is the whole delta
+    ring->head += (uint16_t)(position - ring->dma_position) & mask;
+    ring->dma_position = position;
+}
+
+/**
+ * @brief Account for the DMA being restarted at index 0
+ */
+void comm_rx_ring_dma_restart(CommRxRing_t *ring) {
+    // The DMA now writes at index 0: continue the byte count at the next
+    // buffer lap and let the consumer drop what was left unread
+    uint32_t head = ring->head;
+    ring->resync_head = head;
+    ring->resync = true;
+    if ((head & (ring->size - 1U)) != 0) {
+        ring->head = (head | (ring->size - 1U)) + 1U;
+    }
+    ring->dma_position = 0;
+}
+
+/**
+ * @brief Bytes waiting to be consumed
+ */
+uint32_t comm_rx_ring_available(CommRxRing_t *ring) {
+    if (ring->resync) {
+        ring->resync = false;
+        uint32_t received = ring->resync_head;
+        if (received != ring->tail) {
+            ring->discarded += received - ring->tail;
+            ring->discarding = true; // Never act on a line fragment
+        }
+        ring->tail = ((received & (ring->size - 1U)) != 0)
+                         ? (received | (ring->size - 1U)) + 1U
+                         : received;
+        ring->scan = ring->tail;
+        ring->held = 0;
+    }
+
+    uint32_t head = ring->head;
+    uint32_t pending = head - ring->tail;
+
+    if (pending >= ring->size) {
+        // Lapped: the oldest bytes were overwritten while unread
+        ring->overruns++;
+        ring->discarded += pending;
+        ring->tail = head;
+        ring->scan = head;
+        ring->held = 0;
+        ring->discarding = true;
+        return 0;
+    }
+
+    return pending;
+}
+
+/**
+ * @brief Contiguous readable span starting at the tail
+ */
+uint32_t comm_rx_ring_contiguous(CommRxRing_t *ring, const uint8_t **data) {
+    uint32_t pending = comm_rx_ring_available(ring);
+    uint32_t index = ring->tail & (ring->size - 1U);
+    uint32_t to_end = ring->size - index;
+
+    *data = &ring->buffer[index];
+    return (pending < to_end) ? pending : to_end;
+}
+
+/**
+ * @brief Byte at an offset from the tail (offset < available)
+ */
+uint8_t comm_rx_ring_peek(const CommRxRing_t *ring, uint32_t offset) {
+    return ring->buffer[(ring->tail + offset) & (ring->size - 1U)];
+}
+
+/**
+ * @brief Release consumed bytes back to the DMA
+ */
+void comm_rx_ring_consume(CommRxRing_t *ring, uint32_t count) {
+    ring->tail += count;
+    if ((int32_t)(ring->scan - ring->tail) < 0) {
+        ring->scan = ring->tail;
+    }
+}
+
+/**
+ * @brief Take the next complete '\r' or '\n' terminated line
+ */
+uint32_t comm_rx_ring_next_line(CommRxRing_t *ring, char *scratch,
+                                uint32_t scratch_size, const char **line) {
+    const uint32_t mask = ring->size - 1U;
+
+    // The previous line has been processed: hand its bytes back to the DMA
+    comm_rx_ring_consume(ring, ring->held);
+    ring->held = 0;
+
+    for (;;) {
+        uint32_t pending = comm_rx_ring_available(ring);
+        uint32_t length = ring->scan - ring->tail;
+
+        // Resume the search where the previous call stopped
+        while (length < pending) {
+            uint8_t byte = ring->buffer[(ring->tail + length) & mask];
+            if (byte == '\r' || byte == '\n') {
+                break;
+            }
+            length++;
+        }
+        ring->scan = ring->tail + length;
+
+        if (length == pending) {
+            if (ring->discarding || length >= scratch_size) {
+                // Overlong line: drop it up to its delimiter
+                ring->discarded += length;
+                ring->discarding = true;
+                comm_rx_ring_consume(ring, length);
+            }
+            return 0;
+        }
+
+        if (ring->discarding || length >= scratch_size) {
+            ring->discarded += length + 1U;
+            ring->discarding = false;
+            comm_rx_ring_consume(ring, length + 1U);
+            continue;
+        }
+        if (length == 0) {
+            comm_rx_ring_consume(ring, 1U); // Empty line
+            continue;
+        }
+
+        uint32_t start = ring->tail & mask;
+        if (start + length < ring->size) {
+            // Terminate in place over the delimiter
+            ring->buffer[start + length] = '\0';
+            *line = (const char *)&ring->buffer[start];
+        } else {
+            // Straddles the buffer end: the only case that is copied
+            uint32_t first = ring->size - start;
+            memcpy(scratch, &ring->buffer[start], first);
+            memcpy(scratch + first, ring->buffer, length - first);
+            scratch[length] = '\0';
+            *line = scratch;
+        }
+
+        ring->held = length + 1U;
+        return length;
+    }
+}
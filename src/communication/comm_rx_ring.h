@@ -0,0 +1,116 @@
+/**
+ * @file comm_rx_ring.h
+ * @brief Circular-DMA receive ring with in-place line extraction
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details The UART DMA stream runs in circular mode over the ring buffer
+ *          and never stops. Idle-line, half-transfer and transfer-complete
+ *          events report the DMA write index; the ring turns those into a
+ *          free-running head count, the comm task consumes from the tail.
+ *          With an event at least every half buffer no lap can be missed,
+ *          so received bytes are visible at the next idle line regardless
+ *          of how full the buffer is.
+ *
+ *          Lines are handed out in place: the delimiter is replaced by a
+ *          terminator inside the ring, so only a line that straddles the
+ *          end of the buffer is copied into the caller's scratch buffer.
+ *
+ * @note The buffer must be DMA-accessible and non-cacheable (or cache
+ *       maintained by the caller), as for any DMA receive buffer.
+ */
+
+#ifndef COMM_RX_RING_H
+#define COMM_RX_RING_H
+
+#include "common/error_codes.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @brief Receive ring state
+ * @details head is written from the DMA event ISR, tail and scan by the
+ *          consumer only.
+ */
+typedef struct {
+    uint8_t *buffer;               ///< DMA target buffer
+    uint16_t size;                 ///< Buffer size (power of two)
+    uint16_t dma_position;         ///< Last DMA write index (ISR)
+    volatile uint32_t head;        ///< Bytes received, free-running (ISR)
+    uint32_t tail;                 ///< Bytes consumed, free-running
+    uint32_t scan;                 ///< Bytes searched for a delimiter
+    uint32_t held;                 ///< Bytes of the line handed out last
+    bool discarding;               ///< Dropping an overlong line
+    volatile bool resync;          ///< DMA restarted; drop data before it
+    volatile uint32_t resync_head; ///< Bytes received before restart
+    uint32_t overruns;             ///< Times the DMA lapped the consumer
+    uint32_t discarded;            ///< Bytes dropped (overrun, overlong)
+} CommRxRing_t;
+
+/**
+ * @brief Attach a ring to its DMA buffer
+ * @param ring Ring state
+ * @param buffer Circular DMA buffer
+ * @param size Buffer size; must be a power of two
+ * @return ERROR_INVALID_PARAMETER for a bad buffer or size
+ */
+SystemError_t comm_rx_ring_init(CommRxRing_t *ring, uint8_t *buffer,
+                                uint16_t size);
+
+/**
+ * @brief Record the DMA write index (idle, half or full transfer event)
+ * @param ring Ring state
+ * @param dma_position Index the DMA writes next (size - NDTR); the
+ *        buffer size itself is accepted for transfer complete
+ * @note ISR context.
+ */
+void comm_rx_ring_dma_event(CommRxRing_t *ring, uint16_t dma_position);
+
+/**
+ * @brief Account for the DMA being restarted at index 0
+ * @param ring Ring state
+ * @note ISR context; unread bytes from before the restart are dropped.
+ */
+void comm_rx_ring_dma_restart(CommRxRing_t *ring);
+
+/**
+ * @brief Bytes waiting to be consumed
+ * @details Detects an overrun (the DMA lapped the consumer) and drops
+ *          everything received so far when it happens.
+ */
+uint32_t comm_rx_ring_available(CommRxRing_t *ring);
+
+/**
+ * @brief Contiguous readable span starting at the tail
+ * @param ring Ring state
+ * @param data Output: pointer to the first unread byte
+ * @return Span length; the rest of the data follows at the buffer start
+ */
+uint32_t comm_rx_ring_contiguous(CommRxRing_t *ring, const uint8_t **data);
+
+/**
+ * @brief Byte at an offset from the tail (offset < available)
+ */
+uint8_t comm_rx_ring_peek(const CommRxRing_t *ring, uint32_t offset);
+
+/**
+ * @brief Release consumed bytes back to the DMA
+ * @param ring Ring state
+ * @param count Bytes to release (<= available)
+ */
+void comm_rx_ring_consume(CommRxRing_t *ring, uint32_t count);
+
+/**
+ * @brief Take the next complete '\r' or '\n' terminated line
+ * @param ring Ring state
+ * @param scratch Buffer for a line that wraps the ring end
+ * @param scratch_size Scratch size; longer lines are discarded
+ * @param line Output: NUL-terminated line, valid until the next call;
+ *        its bytes stay reserved in the ring until then
+ * @return Line length, or 0 if no complete line is buffered
+ * @note Empty lines (e.g. the '\n' of "\r\n") are skipped.
+ */
+uint32_t comm_rx_ring_next_line(CommRxRing_t *ring, char *scratch,
+                                uint32_t scratch_size, const char **line);
+
+#endif // COMM_RX_RING_H
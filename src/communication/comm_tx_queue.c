@@ -0,0 +1,216 @@
+/**
+ * @file comm_tx_queue.c
+ * @brief Lock-free prioritised transmit queue feeding a DMA stream
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "comm_tx_queue.h"
+#include <stddef.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static CommTxSlot_t *next_ready(CommTxQueue_t *queue, uint8_t *lane);
+static void start_next(CommTxQueue_t *queue);
+static void release(CommTxQueue_t *queue, uint8_t lane);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Reset a queue
+ */
+SystemError_t comm_tx_queue_init(CommTxQueue_t *queue, CommTxStart_t start,
+                                 void *context) {
+    if (queue == NULL || start == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    memset(queue, 0, sizeof(*queue));
+    queue->start = start;
+    queue->context = context;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Claim a slot to build a message in place
+ */
+CommTxSlot_t *comm_tx_queue_claim(CommTxQueue_t *queue, uint8_t priority,
+                                  uint16_t length) {
+    if (length == 0 || length > COMM_TX_SLOT_SIZE) {
+        __atomic_fetch_add(&queue->oversized, 1U, __ATOMIC_RELAXED);
+        return NULL;
+    }
+    if (priority >= COMM_TX_QUEUE_LANES) {
+        priority = COMM_TX_QUEUE_LANES - 1;
+    }
+
+    CommTxLane_t *lane = &queue->lanes[priority];
+    uint32_t claimed = __atomic_load_n(&lane->claimed, __ATOMIC_RELAXED);
+    uint32_t in_use;
+    do {
+        in_use = claimed - __atomic_load_n(&lane->sent, __ATOMIC_ACQUIRE);
+        if (in_use >= COMM_TX_QUEUE_DEPTH) {
+            __atomic_fetch_add(&lane->dropped, 1U, __ATOMIC_RELAXED);
+            return NULL;
+        }
+    } while (!__atomic_compare_exchange_n(&lane->claimed, &claimed,
+                                          claimed + 1U, true,
+                                          __ATOMIC_ACQUIRE, __ATOMIC_RELAXED));
+
+    uint32_t high_water = __atomic_load_n(&lane->high_water, __ATOMIC_RELAXED);
+    while (in_use + 1U > high_water &&
+           !__atomic_compare_exchange_n(&lane->high_water, &high_water,
+                                        in_use + 1U, true, __ATOMIC_RELAXED,
+                                        __ATOMIC_RELAXED)) {
+    }
+
+    CommTxSlot_t *slot = &lane->slots[claimed & (COMM_TX_QUEUE_DEPTH - 1U)];
+    slot->lane = priority;
+    slot->length = length;
+    return slot;
+}
+
+/**
+ * @brief Hand a filled slot to the transmitter
+ */
+void comm_tx_queue_commit(CommTxQueue_t *queue, CommTxSlot_t *slot) {
+    // The slot contents must be visible before the transmitter sees it
+    __atomic_store_n(&slot->ready, true, __ATOMIC_RELEASE);
+
+    __atomic_fetch_add(&queue->lanes[slot->lane].committed, 1U,
+                       __ATOMIC_RELAXED);
+
+    start_next(queue);
+}
+
+/**
+ * @brief Copy a message into the queue
+ */
+SystemError_t comm_tx_queue_push(CommTxQueue_t *queue, uint8_t priority,
+                                 const uint8_t *data, uint16_t length) {
+    if (queue == NULL || data == NULL || length == 0) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    CommTxSlot_t *slot = comm_tx_queue_claim(queue, priority, length);
+    if (slot == NULL) {
+        return (length > COMM_TX_SLOT_SIZE) ? ERROR_COMM_MESSAGE_TOO_LARGE
+                                            : ERROR_COMM_BUSY;
+    }
+
+    memcpy(slot->data, data, length);
+    comm_tx_queue_commit(queue, slot);
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Release the slot just transmitted and start the next one
+ */
+void comm_tx_queue_dma_complete(CommTxQueue_t *queue) {
+    if (__atomic_load_n(&queue->busy, __ATOMIC_ACQUIRE) == 0) {
+        return; // Nothing in flight (spurious or abort while idle)
+    }
+
+    release(queue, queue->active_lane);
+    __atomic_store_n(&queue->busy, 0, __ATOMIC_RELEASE);
+    start_next(queue);
+}
+
+/**
+ * @brief Read a lane's counters
+ */
+SystemError_t comm_tx_queue_get_stats(const CommTxQueue_t *queue,
+                                      uint8_t lane, CommTxLaneStats_t *stats) {
+    if (queue == NULL || stats == NULL || lane >= COMM_TX_QUEUE_LANES) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    const CommTxLane_t *entry = &queue->lanes[lane];
+    stats->occupancy = __atomic_load_n(&entry->claimed, __ATOMIC_RELAXED) -
+                       __atomic_load_n(&entry->sent, __ATOMIC_RELAXED);
+    stats->high_water = __atomic_load_n(&entry->high_water, __ATOMIC_RELAXED);
+    stats->committed = __atomic_load_n(&entry->committed, __ATOMIC_RELAXED);
+    stats->dropped = __atomic_load_n(&entry->dropped, __ATOMIC_RELAXED);
+
+    return SYSTEM_OK;
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Oldest committed slot of the most urgent lane
+ */
+static CommTxSlot_t *next_ready(CommTxQueue_t *queue, uint8_t *lane) {
+    for (uint8_t i = 0; i < COMM_TX_QUEUE_LANES; i++) {
+        CommTxLane_t *entry = &queue->lanes[i];
+        CommTxSlot_t *slot =
+            &entry->slots[entry->sent & (COMM_TX_QUEUE_DEPTH - 1U)];
+        if (__atomic_load_n(&slot->ready, __ATOMIC_ACQUIRE)) {
+            *lane = i;
+            return slot;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Start the next transfer if the transmitter is idle
+ * @details Ownership of the transmitter is a flag taken with a CAS, so
+ *          concurrent callers cannot start two transfers. A producer that
+ *          commits while the owner is giving the transmitter up would be
+ *          missed, hence the check after releasing it.
+ */
+static void start_next(CommTxQueue_t *queue) {
+    uint8_t lane;
+
+    for (;;) {
+        uint8_t idle = 0;
+        if (!__atomic_compare_exchange_n(&queue->busy, &idle, 1, false,
+                                         __ATOMIC_ACQUIRE,
+                                         __ATOMIC_RELAXED)) {
+            return; // Transfer in flight; its completion continues
+        }
+
+        CommTxSlot_t *slot = next_ready(queue, &lane);
+        if (slot != NULL) {
+            queue->active_lane = lane;
+            if (queue->start(queue->context, slot->data, slot->length) ==
+                SYSTEM_OK) {
+                return;
+            }
+            queue->start_errors++;
+            release(queue, lane);
+        }
+
+        __atomic_store_n(&queue->busy, 0, __ATOMIC_RELEASE);
+        if (slot == NULL && next_ready(queue, &lane) == NULL) {
+            return;
+        }
+    }
+}
+
+/**
+ * @brief Return the oldest slot of a lane to the producers
+ */
+static void release(CommTxQueue_t *queue, uint8_t lane) {
+    CommTxLane_t *entry = &queue->lanes[lane];
+    CommTxSlot_t *slot =
+        &entry->slots[entry->sent & (COMM_TX_QUEUE_DEPTH - 1U)];
+
+    __atomic_store_n(&slot->ready, false, __ATOMIC_RELAXED);
+    __atomic_store_n(&entry->sent, entry->sent + 1U, __ATOMIC_RELEASE);
+}
@@ -0,0 +1,151 @@
+/**
+ * @file comm_tx_queue.h
+ * @brief Lock-free prioritised transmit queue feeding a DMA stream
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details One lane per message priority (MSG_PRIORITY_EMERGENCY ..
+ *          MSG_PRIORITY_LOW), each a ring of fixed-size slots. Producers in
+ *          any context claim a slot with a compare-and-swap, fill it in
+ *          place and commit it; no lock is taken and no interrupt is
+ *          masked. A single transfer is in flight at a time: whoever
+ *          finds the transmitter idle (a committing producer or the DMA
+ *          complete interrupt) starts the oldest committed slot of the
+ *          most urgent lane, so queued messages go out back to back and an
+ *          emergency message never waits behind more than the transfer
+ *          already on the wire.
+ *
+ *          A lane is FIFO: a claimed but uncommitted slot holds back the
+ *          slots claimed after it in the same lane, never other lanes.
+ *
+ * @note Slots are the DMA source: the queue must be DMA-accessible and
+ *       non-cacheable (or cache maintained by the start function), as for
+ *       any DMA transmit buffer.
+ */
+
+#ifndef COMM_TX_QUEUE_H
+#define COMM_TX_QUEUE_H
+
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#define COMM_TX_QUEUE_LANES (MSG_PRIORITY_LOW + 1)
+#define COMM_TX_QUEUE_DEPTH UART_TX_QUEUE_DEPTH
+#define COMM_TX_SLOT_SIZE UART_TX_BUFFER_SIZE
+
+#if (COMM_TX_QUEUE_DEPTH & (COMM_TX_QUEUE_DEPTH - 1)) != 0
+#error "UART_TX_QUEUE_DEPTH must be a power of two"
+#endif
+
+/**
+ * @brief Start transmitting one slot
+ * @return SYSTEM_OK if the transfer was started; comm_tx_queue_dma_complete
+ *         must then be called when it ends
+ */
+typedef SystemError_t (*CommTxStart_t)(void *context, const uint8_t *data,
+                                       uint16_t length);
+
+/**
+ * @brief One queued message
+ */
+typedef struct {
+    volatile bool ready;             ///< Committed, may be transmitted
+    uint8_t lane;                    ///< Owning lane
+    uint16_t length;                 ///< Bytes to transmit
+    uint8_t data[COMM_TX_SLOT_SIZE]; ///< Message bytes (DMA source)
+} CommTxSlot_t;
+
+/**
+ * @brief One priority lane
+ * @details claimed is advanced by producers (CAS), sent by the transmitter
+ *          only; both are free-running.
+ */
+typedef struct {
+    CommTxSlot_t slots[COMM_TX_QUEUE_DEPTH];
+    uint32_t claimed;    ///< Slots handed to producers
+    uint32_t sent;       ///< Slots transmitted (or failed to start)
+    uint32_t committed;  ///< Messages accepted
+    uint32_t dropped;    ///< Messages refused: lane full
+    uint32_t high_water; ///< Most slots in use at once
+} CommTxLane_t;
+
+/**
+ * @brief Lane counters snapshot
+ */
+typedef struct {
+    uint32_t occupancy;  ///< Slots in use (claimed, not yet transmitted)
+    uint32_t high_water; ///< Most slots in use at once
+    uint32_t committed;  ///< Messages accepted
+    uint32_t dropped;    ///< Messages refused: lane full
+} CommTxLaneStats_t;
+
+/**
+ * @brief Transmit queue state
+ */
+typedef struct {
+    CommTxLane_t lanes[COMM_TX_QUEUE_LANES];
+    CommTxStart_t start;   ///< Starts a DMA transfer
+    void *context;         ///< Passed to start
+    uint8_t busy;          ///< Transmitter owned (transfer in flight)
+    uint8_t active_lane;   ///< Lane of the transfer in flight
+    uint32_t oversized;    ///< Messages refused: larger than a slot
+    uint32_t start_errors; ///< Transfers that failed to start
+} CommTxQueue_t;
+
+/**
+ * @brief Reset a queue
+ * @param queue Queue state
+ * @param start Transfer start function
+ * @param context Passed to start
+ * @return ERROR_INVALID_PARAMETER for a NULL queue or start function
+ */
+SystemError_t comm_tx_queue_init(CommTxQueue_t *queue, CommTxStart_t start,
+                                 void *context);
+
+/**
+ * @brief Claim a slot to build a message in place
+ * @param queue Queue state
+ * @param priority Message priority; values past MSG_PRIORITY_LOW use the
+ *        low priority lane
+ * @param length Message length, at most COMM_TX_SLOT_SIZE
+ * @return Slot to fill and pass to comm_tx_queue_commit, or NULL if the
+ *         lane is full or the message too long (counted)
+ * @note Any context, including interrupts.
+ */
+CommTxSlot_t *comm_tx_queue_claim(CommTxQueue_t *queue, uint8_t priority,
+                                  uint16_t length);
+
+/**
+ * @brief Hand a filled slot to the transmitter
+ * @details Starts the transmitter if it is idle.
+ * @note Any context, including interrupts.
+ */
+void comm_tx_queue_commit(CommTxQueue_t *queue, CommTxSlot_t *slot);
+
+/**
+ * @brief Copy a message into the queue
+ * @return ERROR_COMM_BUSY if the lane is full, ERROR_COMM_MESSAGE_TOO_LARGE
+ *         if the message does not fit a slot
+ */
+SystemError_t comm_tx_queue_push(CommTxQueue_t *queue, uint8_t priority,
+                                 const uint8_t *data, uint16_t length);
+
+/**
+ * @brief Release the slot just transmitted and start the next one
+ * @note DMA transmit complete (or transmit abort) interrupt.
+ */
+void comm_tx_queue_dma_complete(CommTxQueue_t *queue);
+
+/**
+ * @brief Read a lane's counters
+ * @param queue Queue state
+ * @param lane Lane (message priority)
+ * @param stats Output counters
+ * @return ERROR_INVALID_PARAMETER for a bad lane
+ */
+SystemError_t comm_tx_queue_get_stats(const CommTxQueue_t *queue,
+                                      uint8_t lane, CommTxLaneStats_t *stats);
+
+#endif // COMM_TX_QUEUE_H
@@ -0,0 +1,72 @@
+/**
+ * @file crc16.h
+ * @brief CRC16 engine for protocol frames and telemetry data
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details CRC-16/MODBUS: reflected polynomial CRC16_POLYNOMIAL, initial
+ *          value CRC16_INIT_VALUE, no final XOR (check value 0x4B37 for
+ *          "123456789"). The software path is slice-by-8, with eight
+ *          256-entry tables in flash (4 KB), so eight bytes cost eight
+ *          table lookups and no bit loop. Define CRC16_SLICE_BY as 4 to
+ *          halve the tables' share of the cache.
+ *
+ *          With CRC16_USE_HW_CRC set, long buffers go to the STM32 CRC
+ *          peripheral through the HAL abstraction. The peripheral has a
+ *          single state, so the hardware path must only be used from task
+ *          context; ISRs can always call the software path,
+ *          crc16_update_sw().
+ *
+ *          Incremental use:
+ *          @code
+ *          uint16_t crc = crc16_init();
+ *          crc = crc16_update(crc, part1, len1);
+ *          crc = crc16_update(crc, part2, len2);
+ *          crc = crc16_final(crc);
+ *          @endcode
+ */
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#include "config/comm_config.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef CRC16_SLICE_BY
+#define CRC16_SLICE_BY 8
+#endif
+
+/**
+ * @brief Start an incremental CRC
+ * @return Initial running CRC
+ */
+uint16_t crc16_init(void);
+
+/**
+ * @brief Fold data into a running CRC
+ * @param crc Running CRC (from crc16_init or a previous update)
+ * @param data Data bytes
+ * @param length Number of bytes
+ * @return Updated running CRC
+ */
+uint16_t crc16_update(uint16_t crc, const uint8_t *data, size_t length);
+
+/**
+ * @brief Fold data into a running CRC in software only (ISR safe)
+ */
+uint16_t crc16_update_sw(uint16_t crc, const uint8_t *data, size_t length);
+
+/**
+ * @brief Finish an incremental CRC
+ * @details No final XOR for CRC-16/MODBUS; kept so callers do not depend
+ *          on the variant.
+ */
+uint16_t crc16_final(uint16_t crc);
+
+/**
+ * @brief CRC of a single buffer
+ */
+uint16_t crc16_compute(const uint8_t *data, size_t length);
+
+#endif // CRC16_H
@@ -16,6 +16,7 @@
 #ifndef BUILD_CONFIG_H
 #define BUILD_CONFIG_H
 
+#include "comm_config.h"
 #include <stdint.h>
 
 /* ==========================================================================
@@ -293,7 +294,9 @@ void assert_failed(uint8_t *file, uint32_t line);
 #error "Heap size exceeds available SRAM"
 #endif
 
-#if (UART_TX_BUFFER_SIZE + UART_RX_BUFFER_SIZE) > (8 * 1024)
+// Every TX priority lane holds UART_TX_QUEUE_DEPTH full-size slots
+#if ((MSG_PRIORITY_LOW + 1) * UART_TX_QUEUE_DEPTH * UART_TX_BUFFER_SIZE +     \
+     UART_RX_BUFFER_SIZE) > (16 * 1024)
 #error "UART buffers too large"
 #endif
 
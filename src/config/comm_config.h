@@ -30,6 +30,7 @@
 #define MAX_MESSAGE_PAYLOAD 128 // Maximum message payload size
 // Note: MAX_ETH_PAYLOAD may be defined by HAL Legacy - use different name
 #define COMM_MAX_ETH_PAYLOAD 1500 // Maximum Ethernet payload for our protocol
+#define COMM_BATCH_MAX_COMMANDS 4 // Commands in one MOTOR_CMD_BATCH message
 
 /* ==========================================================================
  */
@@ -48,8 +49,9 @@
 #define UART_MODE UART_MODE_TX_RX
 
 // UART Buffer Sizes
-#define UART_TX_BUFFER_SIZE 512
-#define UART_RX_BUFFER_SIZE 256
+#define UART_TX_BUFFER_SIZE 512  // Largest single transmit (TX slot)
+#define UART_TX_QUEUE_DEPTH 4    // Queued messages per priority lane
+#define UART_RX_BUFFER_SIZE 1024 // Circular DMA ring, power of two
 #define UART_CMD_MAX_LENGTH 64
 
 // UART Timeouts (milliseconds)
@@ -135,6 +137,17 @@
 #define CAN_ID_HEARTBEAT (CAN_ID_BASE_HEARTBEAT + CAN_NODE_ID) // 0x001
 #define CAN_ID_TIME_SYNC (CAN_ID_BASE_HEARTBEAT + 0xFF)        // 0x0FF
 
+// Packed CAN-FD telemetry, one ID per node (0x341 for node 1)
+#define CAN_ID_TELEMETRY (CAN_ID_BASE_DATA + 0x40 + CAN_NODE_ID)
+#define CAN_TELEMETRY_RATE_HZ 500      // Default publication rate
+#define CAN_TELEMETRY_MAX_RATE_HZ 1000 // One publication per control tick
+
+// Time sync on CAN_ID_TIME_SYNC: the master broadcasts SYNC + FOLLOW_UP
+#define CAN_TIME_SYNC_MASTER_NODE 0x01 // Node whose clock is the timebase
+#define CAN_TIME_SYNC_PERIOD_MS 100    // SYNC broadcast period
+#define CAN_TIME_SYNC_STEP_US 1000     // Larger offsets step the timebase
+#define CAN_TIME_SYNC_TIMEOUT_MS 1000  // Unlocked after this long unsynced
+
 // CAN Filter Configuration
 #define CAN_FILTER_COUNT 8
 #define CAN_FILTER_FIFO 0
@@ -259,6 +272,10 @@
 // CRC16 Checksum Constants (SSOT)
 #define CRC16_INIT_VALUE 0xFFFF // Initial CRC value
 #define CRC16_POLYNOMIAL 0xA001 // CRC-16-ANSI polynomial
+#ifndef CRC16_USE_HW_CRC
+#define CRC16_USE_HW_CRC 0 // 1: STM32 CRC peripheral for long buffers
+#endif
+#define CRC16_HW_MIN_LENGTH 64 // Shorter buffers stay in software
 #define INVALID_DEVICE_ID 0xFF  // Invalid/broadcast device ID
 
 #define MSG_CHECKSUM_POLY 0x1D // CRC polynomial
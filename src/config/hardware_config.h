@@ -137,6 +137,8 @@
 #define MOTOR_BUSY_PORT GPIOB     // L6470 BUSY pin port (operation status)
 #define MOTOR_BUSY_PIN                                                        \
     GPIO_PIN_3 // L6470 BUSY pin (high when executing command)
+#define MOTOR_SPI_CS_PORT GPIOD      // L6470 chain chip select (Arduino D10)
+#define MOTOR_SPI_CS_PIN GPIO_PIN_14 // Raised between daisy-chain byte slots
 
 // ============================================================================
 // AS5600 Magnetic Encoder Configuration
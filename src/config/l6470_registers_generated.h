@@ -2,7 +2,7 @@
  * @file l6470_registers_generated.h
  * @brief L6470 Register Definitions - Auto-Generated from Schema
  * @version 1.0
- * @date 2025-08-21 17:10:37
+ * @date 2026-10-15 21:33:43
  *
  * ⚠️  WARNING: AUTO-GENERATED FILE - DO NOT EDIT MANUALLY
  * This file is generated from YAML schema definitions.
@@ -206,6 +206,102 @@
 #define L6470_MAX_SPEED_SAFE_DEFAULT    0x0041
 #define L6470_KVAL_RUN_SAFE_DEFAULT    0x0029
 
+/* ========================================================================== */
+/* Fixed-Point Unit Conversions                                              */
+/* ========================================================================== */
+/* value = round(x * ENC_NUM / ENC_DEN), x = round(value * ENC_DEN / ENC_NUM) */
+/* tick = 4000000 Hz, host units scaled by 1000 */
+
+/* SPEED: msteps/s <-> value * 2^-28 / tick */
+#define L6470_SPEED_ENC_NUM    131072ULL
+#define L6470_SPEED_ENC_DEN    1953125ULL
+
+/** @brief msteps/s to SPEED register value (saturates at the mask) */
+static inline uint32_t l6470_speed_encode(uint32_t x) {
+    uint64_t value = ((uint64_t)x * L6470_SPEED_ENC_NUM + L6470_SPEED_ENC_DEN / 2U) /
+                     L6470_SPEED_ENC_DEN;
+    return (value > L6470_SPEED_MASK) ? L6470_SPEED_MASK : (uint32_t)value;
+}
+
+/** @brief SPEED register value to msteps/s */
+static inline uint32_t l6470_speed_decode(uint32_t value) {
+    return (uint32_t)(((uint64_t)(value & L6470_SPEED_MASK) * L6470_SPEED_ENC_DEN +
+                       L6470_SPEED_ENC_NUM / 2U) /
+                      L6470_SPEED_ENC_NUM);
+}
+
+/* ACC: msteps/s^2 <-> value * 2^-40 / tick^2 */
+#define L6470_ACC_ENC_NUM    2097152ULL
+#define L6470_ACC_ENC_DEN    30517578125ULL
+
+/** @brief msteps/s^2 to ACC register value (saturates at the mask) */
+static inline uint32_t l6470_acc_encode(uint32_t x) {
+    uint64_t value = ((uint64_t)x * L6470_ACC_ENC_NUM + L6470_ACC_ENC_DEN / 2U) /
+                     L6470_ACC_ENC_DEN;
+    return (value > L6470_ACC_MASK) ? L6470_ACC_MASK : (uint32_t)value;
+}
+
+/** @brief ACC register value to msteps/s^2 */
+static inline uint32_t l6470_acc_decode(uint32_t value) {
+    return (uint32_t)(((uint64_t)(value & L6470_ACC_MASK) * L6470_ACC_ENC_DEN +
+                       L6470_ACC_ENC_NUM / 2U) /
+                      L6470_ACC_ENC_NUM);
+}
+
+/* DEC: msteps/s^2 <-> value * 2^-40 / tick^2 */
+#define L6470_DEC_ENC_NUM    2097152ULL
+#define L6470_DEC_ENC_DEN    30517578125ULL
+
+/** @brief msteps/s^2 to DEC register value (saturates at the mask) */
+static inline uint32_t l6470_dec_encode(uint32_t x) {
+    uint64_t value = ((uint64_t)x * L6470_DEC_ENC_NUM + L6470_DEC_ENC_DEN / 2U) /
+                     L6470_DEC_ENC_DEN;
+    return (value > L6470_DEC_MASK) ? L6470_DEC_MASK : (uint32_t)value;
+}
+
+/** @brief DEC register value to msteps/s^2 */
+static inline uint32_t l6470_dec_decode(uint32_t value) {
+    return (uint32_t)(((uint64_t)(value & L6470_DEC_MASK) * L6470_DEC_ENC_DEN +
+                       L6470_DEC_ENC_NUM / 2U) /
+                      L6470_DEC_ENC_NUM);
+}
+
+/* MAX_SPEED: msteps/s <-> value * 2^-18 / tick */
+#define L6470_MAX_SPEED_ENC_NUM    128ULL
+#define L6470_MAX_SPEED_ENC_DEN    1953125ULL
+
+/** @brief msteps/s to MAX_SPEED register value (saturates at the mask) */
+static inline uint32_t l6470_max_speed_encode(uint32_t x) {
+    uint64_t value = ((uint64_t)x * L6470_MAX_SPEED_ENC_NUM + L6470_MAX_SPEED_ENC_DEN / 2U) /
+                     L6470_MAX_SPEED_ENC_DEN;
+    return (value > L6470_MAX_SPEED_MASK) ? L6470_MAX_SPEED_MASK : (uint32_t)value;
+}
+
+/** @brief MAX_SPEED register value to msteps/s */
+static inline uint32_t l6470_max_speed_decode(uint32_t value) {
+    return (uint32_t)(((uint64_t)(value & L6470_MAX_SPEED_MASK) * L6470_MAX_SPEED_ENC_DEN +
+                       L6470_MAX_SPEED_ENC_NUM / 2U) /
+                      L6470_MAX_SPEED_ENC_NUM);
+}
+
+/* MIN_SPEED: msteps/s <-> value * 2^-24 / tick */
+#define L6470_MIN_SPEED_ENC_NUM    8192ULL
+#define L6470_MIN_SPEED_ENC_DEN    1953125ULL
+
+/** @brief msteps/s to MIN_SPEED register value (saturates at the mask) */
+static inline uint32_t l6470_min_speed_encode(uint32_t x) {
+    uint64_t value = ((uint64_t)x * L6470_MIN_SPEED_ENC_NUM + L6470_MIN_SPEED_ENC_DEN / 2U) /
+                     L6470_MIN_SPEED_ENC_DEN;
+    return (value > L6470_MIN_SPEED_MASK) ? L6470_MIN_SPEED_MASK : (uint32_t)value;
+}
+
+/** @brief MIN_SPEED register value to msteps/s */
+static inline uint32_t l6470_min_speed_decode(uint32_t value) {
+    return (uint32_t)(((uint64_t)(value & L6470_MIN_SPEED_MASK) * L6470_MIN_SPEED_ENC_DEN +
+                       L6470_MIN_SPEED_ENC_NUM / 2U) /
+                      L6470_MIN_SPEED_ENC_NUM);
+}
+
 /* ========================================================================== */
 /* Register Access Function Declarations                                    */
 /* ========================================================================== */
@@ -155,6 +155,9 @@
 #define MOTOR_MAX_SPEED MOTOR_MAX_SPEED_STEPS_PER_SEC
 #define MOTOR_MAX_ACCELERATION 1600
 #define MOTOR1_ACCELERATION L6470_ACC
+#define MOTOR1_DECELERATION L6470_DEC
+#define MOTOR2_ACCELERATION L6470_ACC
+#define MOTOR2_DECELERATION L6470_DEC
 
 /* ==========================================================================
  */
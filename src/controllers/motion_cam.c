@@ -0,0 +1,258 @@
+/**
+ * @file motion_cam.c
+ * @brief Electronic gearing and cam-table following for slave axes
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "motion_cam.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define CAM_ONE ((int64_t)1 << MOTION_CAM_FRAC_BITS)
+#define CAM_HALF ((int64_t)1 << (MOTION_CAM_FRAC_BITS - 1))
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static int64_t floor_div(int64_t numerator, int64_t denominator);
+static int32_t round_q16(int64_t value);
+static int32_t cam_cycle_length(const MotionCamTable_t *cam);
+static int32_t cam_stroke(const MotionCamTable_t *cam);
+static int64_t law_offset_q16(const MotionFollowLaw_t *law, int64_t master_rel,
+                              int32_t *cycle);
+static void apply_switch(MotionFollower_t *follower, int32_t master_position,
+                         int32_t boundary_cycle);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Disengage a follower
+ */
+void motion_cam_follower_init(MotionFollower_t *follower) {
+    if (follower != NULL) {
+        memset(follower, 0, sizeof(*follower));
+    }
+}
+
+/**
+ * @brief Check a follower law
+ */
+SystemError_t motion_cam_validate_law(const MotionFollowLaw_t *law) {
+    if (law == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    switch (law->mode) {
+    case MOTION_FOLLOW_GEAR:
+        if (law->gear_denominator == 0 ||
+            law->gear_denominator > MOTION_CAM_MAX_GEAR_TERM ||
+            abs(law->gear_numerator) > MOTION_CAM_MAX_GEAR_TERM) {
+            return ERROR_INVALID_PARAMETER;
+        }
+        return SYSTEM_OK;
+
+    case MOTION_FOLLOW_CAM:
+        if (law->cam == NULL || law->cam->points == NULL ||
+            law->cam->point_count < 2 || law->cam->master_spacing == 0 ||
+            (uint64_t)(law->cam->point_count - 1U) *
+                    law->cam->master_spacing >
+                (uint64_t)INT32_MAX) {
+            return ERROR_INVALID_PARAMETER;
+        }
+        return SYSTEM_OK;
+
+    case MOTION_FOLLOW_NONE:
+    default:
+        return ERROR_INVALID_PARAMETER;
+    }
+}
+
+/**
+ * @brief Engage a follower from rest
+ */
+SystemError_t motion_cam_engage(MotionFollower_t *follower,
+                                const MotionFollowLaw_t *law,
+                                int32_t master_position,
+                                int32_t slave_position) {
+    if (follower == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    SystemError_t result = motion_cam_validate_law(law);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    memset(follower, 0, sizeof(*follower));
+    follower->law = *law;
+    follower->master_origin = master_position;
+    follower->slave_origin = slave_position;
+    follower->setpoint = slave_position;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Latch a law switch for an engaged follower
+ */
+SystemError_t motion_cam_switch(MotionFollower_t *follower,
+                                const MotionFollowLaw_t *law,
+                                bool at_cycle_end) {
+    if (follower == NULL || follower->law.mode == MOTION_FOLLOW_NONE) {
+        return ERROR_INVALID_STATE;
+    }
+
+    SystemError_t result = motion_cam_validate_law(law);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    // Flag last so the evaluator never sees a half-written request
+    follower->switch_pending = false;
+    follower->pending = *law;
+    follower->pending_at_cycle =
+        at_cycle_end && follower->law.mode == MOTION_FOLLOW_CAM;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    follower->switch_pending = true;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Evaluate the slave setpoint for a master position
+ */
+int32_t motion_cam_evaluate(MotionFollower_t *follower,
+                            int32_t master_position) {
+    if (follower->law.mode == MOTION_FOLLOW_NONE) {
+        return follower->setpoint;
+    }
+
+    int32_t cycle = 0;
+    int64_t master_rel =
+        (int64_t)master_position - (int64_t)follower->master_origin;
+    int64_t offset = law_offset_q16(&follower->law, master_rel, &cycle);
+
+    if (follower->switch_pending) {
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+        if (!follower->pending_at_cycle) {
+            // Finish this tick on the old law, then re-base on its setpoint
+            follower->setpoint = follower->slave_origin + round_q16(offset);
+            apply_switch(follower, master_position, 0);
+            return follower->setpoint;
+        }
+        if (cycle != follower->last_cycle) {
+            // Crossed a cycle boundary: re-base exactly on it
+            int32_t boundary = (cycle > follower->last_cycle)
+                                   ? cycle
+                                   : follower->last_cycle;
+            apply_switch(follower, master_position, boundary);
+            master_rel =
+                (int64_t)master_position - (int64_t)follower->master_origin;
+            offset = law_offset_q16(&follower->law, master_rel, &cycle);
+        }
+    }
+
+    follower->last_cycle = cycle;
+    follower->setpoint = follower->slave_origin + round_q16(offset);
+
+    return follower->setpoint;
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Division rounding towards negative infinity
+ */
+static int64_t floor_div(int64_t numerator, int64_t denominator) {
+    int64_t quotient = numerator / denominator;
+    if ((numerator % denominator != 0) &&
+        ((numerator < 0) != (denominator < 0))) {
+        quotient--;
+    }
+    return quotient;
+}
+
+/**
+ * @brief Round a Q16 step count to whole steps (half up)
+ */
+static int32_t round_q16(int64_t value) {
+    return (int32_t)((value + CAM_HALF) >> MOTION_CAM_FRAC_BITS);
+}
+
+/**
+ * @brief Master travel of one cam cycle (steps)
+ */
+static int32_t cam_cycle_length(const MotionCamTable_t *cam) {
+    return (int32_t)((cam->point_count - 1U) * cam->master_spacing);
+}
+
+/**
+ * @brief Slave travel of one cam cycle (steps)
+ */
+static int32_t cam_stroke(const MotionCamTable_t *cam) {
+    return cam->points[cam->point_count - 1U] - cam->points[0];
+}
+
+/**
+ * @brief Slave offset from its origin for a master offset (Q16 steps)
+ * @param cycle Output: cam cycle index (0 for gears)
+ */
+static int64_t law_offset_q16(const MotionFollowLaw_t *law, int64_t master_rel,
+                              int32_t *cycle) {
+    if (law->mode == MOTION_FOLLOW_GEAR) {
+        // Exact rational ratio, no accumulated drift
+        *cycle = 0;
+        return floor_div(master_rel * law->gear_numerator * CAM_ONE,
+                         (int64_t)law->gear_denominator);
+    }
+
+    const MotionCamTable_t *cam = law->cam;
+    int64_t length = cam_cycle_length(cam);
+    int64_t cycles = floor_div(master_rel, length);
+    int64_t phase = master_rel - cycles * length;
+
+    // Uniform spacing: the segment is found by division, not search
+    uint32_t index = (uint32_t)(phase / cam->master_spacing);
+    int64_t within = phase - (int64_t)index * cam->master_spacing;
+    int64_t frac_q16 = (within * CAM_ONE) / cam->master_spacing;
+    int64_t base = cam->points[index];
+    int64_t rise = (int64_t)cam->points[index + 1U] - base;
+
+    *cycle = (int32_t)cycles;
+    return (cycles * cam_stroke(cam) + base - cam->points[0]) * CAM_ONE +
+           rise * frac_q16;
+}
+
+/**
+ * @brief Make the latched law active without a setpoint jump
+ * @param boundary_cycle Cam cycle boundary to re-base on (cycle-end
+ *        switches); immediate switches re-base on the current master
+ *        position and setpoint
+ */
+static void apply_switch(MotionFollower_t *follower, int32_t master_position,
+                         int32_t boundary_cycle) {
+    if (follower->pending_at_cycle) {
+        const MotionCamTable_t *cam = follower->law.cam;
+        follower->master_origin += boundary_cycle * cam_cycle_length(cam);
+        follower->slave_origin += boundary_cycle * cam_stroke(cam);
+    } else {
+        follower->master_origin = master_position;
+        follower->slave_origin = follower->setpoint;
+    }
+
+    follower->law = follower->pending;
+    follower->last_cycle = 0;
+    follower->switch_pending = false;
+}
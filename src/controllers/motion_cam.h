@@ -0,0 +1,127 @@
+/**
+ * @file motion_cam.h
+ * @brief Electronic gearing and cam-table following for slave axes
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details A follower maps the master position to a slave setpoint each
+ *          control tick, either through a rational gear ratio or through a
+ *          cam table of slave positions at uniform master spacing. Cam
+ *          lookup is an index computation (no search) followed by linear
+ *          interpolation in Q16 fixed point, so the setpoint is within half
+ *          a step of the ideal curve.
+ *
+ *          Gears and cams can be switched while running. A switch is
+ *          latched and applied by the evaluator, re-basing the follower so
+ *          the slave setpoint is continuous: immediately, or for cams at
+ *          the next cycle boundary of the running cam.
+ */
+
+#ifndef MOTION_CAM_H
+#define MOTION_CAM_H
+
+#include "common/error_codes.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Fixed-point fraction bits used for interpolation
+#define MOTION_CAM_FRAC_BITS 16
+
+// Largest gear numerator / denominator magnitude (keeps products in 64 bit)
+#define MOTION_CAM_MAX_GEAR_TERM 32767
+
+/**
+ * @brief Cam table: slave positions at uniform master spacing
+ * @details The table covers one master cycle of
+ *          (point_count - 1) * master_spacing steps. Following cycles
+ *          repeat it, offset by the table's stroke (last - first point), so
+ *          rolling cams and reciprocating cams (stroke 0) both work.
+ */
+typedef struct {
+    const int32_t *points;   ///< Slave positions (steps)
+    uint16_t point_count;    ///< Number of points (>= 2)
+    uint32_t master_spacing; ///< Master steps between points (> 0)
+} MotionCamTable_t;
+
+/**
+ * @brief Follower relationship
+ */
+typedef enum {
+    MOTION_FOLLOW_NONE = 0, ///< Not following
+    MOTION_FOLLOW_GEAR,     ///< slave = numerator / denominator * master
+    MOTION_FOLLOW_CAM       ///< slave = cam(master)
+} MotionFollowMode_t;
+
+/**
+ * @brief Follower law (gear ratio or cam)
+ */
+typedef struct {
+    MotionFollowMode_t mode;       ///< Relationship
+    int32_t gear_numerator;        ///< Gear ratio numerator
+    uint32_t gear_denominator;     ///< Gear ratio denominator (> 0)
+    const MotionCamTable_t *cam;   ///< Cam table (MOTION_FOLLOW_CAM)
+} MotionFollowLaw_t;
+
+/**
+ * @brief Follower state for one slave axis
+ */
+typedef struct {
+    MotionFollowLaw_t law;       ///< Active law
+    int32_t master_origin;       ///< Master position at (re)basing
+    int32_t slave_origin;        ///< Slave setpoint at (re)basing
+    int32_t last_cycle;          ///< Cam cycle of the last evaluation
+    int32_t setpoint;            ///< Last slave setpoint (steps)
+    MotionFollowLaw_t pending;   ///< Latched law switch
+    bool pending_at_cycle;       ///< Apply switch at next cam cycle
+    volatile bool switch_pending; ///< Switch latched for the evaluator
+} MotionFollower_t;
+
+/**
+ * @brief Disengage a follower
+ * @param follower Follower state
+ */
+void motion_cam_follower_init(MotionFollower_t *follower);
+
+/**
+ * @brief Check a follower law
+ * @param law Law to check
+ * @return ERROR_INVALID_PARAMETER for an out-of-range ratio or bad cam
+ */
+SystemError_t motion_cam_validate_law(const MotionFollowLaw_t *law);
+
+/**
+ * @brief Engage a follower from rest
+ * @param follower Follower state
+ * @param law Gear or cam law
+ * @param master_position Master position the law is anchored at (steps)
+ * @param slave_position Slave setpoint at that master position (steps)
+ * @return SystemError_t Operation result
+ * @note Cams are anchored at their phase 0.
+ */
+SystemError_t motion_cam_engage(MotionFollower_t *follower,
+                                const MotionFollowLaw_t *law,
+                                int32_t master_position,
+                                int32_t slave_position);
+
+/**
+ * @brief Latch a law switch for an engaged follower
+ * @param follower Follower state
+ * @param law New gear or cam law
+ * @param at_cycle_end For a running cam: wait for its next cycle boundary
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_cam_switch(MotionFollower_t *follower,
+                                const MotionFollowLaw_t *law,
+                                bool at_cycle_end);
+
+/**
+ * @brief Evaluate the slave setpoint for a master position
+ * @param follower Follower state
+ * @param master_position Master position this tick (steps)
+ * @return Slave setpoint (steps)
+ * @note Called once per control tick; applies latched switches.
+ */
+int32_t motion_cam_evaluate(MotionFollower_t *follower,
+                            int32_t master_position);
+
+#endif // MOTION_CAM_H
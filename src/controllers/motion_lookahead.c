@@ -0,0 +1,380 @@
+/**
+ * @file motion_lookahead.c
+ * @brief Look-ahead segment queue with junction velocity blending
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "motion_lookahead.h"
+#include "position_control.h"
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Variables                                                         */
+/* ==========================================================================
+ */
+
+// Segment ring; ring_head is written by the producer, ring_tail by the
+// consumer. Free-running 8-bit indices, masked on access.
+static LookaheadSegment_t ring[MOTION_LOOKAHEAD_DEPTH];
+static volatile uint8_t ring_head = 0;
+static volatile uint8_t ring_tail = 0;
+
+// Producer state: geometry of the most recently queued segment
+static int32_t queue_end[MAX_MOTORS];
+static float last_unit[MAX_MOTORS];
+static float last_max_speed = 0.0f;
+static bool has_previous = false;
+
+// Consumer state: executing segment and planner bookkeeping
+static uint8_t planned_head = 0;
+static bool executing = false;
+static float segment_distance = 0.0f;
+static float path_speed = 0.0f;
+static uint32_t completed_segments = 0;
+static uint32_t full_stops = 0;
+static volatile bool abort_pending = false;
+
+// Segment end tolerance; the remainder is carried into the next segment
+#define LOOKAHEAD_END_TOLERANCE 0.5f
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static float junction_speed(const float *prev_unit, const float *unit,
+                            float acceleration);
+static void plan_queue(uint8_t head);
+static void drop_queue(void);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Reset the queue and executor
+ */
+SystemError_t motion_lookahead_init(void) {
+    memset(ring, 0, sizeof(ring));
+    ring_head = 0;
+    ring_tail = 0;
+    memset(queue_end, 0, sizeof(queue_end));
+    memset(last_unit, 0, sizeof(last_unit));
+    last_max_speed = 0.0f;
+    has_previous = false;
+    planned_head = 0;
+    executing = false;
+    segment_distance = 0.0f;
+    path_speed = 0.0f;
+    completed_segments = 0;
+    full_stops = 0;
+    abort_pending = false;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Set the position the next queued segment starts from
+ */
+SystemError_t motion_lookahead_set_origin(const int32_t position[MAX_MOTORS]) {
+    if (position == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    if (motion_lookahead_is_active()) {
+        return ERROR_MOTION_ACTIVE;
+    }
+
+    memcpy(queue_end, position, sizeof(queue_end));
+    has_previous = false;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Queue one coordinated move (producer side)
+ */
+SystemError_t motion_lookahead_push(const CoordinatedMoveCommand_t *move) {
+    if (move == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    // The pending drop would discard this segment too
+    if (abort_pending) {
+        return ERROR_MOTION_ACTIVE;
+    }
+
+    uint8_t head = ring_head;
+    if ((uint8_t)(head - ring_tail) >= MOTION_LOOKAHEAD_DEPTH) {
+        return ERROR_BUFFER_OVERFLOW;
+    }
+
+    LookaheadSegment_t *seg = &ring[head & MOTION_LOOKAHEAD_MASK];
+    float delta[MAX_MOTORS];
+    float length_sq = 0.0f;
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        seg->start[i] = queue_end[i];
+        seg->target[i] = move->motor_targets[i].enabled
+                             ? move->motor_targets[i].target_position
+                             : queue_end[i];
+        delta[i] = (float)(seg->target[i] - seg->start[i]);
+        length_sq += delta[i] * delta[i];
+    }
+
+    if (length_sq == 0.0f) {
+        return SYSTEM_OK;
+    }
+
+    // Path limits: the tightest axis limit projected onto the direction
+    seg->length = sqrtf(length_sq);
+    seg->max_speed = FLT_MAX;
+    seg->acceleration = FLT_MAX;
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        seg->unit[i] = delta[i] / seg->length;
+        float share = fabsf(seg->unit[i]);
+        if (share == 0.0f) {
+            continue;
+        }
+
+        const MotorTarget_t *axis = &move->motor_targets[i];
+        if (axis->max_velocity == 0 || axis->acceleration == 0) {
+            return ERROR_INVALID_PARAMETER;
+        }
+        seg->max_speed =
+            fminf(seg->max_speed, (float)axis->max_velocity / share);
+        seg->acceleration =
+            fminf(seg->acceleration, (float)axis->acceleration / share);
+    }
+
+    seg->max_entry_speed = 0.0f;
+    if (has_previous) {
+        float limit = fminf(seg->max_speed, last_max_speed);
+        seg->max_entry_speed = fminf(
+            limit, junction_speed(last_unit, seg->unit, seg->acceleration));
+    }
+    seg->entry_speed = 0.0f;
+    seg->sequence_id = move->sequence_id;
+
+    memcpy(queue_end, seg->target, sizeof(queue_end));
+    memcpy(last_unit, seg->unit, sizeof(last_unit));
+    last_max_speed = seg->max_speed;
+    has_previous = true;
+
+    // Publish the slot only once it is fully written
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    ring_head = (uint8_t)(head + 1U);
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Free ring slots (producer side)
+ */
+uint8_t motion_lookahead_free_slots(void) {
+    return (uint8_t)(MOTION_LOOKAHEAD_DEPTH -
+                     (uint8_t)(ring_head - ring_tail));
+}
+
+/**
+ * @brief Whether segments are executing or queued
+ */
+bool motion_lookahead_is_active(void) {
+    return executing || ring_head != ring_tail || abort_pending;
+}
+
+/**
+ * @brief Advance the executor one tick (consumer side)
+ */
+SystemError_t motion_lookahead_update(uint32_t dt_ms,
+                                      int32_t target_pos[MAX_MOTORS],
+                                      int32_t target_vel[MAX_MOTORS]) {
+    if (target_pos == NULL || target_vel == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    if (abort_pending) {
+        drop_queue();
+        abort_pending = false;
+    }
+
+    uint8_t head = ring_head;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    if (!executing && head == ring_tail) {
+        return ERROR_INVALID_STATE;
+    }
+
+    if (head != planned_head) {
+        plan_queue(head);
+        planned_head = head;
+    }
+    if (!executing) {
+        segment_distance = 0.0f;
+        path_speed = ring[ring_tail & MOTION_LOOKAHEAD_MASK].entry_speed;
+        executing = true;
+    }
+
+    const float dt = (float)dt_ms / 1000.0f;
+    LookaheadSegment_t *seg = &ring[ring_tail & MOTION_LOOKAHEAD_MASK];
+    uint8_t next = (uint8_t)(ring_tail + 1U);
+    float exit_speed =
+        (next != head) ? ring[next & MOTION_LOOKAHEAD_MASK].entry_speed : 0.0f;
+
+    // Online trapezoid: accelerate, capped by the feed limit and by the
+    // speed from which the planned exit speed is still reachable. The
+    // braking distance is taken from where this tick will end.
+    float remaining = seg->length - segment_distance - path_speed * dt;
+    float brake_speed =
+        sqrtf(exit_speed * exit_speed +
+              2.0f * seg->acceleration * fmaxf(remaining, 0.0f));
+    float speed = fminf(path_speed + seg->acceleration * dt,
+                        fminf(seg->max_speed, brake_speed));
+
+    segment_distance += 0.5f * (path_speed + speed) * dt;
+    path_speed = speed;
+
+    if (segment_distance >= seg->length - LOOKAHEAD_END_TOLERANCE) {
+        float carry = fmaxf(segment_distance - seg->length, 0.0f);
+        completed_segments++;
+        ring_tail = next;
+
+        if (next == head) {
+            // Queue drained: land exactly on the final target
+            memcpy(target_pos, seg->target, sizeof(seg->target));
+            memset(target_vel, 0, sizeof(int32_t) * MAX_MOTORS);
+            executing = false;
+            path_speed = 0.0f;
+            full_stops++;
+            return SYSTEM_OK;
+        }
+
+        seg = &ring[next & MOTION_LOOKAHEAD_MASK];
+        segment_distance = fminf(carry, seg->length);
+        path_speed = fminf(path_speed, seg->entry_speed);
+    }
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        target_pos[i] =
+            seg->start[i] + (int32_t)lroundf(seg->unit[i] * segment_distance);
+        target_vel[i] = (int32_t)lroundf(seg->unit[i] * path_speed);
+    }
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Drop all queued segments and stop at the last setpoint
+ */
+void motion_lookahead_abort(void) {
+    // The executor owns ring_tail, so it performs the drop on its next tick
+    abort_pending = true;
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        position_control_clear_feedforward(i);
+    }
+}
+
+/**
+ * @brief Get executor status
+ */
+SystemError_t motion_lookahead_get_status(LookaheadStatus_t *status) {
+    if (status == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    status->active = motion_lookahead_is_active();
+    status->queued = (uint8_t)(ring_head - ring_tail);
+    status->sequence_id =
+        status->queued > 0
+            ? ring[ring_tail & MOTION_LOOKAHEAD_MASK].sequence_id
+            : 0;
+    status->path_speed = path_speed;
+    status->completed = completed_segments;
+    status->full_stops = full_stops;
+
+    return SYSTEM_OK;
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Junction speed limit from the junction deviation rule
+ * @details Treats the corner as an arc that stays within
+ *          MOTION_LOOKAHEAD_JUNCTION_DEVIATION of the corner point and
+ *          returns the speed at which its centripetal acceleration equals
+ *          the segment acceleration. Collinear segments are unlimited,
+ *          reversals must stop.
+ */
+static float junction_speed(const float *prev_unit, const float *unit,
+                            float acceleration) {
+    float cos_theta = 0.0f;
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        cos_theta -= prev_unit[i] * unit[i];
+    }
+
+    if (cos_theta > 0.999999f) {
+        return 0.0f;
+    }
+    if (cos_theta < -0.999999f) {
+        return FLT_MAX;
+    }
+
+    float sin_half = sqrtf(0.5f * (1.0f - cos_theta));
+    return sqrtf(acceleration * MOTION_LOOKAHEAD_JUNCTION_DEVIATION *
+                 sin_half / (1.0f - sin_half));
+}
+
+/**
+ * @brief Recompute entry speeds of all segments not yet started
+ * @details Backward pass from rest at the newest segment, then a forward
+ *          pass from the executing segment's reachable exit speed.
+ */
+static void plan_queue(uint8_t head) {
+    uint8_t first = executing ? (uint8_t)(ring_tail + 1U) : ring_tail;
+    if (first == head) {
+        return;
+    }
+
+    float next_entry = 0.0f;
+    for (uint8_t i = head; i != first;) {
+        i--;
+        LookaheadSegment_t *seg = &ring[i & MOTION_LOOKAHEAD_MASK];
+        float reachable = sqrtf(next_entry * next_entry +
+                                2.0f * seg->acceleration * seg->length);
+        seg->entry_speed = fminf(seg->max_entry_speed, reachable);
+        next_entry = seg->entry_speed;
+    }
+
+    float reachable = 0.0f;
+    if (executing) {
+        const LookaheadSegment_t *cur =
+            &ring[ring_tail & MOTION_LOOKAHEAD_MASK];
+        float remaining = fmaxf(cur->length - segment_distance, 0.0f);
+        reachable = sqrtf(path_speed * path_speed +
+                          2.0f * cur->acceleration * remaining);
+    }
+    for (uint8_t i = first; i != head; i++) {
+        LookaheadSegment_t *seg = &ring[i & MOTION_LOOKAHEAD_MASK];
+        seg->entry_speed = fminf(seg->entry_speed, reachable);
+        reachable = sqrtf(seg->entry_speed * seg->entry_speed +
+                          2.0f * seg->acceleration * seg->length);
+    }
+}
+
+/**
+ * @brief Drop every queued segment (consumer side)
+ */
+static void drop_queue(void) {
+    ring_tail = ring_head;
+    planned_head = ring_tail;
+    executing = false;
+    path_speed = 0.0f;
+    segment_distance = 0.0f;
+}
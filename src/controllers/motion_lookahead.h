@@ -0,0 +1,124 @@
+/**
+ * @file motion_lookahead.h
+ * @brief Look-ahead segment queue with junction velocity blending
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details Coordinated moves are queued as straight segments in joint
+ *          space. Each segment's path speed and acceleration are the
+ *          tightest of its axes' MotorTarget_t limits projected onto the
+ *          direction of travel. Junction speeds between consecutive
+ *          segments are bounded by the junction deviation rule, then a
+ *          backward and forward pass over the queue makes every entry
+ *          speed reachable with the segments' acceleration, so the path
+ *          only comes to rest at reversals and at the end of the queue.
+ *
+ *          The queue is a single-producer / single-consumer ring: the comm
+ *          layer (or multi_motor_execute_sequence) pushes, the 1 kHz
+ *          motion task consumes. Replanning happens on the consumer side
+ *          whenever new segments have been published.
+ */
+
+#ifndef MOTION_LOOKAHEAD_H
+#define MOTION_LOOKAHEAD_H
+
+#include "common/error_codes.h"
+#include "config/motor_config.h"
+#include "multi_motor_coordinator.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Queue depth (power of two); also the planner's look-ahead horizon
+#define MOTION_LOOKAHEAD_DEPTH 16U
+#define MOTION_LOOKAHEAD_MASK (MOTION_LOOKAHEAD_DEPTH - 1U)
+
+// Allowed deviation from the corner point when blending (steps)
+#define MOTION_LOOKAHEAD_JUNCTION_DEVIATION 8.0f
+
+/**
+ * @brief One queued straight-line segment
+ */
+typedef struct {
+    int32_t start[MAX_MOTORS];  ///< Segment start position (steps)
+    int32_t target[MAX_MOTORS]; ///< Segment end position (steps)
+    float unit[MAX_MOTORS];     ///< Direction cosines in joint space
+    float length;               ///< Path length (steps)
+    float max_speed;            ///< Path speed limit (steps/s)
+    float acceleration;         ///< Path acceleration limit (steps/s^2)
+    float max_entry_speed;      ///< Junction limit with previous segment
+    float entry_speed;          ///< Planned entry speed (steps/s)
+    uint8_t sequence_id;        ///< Originating command sequence id
+} LookaheadSegment_t;
+
+/**
+ * @brief Look-ahead executor status
+ */
+typedef struct {
+    bool active;              ///< Segments executing or queued
+    uint8_t queued;           ///< Segments in the ring (incl. executing)
+    uint8_t sequence_id;      ///< Sequence id of the executing segment
+    float path_speed;         ///< Current path speed (steps/s)
+    uint32_t completed;       ///< Segments completed since init
+    uint32_t full_stops;      ///< Times the path came to rest
+} LookaheadStatus_t;
+
+/**
+ * @brief Reset the queue and executor
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_lookahead_init(void);
+
+/**
+ * @brief Set the position the next queued segment starts from
+ * @param position Per-axis start position (steps)
+ * @return ERROR_MOTION_ACTIVE if segments are still queued
+ * @note Only valid while the queue is empty; segments then chain from the
+ *       previous segment's target.
+ */
+SystemError_t motion_lookahead_set_origin(const int32_t position[MAX_MOTORS]);
+
+/**
+ * @brief Queue one coordinated move (producer side)
+ * @param move Move command; axes not enabled hold their position
+ * @return ERROR_BUFFER_OVERFLOW if the ring is full,
+ *         ERROR_MOTION_ACTIVE while an abort waits for the executor,
+ *         ERROR_INVALID_PARAMETER for a move without usable limits
+ * @note Zero-length moves are accepted and dropped.
+ */
+SystemError_t motion_lookahead_push(const CoordinatedMoveCommand_t *move);
+
+/**
+ * @brief Free ring slots (producer side)
+ */
+uint8_t motion_lookahead_free_slots(void);
+
+/**
+ * @brief Whether segments are executing or queued
+ * @note Stays true after an abort until the executor has dropped the queue.
+ */
+bool motion_lookahead_is_active(void);
+
+/**
+ * @brief Advance the executor one tick (consumer side)
+ * @param dt_ms Tick length in milliseconds
+ * @param target_pos Output: per-axis position setpoints (steps)
+ * @param target_vel Output: per-axis signed velocity setpoints (steps/s)
+ * @return ERROR_INVALID_STATE if nothing is queued
+ */
+SystemError_t motion_lookahead_update(uint32_t dt_ms,
+                                      int32_t target_pos[MAX_MOTORS],
+                                      int32_t target_vel[MAX_MOTORS]);
+
+/**
+ * @brief Drop all queued segments and stop at the last setpoint
+ */
+void motion_lookahead_abort(void);
+
+/**
+ * @brief Get executor status
+ * @param status Pointer to store status
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_lookahead_get_status(LookaheadStatus_t *status);
+
+#endif // MOTION_LOOKAHEAD_H
@@ -13,10 +13,21 @@
 #include "config/motor_config.h"
 #include "config/safety_config.h"
 #include "hal_abstraction/hal_abstraction.h"
+#include "position_control.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
 
+/**
+ * @brief Constant-jerk piece of a continuous-time plan (SI units)
+ */
+typedef struct {
+  double duration;            // Piece duration (s)
+  MotionProfilePhase_t phase; // Reported phase
+  double acceleration;        // Acceleration at piece start (steps/s^2)
+  double jerk;                // Constant jerk (steps/s^3)
+} TrajectoryPiece_t;
+
 /* ==========================================================================
  */
 /* Forward Declarations for Static Functions                                 */
@@ -33,6 +44,31 @@ static SystemError_t execute_scurve_profile(MotionProfile_t *profile,
                                             int32_t *target_pos,
                                             uint32_t *target_vel);
 
+static void trajectory_load_segment(MotionTrajectory_t *trajectory);
+static void trajectory_set_segment_state(MotionSegment_t *segment,
+                                         int32_t origin, double position,
+                                         double velocity, double acceleration,
+                                         double jerk);
+
+static void trajectory_current_state(const MotionTrajectory_t *trajectory,
+                                     int32_t *origin, double *position,
+                                     double *velocity, double *acceleration);
+
+static void trajectory_sample_pieces(MotionTrajectory_t *trajectory,
+                                     const TrajectoryPiece_t *pieces,
+                                     uint8_t piece_count, int32_t origin,
+                                     double position, double velocity,
+                                     int32_t end_position);
+
+static double plan_velocity_change(double v0, double a0, double v1,
+                                   double max_accel, double max_jerk,
+                                   const MotionProfilePhase_t phases[3],
+                                   TrajectoryPiece_t pieces[3]);
+
+static double plan_rest_to_rest(double v0, double a0, double peak_velocity,
+                                double max_accel, double max_jerk,
+                                TrajectoryPiece_t pieces[7]);
+
 /* ==========================================================================
  */
 /* Global Variables                                                          */
@@ -41,7 +77,52 @@ static SystemError_t execute_scurve_profile(MotionProfile_t *profile,
 
 // Motion profile storage
 static MotionProfile_t active_profiles[MAX_MOTORS];
-static bool profile_active[MAX_MOTORS] = {false};
+static MotionTrajectory_t active_trajectories[MAX_MOTORS];
+// Bit per motor; updated atomically so a group of motors can be started
+// on the same RT tick
+static volatile uint32_t active_mask = 0;
+static bool trajectory_planned[MAX_MOTORS] = {false};
+
+// Retarget requests latched for the RT task. The flag is stored with
+// release and loaded with acquire so the RT task sees the whole request.
+static int32_t pending_target[MAX_MOTORS];
+static MotionLimits_t pending_limits[MAX_MOTORS];
+static volatile bool retarget_pending[MAX_MOTORS] = {false};
+
+// One step in Q32.32 fixed point
+#define TRAJECTORY_ONE ((int64_t)1 << MOTION_TRAJECTORY_FRAC_BITS)
+#define TRAJECTORY_HALF ((int64_t)1 << (MOTION_TRAJECTORY_FRAC_BITS - 1))
+
+/**
+ * @brief Segment description used while planning (SI units)
+ */
+typedef struct {
+  uint32_t ticks;             // Duration in update ticks
+  MotionProfilePhase_t phase; // Reported phase
+  double acceleration;        // Acceleration at segment start (steps/s^2)
+  double jerk;                // Constant jerk (steps/s^3)
+} TrajectorySegmentSpec_t;
+
+/**
+ * @brief Whether a motor's trajectory is being stepped by the RT task
+ */
+static inline bool profile_is_active(uint8_t motor_id) {
+  return (active_mask & (1U << motor_id)) != 0U;
+}
+
+/**
+ * @brief Hand a set of motors to the RT task in one atomic update
+ */
+static inline void profile_set_active(uint32_t motor_bits) {
+  __atomic_fetch_or(&active_mask, motor_bits, __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Take a set of motors away from the RT task
+ */
+static inline void profile_set_inactive(uint32_t motor_bits) {
+  __atomic_fetch_and(&active_mask, ~motor_bits, __ATOMIC_RELEASE);
+}
 
 /**
  * @brief Initialize motion profiling system
@@ -50,7 +131,10 @@ static bool profile_active[MAX_MOTORS] = {false};
 SystemError_t motion_profile_init(void) {
   // Clear all motion profiles
   memset(active_profiles, 0, sizeof(active_profiles));
-  memset(profile_active, false, sizeof(profile_active));
+  memset(active_trajectories, 0, sizeof(active_trajectories));
+  active_mask = 0;
+  memset(trajectory_planned, false, sizeof(trajectory_planned));
+  memset((void *)retarget_pending, false, sizeof(retarget_pending));
 
   return SYSTEM_OK;
 }
@@ -336,9 +420,20 @@ SystemError_t motion_profile_start(uint8_t motor_id, MotionProfile_t *profile) {
     return ERROR_INVALID_PARAMETER;
   }
 
+  // Keep the RT task off the slot while the trajectory is replanned
+  profile_set_inactive(1U << motor_id);
+  __atomic_store_n(&retarget_pending[motor_id], false, __ATOMIC_RELEASE);
+
+  SystemError_t result =
+      motion_profile_trajectory_plan(&active_trajectories[motor_id], profile);
+  if (result != SYSTEM_OK) {
+    return result;
+  }
+
   // Copy profile to active storage
   memcpy(&active_profiles[motor_id], profile, sizeof(MotionProfile_t));
-  profile_active[motor_id] = true;
+  trajectory_planned[motor_id] = true;
+  profile_set_active(1U << motor_id);
 
   // Record start time
   active_profiles[motor_id].start_time_ms = HAL_Abstraction_GetTick();
@@ -356,7 +451,9 @@ SystemError_t motion_profile_stop(uint8_t motor_id) {
     return ERROR_INVALID_PARAMETER;
   }
 
-  profile_active[motor_id] = false;
+  profile_set_inactive(1U << motor_id);
+  __atomic_store_n(&retarget_pending[motor_id], false, __ATOMIC_RELEASE);
+  position_control_clear_feedforward(motor_id);
   return SYSTEM_OK;
 }
 
@@ -370,7 +467,7 @@ bool motion_profile_is_active(uint8_t motor_id) {
     return false;
   }
 
-  return profile_active[motor_id];
+  return profile_is_active(motor_id);
 }
 
 /**
@@ -385,29 +482,744 @@ SystemError_t motion_profile_get_status(uint8_t motor_id,
     return ERROR_INVALID_PARAMETER;
   }
 
-  if (!profile_active[motor_id]) {
+  if (!profile_is_active(motor_id)) {
     status->is_active = false;
     return SYSTEM_OK;
   }
 
-  MotionProfile_t *profile = &active_profiles[motor_id];
-  uint32_t current_time = HAL_Abstraction_GetTick();
-  uint32_t elapsed_time = current_time - profile->start_time_ms;
+  // Report the setpoint the RT task last handed to position control
+  const MotionTrajectory_t *trajectory = &active_trajectories[motor_id];
 
   status->is_active = true;
-  status->current_phase = profile->current_phase;
-  status->elapsed_time_ms = elapsed_time;
-  status->total_time_ms = profile->total_time_ms;
-  status->progress_percent = (elapsed_time * 100) / profile->total_time_ms;
+  status->current_phase = active_profiles[motor_id].current_phase;
+  status->elapsed_time_ms =
+      trajectory->elapsed_ticks * MOTION_PROFILE_UPDATE_RATE_MS;
+  status->total_time_ms =
+      trajectory->total_ticks * MOTION_PROFILE_UPDATE_RATE_MS;
+  status->progress_percent =
+      (trajectory->total_ticks > 0)
+          ? (uint8_t)(((uint64_t)trajectory->elapsed_ticks * 100U) /
+                      trajectory->total_ticks)
+          : 100U;
+  status->current_target_position = trajectory->target_position;
+  status->current_target_velocity = trajectory->target_velocity;
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Advance the active trajectory of a motor by one update tick
+ * @param motor_id Motor identifier
+ * @param target_pos Pointer to store position setpoint (steps)
+ * @param target_vel Pointer to store signed velocity setpoint (steps/sec)
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_profile_update(uint8_t motor_id, int32_t *target_pos,
+                                    int32_t *target_vel) {
+  if (motor_id >= MAX_MOTORS || target_pos == NULL || target_vel == NULL) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  if (!profile_is_active(motor_id)) {
+    return ERROR_INVALID_STATE;
+  }
+
+  MotionTrajectory_t *trajectory = &active_trajectories[motor_id];
+
+  // Replan from the current setpoint state; on failure keep the old plan
+  if (__atomic_load_n(&retarget_pending[motor_id], __ATOMIC_ACQUIRE)) {
+    __atomic_store_n(&retarget_pending[motor_id], false, __ATOMIC_RELAXED);
+    if (motion_profile_trajectory_replan(trajectory, pending_target[motor_id],
+                                         &pending_limits[motor_id]) ==
+        SYSTEM_OK) {
+      active_profiles[motor_id].end_position = pending_target[motor_id];
+    }
+  }
+
+  bool running =
+      motion_profile_trajectory_step(trajectory, target_pos, target_vel);
+
+  if (running) {
+    active_profiles[motor_id].current_phase =
+        trajectory->segments[trajectory->segment_index].phase;
+  } else {
+    active_profiles[motor_id].current_phase = PROFILE_PHASE_COMPLETE;
+    profile_set_inactive(1U << motor_id);
+  }
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Change the target of a motor without stopping it
+ * @param motor_id Motor identifier
+ * @param target_position New target position (steps)
+ * @param limits Velocity/acceleration/jerk limits for the new move
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_profile_retarget(uint8_t motor_id,
+                                      int32_t target_position,
+                                      const MotionLimits_t *limits) {
+  if (motor_id >= MAX_MOTORS || limits == NULL || limits->max_velocity == 0 ||
+      limits->max_acceleration == 0 || limits->max_jerk == 0) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  if (limits->max_velocity > MOTOR_MAX_SPEED ||
+      limits->max_acceleration > MOTOR_MAX_ACCELERATION) {
+    return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+  }
+
+  // Without a previous move there is no known setpoint to start from
+  if (!trajectory_planned[motor_id]) {
+    return ERROR_INVALID_STATE;
+  }
+
+  // Flag last so the RT task never sees a half-written request
+  __atomic_store_n(&retarget_pending[motor_id], false, __ATOMIC_RELEASE);
+  pending_target[motor_id] = target_position;
+  pending_limits[motor_id] = *limits;
+  __atomic_store_n(&retarget_pending[motor_id], true, __ATOMIC_RELEASE);
+  profile_set_active(1U << motor_id);
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Replan a trajectory from its current state to a new target
+ * @param trajectory Pointer to trajectory generator state
+ * @param target_position New target position (steps)
+ * @param limits Velocity/acceleration/jerk limits (all non-zero)
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_profile_trajectory_replan(MotionTrajectory_t *trajectory,
+                                               int32_t target_position,
+                                               const MotionLimits_t *limits) {
+  if (trajectory == NULL || limits == NULL || limits->max_velocity == 0 ||
+      limits->max_acceleration == 0 || limits->max_jerk == 0) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  int32_t origin;
+  double position;
+  double velocity;
+  double acceleration;
+  trajectory_current_state(trajectory, &origin, &position, &velocity,
+                           &acceleration);
+
+  const double max_vel = (double)limits->max_velocity;
+  const double max_accel = (double)limits->max_acceleration;
+  const double max_jerk = (double)limits->max_jerk;
+  double remaining = (double)target_position - (double)origin - position;
+
+  // Distance is continuous in peak velocity, so bisection always converges
+  TrajectoryPiece_t pieces[MOTION_TRAJECTORY_MAX_SEGMENTS];
+  double reach_high = plan_rest_to_rest(velocity, acceleration, max_vel,
+                                        max_accel, max_jerk, pieces);
+  double reach_low = plan_rest_to_rest(velocity, acceleration, -max_vel,
+                                       max_accel, max_jerk, pieces);
+  double peak = max_vel;
+  double cruise = 0.0;
+
+  if (remaining == 0.0 && velocity == 0.0 && acceleration == 0.0) {
+    // Already at rest on the target: plan an empty move
+    peak = 0.0;
+  } else if (remaining >= reach_high) {
+    cruise = (remaining - reach_high) / max_vel;
+  } else if (remaining <= reach_low) {
+    peak = -max_vel;
+    cruise = (reach_low - remaining) / max_vel;
+  } else {
+    double low = -max_vel;
+    double high = max_vel;
+    for (uint8_t i = 0; i < MOTION_REPLAN_ITERATIONS; i++) {
+      double mid = 0.5 * (low + high);
+      if (plan_rest_to_rest(velocity, acceleration, mid, max_accel, max_jerk,
+                            pieces) < remaining) {
+        low = mid;
+      } else {
+        high = mid;
+      }
+    }
+    peak = 0.5 * (low + high);
+  }
+
+  plan_rest_to_rest(velocity, acceleration, peak, max_accel, max_jerk,
+                    pieces);
+  pieces[3].duration = cruise;
+
+  double total_sec = 0.0;
+  for (uint8_t i = 0; i < MOTION_TRAJECTORY_MAX_SEGMENTS; i++) {
+    total_sec += pieces[i].duration;
+  }
+  if (total_sec * MOTION_PROFILE_TICKS_PER_SEC >= (double)UINT32_MAX) {
+    return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+  }
+
+  // Restart from the last emitted setpoint so the output stays continuous
+  int32_t last_position = trajectory->target_position;
+  int32_t last_velocity = trajectory->target_velocity;
+  trajectory_sample_pieces(trajectory, pieces, MOTION_TRAJECTORY_MAX_SEGMENTS,
+                           origin, position, velocity, target_position);
+  trajectory->target_position = last_position;
+  trajectory->target_velocity = last_velocity;
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Plan an incremental trajectory from a generated profile
+ * @param trajectory Pointer to trajectory generator state
+ * @param profile Profile from motion_profile_generate_*()
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_profile_trajectory_plan(MotionTrajectory_t *trajectory,
+                                             const MotionProfile_t *profile) {
+  if (trajectory == NULL || profile == NULL) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  // Acceleration half of the profile; the deceleration half mirrors it
+  TrajectorySegmentSpec_t specs[MOTION_TRAJECTORY_MAX_SEGMENTS];
+  uint8_t half_count;
+
+  switch (profile->type) {
+  case PROFILE_TRAPEZOIDAL:
+    specs[0] = (TrajectorySegmentSpec_t){profile->accel_time_ms,
+                                         PROFILE_PHASE_ACCEL,
+                                         (double)profile->acceleration, 0.0};
+    specs[1] = (TrajectorySegmentSpec_t){0, PROFILE_PHASE_CONST_VEL, 0.0,
+                                         0.0};
+    specs[2] = (TrajectorySegmentSpec_t){profile->accel_time_ms,
+                                         PROFILE_PHASE_DECEL,
+                                         -(double)profile->acceleration, 0.0};
+    half_count = 1;
+    break;
+
+  case PROFILE_SCURVE: {
+    double jerk = (double)profile->jerk;
+    double peak_accel = jerk * profile->jerk_time_ms / 1000.0;
+
+    specs[0] = (TrajectorySegmentSpec_t){profile->jerk_time_ms,
+                                         PROFILE_PHASE_JERK_ACCEL, 0.0, jerk};
+    specs[1] = (TrajectorySegmentSpec_t){profile->linear_accel_time_ms,
+                                         PROFILE_PHASE_LINEAR_ACCEL,
+                                         peak_accel, 0.0};
+    specs[2] = (TrajectorySegmentSpec_t){profile->jerk_time_ms,
+                                         PROFILE_PHASE_JERK_DECEL_ACCEL,
+                                         peak_accel, -jerk};
+    specs[3] = (TrajectorySegmentSpec_t){0, PROFILE_PHASE_CONST_VEL_SCURVE,
+                                         0.0, 0.0};
+    specs[4] = (TrajectorySegmentSpec_t){profile->jerk_time_ms,
+                                         PROFILE_PHASE_JERK_ACCEL_DECEL, 0.0,
+                                         -jerk};
+    specs[5] = (TrajectorySegmentSpec_t){profile->linear_accel_time_ms,
+                                         PROFILE_PHASE_LINEAR_DECEL,
+                                         -peak_accel, 0.0};
+    specs[6] = (TrajectorySegmentSpec_t){profile->jerk_time_ms,
+                                         PROFILE_PHASE_JERK_DECEL, -peak_accel,
+                                         jerk};
+    half_count = 3;
+    break;
+  }
+
+  default:
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  const double tick_sec = 1.0 / MOTION_PROFILE_TICKS_PER_SEC;
+  uint8_t spec_count = (uint8_t)(2U * half_count + 1U);
+
+  // Integrate the acceleration half to get cruise velocity and distance
+  double half_distance = 0.0;
+  double cruise_velocity = 0.0;
+  uint64_t half_ticks = 0;
+  for (uint8_t i = 0; i < half_count; i++) {
+    double t = specs[i].ticks * tick_sec;
+    half_distance += cruise_velocity * t +
+                     specs[i].acceleration * t * t / 2.0 +
+                     specs[i].jerk * t * t * t / 6.0;
+    cruise_velocity += specs[i].acceleration * t + specs[i].jerk * t * t / 2.0;
+    half_ticks += specs[i].ticks;
+  }
+
+  // Cruise covers the remainder, rounded up so the scale below is <= 1
+  double distance = fabs((double)profile->end_position -
+                         (double)profile->start_position);
+  double cruise_ticks = 0.0;
+  if (distance > 2.0 * half_distance && cruise_velocity > 0.0) {
+    cruise_ticks =
+        ceil((distance - 2.0 * half_distance) / (cruise_velocity * tick_sec));
+  }
+  if ((double)(2U * half_ticks) + cruise_ticks > (double)UINT32_MAX) {
+    return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+  }
+  specs[half_count].ticks = (uint32_t)cruise_ticks;
+
+  double nominal = 2.0 * half_distance +
+                   cruise_velocity * specs[half_count].ticks * tick_sec;
+  if (distance > 0.0 && nominal <= 0.0) {
+    return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+  }
 
-  if (status->progress_percent > 100) {
-    status->progress_percent = 100;
+  // Time-preserving scale: shape and duration kept, distance made exact
+  double scale = (distance > 0.0) ? distance / nominal : 0.0;
+  if (profile->end_position < profile->start_position) {
+    scale = -scale;
   }
 
-  // Calculate current targets
-  motion_profile_execute(motor_id, profile, elapsed_time,
-                         &status->current_target_position,
-                         &status->current_target_velocity);
+  memset(trajectory, 0, sizeof(*trajectory));
+  trajectory->end_position = profile->end_position;
+  trajectory->target_position = profile->start_position;
+
+  double position = 0.0;
+  double velocity = 0.0;
+
+  for (uint8_t i = 0; i < spec_count && distance > 0.0; i++) {
+    const TrajectorySegmentSpec_t *spec = &specs[i];
+    if (spec->ticks == 0) {
+      continue;
+    }
+
+    MotionSegment_t *segment = &trajectory->segments[trajectory->segment_count];
+    segment->ticks = spec->ticks;
+    segment->phase = spec->phase;
+    trajectory_set_segment_state(segment, profile->start_position,
+                                 position * scale, velocity * scale,
+                                 spec->acceleration * scale,
+                                 spec->jerk * scale);
+
+    trajectory->segment_count++;
+    trajectory->total_ticks += spec->ticks;
+
+    double t = spec->ticks * tick_sec;
+    position += velocity * t + spec->acceleration * t * t / 2.0 +
+                spec->jerk * t * t * t / 6.0;
+    velocity += spec->acceleration * t + spec->jerk * t * t / 2.0;
+  }
+
+  if (trajectory->segment_count > 0) {
+    trajectory_load_segment(trajectory);
+  }
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Advance a trajectory by one update tick
+ * @param trajectory Pointer to trajectory generator state
+ * @param target_pos Pointer to store position setpoint (steps)
+ * @param target_vel Pointer to store signed velocity setpoint (steps/sec)
+ * @return bool True while the trajectory has ticks remaining
+ */
+bool motion_profile_trajectory_step(MotionTrajectory_t *trajectory,
+                                    int32_t *target_pos,
+                                    int32_t *target_vel) {
+  if (trajectory->segment_index >= trajectory->segment_count) {
+    trajectory->target_position = trajectory->end_position;
+    trajectory->target_velocity = 0;
+    *target_pos = trajectory->end_position;
+    *target_vel = 0;
+    return false;
+  }
+
+  // Forward differencing: exact cubic evaluation with three additions
+  const MotionSegment_t *segment =
+      &trajectory->segments[trajectory->segment_index];
+  trajectory->position += trajectory->delta1;
+  trajectory->delta1 += trajectory->delta2;
+  trajectory->delta2 += segment->delta3;
+  trajectory->elapsed_ticks++;
+
+  if (--trajectory->ticks_left == 0) {
+    trajectory->segment_index++;
+    if (trajectory->segment_index >= trajectory->segment_count) {
+      // Final tick lands on the commanded position, not the accumulator
+      trajectory->target_position = trajectory->end_position;
+      trajectory->target_velocity = 0;
+      *target_pos = trajectory->end_position;
+      *target_vel = 0;
+      return false;
+    }
+
+    // Snap to the planned boundary state so rounding cannot accumulate
+    trajectory_load_segment(trajectory);
+    segment = &trajectory->segments[trajectory->segment_index];
+  }
+
+  // v(n) = d1 - d2 / 2 + jerk / 3 (steps/tick, Q32.32), signed so the
+  // feedforward pushes along reverse moves too
+  int64_t velocity =
+      trajectory->delta1 - (trajectory->delta2 / 2) + segment->velocity_bias;
+
+  trajectory->target_position =
+      (int32_t)((trajectory->position + TRAJECTORY_HALF) >>
+                MOTION_TRAJECTORY_FRAC_BITS);
+  trajectory->target_velocity =
+      (int32_t)((velocity * MOTION_PROFILE_TICKS_PER_SEC + TRAJECTORY_HALF) >>
+                MOTION_TRAJECTORY_FRAC_BITS);
+
+  *target_pos = trajectory->target_position;
+  *target_vel = trajectory->target_velocity;
+  return true;
+}
+
+/**
+ * @brief Load the start state of the current segment
+ */
+static void trajectory_load_segment(MotionTrajectory_t *trajectory) {
+  const MotionSegment_t *segment =
+      &trajectory->segments[trajectory->segment_index];
+
+  trajectory->position = segment->position;
+  trajectory->delta1 = segment->delta1;
+  trajectory->delta2 = segment->delta2;
+  trajectory->ticks_left = segment->ticks;
+}
+
+/**
+ * @brief Encode a segment start state as Q32.32 forward differences
+ * @param origin Integer part of the position (steps)
+ * @param position Position relative to origin (steps)
+ * @param velocity Velocity (steps/sec)
+ * @param acceleration Acceleration (steps/sec²)
+ * @param jerk Jerk (steps/sec³)
+ */
+static void trajectory_set_segment_state(MotionSegment_t *segment,
+                                         int32_t origin, double position,
+                                         double velocity, double acceleration,
+                                         double jerk) {
+  const double one = (double)TRAJECTORY_ONE;
+  const double tick_sec = 1.0 / MOTION_PROFILE_TICKS_PER_SEC;
+
+  // Per-tick units, so the differences below need no further scaling
+  double v = velocity * tick_sec;
+  double a = acceleration * tick_sec * tick_sec;
+  double j = jerk * tick_sec * tick_sec * tick_sec;
+
+  segment->position =
+      (int64_t)origin * TRAJECTORY_ONE + llround(position * one);
+  segment->delta1 = llround((v + a / 2.0 + j / 6.0) * one);
+  segment->delta2 = llround((a + j) * one);
+  segment->delta3 = llround(j * one);
+  segment->velocity_bias = llround(j / 3.0 * one);
+}
+
+/**
+ * @brief Decode the current setpoint state of a trajectory
+ * @param origin Integer part of the position (steps)
+ * @param position Fractional position above origin (steps)
+ * @param velocity Velocity (steps/sec)
+ * @param acceleration Acceleration (steps/sec²)
+ */
+static void trajectory_current_state(const MotionTrajectory_t *trajectory,
+                                     int32_t *origin, double *position,
+                                     double *velocity, double *acceleration) {
+  if (trajectory->segment_index >= trajectory->segment_count) {
+    // Finished (or never planned): at rest on the last setpoint
+    *origin = trajectory->target_position;
+    *position = 0.0;
+    *velocity = 0.0;
+    *acceleration = 0.0;
+    return;
+  }
+
+  const MotionSegment_t *segment =
+      &trajectory->segments[trajectory->segment_index];
+  const double one = (double)TRAJECTORY_ONE;
+  const double ticks_per_sec = MOTION_PROFILE_TICKS_PER_SEC;
+  int64_t whole = trajectory->position >> MOTION_TRAJECTORY_FRAC_BITS;
+
+  *origin = (int32_t)whole;
+  *position = (double)(trajectory->position - whole * TRAJECTORY_ONE) / one;
+
+  // Inverse of trajectory_set_segment_state(): v = d1 - d2/2 + j/3,
+  // a = d2 - j (per tick)
+  *velocity = (double)(trajectory->delta1 - trajectory->delta2 / 2 +
+                       segment->velocity_bias) /
+              one * ticks_per_sec;
+  *acceleration = (double)(trajectory->delta2 - segment->delta3) / one *
+                  ticks_per_sec * ticks_per_sec;
+}
+
+/**
+ * @brief Sample a continuous plan onto the update tick grid
+ * @param pieces Constant-jerk pieces, started from (position, velocity)
+ * @param origin Integer part of the start position (steps)
+ * @param end_position Exact final position (steps)
+ * @details A piece owns the ticks that fall inside it; its start state is
+ *          evaluated at its first tick. Plans sampled from pieces with the
+ *          same durations therefore share their tick boundaries.
+ */
+static void trajectory_sample_pieces(MotionTrajectory_t *trajectory,
+                                     const TrajectoryPiece_t *pieces,
+                                     uint8_t piece_count, int32_t origin,
+                                     double position, double velocity,
+                                     int32_t end_position) {
+  memset(trajectory, 0, sizeof(*trajectory));
+  trajectory->end_position = end_position;
+  trajectory->target_position = origin;
+
+  const double tick_sec = 1.0 / MOTION_PROFILE_TICKS_PER_SEC;
+  double piece_start = 0.0;
+  uint32_t first_tick = 0;
+
+  for (uint8_t i = 0; i < piece_count; i++) {
+    const TrajectoryPiece_t *piece = &pieces[i];
+    double piece_end = piece_start + piece->duration;
+    double end_tick_f = ceil(piece_end * MOTION_PROFILE_TICKS_PER_SEC - 1e-6);
+    uint32_t end_tick = (end_tick_f > 0.0) ? (uint32_t)end_tick_f : 0U;
+
+    if (end_tick > first_tick) {
+      double tau = first_tick * tick_sec - piece_start;
+      MotionSegment_t *segment =
+          &trajectory->segments[trajectory->segment_count++];
+
+      segment->ticks = end_tick - first_tick;
+      segment->phase = piece->phase;
+      trajectory_set_segment_state(
+          segment, origin,
+          position + velocity * tau + piece->acceleration * tau * tau / 2.0 +
+              piece->jerk * tau * tau * tau / 6.0,
+          velocity + piece->acceleration * tau + piece->jerk * tau * tau / 2.0,
+          piece->acceleration + piece->jerk * tau, piece->jerk);
+      first_tick = end_tick;
+    }
+
+    double t = piece->duration;
+    position += velocity * t + piece->acceleration * t * t / 2.0 +
+                piece->jerk * t * t * t / 6.0;
+    velocity += piece->acceleration * t + piece->jerk * t * t / 2.0;
+    piece_start = piece_end;
+  }
+
+  trajectory->total_ticks = first_tick;
+  if (trajectory->segment_count > 0) {
+    trajectory_load_segment(trajectory);
+  }
+}
+
+/**
+ * @brief Plan a jerk-limited change from (v0, a0) to (v1, 0)
+ * @param phases Phase reported for each of the three pieces
+ * @param pieces Output: ramp-up, constant and ramp-down acceleration
+ * @return Distance covered (steps)
+ */
+static double plan_velocity_change(double v0, double a0, double v1,
+                                   double max_accel, double max_jerk,
+                                   const MotionProfilePhase_t phases[3],
+                                   TrajectoryPiece_t pieces[3]) {
+  // Ramping the current acceleration straight to zero ends at v_ramp; the
+  // target velocity decides which way acceleration has to go from there
+  double v_ramp = v0 + a0 * fabs(a0) / (2.0 * max_jerk);
+  double sign = (v1 >= v_ramp) ? 1.0 : -1.0;
+  double a0s = sign * a0;
+  double dv = sign * (v1 - v0);
+
+  double peak = max_accel;
+  double hold = 0.0;
+  double ramp_gain = (2.0 * peak * peak - a0s * a0s) / (2.0 * max_jerk);
+  if (dv >= ramp_gain) {
+    hold = (dv - ramp_gain) / peak;
+  } else {
+    peak = sqrt(fmax(0.0, (2.0 * max_jerk * dv + a0s * a0s) / 2.0));
+  }
+  if (peak < a0s) {
+    peak = a0s;
+  }
+
+  pieces[0] = (TrajectoryPiece_t){(peak - a0s) / max_jerk, phases[0], a0,
+                                  sign * max_jerk};
+  pieces[1] = (TrajectoryPiece_t){hold, phases[1], sign * peak, 0.0};
+  pieces[2] = (TrajectoryPiece_t){peak / max_jerk, phases[2], sign * peak,
+                                  -sign * max_jerk};
+
+  double distance = 0.0;
+  double velocity = v0;
+  for (uint8_t i = 0; i < 3; i++) {
+    double t = pieces[i].duration;
+    distance += velocity * t + pieces[i].acceleration * t * t / 2.0 +
+                pieces[i].jerk * t * t * t / 6.0;
+    velocity += pieces[i].acceleration * t + pieces[i].jerk * t * t / 2.0;
+  }
+
+  return distance;
+}
+
+/**
+ * @brief Plan (v0, a0) -> peak_velocity -> rest without a cruise phase
+ * @param pieces Output: three change pieces, cruise (zero), three stop pieces
+ * @return Distance covered (steps)
+ */
+static double plan_rest_to_rest(double v0, double a0, double peak_velocity,
+                                double max_accel, double max_jerk,
+                                TrajectoryPiece_t pieces[7]) {
+  static const MotionProfilePhase_t change_phases[3] = {
+      PROFILE_PHASE_JERK_ACCEL, PROFILE_PHASE_LINEAR_ACCEL,
+      PROFILE_PHASE_JERK_DECEL_ACCEL};
+  static const MotionProfilePhase_t stop_phases[3] = {
+      PROFILE_PHASE_JERK_ACCEL_DECEL, PROFILE_PHASE_LINEAR_DECEL,
+      PROFILE_PHASE_JERK_DECEL};
+
+  double distance = plan_velocity_change(v0, a0, peak_velocity, max_accel,
+                                         max_jerk, change_phases, pieces);
+  pieces[3] = (TrajectoryPiece_t){0.0, PROFILE_PHASE_CONST_VEL_SCURVE,
+                                  0.0, 0.0};
+  distance += plan_velocity_change(peak_velocity, 0.0, 0.0, max_accel,
+                                   max_jerk, stop_phases, &pieces[4]);
+
+  return distance;
+}
+
+/**
+ * @brief Plan a time-synchronised straight-line move for several axes
+ * @param trajectories Output: one trajectory per entry of axes
+ * @param axes Start, end and limits of each axis
+ * @param axis_count Number of axes
+ * @return SystemError_t Operation result
+ */
+SystemError_t
+motion_profile_plan_synchronized(MotionTrajectory_t *trajectories,
+                                 const MotionSyncAxis_t *axes,
+                                 uint8_t axis_count) {
+  if (trajectories == NULL || axes == NULL || axis_count == 0) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  // Limits of the normalised path parameter s (distance 1): each axis
+  // moves |distance| * s, so its limits shrink by its distance
+  double max_vel = HUGE_VAL;
+  double max_accel = HUGE_VAL;
+  double max_decel = HUGE_VAL;
+  bool moving = false;
+
+  for (uint8_t i = 0; i < axis_count; i++) {
+    double distance =
+        fabs((double)axes[i].end_position - (double)axes[i].start_position);
+    if (distance == 0.0) {
+      continue;
+    }
+    if (axes[i].max_velocity == 0 || axes[i].acceleration == 0) {
+      return ERROR_INVALID_PARAMETER;
+    }
+
+    uint32_t decel = (axes[i].deceleration != 0) ? axes[i].deceleration
+                                                 : axes[i].acceleration;
+    max_vel = fmin(max_vel, axes[i].max_velocity / distance);
+    max_accel = fmin(max_accel, axes[i].acceleration / distance);
+    max_decel = fmin(max_decel, decel / distance);
+    moving = true;
+  }
+
+  TrajectoryPiece_t pieces[3] = {{0.0, PROFILE_PHASE_ACCEL, 0.0, 0.0},
+                                 {0.0, PROFILE_PHASE_CONST_VEL, 0.0, 0.0},
+                                 {0.0, PROFILE_PHASE_DECEL, 0.0, 0.0}};
+
+  if (moving) {
+    // Minimum-time trapezoid over unit distance; triangular if the ramps
+    // alone would overshoot
+    double peak = max_vel;
+    double ramps = peak * peak / (2.0 * max_accel) +
+                   peak * peak / (2.0 * max_decel);
+    if (ramps > 1.0) {
+      peak = sqrt(2.0 * max_accel * max_decel / (max_accel + max_decel));
+      ramps = 1.0;
+    }
+
+    pieces[0].duration = peak / max_accel;
+    pieces[0].acceleration = max_accel;
+    pieces[1].duration = (1.0 - ramps) / peak;
+    pieces[2].duration = peak / max_decel;
+    pieces[2].acceleration = -max_decel;
+
+    double total_sec =
+        pieces[0].duration + pieces[1].duration + pieces[2].duration;
+    if (total_sec * MOTION_PROFILE_TICKS_PER_SEC >= (double)UINT32_MAX) {
+      return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+    }
+  }
+
+  // Same piece durations on every axis, scaled by its signed distance
+  for (uint8_t i = 0; i < axis_count; i++) {
+    double distance =
+        (double)axes[i].end_position - (double)axes[i].start_position;
+    TrajectoryPiece_t scaled[3];
+
+    for (uint8_t p = 0; p < 3; p++) {
+      scaled[p] = pieces[p];
+      scaled[p].acceleration *= distance;
+    }
+    trajectory_sample_pieces(&trajectories[i], scaled, 3,
+                             axes[i].start_position, 0.0, 0.0,
+                             axes[i].end_position);
+  }
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Plan and start a time-synchronised move
+ * @param axes Start, end, limits and motor of each axis
+ * @param axis_count Number of axes (at most MAX_MOTORS)
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_profile_start_synchronized(const MotionSyncAxis_t *axes,
+                                                uint8_t axis_count) {
+  static MotionTrajectory_t plans[MAX_MOTORS];
+
+  if (axes == NULL || axis_count == 0 || axis_count > MAX_MOTORS) {
+    return ERROR_INVALID_PARAMETER;
+  }
+
+  uint32_t motor_bits = 0;
+  for (uint8_t i = 0; i < axis_count; i++) {
+    if (axes[i].motor_id >= MAX_MOTORS ||
+        (motor_bits & (1U << axes[i].motor_id)) != 0U) {
+      return ERROR_INVALID_PARAMETER;
+    }
+    if (axes[i].max_velocity > MOTOR_MAX_SPEED ||
+        axes[i].acceleration > MOTOR_MAX_ACCELERATION ||
+        axes[i].deceleration > MOTOR_MAX_ACCELERATION) {
+      return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+    }
+    motor_bits |= 1U << axes[i].motor_id;
+  }
+
+  SystemError_t result =
+      motion_profile_plan_synchronized(plans, axes, axis_count);
+  if (result != SYSTEM_OK) {
+    return result;
+  }
+
+  // Keep the RT task off every slot until all plans are in place
+  profile_set_inactive(motor_bits);
+
+  uint32_t start_time = HAL_Abstraction_GetTick();
+  for (uint8_t i = 0; i < axis_count; i++) {
+    uint8_t motor_id = axes[i].motor_id;
+    MotionProfile_t *profile = &active_profiles[motor_id];
+
+    __atomic_store_n(&retarget_pending[motor_id], false, __ATOMIC_RELEASE);
+    active_trajectories[motor_id] = plans[i];
+
+    memset(profile, 0, sizeof(*profile));
+    profile->type = PROFILE_TRAPEZOIDAL;
+    profile->current_phase = PROFILE_PHASE_ACCEL;
+    profile->start_position = axes[i].start_position;
+    profile->end_position = axes[i].end_position;
+    profile->direction =
+        (axes[i].end_position >= axes[i].start_position) ? 1 : -1;
+    profile->max_velocity = axes[i].max_velocity;
+    profile->acceleration = axes[i].acceleration;
+    profile->deceleration = axes[i].deceleration;
+    profile->start_time_ms = start_time;
+    profile->total_time_ms =
+        plans[i].total_ticks * MOTION_PROFILE_UPDATE_RATE_MS;
+    trajectory_planned[motor_id] = true;
+  }
+
+  // One atomic update: every axis is stepped from the same RT tick
+  profile_set_active(motor_bits);
 
   return SYSTEM_OK;
 }
@@ -427,36 +1239,26 @@ SystemError_t motion_profile_synchronize(uint8_t *motor_ids,
     return ERROR_INVALID_PARAMETER;
   }
 
-  // Find the longest profile time
-  uint32_t max_time = 0;
+  // Replan all axes onto one common time base within each profile's own
+  // velocity and acceleration limits
+  MotionSyncAxis_t axes[MAX_MOTORS];
   for (uint8_t i = 0; i < motor_count; i++) {
-    if (profiles[i].total_time_ms > max_time) {
-      max_time = profiles[i].total_time_ms;
-    }
+    axes[i] = (MotionSyncAxis_t){motor_ids[i],
+                                 profiles[i].start_position,
+                                 profiles[i].end_position,
+                                 profiles[i].max_velocity,
+                                 profiles[i].acceleration,
+                                 profiles[i].deceleration};
   }
 
-  // Scale all profiles to match the longest time
-  for (uint8_t i = 0; i < motor_count; i++) {
-    if (profiles[i].total_time_ms < max_time) {
-      // Reduce velocity to extend time
-      float scale_factor = (float)profiles[i].total_time_ms / max_time;
-      profiles[i].max_velocity =
-          (uint32_t)(profiles[i].max_velocity * scale_factor);
-      profiles[i].peak_velocity =
-          (uint32_t)(profiles[i].peak_velocity * scale_factor);
-
-      // Recalculate timing with new velocity
-      motion_profile_generate_trapezoidal(
-          &profiles[i], profiles[i].start_position, profiles[i].end_position,
-          profiles[i].max_velocity, profiles[i].acceleration);
-    }
+  SystemError_t result = motion_profile_start_synchronized(axes, motor_count);
+  if (result != SYSTEM_OK) {
+    return result;
   }
 
-  // Start all profiles simultaneously
-  uint32_t sync_start_time = HAL_Abstraction_GetTick();
   for (uint8_t i = 0; i < motor_count; i++) {
-    profiles[i].start_time_ms = sync_start_time;
-    motion_profile_start(motor_ids[i], &profiles[i]);
+    profiles[i].start_time_ms = active_profiles[motor_ids[i]].start_time_ms;
+    profiles[i].total_time_ms = active_profiles[motor_ids[i]].total_time_ms;
   }
 
   return SYSTEM_OK;
@@ -106,9 +106,79 @@ typedef struct {
   uint32_t total_time_ms;             ///< Total profile time
   uint8_t progress_percent;           ///< Progress percentage (0-100)
   int32_t current_target_position;    ///< Current target position
-  uint32_t current_target_velocity;   ///< Current target velocity
+  int32_t current_target_velocity;    ///< Current target velocity (signed)
 } MotionProfileStatus_t;
 
+/**
+ * @brief Maximum constant-jerk segments in a trajectory (7-phase S-curve)
+ */
+#define MOTION_TRAJECTORY_MAX_SEGMENTS 7
+
+/**
+ * @brief Fixed-point fraction bits of trajectory accumulators (Q32.32)
+ */
+#define MOTION_TRAJECTORY_FRAC_BITS 32
+
+/**
+ * @brief Constant-jerk trajectory segment
+ *
+ * Start state is stored as forward differences of position per tick so the
+ * generator advances with three integer additions and no multiplies.
+ */
+typedef struct {
+  uint32_t ticks;             ///< Segment duration (update ticks)
+  MotionProfilePhase_t phase; ///< Phase reported while in this segment
+  int64_t position;           ///< Start position (Q32.32 steps)
+  int64_t delta1;             ///< First difference (Q32.32 steps/tick)
+  int64_t delta2;             ///< Second difference (Q32.32 steps/tick^2)
+  int64_t delta3;             ///< Third difference = jerk (steps/tick^3)
+  int64_t velocity_bias;      ///< jerk / 3 for velocity reconstruction
+} MotionSegment_t;
+
+/**
+ * @brief Incremental trajectory generator state
+ *
+ * Segment start states are computed once when the trajectory is planned and
+ * loaded verbatim at every boundary, so accumulator rounding never carries
+ * from one segment into the next and the final tick lands exactly on
+ * end_position.
+ */
+typedef struct {
+  MotionSegment_t segments[MOTION_TRAJECTORY_MAX_SEGMENTS]; ///< Plan
+  uint8_t segment_count;   ///< Number of planned segments
+  uint8_t segment_index;   ///< Segment being executed
+  uint32_t ticks_left;     ///< Ticks remaining in current segment
+  uint32_t total_ticks;    ///< Planned duration (update ticks)
+  uint32_t elapsed_ticks;  ///< Ticks executed so far
+  int64_t position;        ///< Position accumulator (Q32.32 steps)
+  int64_t delta1;          ///< First difference accumulator
+  int64_t delta2;          ///< Second difference accumulator
+  int32_t end_position;    ///< Exact final position (steps)
+  int32_t target_position; ///< Last emitted position setpoint (steps)
+  int32_t target_velocity; ///< Last emitted velocity setpoint (steps/sec)
+} MotionTrajectory_t;
+
+/**
+ * @brief Kinematic limits for online (re)planning
+ */
+typedef struct {
+  uint32_t max_velocity;     ///< Velocity limit (steps/sec)
+  uint32_t max_acceleration; ///< Acceleration limit (steps/sec²)
+  uint32_t max_jerk;         ///< Jerk limit (steps/sec³)
+} MotionLimits_t;
+
+/**
+ * @brief One axis of a time-synchronised multi-axis move
+ */
+typedef struct {
+  uint8_t motor_id;       ///< Motor identifier
+  int32_t start_position; ///< Start position (steps)
+  int32_t end_position;   ///< Target position (steps)
+  uint32_t max_velocity;  ///< Axis velocity limit (steps/sec)
+  uint32_t acceleration;  ///< Axis acceleration limit (steps/sec²)
+  uint32_t deceleration;  ///< Axis deceleration limit (0 = acceleration)
+} MotionSyncAxis_t;
+
 /**
  * @brief Motion profile configuration
  */
@@ -202,12 +272,114 @@ bool motion_profile_is_active(uint8_t motor_id);
 SystemError_t motion_profile_get_status(uint8_t motor_id,
                                         MotionProfileStatus_t *status);
 
+/**
+ * @brief Advance the active trajectory of a motor by one update tick
+ * @param motor_id Motor identifier
+ * @param target_pos Pointer to store position setpoint (steps)
+ * @param target_vel Pointer to store signed velocity setpoint (steps/sec)
+ * @return SystemError_t Operation result
+ * @note Called from the 1 kHz motion profile task. The profile is marked
+ *       inactive on the tick that reaches end_position.
+ */
+SystemError_t motion_profile_update(uint8_t motor_id, int32_t *target_pos,
+                                    int32_t *target_vel);
+
+/**
+ * @brief Plan an incremental trajectory from a generated profile
+ * @param trajectory Pointer to trajectory generator state
+ * @param profile Profile from motion_profile_generate_*()
+ * @return SystemError_t Operation result
+ * @details Phase durations are taken from the profile; the cruise phase is
+ *          rounded up to whole ticks and the trajectory is scaled so the
+ *          travelled distance equals end_position - start_position exactly.
+ *          Velocity, acceleration and jerk never exceed the profile values.
+ */
+SystemError_t motion_profile_trajectory_plan(MotionTrajectory_t *trajectory,
+                                             const MotionProfile_t *profile);
+
+/**
+ * @brief Advance a trajectory by one update tick
+ * @param trajectory Pointer to trajectory generator state
+ * @param target_pos Pointer to store position setpoint (steps)
+ * @param target_vel Pointer to store signed velocity setpoint (steps/sec)
+ * @return bool True while the trajectory has ticks remaining
+ */
+bool motion_profile_trajectory_step(MotionTrajectory_t *trajectory,
+                                    int32_t *target_pos,
+                                    int32_t *target_vel);
+
+/**
+ * @brief Change the target of a motor without stopping it
+ * @param motor_id Motor identifier
+ * @param target_position New target position (steps)
+ * @param limits Velocity/acceleration/jerk limits for the new move
+ * @return SystemError_t Operation result
+ * @details The request is latched and picked up by the next
+ *          motion_profile_update() call, which replans from the current
+ *          setpoint state (position, velocity and acceleration) before
+ *          stepping. An idle motor starts from rest at its last setpoint.
+ */
+SystemError_t motion_profile_retarget(uint8_t motor_id,
+                                      int32_t target_position,
+                                      const MotionLimits_t *limits);
+
+/**
+ * @brief Replan a trajectory from its current state to a new target
+ * @param trajectory Pointer to trajectory generator state
+ * @param target_position New target position (steps)
+ * @param limits Velocity/acceleration/jerk limits (all non-zero)
+ * @return SystemError_t Operation result
+ * @details Plans a jerk-limited S-curve that takes the current position,
+ *          velocity and acceleration to rest at target_position, reversing
+ *          if the target can no longer be reached without overshoot.
+ *          Compute time is bounded: the peak velocity is found with
+ *          MOTION_REPLAN_ITERATIONS bisection steps of a closed-form
+ *          distance function.
+ */
+SystemError_t motion_profile_trajectory_replan(MotionTrajectory_t *trajectory,
+                                               int32_t target_position,
+                                               const MotionLimits_t *limits);
+
+/**
+ * @brief Plan a time-synchronised straight-line move for several axes
+ * @param trajectories Output: one trajectory per entry of axes
+ * @param axes Start, end and limits of each axis
+ * @param axis_count Number of axes
+ * @return SystemError_t Operation result
+ * @details All axes follow one normalised trapezoid s(t), 0 -> 1, so that
+ *          position_i(t) = start_i + (end_i - start_i) * s(t). Its velocity,
+ *          acceleration and deceleration are the tightest of the axes'
+ *          limits divided by their distance, giving the minimum common move
+ *          time in which no axis exceeds its own limits. The trajectories
+ *          share every tick boundary, so the axes start and finish on the
+ *          same tick and deviate from the joint-space line by rounding only
+ *          (at most one step).
+ */
+SystemError_t
+motion_profile_plan_synchronized(MotionTrajectory_t *trajectories,
+                                 const MotionSyncAxis_t *axes,
+                                 uint8_t axis_count);
+
+/**
+ * @brief Plan and start a time-synchronised move
+ * @param axes Start, end, limits and motor of each axis
+ * @param axis_count Number of axes (at most MAX_MOTORS)
+ * @return SystemError_t Operation result
+ * @note The motors are handed to the RT task in a single atomic update, so
+ *       they are stepped from the same tick.
+ */
+SystemError_t motion_profile_start_synchronized(const MotionSyncAxis_t *axes,
+                                                uint8_t axis_count);
+
 /**
  * @brief Synchronize multiple motor profiles for coordinated motion
  * @param motor_ids Array of motor identifiers
  * @param profiles Array of motion profiles
  * @param motor_count Number of motors to synchronize
  * @return SystemError_t Operation result
+ * @details Replans the profiles with motion_profile_start_synchronized()
+ *          using each profile's velocity, acceleration and deceleration;
+ *          start_time_ms and total_time_ms are updated to the common plan.
  */
 SystemError_t motion_profile_synchronize(uint8_t *motor_ids,
                                          MotionProfile_t *profiles,
@@ -220,6 +392,9 @@ SystemError_t motion_profile_synchronize(uint8_t *motor_ids,
 #define MOTION_PROFILE_UPDATE_RATE_MS 1      ///< Default update rate (1ms)
 #define MOTION_PROFILE_MIN_TIME_MS 10        ///< Minimum profile time
 #define MOTION_PROFILE_MAX_JERK_TIME_MS 1000 ///< Maximum jerk time
+#define MOTION_PROFILE_TICKS_PER_SEC                                           \
+  (1000U / MOTION_PROFILE_UPDATE_RATE_MS) ///< Update ticks per second
+#define MOTION_REPLAN_ITERATIONS 32 ///< Peak velocity bisection steps
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,305 @@
+/**
+ * @file motion_pvt.c
+ * @brief Streamed position-velocity-time (PVT) trajectory buffer
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "motion_pvt.h"
+#include "position_control.h"
+#include "position_safety.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Variables                                                         */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Stream state of one motor
+ * @details head is written by the producer, tail by the consumer;
+ *          free-running 8-bit indices, masked on access.
+ */
+typedef struct {
+    PvtPoint_t ring[MOTION_PVT_DEPTH]; ///< Queued points
+    volatile uint8_t head;             ///< Producer index
+    volatile uint8_t tail;             ///< Consumer index
+    bool armed;                        ///< begin() called, no push yet
+    volatile bool running;             ///< Consumer is interpolating
+    volatile bool abort_pending;       ///< Drop requested by producer
+    int32_t last_position;             ///< Last point reached (steps)
+    int32_t last_velocity;             ///< Velocity there (steps/s)
+    uint32_t elapsed_ms;               ///< Time since last point reached
+    int32_t position;                  ///< Last interpolated position
+    uint32_t underruns;                ///< Streams cut by an empty ring
+    uint32_t points_done;              ///< Points reached
+} PvtStream_t;
+
+static PvtStream_t streams[MAX_MOTORS];
+
+/* ==========================================================================
+ */
+/* Private Function Prototypes                                               */
+/* ==========================================================================
+ */
+
+static SystemError_t validate_point(uint8_t motor_id, const PvtPoint_t *point);
+static void hermite(const PvtStream_t *stream, const PvtPoint_t *next,
+                    int32_t *position, int32_t *velocity);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Reset all streams
+ */
+SystemError_t motion_pvt_init(void) {
+    memset(streams, 0, sizeof(streams));
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Arm a stream starting at rest at the given position
+ */
+SystemError_t motion_pvt_begin(uint8_t motor_id, int32_t start_position) {
+    if (motor_id >= MAX_MOTORS) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+
+    PvtStream_t *stream = &streams[motor_id];
+    if (stream->running) {
+        return ERROR_INVALID_STATE;
+    }
+
+    // The consumer does not touch a stopped stream, so an abort that
+    // arrived after it drained has nothing left to drop
+    stream->abort_pending = false;
+    stream->tail = stream->head;
+    stream->last_position = start_position;
+    stream->last_velocity = 0;
+    stream->elapsed_ms = 0;
+    stream->position = start_position;
+    stream->armed = true;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Append a batch of points to a stream (producer side)
+ */
+SystemError_t motion_pvt_push(uint8_t motor_id, const PvtPoint_t *points,
+                              uint8_t count) {
+    if (motor_id >= MAX_MOTORS) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+    if (points == NULL || count == 0) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    PvtStream_t *stream = &streams[motor_id];
+    if (!stream->armed && !stream->running) {
+        return ERROR_INVALID_STATE;
+    }
+
+    // All or nothing, so a batch never splits across an overflow
+    uint8_t head = stream->head;
+    if (count > MOTION_PVT_DEPTH - (uint8_t)(head - stream->tail)) {
+        return ERROR_BUFFER_OVERFLOW;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        SystemError_t result = validate_point(motor_id, &points[i]);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+    }
+
+    for (uint8_t i = 0; i < count; i++) {
+        stream->ring[(uint8_t)(head + i) & MOTION_PVT_MASK] = points[i];
+    }
+
+    // Publish the points only once they are fully written
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    stream->head = (uint8_t)(head + count);
+
+    if (stream->armed) {
+        stream->armed = false;
+        stream->running = true;
+    } else {
+        // The consumer may have drained and stopped after the check above,
+        // before seeing this batch. It never reads a stopped stream again,
+        // so take the points back rather than leave them stranded.
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (!stream->running && stream->tail != stream->head) {
+            stream->head = head;
+            return ERROR_INVALID_STATE;
+        }
+    }
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Whether a motor's stream is running
+ */
+bool motion_pvt_is_active(uint8_t motor_id) {
+    return motor_id < MAX_MOTORS && streams[motor_id].running;
+}
+
+/**
+ * @brief Advance a stream one tick (consumer side)
+ */
+SystemError_t motion_pvt_update(uint8_t motor_id, uint32_t dt_ms,
+                                int32_t *target_pos, int32_t *target_vel) {
+    if (motor_id >= MAX_MOTORS || target_pos == NULL || target_vel == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    PvtStream_t *stream = &streams[motor_id];
+    if (stream->abort_pending) {
+        stream->tail = stream->head;
+        stream->running = false;
+        stream->abort_pending = false;
+    }
+    if (!stream->running) {
+        return ERROR_INVALID_STATE;
+    }
+
+    uint8_t head = stream->head;
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+    // Pop every point this tick reaches or passes
+    stream->elapsed_ms += dt_ms;
+    while (stream->tail != head) {
+        const PvtPoint_t *next =
+            &stream->ring[stream->tail & MOTION_PVT_MASK];
+        if (stream->elapsed_ms < next->duration_ms) {
+            break;
+        }
+        stream->elapsed_ms -= next->duration_ms;
+        stream->last_position = next->position;
+        stream->last_velocity = next->velocity;
+        stream->points_done++;
+        stream->tail = (uint8_t)(stream->tail + 1U);
+    }
+
+    if (stream->tail == head) {
+        // Drained: a normal end at rest, an underrun while moving
+        if (stream->last_velocity != 0) {
+            stream->underruns++;
+        }
+        stream->running = false;
+        stream->elapsed_ms = 0;
+        stream->position = stream->last_position;
+        *target_pos = stream->last_position;
+        *target_vel = 0;
+        return SYSTEM_OK;
+    }
+
+    hermite(stream, &stream->ring[stream->tail & MOTION_PVT_MASK], target_pos,
+            target_vel);
+    stream->position = *target_pos;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Stop a stream at its last setpoint and drop queued points
+ */
+void motion_pvt_abort(uint8_t motor_id) {
+    if (motor_id >= MAX_MOTORS) {
+        return;
+    }
+
+    // The consumer owns tail, so it performs the drop on its next tick. It
+    // may drain the stream between a check of running and this store, so
+    // the request is made unconditionally and begin() discards it.
+    streams[motor_id].armed = false;
+    streams[motor_id].abort_pending = true;
+    position_control_clear_feedforward(motor_id);
+}
+
+/**
+ * @brief Get stream status
+ */
+SystemError_t motion_pvt_get_status(uint8_t motor_id, PvtStatus_t *status) {
+    if (motor_id >= MAX_MOTORS) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+    if (status == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    const PvtStream_t *stream = &streams[motor_id];
+    status->running = stream->running;
+    status->queued = (uint8_t)(stream->head - stream->tail);
+    status->free = (uint8_t)(MOTION_PVT_DEPTH - status->queued);
+    status->underruns = stream->underruns;
+    status->points_done = stream->points_done;
+    status->position = stream->position;
+
+    return SYSTEM_OK;
+}
+
+/* ==========================================================================
+ */
+/* Private Function Implementations                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Check a streamed point against the motor and soft limits
+ */
+static SystemError_t validate_point(uint8_t motor_id,
+                                    const PvtPoint_t *point) {
+    if (point->duration_ms == 0) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    if (abs(point->position) > MOTOR_MAX_POSITION_STEPS) {
+        return ERROR_MOTOR_POSITION_OUT_OF_RANGE;
+    }
+    if (abs(point->velocity) > MOTOR_MAX_SPEED) {
+        return ERROR_MOTOR_PARAMETER_OUT_OF_RANGE;
+    }
+
+    PositionValidationResult_t validation;
+    SystemError_t result = position_safety_validate_target(
+        motor_id, (float)point->position * STEPS_TO_DEGREES, &validation);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    if (!validation.position_valid) {
+        return ERROR_POSITION_LIMIT_EXCEEDED;
+    }
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Cubic Hermite interpolation from the last point to the next
+ * @details Evaluated relative to the last point so float resolution is
+ *          spent on the segment, not on the absolute position.
+ */
+static void hermite(const PvtStream_t *stream, const PvtPoint_t *next,
+                    int32_t *position, int32_t *velocity) {
+    const float span_s = (float)next->duration_ms / 1000.0f;
+    const float s = (float)stream->elapsed_ms / (float)next->duration_ms;
+    const float s2 = s * s;
+    const float s3 = s2 * s;
+    const float delta = (float)(next->position - stream->last_position);
+    const float m0 = (float)stream->last_velocity * span_s;
+    const float m1 = (float)next->velocity * span_s;
+
+    // h10, h01 and h11 basis functions (h00 is folded into the base)
+    float offset = (s3 - 2.0f * s2 + s) * m0 +
+                   (-2.0f * s3 + 3.0f * s2) * delta + (s3 - s2) * m1;
+    float rate = (3.0f * s2 - 4.0f * s + 1.0f) * m0 +
+                 (-6.0f * s2 + 6.0f * s) * delta + (3.0f * s2 - 2.0f * s) * m1;
+
+    *position = stream->last_position + (int32_t)lroundf(offset);
+    *velocity = (int32_t)lroundf(rate / span_s);
+}
@@ -0,0 +1,113 @@
+/**
+ * @file motion_pvt.h
+ * @brief Streamed position-velocity-time (PVT) trajectory buffer
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details The host generates the path and streams it as PVT points: a
+ *          position and velocity to be reached a given time after the
+ *          previous point. Each motor has its own single-producer /
+ *          single-consumer ring; the comm layer pushes whole batches, the
+ *          1 kHz motion task pops points and interpolates between them with
+ *          a cubic Hermite segment, so position and velocity are continuous
+ *          at every point.
+ *
+ *          A stream is armed with motion_pvt_begin() at the motor's current
+ *          setpoint and runs once the first batch is pushed. It ends when
+ *          the ring drains at a point with zero velocity; draining while
+ *          still moving is an underrun and stops the stream at the last
+ *          point reached.
+ */
+
+#ifndef MOTION_PVT_H
+#define MOTION_PVT_H
+
+#include "common/error_codes.h"
+#include "config/motor_config.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Points per motor ring (power of two)
+#define MOTION_PVT_DEPTH 64U
+#define MOTION_PVT_MASK (MOTION_PVT_DEPTH - 1U)
+
+/**
+ * @brief One streamed trajectory point
+ */
+typedef struct {
+    int32_t position;     ///< Position at the point (steps)
+    int32_t velocity;     ///< Signed velocity at the point (steps/s)
+    uint32_t duration_ms; ///< Time from the previous point (ms, > 0)
+} PvtPoint_t;
+
+/**
+ * @brief Per-motor stream status
+ */
+typedef struct {
+    bool running;         ///< Stream is being interpolated
+    uint8_t queued;       ///< Points waiting in the ring
+    uint8_t free;         ///< Free ring slots
+    uint32_t underruns;   ///< Streams cut short by an empty ring
+    uint32_t points_done; ///< Points reached since init
+    int32_t position;     ///< Last interpolated position (steps)
+} PvtStatus_t;
+
+/**
+ * @brief Reset all streams
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_pvt_init(void);
+
+/**
+ * @brief Arm a stream starting at rest at the given position
+ * @param motor_id Motor identifier
+ * @param start_position Current position setpoint (steps)
+ * @return ERROR_INVALID_STATE if a stream is running
+ */
+SystemError_t motion_pvt_begin(uint8_t motor_id, int32_t start_position);
+
+/**
+ * @brief Append a batch of points to a stream (producer side)
+ * @param motor_id Motor identifier
+ * @param points Points in time order
+ * @param count Number of points
+ * @return ERROR_BUFFER_OVERFLOW if the batch does not fit (nothing is
+ *         queued), ERROR_INVALID_STATE if no stream is armed or running
+ *         (also when it underran during the push; nothing is queued),
+ *         ERROR_POSITION_LIMIT_EXCEEDED if a point is outside the soft
+ *         limits (position_safety_validate_target)
+ */
+SystemError_t motion_pvt_push(uint8_t motor_id, const PvtPoint_t *points,
+                              uint8_t count);
+
+/**
+ * @brief Whether a motor's stream is running
+ */
+bool motion_pvt_is_active(uint8_t motor_id);
+
+/**
+ * @brief Advance a stream one tick (consumer side)
+ * @param motor_id Motor identifier
+ * @param dt_ms Tick length in milliseconds
+ * @param target_pos Output: position setpoint (steps)
+ * @param target_vel Output: signed velocity setpoint (steps/s)
+ * @return ERROR_INVALID_STATE if the stream is not running
+ */
+SystemError_t motion_pvt_update(uint8_t motor_id, uint32_t dt_ms,
+                                int32_t *target_pos, int32_t *target_vel);
+
+/**
+ * @brief Stop a stream at its last setpoint and drop queued points
+ * @param motor_id Motor identifier
+ */
+void motion_pvt_abort(uint8_t motor_id);
+
+/**
+ * @brief Get stream status
+ * @param motor_id Motor identifier
+ * @param status Pointer to store status
+ * @return SystemError_t Operation result
+ */
+SystemError_t motion_pvt_get_status(uint8_t motor_id, PvtStatus_t *status);
+
+#endif // MOTION_PVT_H
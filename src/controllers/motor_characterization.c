@@ -18,6 +18,7 @@
 #include "motor_characterization.h"
 #include "common/data_types.h"
 #include "common/system_state.h"
+#include "config/l6470_registers_generated.h"
 #include "config/motor_config.h"
 #include "drivers/as5600/as5600_driver.h"
 #include "drivers/l6470/l6470_driver.h"
@@ -986,26 +987,27 @@ static SystemError_t
 optimize_l6470_motion_profile(const MotorPhysicalParameters_t *motor_params,
                               OptimalControlParameters_t *optimal_params) {
   // Get baseline motion parameters from SSOT
-  optimal_params->optimal_acceleration = MOTOR1_ACCELERATION_DEFAULT;
-  optimal_params->optimal_deceleration = MOTOR1_DECELERATION_DEFAULT;
   optimal_params->optimal_max_speed = MOTOR1_MAX_SPEED_DEFAULT;
   optimal_params->optimal_min_speed = MOTOR1_MIN_SPEED_DEFAULT;
 
+  // Scale in milli-steps/s² and re-encode so the result is saturated to
+  // the ACC/DEC register range
+  uint32_t acc_msteps = l6470_acc_decode(MOTOR1_ACCELERATION_DEFAULT);
+  uint32_t dec_msteps = l6470_dec_decode(MOTOR1_DECELERATION_DEFAULT);
+
   // Optimize based on inertia characteristics
   float inertia_factor = motor_params->rotor_inertia_kg_m2 / 1e-5f; // Normalize
 
   // Lower inertia allows higher acceleration
   if (inertia_factor < 0.5f) {
-    optimal_params->optimal_acceleration =
-        (uint16_t)(optimal_params->optimal_acceleration * 1.2f);
-    optimal_params->optimal_deceleration =
-        (uint16_t)(optimal_params->optimal_deceleration * 1.2f);
+    acc_msteps = acc_msteps / 5U * 6U;
+    dec_msteps = dec_msteps / 5U * 6U;
   } else if (inertia_factor > 2.0f) {
-    optimal_params->optimal_acceleration =
-        (uint16_t)(optimal_params->optimal_acceleration * 0.8f);
-    optimal_params->optimal_deceleration =
-        (uint16_t)(optimal_params->optimal_deceleration * 0.8f);
+    acc_msteps = acc_msteps / 5U * 4U;
+    dec_msteps = dec_msteps / 5U * 4U;
   }
+  optimal_params->optimal_acceleration = (uint16_t)l6470_acc_encode(acc_msteps);
+  optimal_params->optimal_deceleration = (uint16_t)l6470_dec_encode(dec_msteps);
 
   // Optimize jerk limiting
   optimal_params->optimal_jerk_limit =
@@ -378,6 +378,12 @@ SystemError_t motor_controller_update(void) {
         state->last_update_time = HAL_Abstraction_GetTick();
     }
 
+    // Coalesced register writes and background read-back, once per tick
+    SystemError_t service_result = l6470_service();
+    if (service_result != SYSTEM_OK) {
+        overall_result = service_result;
+    }
+
     return overall_result;
 }
 
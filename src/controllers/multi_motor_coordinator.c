@@ -9,12 +9,16 @@
  */
 
 #include "multi_motor_coordinator.h"
+#include "communication/comm_protocol.h"
 #include "config/comm_config.h" // for INVALID_DEVICE_ID
 #include "config/motor_config.h"
 #include "config/safety_config.h"
 #include "hal_abstraction/hal_abstraction.h"
+#include "motion_lookahead.h"
 #include "motion_profile.h"
+#include "motion_pvt.h"
 #include "position_control.h"
+#include "position_safety.h"
 #include "safety/fault_monitor.h"
 #include "safety/safety_system.h"
 #include <math.h>
@@ -28,7 +32,7 @@
  */
 
 static SystemError_t
-validate_coordinated_move(CoordinatedMoveCommand_t *move_cmd);
+validate_coordinated_move(const CoordinatedMoveCommand_t *move_cmd);
 static SystemError_t
 execute_synchronized_move(CoordinatedMoveCommand_t *move_cmd);
 static SystemError_t
@@ -43,8 +47,13 @@ static void update_load_sharing(uint32_t dt_ms);
 static void update_master_slave_motion(uint32_t dt_ms);
 static void check_motion_completion(void);
 static void calculate_sync_error(CoordinationStatus_t *status);
-static uint32_t calculate_move_time(int32_t distance, uint32_t max_velocity,
-                                    uint32_t acceleration);
+static int32_t sync_axis_error(uint8_t motor_id, const int32_t *positions);
+static int32_t setpoint_position(uint8_t motor_id);
+static bool within_soft_limits(uint8_t motor_id, int32_t position);
+static SystemError_t engage_follower(uint8_t slave_id,
+                                     const MotionFollowLaw_t *law,
+                                     bool at_cycle_end);
+static void release_followers(void);
 
 /* ==========================================================================
  */
@@ -52,9 +61,28 @@ static uint32_t calculate_move_time(int32_t distance, uint32_t max_velocity,
 /* ==========================================================================
  */
 
+/**
+ * @brief Joint-space line of the last time-synchronised move
+ */
+typedef struct {
+    bool valid;                   ///< A synchronised move has been planned
+    bool axis[MAX_MOTORS];        ///< Motor takes part in the move
+    int32_t start[MAX_MOTORS];    ///< Start setpoint (steps)
+    int32_t distance[MAX_MOTORS]; ///< Signed travel (steps)
+    uint8_t reference;            ///< Axis with the longest travel
+} SyncMoveLine_t;
+
 // Multi-motor coordination state
 static MultiMotorCoordinator_t coordinator;
 static bool coordinator_initialized = false;
+static SyncMoveLine_t sync_line;
+
+// Gear / cam followers, evaluated by multi_motor_follow_update(). A
+// follower is only read by the control task once follower_engaged is set.
+static MotionFollower_t followers[MAX_MOTORS];
+static volatile bool follower_engaged[MAX_MOTORS];
+static int32_t following_error[MAX_MOTORS];
+static int32_t peak_following_error[MAX_MOTORS];
 
 /**
  * @brief Initialize multi-motor coordination system
@@ -71,6 +99,8 @@ SystemError_t multi_motor_init(void) {
 #endif
     // Clear coordinator state
     memset(&coordinator, 0, sizeof(coordinator));
+    memset(&sync_line, 0, sizeof(sync_line));
+    release_followers();
 
     // Initialize motor states
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
@@ -96,6 +126,9 @@ SystemError_t multi_motor_init(void) {
     coordinator.motion_state.active = false;
     coordinator.motion_state.sequence_step = 0;
 
+    // Blended sequences run from the look-ahead queue
+    motion_lookahead_init();
+
     coordinator_initialized = true;
 
     return SYSTEM_OK;
@@ -125,6 +158,7 @@ SystemError_t multi_motor_enable_motor(uint8_t motor_id, bool enable) {
         // Disable synchronization and load sharing for disabled motor
         coordinator.motor_states[motor_id].synchronized = false;
         coordinator.motor_states[motor_id].load_share_enabled = false;
+        follower_engaged[motor_id] = false;
     }
 
     return SYSTEM_OK;
@@ -147,6 +181,9 @@ SystemError_t multi_motor_set_mode(CoordinationMode_t mode) {
 
     coordinator.motion_state.mode = mode;
 
+    // Gear and cam relationships belong to the previous master assignment
+    release_followers();
+
     // Configure motors based on mode
     switch (mode) {
     case COORDINATION_MODE_INDEPENDENT:
@@ -223,6 +260,9 @@ multi_motor_coordinated_move(CoordinatedMoveCommand_t *move_cmd) {
     memcpy(&coordinator.current_move, move_cmd,
            sizeof(CoordinatedMoveCommand_t));
 
+    // Only a synchronised move plans a new line to measure against
+    sync_line.valid = false;
+
     // Execute based on coordination mode
     switch (coordinator.motion_state.mode) {
     case COORDINATION_MODE_SYNCHRONIZED:
@@ -251,6 +291,103 @@ multi_motor_coordinated_move(CoordinatedMoveCommand_t *move_cmd) {
     return result;
 }
 
+/**
+ * @brief Queue a coordinated move on the look-ahead planner
+ * @param move_cmd Coordinated move command
+ * @return SystemError_t Operation result
+ * @details Consecutive queued moves are blended through their junctions
+ *          instead of stopping between them. The first move of a run
+ *          starts from the current position setpoints.
+ */
+SystemError_t
+multi_motor_queue_move(const CoordinatedMoveCommand_t *move_cmd) {
+    if (!coordinator_initialized || move_cmd == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    // Per-motor profiles and queued segments must not drive the same axes
+    bool queue_running = motion_lookahead_is_active();
+    if (coordinator.motion_state.active && !queue_running) {
+        return ERROR_MOTION_ACTIVE;
+    }
+
+    SystemError_t result = validate_coordinated_move(move_cmd);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    if (!queue_running) {
+        int32_t origin[MAX_MOTORS];
+        for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+            origin[i] = setpoint_position(i);
+        }
+        result = motion_lookahead_set_origin(origin);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+    }
+
+    result = motion_lookahead_push(move_cmd);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    // Blended segments leave the line of the last synchronised move
+    sync_line.valid = false;
+
+    memcpy(&coordinator.current_move, move_cmd,
+           sizeof(CoordinatedMoveCommand_t));
+    if (!coordinator.motion_state.active) {
+        coordinator.motion_state.active = true;
+        coordinator.motion_state.start_time = HAL_Abstraction_GetTick();
+    }
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Execute a sequence of coordinated moves
+ * @param sequence Array of move commands
+ * @param sequence_length Number of moves
+ * @return SystemError_t Operation result
+ * @details The whole sequence is queued on the look-ahead planner, so
+ *          moves are blended and the axes only stop at reversals and at
+ *          the end of the sequence.
+ */
+SystemError_t multi_motor_execute_sequence(CoordinatedMoveCommand_t *sequence,
+                                           uint8_t sequence_length) {
+    if (!coordinator_initialized || sequence == NULL ||
+        sequence_length == 0) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    if (coordinator.motion_state.active) {
+        return ERROR_MOTION_ACTIVE;
+    }
+
+    if (sequence_length > motion_lookahead_free_slots()) {
+        return ERROR_BUFFER_OVERFLOW;
+    }
+
+    // Validate everything up front so a bad entry queues nothing
+    for (uint8_t i = 0; i < sequence_length; i++) {
+        SystemError_t result = validate_coordinated_move(&sequence[i]);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+    }
+
+    for (uint8_t i = 0; i < sequence_length; i++) {
+        SystemError_t result = multi_motor_queue_move(&sequence[i]);
+        if (result != SYSTEM_OK) {
+            multi_motor_stop_coordinated_motion();
+            return result;
+        }
+    }
+
+    return SYSTEM_OK;
+}
+
 /**
  * @brief Update coordination system (call from main control loop)
  * @param dt_ms Time step in milliseconds
@@ -301,15 +438,21 @@ SystemError_t multi_motor_stop_coordinated_motion(void) {
         return ERROR_NOT_INITIALIZED;
     }
 
+    // A batch waiting for its start would restart the motors
+    comm_cancel_pending_batch();
+
     // Stop all enabled motors
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
         if (coordinator.motor_states[i].enabled) {
             motion_profile_stop(i);
+            motion_pvt_abort(i);
         }
     }
+    motion_lookahead_abort();
 
     coordinator.motion_state.active = false;
     coordinator.motion_state.sequence_step = 0;
+    sync_line.valid = false;
 
     return SYSTEM_OK;
 }
@@ -337,6 +480,9 @@ SystemError_t multi_motor_get_status(CoordinationStatus_t *status) {
             coordinator.motor_states[i].synchronized;
         status->motor_load_share[i] =
             coordinator.motor_states[i].load_share_enabled;
+        status->motor_following[i] = follower_engaged[i];
+        status->following_error[i] = following_error[i];
+        status->peak_following_error[i] = peak_following_error[i];
 
         // Get position control status
         PositionControlStatus_t pos_status;
@@ -386,11 +532,121 @@ SystemError_t multi_motor_configure_load_sharing(LoadSharingConfig_t *config) {
     return SYSTEM_OK;
 }
 
+/**
+ * @brief Gear a slave to the sync master
+ * @param slave_id Slave motor
+ * @param numerator Slave steps per denominator master steps (signed)
+ * @param denominator Master steps per numerator slave steps
+ * @return SystemError_t Operation result
+ * @note Engages at the current setpoints, or switches an engaged follower
+ *       immediately without a setpoint jump.
+ */
+SystemError_t multi_motor_set_gear_ratio(uint8_t slave_id, int32_t numerator,
+                                         uint32_t denominator) {
+    MotionFollowLaw_t law = {.mode = MOTION_FOLLOW_GEAR,
+                             .gear_numerator = numerator,
+                             .gear_denominator = denominator,
+                             .cam = NULL};
+
+    return engage_follower(slave_id, &law, false);
+}
+
+/**
+ * @brief Drive a slave from a cam table on the sync master
+ * @param slave_id Slave motor
+ * @param cam Cam table; must stay valid while in use
+ * @param at_cycle_end When a cam is running, switch at its next cycle
+ *        boundary instead of immediately
+ * @return SystemError_t Operation result
+ */
+SystemError_t multi_motor_set_cam(uint8_t slave_id,
+                                  const MotionCamTable_t *cam,
+                                  bool at_cycle_end) {
+    MotionFollowLaw_t law = {.mode = MOTION_FOLLOW_CAM,
+                             .gear_numerator = 0,
+                             .gear_denominator = 0,
+                             .cam = cam};
+
+    return engage_follower(slave_id, &law, at_cycle_end);
+}
+
+/**
+ * @brief Stop a slave following; it holds its last setpoint
+ * @param slave_id Slave motor
+ * @return SystemError_t Operation result
+ */
+SystemError_t multi_motor_release_follower(uint8_t slave_id) {
+    if (slave_id >= MAX_MOTORS || !coordinator_initialized) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+
+    follower_engaged[slave_id] = false;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Evaluate gear and cam followers (call every control tick)
+ * @param dt_ms Time step in milliseconds
+ * @return SystemError_t Operation result
+ * @note Runs right after the master's profile step so slaves follow the
+ *       master setpoint of the same tick.
+ */
+SystemError_t multi_motor_follow_update(uint32_t dt_ms) {
+    if (!coordinator_initialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+    if (coordinator.motion_state.mode != COORDINATION_MODE_MASTER_SLAVE ||
+        dt_ms == 0) {
+        return SYSTEM_OK;
+    }
+
+    int32_t master_position =
+        setpoint_position(coordinator.sync_config.sync_master);
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        if (!follower_engaged[i]) {
+            continue;
+        }
+        __atomic_thread_fence(__ATOMIC_ACQUIRE);
+
+        // Error of the setpoint position control has just been tracking
+        PositionControlStatus_t pos_status;
+        if (position_control_get_status(i, &pos_status) == SYSTEM_OK) {
+            following_error[i] =
+                followers[i].setpoint - pos_status.current_position;
+            if (abs(following_error[i]) > peak_following_error[i]) {
+                peak_following_error[i] = abs(following_error[i]);
+            }
+        }
+
+        int32_t previous = followers[i].setpoint;
+        int32_t setpoint = motion_cam_evaluate(&followers[i], master_position);
+
+        // A law can carry the slave past its soft limits; it then stops
+        // following at the last setpoint inside them
+        if (!within_soft_limits(i, setpoint)) {
+            follower_engaged[i] = false;
+            followers[i].setpoint = previous;
+            position_control_set_profile_setpoint(i, previous, 0);
+            safety_log_event(SAFETY_EVENT_LIMIT_VIOLATION, i,
+                             (uint32_t)setpoint);
+            continue;
+        }
+        int32_t velocity = (int32_t)((int64_t)(setpoint - previous) * 1000 /
+                                     (int64_t)dt_ms);
+
+        position_control_set_profile_setpoint(i, setpoint, velocity);
+    }
+
+    return SYSTEM_OK;
+}
+
 /**
  * @brief Validate coordinated move command
  */
 static SystemError_t
-validate_coordinated_move(CoordinatedMoveCommand_t *move_cmd) {
+validate_coordinated_move(const CoordinatedMoveCommand_t *move_cmd) {
     // Check if any motor is enabled for the move
     bool any_motor_enabled = false;
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
@@ -403,6 +659,11 @@ validate_coordinated_move(CoordinatedMoveCommand_t *move_cmd) {
                 return ERROR_POSITION_OUT_OF_RANGE;
             }
 
+            int32_t target = move_cmd->motor_targets[i].target_position;
+            if (!within_soft_limits(i, target)) {
+                return ERROR_POSITION_LIMIT_EXCEEDED;
+            }
+
             if (move_cmd->motor_targets[i].max_velocity > MOTOR_MAX_SPEED) {
                 return ERROR_VELOCITY_OUT_OF_RANGE;
             }
@@ -421,53 +682,49 @@ validate_coordinated_move(CoordinatedMoveCommand_t *move_cmd) {
  */
 static SystemError_t
 execute_synchronized_move(CoordinatedMoveCommand_t *move_cmd) {
-    // Calculate move time based on slowest motor
-    uint32_t max_move_time = 0;
+    // One common time base for all axes, each within its own limits, so
+    // the motors stay on the straight joint-space line to the target
+    MotionSyncAxis_t axes[MAX_MOTORS];
+    uint8_t axis_count = 0;
+    int32_t longest = -1;
 
+    memset(&sync_line, 0, sizeof(sync_line));
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
         if (move_cmd->motor_targets[i].enabled &&
             coordinator.motor_states[i].enabled) {
-            // Get current position
-            PositionControlStatus_t pos_status;
-            position_control_get_status(i, &pos_status);
-
-            // Calculate distance and time needed
-            int32_t distance = abs(move_cmd->motor_targets[i].target_position -
-                                   pos_status.current_position);
-            uint32_t move_time = calculate_move_time(
-                distance, move_cmd->motor_targets[i].max_velocity,
-                move_cmd->motor_targets[i].acceleration);
-
-            if (move_time > max_move_time) {
-                max_move_time = move_time;
+            const MotorTarget_t *target = &move_cmd->motor_targets[i];
+            int32_t start = setpoint_position(i);
+
+            axes[axis_count++] = (MotionSyncAxis_t){
+                .motor_id = i,
+                .start_position = start,
+                .end_position = target->target_position,
+                .max_velocity = target->max_velocity,
+                .acceleration = target->acceleration,
+                .deceleration = target->deceleration};
+
+            sync_line.axis[i] = true;
+            sync_line.start[i] = start;
+            sync_line.distance[i] = target->target_position - start;
+            if (abs(sync_line.distance[i]) > longest) {
+                longest = abs(sync_line.distance[i]);
+                sync_line.reference = i;
             }
         }
     }
 
-    // Create synchronized motion profiles
-    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
-        if (move_cmd->motor_targets[i].enabled &&
-            coordinator.motor_states[i].enabled) {
-            MotionProfile_t profile_config = {
-                .type = PROFILE_TRAPEZOIDAL,
-                .start_position = coordinator.motor_states[i].current_position,
-                .end_position = move_cmd->motor_targets[i].target_position,
-                .max_velocity = move_cmd->motor_targets[i].max_velocity,
-                .acceleration = move_cmd->motor_targets[i].acceleration,
-                .direction = (move_cmd->motor_targets[i].target_position >
-                              coordinator.motor_states[i].current_position)
-                                 ? DIRECTION_FORWARD
-                                 : DIRECTION_BACKWARD};
+    if (axis_count == 0) {
+        return ERROR_NO_MOTORS_ENABLED;
+    }
 
-            SystemError_t result = motion_profile_start(i, &profile_config);
-            if (result != SYSTEM_OK) {
-                // Stop all motors on failure
-                multi_motor_stop_coordinated_motion();
-                return result;
-            }
-        }
+    SystemError_t result = motion_profile_start_synchronized(axes, axis_count);
+    if (result != SYSTEM_OK) {
+        // Stop all motors on failure
+        multi_motor_stop_coordinated_motion();
+        return result;
     }
 
+    sync_line.valid = true;
     return SYSTEM_OK;
 }
 
@@ -639,15 +896,16 @@ static void update_motor_states(void) {
  * @brief Update synchronized motion
  */
 static void update_synchronized_motion(uint32_t dt_ms) {
+    int32_t positions[MAX_MOTORS];
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        positions[i] = coordinator.motor_states[i].current_position;
+    }
+
     // Check synchronization between motors
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
         if (coordinator.motor_states[i].synchronized &&
             coordinator.motor_states[i].enabled) {
-            // Calculate synchronization error relative to master
-            uint8_t master_id = coordinator.sync_config.sync_master;
-            int32_t sync_error =
-                coordinator.motor_states[i].current_position -
-                coordinator.motor_states[master_id].current_position;
+            int32_t sync_error = sync_axis_error(i, positions);
 
             if (abs(sync_error) > coordinator.sync_config.sync_tolerance) {
                 // Report synchronization fault
@@ -718,10 +976,11 @@ static void update_master_slave_motion(uint32_t dt_ms) {
     int32_t master_position =
         coordinator.motor_states[master_id].current_position;
 
-    // Update slave motors to follow master
+    // Update slave motors to follow master; geared and cammed slaves are
+    // driven every control tick by multi_motor_follow_update()
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
         if (i != master_id && coordinator.motor_states[i].synchronized &&
-            coordinator.motor_states[i].enabled) {
+            coordinator.motor_states[i].enabled && !follower_engaged[i]) {
             int32_t slave_target =
                 master_position + coordinator.motor_states[i].slave_offset;
             position_control_set_target(i, slave_target);
@@ -735,6 +994,11 @@ static void update_master_slave_motion(uint32_t dt_ms) {
 static void check_motion_completion(void) {
     bool all_settled = true;
 
+    // Queued segments are still to run, whatever the axes report now
+    if (motion_lookahead_is_active()) {
+        return;
+    }
+
     for (uint8_t i = 0; i < MAX_MOTORS; i++) {
         if (coordinator.motor_states[i].enabled &&
             coordinator.current_move.motor_targets[i].enabled) {
@@ -749,6 +1013,7 @@ static void check_motion_completion(void) {
     if (all_settled) {
         coordinator.motion_state.active = false;
         coordinator.motion_state.sequence_step = 0;
+        sync_line.valid = false;
     }
 }
 
@@ -761,6 +1026,19 @@ static void calculate_sync_error(CoordinationStatus_t *status) {
         return;
     }
 
+    // Deviation from the line of the synchronised move
+    if (sync_line.valid) {
+        int32_t max_error = 0;
+        for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+            int32_t error = abs(sync_axis_error(i, status->motor_positions));
+            if (sync_line.axis[i] && error > max_error) {
+                max_error = error;
+            }
+        }
+        status->max_sync_error = max_error;
+        return;
+    }
+
     int32_t min_pos = INT32_MAX;
     int32_t max_pos = INT32_MIN;
 
@@ -779,23 +1057,106 @@ static void calculate_sync_error(CoordinationStatus_t *status) {
 }
 
 /**
- * @brief Calculate move time for given parameters
- */
-static uint32_t calculate_move_time(int32_t distance, uint32_t max_velocity,
-                                    uint32_t acceleration) {
-    // Simple trapezoidal profile time calculation
-    float accel_time = (float)max_velocity / (float)acceleration;
-    float accel_distance =
-        0.5f * (float)acceleration * accel_time * accel_time;
-
-    if (2.0f * accel_distance >= (float)distance) {
-        // Triangular profile
-        return (uint32_t)(2.0f * sqrtf((float)distance / (float)acceleration) *
-                          1000.0f);
-    } else {
-        // Trapezoidal profile
-        float constant_distance = (float)distance - 2.0f * accel_distance;
-        float constant_time = constant_distance / (float)max_velocity;
-        return (uint32_t)((2.0f * accel_time + constant_time) * 1000.0f);
+ * @brief Position error of one axis relative to the synchronised line
+ * @details The expected position follows the reference axis' progress
+ *          along the move. Without a synchronised move this falls back to
+ *          the offset from the sync master.
+ */
+static int32_t sync_axis_error(uint8_t motor_id, const int32_t *positions) {
+    if (!sync_line.valid || !sync_line.axis[motor_id]) {
+        return positions[motor_id] -
+               positions[coordinator.sync_config.sync_master];
+    }
+
+    // Exact in int64: a float progress loses whole steps on long moves
+    uint8_t ref = sync_line.reference;
+    int64_t expected = sync_line.distance[motor_id];
+    if (sync_line.distance[ref] != 0) {
+        int64_t travel = (int64_t)sync_line.distance[motor_id] *
+                         ((int64_t)positions[ref] - sync_line.start[ref]);
+        int64_t span = sync_line.distance[ref];
+        if (span < 0) {
+            travel = -travel;
+            span = -span;
+        }
+        // Rounded to the nearest step
+        expected = (travel >= 0 ? travel + span / 2 : travel - span / 2) / span;
+    }
+
+    return (int32_t)((int64_t)positions[motor_id] - sync_line.start[motor_id] -
+                     expected);
+}
+
+/**
+ * @brief Position setpoint a new move of a motor starts from
+ */
+static int32_t setpoint_position(uint8_t motor_id) {
+    PositionControlStatus_t pos_status;
+    if (position_control_get_status(motor_id, &pos_status) == SYSTEM_OK) {
+        return pos_status.target_position;
+    }
+    return coordinator.motor_states[motor_id].current_position;
+}
+
+/**
+ * @brief Check a position setpoint against a motor's soft limits
+ */
+static bool within_soft_limits(uint8_t motor_id, int32_t position) {
+    PositionValidationResult_t validation;
+    return position_safety_validate_target(
+               motor_id, (float)position * STEPS_TO_DEGREES, &validation) ==
+               SYSTEM_OK &&
+           validation.position_valid;
+}
+
+/**
+ * @brief Engage a gear / cam follower or latch a switch of its law
+ */
+static SystemError_t engage_follower(uint8_t slave_id,
+                                     const MotionFollowLaw_t *law,
+                                     bool at_cycle_end) {
+    if (!coordinator_initialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+    if (coordinator.motion_state.mode != COORDINATION_MODE_MASTER_SLAVE) {
+        return ERROR_INVALID_STATE;
+    }
+
+    uint8_t master_id = coordinator.sync_config.sync_master;
+    if (slave_id >= MAX_MOTORS || slave_id == master_id ||
+        !coordinator.motor_states[slave_id].enabled) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+
+    if (follower_engaged[slave_id]) {
+        return motion_cam_switch(&followers[slave_id], law, at_cycle_end);
+    }
+
+    // Not yet read by the control task: safe to set up in place
+    SystemError_t result =
+        motion_cam_engage(&followers[slave_id], law,
+                          setpoint_position(master_id),
+                          setpoint_position(slave_id));
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    following_error[slave_id] = 0;
+    peak_following_error[slave_id] = 0;
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+    follower_engaged[slave_id] = true;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Disengage every gear / cam follower
+ */
+static void release_followers(void) {
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        follower_engaged[i] = false;
+        motion_cam_follower_init(&followers[i]);
+        following_error[i] = 0;
+        peak_following_error[i] = 0;
     }
 }
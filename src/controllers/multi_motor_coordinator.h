@@ -14,6 +14,7 @@
 #include "common/data_types.h"
 #include "common/error_codes.h"
 #include "config/motor_config.h"
+#include "motion_cam.h"
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -153,6 +154,9 @@ typedef struct {
     int32_t motor_positions[MAX_MOTORS]; ///< Current motor positions
     bool motor_settled[MAX_MOTORS];      ///< Motor settled status
     int32_t max_sync_error;              ///< Maximum synchronization error
+    bool motor_following[MAX_MOTORS];    ///< Slave on a gear or cam
+    int32_t following_error[MAX_MOTORS]; ///< Slave setpoint - position
+    int32_t peak_following_error[MAX_MOTORS]; ///< Largest |error| seen
 } CoordinationStatus_t;
 
 // Core coordination functions
@@ -162,6 +166,7 @@ SystemError_t multi_motor_set_mode(CoordinationMode_t mode);
 
 // Motion control functions
 SystemError_t multi_motor_coordinated_move(CoordinatedMoveCommand_t *move_cmd);
+SystemError_t multi_motor_queue_move(const CoordinatedMoveCommand_t *move_cmd);
 SystemError_t multi_motor_update(uint32_t dt_ms);
 SystemError_t multi_motor_stop_coordinated_motion(void);
 
@@ -183,6 +188,15 @@ SystemError_t multi_motor_execute_sequence(CoordinatedMoveCommand_t *sequence,
 SystemError_t multi_motor_emergency_stop(void);
 SystemError_t multi_motor_home_all_motors(void);
 
+// Electronic gearing and cams (master-slave mode)
+SystemError_t multi_motor_set_gear_ratio(uint8_t slave_id, int32_t numerator,
+                                         uint32_t denominator);
+SystemError_t multi_motor_set_cam(uint8_t slave_id,
+                                  const MotionCamTable_t *cam,
+                                  bool at_cycle_end);
+SystemError_t multi_motor_release_follower(uint8_t slave_id);
+SystemError_t multi_motor_follow_update(uint32_t dt_ms);
+
 // Internal functions (declared for testing)
 // Internal functions are implemented in multi_motor_coordinator.c
 // (Static functions should not be declared in headers)
@@ -31,7 +31,7 @@ static void apply_position_filter(PositionControl_t *ctrl);
 static void calculate_velocity(PositionControl_t *ctrl, uint32_t dt_ms);
 static float calculate_pid_output(PositionControl_t *ctrl, uint32_t dt_ms);
 static float calculate_feedforward_output(PositionControl_t *ctrl,
-                                          uint32_t target_velocity,
+                                          int32_t target_velocity,
                                           uint32_t dt_ms);
 static float apply_output_limits(PositionControl_t *ctrl, float output);
 static SystemError_t send_motor_command(uint8_t motor_id, float output);
@@ -160,21 +160,8 @@ SystemError_t position_control_update(uint8_t motor_id, uint32_t dt_ms) {
   // Calculate velocity
   calculate_velocity(ctrl, dt_ms);
 
-  // Get motion profile targets if active
-  int32_t profile_target_pos = ctrl->state.target_position;
-  uint32_t profile_target_vel = 0;
-
-  if (motion_profile_is_active(motor_id)) {
-    MotionProfileStatus_t profile_status;
-    motion_profile_get_status(motor_id, &profile_status);
-    profile_target_pos = profile_status.current_target_position;
-    profile_target_vel = profile_status.current_target_velocity;
-
-    // Update target position from profile
-    ctrl->state.target_position = profile_target_pos;
-    ctrl->state.position_error =
-        ctrl->state.target_position - ctrl->state.current_position;
-  }
+  // Trajectory setpoints are pushed by the motion profile task each tick
+  int32_t profile_target_vel = ctrl->state.target_velocity;
 
   // Calculate PID output
   float pid_output = calculate_pid_output(ctrl, dt_ms);
@@ -249,10 +236,55 @@ SystemError_t position_control_set_target(uint8_t motor_id,
   }
 
   ctrl->state.target_position = safe_target_steps;
+  ctrl->state.target_velocity = 0;
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Set trajectory setpoint for motor
+ * @param motor_id Motor identifier
+ * @param position Position setpoint in steps
+ * @param velocity Signed velocity setpoint in steps/sec (feedforward)
+ * @return SystemError_t Operation result
+ * @note Called every tick by the motion profile task, so only the range
+ *       check of position_control_set_target() is repeated here. The soft
+ *       limits are checked where each source accepts its motion: profile,
+ *       coordinated and queued move targets in the coordinator, PVT points
+ *       in motion_pvt_push(), gear / cam setpoints every tick in
+ *       multi_motor_follow_update().
+ */
+SystemError_t position_control_set_profile_setpoint(uint8_t motor_id,
+                                                   int32_t position,
+                                                   int32_t velocity) {
+  if (motor_id >= MAX_MOTORS || !controller_initialized[motor_id]) {
+    return ERROR_MOTOR_INVALID_ID;
+  }
+
+  if (abs(position) > MAX_POSITION_STEPS) {
+    return ERROR_POSITION_OUT_OF_RANGE;
+  }
+
+  PositionControl_t *ctrl = &position_controllers[motor_id];
+  ctrl->state.target_position = position;
+  ctrl->state.target_velocity = velocity;
 
   return SYSTEM_OK;
 }
 
+/**
+ * @brief Drop the velocity feedforward of a stopped trajectory
+ * @param motor_id Motor identifier
+ * @note Called by the trajectory generators when a motion is stopped or
+ *       aborted. The position setpoint stays where the trajectory left it;
+ *       without this the last feedforward would keep driving the motor.
+ */
+void position_control_clear_feedforward(uint8_t motor_id) {
+  if (motor_id < MAX_MOTORS) {
+    position_controllers[motor_id].state.target_velocity = 0;
+  }
+}
+
 /**
  * @brief Get current motor position in degrees
  * @param motor_id Motor identifier
@@ -391,8 +423,10 @@ SystemError_t position_control_get_status(uint8_t motor_id,
  */
 static SystemError_t read_encoder_position(uint8_t motor_id,
                                            int32_t *position) {
-  uint16_t raw_angle;
-  SystemError_t result = as5600_read_angle(motor_id, &raw_angle);
+  // STATUS arrives with the angle, so a lost magnet fails the read
+  AS5600_Sample_t sample;
+  SystemError_t result =
+      as5600_read_burst(motor_id, AS5600_BURST_ANGLES, &sample);
 
   if (result != SYSTEM_OK) {
     return result;
@@ -400,7 +434,7 @@ static SystemError_t read_encoder_position(uint8_t motor_id,
 
   // Convert angle to steps (4096 counts per revolution)
   // Assuming motor has MOTOR_STEPS_PER_REV steps per revolution
-  *position = (int32_t)((uint32_t)raw_angle * MOTOR_STEPS_PER_REV / 4096);
+  *position = (int32_t)((uint32_t)sample.angle * MOTOR_STEPS_PER_REV / 4096);
 
   return SYSTEM_OK;
 }
@@ -478,7 +512,7 @@ static float calculate_pid_output(PositionControl_t *ctrl, uint32_t dt_ms) {
  * @brief Calculate feedforward output
  */
 static float calculate_feedforward_output(PositionControl_t *ctrl,
-                                          uint32_t target_velocity,
+                                          int32_t target_velocity,
                                           uint32_t dt_ms) {
   float velocity_ff = ctrl->feedforward.velocity_gain * (float)target_velocity;
 
@@ -492,7 +526,7 @@ static float calculate_feedforward_output(PositionControl_t *ctrl,
     accel_ff = ctrl->feedforward.acceleration_gain * acceleration;
   }
 
-  // Friction compensation (simple model)
+  // Friction compensation (simple model), signed with the direction of travel
   float friction_ff = 0.0f;
   if (target_velocity != 0) {
     friction_ff = (target_velocity > 0)
@@ -101,6 +101,7 @@ typedef struct {
 typedef struct {
     int32_t current_position;  ///< Current encoder position
     int32_t target_position;   ///< Target position
+    int32_t target_velocity;   ///< Trajectory velocity setpoint (steps/sec)
     int32_t position_error;    ///< Position error (target - current)
     int32_t filtered_position; ///< Filtered position
     float velocity;            ///< Current velocity
@@ -175,6 +176,10 @@ SystemError_t position_control_update(uint8_t motor_id, uint32_t dt_ms);
 // Position target management
 SystemError_t position_control_set_target(uint8_t motor_id,
                                           int32_t target_position);
+SystemError_t position_control_set_profile_setpoint(uint8_t motor_id,
+                                                   int32_t position,
+                                                   int32_t velocity);
+void position_control_clear_feedforward(uint8_t motor_id);
 SystemError_t position_control_enable(uint8_t motor_id, bool enable);
 
 // Homing functions
@@ -9,10 +9,13 @@
  */
 
 #include "real_time_control.h"
+#include "communication/comm_protocol.h"
 #include "config/motor_config.h"
 #include "config/safety_config.h"
 #include "hal_abstraction/hal_abstraction.h"
+#include "motion_lookahead.h"
 #include "motion_profile.h"
+#include "motion_pvt.h"
 #include "multi_motor_coordinator.h"
 #include "position_control.h"
 #include "position_safety.h"
@@ -21,6 +24,32 @@
 #include "stm32h7xx_hal_tim.h"
 #include <string.h>
 
+// Internal functions
+static SystemError_t configure_control_timer(void);
+static SystemError_t configure_safety_timer(void);
+static SystemError_t create_default_tasks(void);
+static void execute_priority_tasks(RTTaskPriority_t priority);
+static void execute_task(RTTask_t *task, uint32_t current_time);
+static void ready_queue_insert(RTTask_t *task);
+static void ready_queue_remove(RTTask_t *task);
+static void ready_queue_sift_up(RTReadyQueue_t *queue, uint8_t index);
+static void ready_queue_sift_down(RTReadyQueue_t *queue, uint8_t index);
+static bool release_before(const RTTask_t *a, const RTTask_t *b);
+static void update_timing_statistics(uint32_t execution_time);
+static void update_performance_monitoring(void);
+static uint32_t get_cycle_count(void);
+static uint32_t cycles_to_us(uint32_t cycles);
+static void summarize_histogram(const RTHistogram_t *histogram,
+                                RTLatencySummary_t *summary);
+static uint8_t *export_histogram(uint8_t *cursor,
+                                 const RTHistogram_t *histogram);
+
+// Default task functions
+static void position_control_task(void *context);
+static void motion_profile_task(void *context);
+static void coordination_task(void *context);
+static void safety_monitor_task(void *context);
+
 // Real-time control system state
 static RTControlSystem_t rt_control_system;
 static bool rt_system_initialized = false;
@@ -29,6 +58,13 @@ static bool rt_system_initialized = false;
 static TIM_HandleTypeDef htim_control_loop;
 static TIM_HandleTypeDef htim_safety_monitor;
 
+// DWT cycles per microsecond, latched at init from SystemCoreClock
+static uint32_t rt_cycles_per_us = 1;
+
+// Utilization window, reset by rt_control_init() so repeated runs replay
+static uint32_t utilization_window_start = 0;
+static uint32_t utilization_window_busy = 0;
+
 /**
  * @brief Initialize real-time control system
  * @return SystemError_t Operation result
@@ -36,6 +72,12 @@ static TIM_HandleTypeDef htim_safety_monitor;
 SystemError_t rt_control_init(void) {
     // Clear system state
     memset(&rt_control_system, 0, sizeof(rt_control_system));
+    rt_cycles_per_us = SystemCoreClock / 1000000U;
+    if (rt_cycles_per_us == 0) {
+        rt_cycles_per_us = 1;
+    }
+    utilization_window_start = get_cycle_count();
+    utilization_window_busy = 0;
 
     // Initialize control tasks
     for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
@@ -62,6 +104,9 @@ SystemError_t rt_control_init(void) {
     rt_control_system.performance.memory_usage = 0;
     rt_control_system.performance.stack_usage = 0;
 
+    // Host-streamed trajectories are consumed by the motion task
+    motion_pvt_init();
+
     // Configure control loop timer (1kHz for position control)
     SystemError_t result = configure_control_timer();
     if (result != SYSTEM_OK) {
@@ -74,20 +119,21 @@ SystemError_t rt_control_init(void) {
         return result;
     }
 
-    // Create default tasks
+    // Create default tasks (rt_control_create_task requires the flag)
+    rt_system_initialized = true;
     result = create_default_tasks();
     if (result != SYSTEM_OK) {
+        rt_system_initialized = false;
         return result;
     }
 
     // Initialize position safety system
     result = position_safety_init();
     if (result != SYSTEM_OK) {
+        rt_system_initialized = false;
         return result;
     }
 
-    rt_system_initialized = true;
-
     return SYSTEM_OK;
 }
 
@@ -147,6 +193,11 @@ SystemError_t rt_control_create_task(RTTaskConfig_t *task_config,
         return ERROR_INVALID_PARAMETER;
     }
 
+    // A task without a ready queue would hold its slot but never run
+    if (task_config->priority >= RT_PRIORITY_COUNT) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
     // Find available task slot
     uint8_t free_slot = RT_MAX_TASKS;
     for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
@@ -168,16 +219,31 @@ SystemError_t rt_control_create_task(RTTaskConfig_t *task_config,
     task->priority = task_config->priority;
     task->period_us = task_config->period_us;
     task->deadline_us = task_config->deadline_us;
+    task->period_cycles = task_config->period_us * rt_cycles_per_us;
+    task->deadline_cycles = task_config->deadline_us * rt_cycles_per_us;
     task->function = task_config->function;
     task->context = task_config->context;
     task->last_execution = 0;
     task->execution_count = 0;
+    task->total_execution_time = 0;
     task->max_execution_time = 0;
     task->missed_deadlines = 0;
+    task->max_release_jitter = 0;
+    rt_histogram_reset(&task->release_latency);
+    rt_histogram_reset(&task->execution_time);
+    rt_histogram_reset(&task->response_time);
 
     strncpy(task->name, task_config->name, RT_TASK_NAME_MAX - 1);
     task->name[RT_TASK_NAME_MAX - 1] = '\0';
 
+    // First release on the next tick of its priority level. The TIM2/TIM3
+    // dispatchers reorder the same heap, so mask them around the insert.
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    task->next_release = get_cycle_count();
+    ready_queue_insert(task);
+    __set_PRIMASK(primask);
+
     *task_id = free_slot;
 
     return SYSTEM_OK;
@@ -196,14 +262,20 @@ SystemError_t rt_control_enable_task(uint8_t task_id, bool enable) {
 
     RTTask_t *task = &rt_control_system.tasks[task_id];
 
+    // The dispatcher ISRs pop and reinsert tasks in the same heaps
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
     if (enable && !task->enabled) {
         task->enabled = true;
         task->state = RT_TASK_READY;
-        task->last_execution = get_microsecond_timestamp();
+        task->next_release = get_cycle_count() + task->period_cycles;
+        ready_queue_insert(task);
     } else if (!enable && task->enabled) {
         task->enabled = false;
         task->state = RT_TASK_IDLE;
+        ready_queue_remove(task);
     }
+    __set_PRIMASK(primask);
 
     return SYSTEM_OK;
 }
@@ -261,20 +333,124 @@ SystemError_t rt_control_get_task_stats(uint8_t task_id,
     stats->execution_count = task->execution_count;
     stats->missed_deadlines = task->missed_deadlines;
     stats->max_execution_time = task->max_execution_time;
+    stats->max_release_jitter = task->max_release_jitter;
     stats->average_execution_time =
         task->total_execution_time /
         (task->execution_count > 0 ? task->execution_count : 1);
+    uint32_t uptime_ms =
+        HAL_Abstraction_GetTick() - rt_control_system.timing.system_start_time;
     stats->cpu_utilization =
-        ((float)task->total_execution_time /
-         (float)(get_microsecond_timestamp() -
-                 rt_control_system.timing.system_start_time)) *
-        100.0f;
+        (uptime_ms > 0) ? ((float)task->total_execution_time /
+                           ((float)uptime_ms * 1000.0f)) *
+                              100.0f
+                        : 0.0f;
+
+    summarize_histogram(&task->release_latency, &stats->release_latency);
+    summarize_histogram(&task->execution_time, &stats->execution_time);
+    summarize_histogram(&task->response_time, &stats->response_time);
 
     strncpy(stats->name, task->name, RT_TASK_NAME_MAX);
 
     return SYSTEM_OK;
 }
 
+/**
+ * @brief Clear latency histograms of a task (e.g. between soak phases)
+ * @param task_id Task identifier
+ * @return SystemError_t Operation result
+ */
+SystemError_t rt_control_reset_task_histograms(uint8_t task_id) {
+    if (!rt_system_initialized || task_id >= RT_MAX_TASKS) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    RTTask_t *task = &rt_control_system.tasks[task_id];
+    rt_histogram_reset(&task->release_latency);
+    rt_histogram_reset(&task->execution_time);
+    rt_histogram_reset(&task->response_time);
+    task->max_release_jitter = 0;
+
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Export latency histograms of all enabled tasks
+ * @param buffer Destination buffer
+ * @param buffer_size Size of buffer in bytes
+ * @param bytes_written Pointer to store the encoded size
+ * @return SystemError_t Operation result
+ *
+ * @details Little-endian layout:
+ *          header  u32 magic "RTH1", u8 task count, u8 bucket count,
+ *                  u8 sub-bucket bits, u8 reserved, u32 cycles per us
+ *          task    u8 task id, then release latency, execution time and
+ *                  response time histograms
+ *          hist    u32 total, u32 max, u8 non-empty bucket count,
+ *                  then (u8 bucket index, u32 count) per non-empty bucket
+ */
+SystemError_t rt_control_export_histograms(uint8_t *buffer,
+                                           uint32_t buffer_size,
+                                           uint32_t *bytes_written) {
+    if (!rt_system_initialized || buffer == NULL || bytes_written == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    // Worst case size from the non-empty bucket counts
+    uint32_t required = RT_HISTOGRAM_EXPORT_HEADER_SIZE;
+    uint8_t task_count = 0;
+    for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
+        const RTTask_t *task = &rt_control_system.tasks[i];
+        if (!task->enabled) {
+            continue;
+        }
+        const RTHistogram_t *histograms[] = {&task->release_latency,
+                                             &task->execution_time,
+                                             &task->response_time};
+        required += 1U;
+        for (uint8_t h = 0; h < 3; h++) {
+            required += 9U;
+            for (uint32_t b = 0; b < RT_HISTOGRAM_BUCKETS; b++) {
+                if (histograms[h]->counts[b] != 0) {
+                    required += 5U;
+                }
+            }
+        }
+        task_count++;
+    }
+
+    if (required > buffer_size) {
+        *bytes_written = 0;
+        return ERROR_BUFFER_OVERFLOW;
+    }
+
+    uint8_t *cursor = buffer;
+    uint32_t magic = RT_HISTOGRAM_EXPORT_MAGIC;
+    for (uint8_t byte = 0; byte < 4; byte++) {
+        *cursor++ = (uint8_t)(magic >> (8U * byte));
+    }
+    *cursor++ = task_count;
+    *cursor++ = (uint8_t)RT_HISTOGRAM_BUCKETS;
+    *cursor++ = (uint8_t)RT_HISTOGRAM_SUB_BUCKET_BITS;
+    *cursor++ = 0;
+    for (uint8_t byte = 0; byte < 4; byte++) {
+        *cursor++ = (uint8_t)(rt_cycles_per_us >> (8U * byte));
+    }
+
+    for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
+        const RTTask_t *task = &rt_control_system.tasks[i];
+        if (!task->enabled) {
+            continue;
+        }
+        *cursor++ = task->id;
+        cursor = export_histogram(cursor, &task->release_latency);
+        cursor = export_histogram(cursor, &task->execution_time);
+        cursor = export_histogram(cursor, &task->response_time);
+    }
+
+    *bytes_written = (uint32_t)(cursor - buffer);
+    return SYSTEM_OK;
+}
+
 /**
  * @brief Control loop timer interrupt handler
  */
@@ -283,14 +459,14 @@ void rt_control_loop_handler(void) {
         return;
     }
 
-    uint32_t start_time = get_microsecond_timestamp();
+    uint32_t start_time = get_cycle_count();
 
     // Execute high-priority control tasks
     execute_priority_tasks(RT_PRIORITY_HIGH);
     execute_priority_tasks(RT_PRIORITY_NORMAL);
 
     // Update timing statistics
-    uint32_t execution_time = get_microsecond_timestamp() - start_time;
+    uint32_t execution_time = cycles_to_us(get_cycle_count() - start_time);
     update_timing_statistics(execution_time);
 
     rt_control_system.timing.total_cycles++;
@@ -360,6 +536,18 @@ static SystemError_t create_default_tasks(void) {
     SystemError_t result;
     uint8_t task_id;
 
+    // Motion profile update task (1kHz), created first so it runs ahead
+    // of position control when both are released together
+    RTTaskConfig_t motion_profile_config = {.name = "MotionProfile",
+                                            .priority = RT_PRIORITY_HIGH,
+                                            .period_us = 1000,
+                                            .deadline_us = 500,
+                                            .function = motion_profile_task,
+                                            .context = NULL};
+    result = rt_control_create_task(&motion_profile_config, &task_id);
+    if (result != SYSTEM_OK)
+        return result;
+
     // Position control task (1kHz)
     RTTaskConfig_t pos_control_config = {.name = "PositionControl",
                                          .priority = RT_PRIORITY_HIGH,
@@ -371,17 +559,6 @@ static SystemError_t create_default_tasks(void) {
     if (result != SYSTEM_OK)
         return result;
 
-    // Motion profile update task (1kHz)
-    RTTaskConfig_t motion_profile_config = {.name = "MotionProfile",
-                                            .priority = RT_PRIORITY_HIGH,
-                                            .period_us = 1000,
-                                            .deadline_us = 500,
-                                            .function = motion_profile_task,
-                                            .context = NULL};
-    result = rt_control_create_task(&motion_profile_config, &task_id);
-    if (result != SYSTEM_OK)
-        return result;
-
     // Multi-motor coordination task (500Hz)
     RTTaskConfig_t coordination_config = {.name = "Coordination",
                                           .priority = RT_PRIORITY_NORMAL,
@@ -408,37 +585,35 @@ static SystemError_t create_default_tasks(void) {
 }
 
 /**
- * @brief Execute tasks of specified priority
+ * @brief Execute released tasks of specified priority
+ * @details Only the head of the priority's ready queue is inspected per
+ *          dispatch, so a tick with no released task costs O(1).
  */
 static void execute_priority_tasks(RTTaskPriority_t priority) {
-    uint32_t current_time = get_microsecond_timestamp();
+    RTReadyQueue_t *queue = &rt_control_system.ready_queues[priority];
+    uint32_t current_time = get_cycle_count();
 
-    for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
-        RTTask_t *task = &rt_control_system.tasks[i];
+    while (queue->count > 0) {
+        RTTask_t *task = &rt_control_system.tasks[queue->task_ids[0]];
 
-        if (!task->enabled || task->priority != priority) {
-            continue;
+        // Queue head not yet released: nothing else is either
+        if ((int32_t)(current_time - task->next_release) < 0) {
+            break;
         }
 
-        // Check if task is ready to execute
-        if ((current_time - task->last_execution) >= task->period_us) {
-            execute_task(task, current_time);
-        }
+        execute_task(task, current_time);
+        ready_queue_sift_down(queue, 0); // Head key moved later
     }
 }
 
 /**
- * @brief Execute individual task
+ * @brief Execute individual task and schedule its next release
+ * @param task Released task
+ * @param current_time Dispatch time (cycles)
  */
 static void execute_task(RTTask_t *task, uint32_t current_time) {
-    // Check for deadline miss
-    uint32_t elapsed = current_time - task->last_execution;
-    if (elapsed > task->deadline_us && task->execution_count > 0) {
-        task->missed_deadlines++;
-    }
-
     // Record execution start
-    uint32_t execution_start = get_microsecond_timestamp();
+    uint32_t execution_start = get_cycle_count();
     task->state = RT_TASK_RUNNING;
 
     // Execute task function
@@ -446,10 +621,32 @@ static void execute_task(RTTask_t *task, uint32_t current_time) {
         task->function(task->context);
     }
 
-    // Record execution time
-    uint32_t execution_time = get_microsecond_timestamp() - execution_start;
+    uint32_t execution_end = get_cycle_count();
+    uint32_t latency_cycles = execution_start - task->next_release;
+    uint32_t execution_cycles = execution_end - execution_start;
+    uint32_t response_cycles = execution_end - task->next_release;
+
+    rt_histogram_record(&task->release_latency, latency_cycles);
+    rt_histogram_record(&task->execution_time, execution_cycles);
+    rt_histogram_record(&task->response_time, response_cycles);
+    utilization_window_busy += execution_cycles;
+
+    // Release jitter: delay between scheduled release and actual start
+    uint32_t release_jitter = cycles_to_us(latency_cycles);
+    if (release_jitter > task->max_release_jitter) {
+        task->max_release_jitter = release_jitter;
+    }
+    if (release_jitter > rt_control_system.timing.max_jitter_us) {
+        rt_control_system.timing.max_jitter_us = release_jitter;
+    }
+
+    // Deadline is relative to the release, not to the previous run
+    if (response_cycles > task->deadline_cycles) {
+        task->missed_deadlines++;
+    }
 
-    task->last_execution = current_time;
+    uint32_t execution_time = cycles_to_us(execution_cycles);
+    task->last_execution = cycles_to_us(execution_start);
     task->execution_count++;
     task->total_execution_time += execution_time;
     task->state = RT_TASK_READY;
@@ -458,53 +655,143 @@ static void execute_task(RTTask_t *task, uint32_t current_time) {
     if (execution_time > task->max_execution_time) {
         task->max_execution_time = execution_time;
     }
+
+    // Fixed-rate release; releases already in the past were missed
+    task->next_release += task->period_cycles;
+    while ((int32_t)(current_time - task->next_release) >= 0) {
+        task->next_release += task->period_cycles;
+        task->missed_deadlines++;
+    }
+}
+
+/**
+ * @brief Compare two tasks by release time (ties broken by task id)
+ */
+static bool release_before(const RTTask_t *a, const RTTask_t *b) {
+    int32_t delta = (int32_t)(a->next_release - b->next_release);
+    return (delta < 0) || (delta == 0 && a->id < b->id);
+}
+
+/**
+ * @brief Add task to the ready queue of its priority level
+ */
+static void ready_queue_insert(RTTask_t *task) {
+    if (task->queued || task->priority >= RT_PRIORITY_COUNT) {
+        return;
+    }
+
+    RTReadyQueue_t *queue = &rt_control_system.ready_queues[task->priority];
+    uint8_t index = queue->count++;
+    queue->task_ids[index] = task->id;
+    task->queue_index = index;
+    task->queued = true;
+    ready_queue_sift_up(queue, index);
+}
+
+/**
+ * @brief Remove task from its ready queue
+ */
+static void ready_queue_remove(RTTask_t *task) {
+    if (!task->queued) {
+        return;
+    }
+
+    RTReadyQueue_t *queue = &rt_control_system.ready_queues[task->priority];
+    uint8_t index = task->queue_index;
+    uint8_t last = --queue->count;
+    task->queued = false;
+
+    if (index == last) {
+        return;
+    }
+
+    // Move the last entry into the hole and restore heap order
+    RTTask_t *moved = &rt_control_system.tasks[queue->task_ids[last]];
+    queue->task_ids[index] = moved->id;
+    moved->queue_index = index;
+    ready_queue_sift_up(queue, index);
+    ready_queue_sift_down(queue, moved->queue_index);
+}
+
+/**
+ * @brief Move heap entry towards the root while it releases earlier
+ */
+static void ready_queue_sift_up(RTReadyQueue_t *queue, uint8_t index) {
+    while (index > 0) {
+        uint8_t parent = (uint8_t)((index - 1U) / 2U);
+        RTTask_t *child = &rt_control_system.tasks[queue->task_ids[index]];
+        RTTask_t *parent_task =
+            &rt_control_system.tasks[queue->task_ids[parent]];
+
+        if (!release_before(child, parent_task)) {
+            break;
+        }
+
+        queue->task_ids[index] = parent_task->id;
+        queue->task_ids[parent] = child->id;
+        parent_task->queue_index = index;
+        child->queue_index = parent;
+        index = parent;
+    }
+}
+
+/**
+ * @brief Move heap entry towards the leaves while a child releases earlier
+ */
+static void ready_queue_sift_down(RTReadyQueue_t *queue, uint8_t index) {
+    RTTask_t *tasks = rt_control_system.tasks;
+
+    while (true) {
+        uint8_t left = (uint8_t)(2U * index + 1U);
+        uint8_t right = (uint8_t)(left + 1U);
+        uint8_t earliest = index;
+
+        if (left < queue->count &&
+            release_before(&tasks[queue->task_ids[left]],
+                           &tasks[queue->task_ids[earliest]])) {
+            earliest = left;
+        }
+        if (right < queue->count &&
+            release_before(&tasks[queue->task_ids[right]],
+                           &tasks[queue->task_ids[earliest]])) {
+            earliest = right;
+        }
+        if (earliest == index) {
+            break;
+        }
+
+        RTTask_t *parent_task = &tasks[queue->task_ids[index]];
+        RTTask_t *child = &tasks[queue->task_ids[earliest]];
+        queue->task_ids[index] = child->id;
+        queue->task_ids[earliest] = parent_task->id;
+        child->queue_index = index;
+        parent_task->queue_index = earliest;
+        index = earliest;
+    }
 }
 
 /**
  * @brief Update timing statistics
+ * @note Release jitter is tracked per task in execute_task()
  */
 static void update_timing_statistics(uint32_t execution_time) {
     // Check for timing overrun
     if (execution_time > RT_CONTROL_LOOP_PERIOD_US) {
         rt_control_system.timing.overrun_count++;
     }
-
-    // Calculate jitter
-    static uint32_t last_execution_time = 0;
-    if (last_execution_time > 0) {
-        uint32_t jitter = (execution_time > last_execution_time)
-                              ? (execution_time - last_execution_time)
-                              : (last_execution_time - execution_time);
-
-        if (jitter > rt_control_system.timing.max_jitter_us) {
-            rt_control_system.timing.max_jitter_us = jitter;
-        }
-    }
-    last_execution_time = execution_time;
 }
 
 /**
  * @brief Update performance monitoring
  */
 static void update_performance_monitoring(void) {
-    static uint32_t last_update = 0;
-    uint32_t current_time = get_microsecond_timestamp();
-
-    // Update every 100ms
-    if ((current_time - last_update) >= 100000) {
-        // Calculate CPU utilization
-        uint32_t total_execution_time = 0;
-        for (uint8_t i = 0; i < RT_MAX_TASKS; i++) {
-            if (rt_control_system.tasks[i].enabled) {
-                total_execution_time +=
-                    rt_control_system.tasks[i].total_execution_time;
-            }
-        }
+    uint32_t current_time = get_cycle_count();
+    uint32_t elapsed_time = current_time - utilization_window_start;
 
-        uint32_t elapsed_time =
-            current_time - rt_control_system.timing.system_start_time;
+    // Utilization over the last window rather than since boot
+    if (elapsed_time >= RT_UTILIZATION_WINDOW_US * rt_cycles_per_us) {
         rt_control_system.performance.cpu_utilization =
-            ((float)total_execution_time / (float)elapsed_time) * 100.0f;
+            ((float)utilization_window_busy / (float)elapsed_time) * 100.0f;
 
         if (rt_control_system.performance.cpu_utilization >
             rt_control_system.performance.max_cpu_utilization) {
@@ -515,16 +802,73 @@ static void update_performance_monitoring(void) {
         // Update memory usage (simplified)
         rt_control_system.performance.memory_usage = sizeof(RTControlSystem_t);
 
-        last_update = current_time;
+        utilization_window_start = current_time;
+        utilization_window_busy = 0;
     }
 }
 
 /**
- * @brief Get microsecond timestamp
+ * @brief Get DWT cycle count
+ */
+static uint32_t get_cycle_count(void) {
+#ifdef UNITY_TESTING
+    // Host runs follow the (virtual) HAL clock for reproducible timing
+    return HAL_Abstraction_GetMicroseconds() * rt_cycles_per_us;
+#else
+    // DWT cycle counter (HAL_Abstraction_InitCycleCounter at start-up)
+    return DWT->CYCCNT;
+#endif
+}
+
+/**
+ * @brief Convert a cycle interval to microseconds
+ */
+static uint32_t cycles_to_us(uint32_t cycles) {
+    return cycles / rt_cycles_per_us;
+}
+
+/**
+ * @brief Fill percentile summary from a cycle histogram
  */
-static uint32_t get_microsecond_timestamp(void) {
-    // Use DWT cycle counter for high precision timing
-    return DWT->CYCCNT / (SystemCoreClock / 1000000);
+static void summarize_histogram(const RTHistogram_t *histogram,
+                                RTLatencySummary_t *summary) {
+    summary->p50_us = cycles_to_us(
+        rt_histogram_percentile(histogram, RT_PERCENTILE_P50));
+    summary->p99_us = cycles_to_us(
+        rt_histogram_percentile(histogram, RT_PERCENTILE_P99));
+    summary->p999_us = cycles_to_us(
+        rt_histogram_percentile(histogram, RT_PERCENTILE_P999));
+    summary->max_us = cycles_to_us(histogram->max);
+}
+
+/**
+ * @brief Encode one histogram for rt_control_export_histograms()
+ * @return Cursor past the encoded histogram
+ */
+static uint8_t *export_histogram(uint8_t *cursor,
+                                 const RTHistogram_t *histogram) {
+    uint32_t header[2] = {histogram->total, histogram->max};
+    for (uint8_t word = 0; word < 2; word++) {
+        for (uint8_t byte = 0; byte < 4; byte++) {
+            *cursor++ = (uint8_t)(header[word] >> (8U * byte));
+        }
+    }
+
+    uint8_t *bucket_count = cursor++;
+    *bucket_count = 0;
+    for (uint32_t b = 0; b < RT_HISTOGRAM_BUCKETS; b++) {
+        uint32_t count = histogram->counts[b];
+        if (count == 0) {
+            continue;
+        }
+        *cursor++ = (uint8_t)b;
+        for (uint8_t byte = 0; byte < 4; byte++) {
+            *cursor++ = (uint8_t)(count >> (8U * byte));
+        }
+        (*bucket_count)++;
+    }
+
+    return cursor;
 }
 
 /**
@@ -549,16 +893,61 @@ static void position_control_task(void *context) {
 static void motion_profile_task(void *context) {
     (void)context; // Unused parameter
 
-    // Update motion profiles for all motors
+    // Commands batched by the host start together, in this tick
+    comm_apply_pending_batch();
+
+    // Step each active trajectory one tick and hand the setpoint straight
+    // to position control, which runs next in the same release
     for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
         if (motion_profile_is_active(motor_id)) {
-            // TODO: Get active profile and execute it properly
-            // For now, skip execution until motion_profile_update function is
-            // implemented motion_profile_execute requires MotionProfile_t
-            // *profile parameter
-            (void)motor_id; // Suppress unused variable warning
+            int32_t target_pos;
+            int32_t target_vel;
+
+            if (motion_profile_update(motor_id, &target_pos, &target_vel) ==
+                SYSTEM_OK) {
+                position_control_set_profile_setpoint(motor_id, target_pos,
+                                                      target_vel);
+            }
         }
     }
+
+    // Host-streamed PVT points take over their motor's setpoint
+    for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
+        if (motion_pvt_is_active(motor_id)) {
+            int32_t target_pos;
+            int32_t target_vel;
+
+            if (motion_pvt_update(motor_id, MOTION_PROFILE_UPDATE_RATE_MS,
+                                  &target_pos, &target_vel) == SYSTEM_OK) {
+                position_control_set_profile_setpoint(motor_id, target_pos,
+                                                      target_vel);
+            } else {
+                // Aborted: a setpoint of this tick may have raced the abort
+                position_control_clear_feedforward(motor_id);
+            }
+        }
+    }
+
+    // Blended multi-axis path from the coordinator's look-ahead queue
+    if (motion_lookahead_is_active()) {
+        int32_t path_pos[MAX_MOTORS];
+        int32_t path_vel[MAX_MOTORS];
+
+        if (motion_lookahead_update(MOTION_PROFILE_UPDATE_RATE_MS, path_pos,
+                                    path_vel) == SYSTEM_OK) {
+            for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
+                position_control_set_profile_setpoint(
+                    motor_id, path_pos[motor_id], path_vel[motor_id]);
+            }
+        } else {
+            for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
+                position_control_clear_feedforward(motor_id);
+            }
+        }
+    }
+
+    // Geared / cammed slaves track this tick's master setpoint
+    multi_motor_follow_update(MOTION_PROFILE_UPDATE_RATE_MS);
 }
 
 /**
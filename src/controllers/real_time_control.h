@@ -14,10 +14,9 @@
 #include "common/data_types.h"
 #include "common/error_codes.h"
 #include "config/project_constants.h"
-#ifndef UNITY_TESTING
-#include "stm32h7xx_hal.h"
+#include "rt_histogram.h"
+#include "stm32h7xx_hal.h" // Mock HAL (tests/mocks) on host builds
 #include "stm32h7xx_hal_tim.h"
-#endif
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -30,6 +29,11 @@
 // Performance monitoring thresholds
 #define CPU_UTILIZATION_WARNING_THRESHOLD 80.0f // CPU utilization warning (%)
 #define MAX_ALLOWED_OVERRUNS 10                 // Maximum timing overruns
+#define RT_UTILIZATION_WINDOW_US 100000         // CPU utilization window
+
+// Histogram export format (rt_control_export_histograms)
+#define RT_HISTOGRAM_EXPORT_MAGIC 0x31485452U // "RTH1" little-endian
+#define RT_HISTOGRAM_EXPORT_HEADER_SIZE 12    // Bytes before task records
 
 // Error codes specific to real-time control - map to canonical SSOT ranges
 /*
@@ -72,7 +76,8 @@ typedef enum {
     RT_PRIORITY_CRITICAL = 0, ///< Critical priority (safety tasks)
     RT_PRIORITY_HIGH,         ///< High priority (control loops)
     RT_PRIORITY_NORMAL,       ///< Normal priority (coordination)
-    RT_PRIORITY_LOW           ///< Low priority (logging, diagnostics)
+    RT_PRIORITY_LOW,          ///< Low priority (logging, diagnostics)
+    RT_PRIORITY_COUNT         ///< Number of priority levels
 } RTTaskPriority_t;
 
 /**
@@ -125,21 +130,45 @@ typedef struct {
     RTTaskFunction_t function;   ///< Task function pointer
     void *context;               ///< Task context data
 
+    // Release scheduling (DWT cycle time base, wraps every 2^32 cycles)
+    uint32_t next_release;    ///< Next scheduled release (cycles)
+    uint32_t period_cycles;   ///< Task period in cycles
+    uint32_t deadline_cycles; ///< Relative deadline in cycles
+    uint8_t queue_index;      ///< Position in its priority ready queue
+    bool queued;              ///< Task is held in a ready queue
+
     // Execution statistics
-    uint32_t last_execution;       ///< Last execution timestamp
+    uint32_t last_execution;       ///< Last execution start timestamp
     uint32_t execution_count;      ///< Total execution count
     uint32_t total_execution_time; ///< Total execution time
     uint32_t max_execution_time;   ///< Maximum execution time
     uint32_t missed_deadlines;     ///< Number of missed deadlines
+    uint32_t max_release_jitter;   ///< Max start delay after release (us)
+
+    // Latency distributions (cycles)
+    RTHistogram_t release_latency; ///< Release to start of execution
+    RTHistogram_t execution_time;  ///< Start to end of execution
+    RTHistogram_t response_time;   ///< Release to end of execution
 } RTTask_t;
 
+/**
+ * @brief Release-ordered ready queue (binary min-heap of task ids)
+ * @details One queue per priority level, keyed on next_release. A timer
+ *          tick only inspects the queue head, so dispatch cost scales with
+ *          the number of released tasks rather than with RT_MAX_TASKS.
+ */
+typedef struct {
+    uint8_t task_ids[RT_MAX_TASKS]; ///< Heap storage (index 0 = earliest)
+    uint8_t count;                  ///< Number of queued tasks
+} RTReadyQueue_t;
+
 /**
  * @brief Real-time system timing statistics
  */
 typedef struct {
     uint32_t system_start_time; ///< System start timestamp
     uint32_t total_cycles;      ///< Total control cycles executed
-    uint32_t max_jitter_us;     ///< Maximum timing jitter
+    uint32_t max_jitter_us;     ///< Maximum release jitter (start - release)
     uint32_t overrun_count;     ///< Number of timing overruns
 } RTTiming_t;
 
@@ -157,10 +186,11 @@ typedef struct {
  * @brief Real-time control system structure
  */
 typedef struct {
-    RTSystemState_t system_state; ///< Current system state
-    RTTask_t tasks[RT_MAX_TASKS]; ///< Real-time tasks array
-    RTTiming_t timing;            ///< Timing statistics
-    RTPerformance_t performance;  ///< Performance monitoring
+    RTSystemState_t system_state;                   ///< Current system state
+    RTTask_t tasks[RT_MAX_TASKS];                   ///< Real-time tasks array
+    RTReadyQueue_t ready_queues[RT_PRIORITY_COUNT]; ///< Ready queues
+    RTTiming_t timing;                              ///< Timing statistics
+    RTPerformance_t performance;                    ///< Performance monitoring
 } RTControlSystem_t;
 
 /**
@@ -176,6 +206,16 @@ typedef struct {
     RTPerformance_t performance;  ///< Performance data
 } RTSystemStatus_t;
 
+/**
+ * @brief Percentile summary of one latency histogram
+ */
+typedef struct {
+    uint32_t p50_us;  ///< Median
+    uint32_t p99_us;  ///< 99th percentile
+    uint32_t p999_us; ///< 99.9th percentile
+    uint32_t max_us;  ///< Largest sample
+} RTLatencySummary_t;
+
 /**
  * @brief Real-time task statistics structure
  */
@@ -184,8 +224,14 @@ typedef struct {
     uint32_t execution_count;        ///< Total executions
     uint32_t missed_deadlines;       ///< Missed deadlines
     uint32_t max_execution_time;     ///< Maximum execution time
+    uint32_t max_release_jitter;     ///< Max start delay after release (us)
     uint32_t average_execution_time; ///< Average execution time
     float cpu_utilization;           ///< Task CPU utilization (%)
+
+    // Latency percentiles from the task histograms
+    RTLatencySummary_t release_latency; ///< Release to start
+    RTLatencySummary_t execution_time;  ///< Execution duration
+    RTLatencySummary_t response_time;   ///< Release to completion
 } RTTaskStats_t;
 
 // Core real-time control functions
@@ -201,6 +247,10 @@ SystemError_t rt_control_enable_task(uint8_t task_id, bool enable);
 // Status and monitoring functions
 SystemError_t rt_control_get_status(RTSystemStatus_t *status);
 SystemError_t rt_control_get_task_stats(uint8_t task_id, RTTaskStats_t *stats);
+SystemError_t rt_control_reset_task_histograms(uint8_t task_id);
+SystemError_t rt_control_export_histograms(uint8_t *buffer,
+                                           uint32_t buffer_size,
+                                           uint32_t *bytes_written);
 
 // Interrupt handlers
 void rt_control_loop_handler(void);
@@ -211,26 +261,7 @@ bool rt_control_is_running(void);
 uint32_t rt_control_get_cycle_count(void);
 float rt_control_get_cpu_utilization(void);
 
-// Internal functions (declared for testing)
-static SystemError_t configure_control_timer(void);
-static SystemError_t configure_safety_timer(void);
-static SystemError_t create_default_tasks(void);
-static void execute_priority_tasks(RTTaskPriority_t priority);
-static void execute_task(RTTask_t *task, uint32_t current_time);
-static void update_timing_statistics(uint32_t execution_time);
-static void update_performance_monitoring(void);
-static uint32_t get_microsecond_timestamp(void);
-
-// Default task functions
-static void position_control_task(void *context);
-static void motion_profile_task(void *context);
-static void coordination_task(void *context);
-static void safety_monitor_task(void *context);
-
 // HAL callback function
 void HAL_TIM_PeriodElapsedCallback(TIM_HandleTypeDef *htim);
 
-// External dependencies
-extern void DWT_Init(void); // Enable DWT cycle counter for timing
-
 #endif // REAL_TIME_CONTROL_H
@@ -0,0 +1,93 @@
+/**
+ * @file rt_histogram.c
+ * @brief Log-bucketed latency histogram for real-time task instrumentation
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "rt_histogram.h"
+#include <string.h>
+
+/**
+ * @brief Clear all samples
+ */
+void rt_histogram_reset(RTHistogram_t *histogram) {
+    if (histogram != NULL) {
+        memset(histogram, 0, sizeof(*histogram));
+    }
+}
+
+/**
+ * @brief Record one sample
+ */
+void rt_histogram_record(RTHistogram_t *histogram, uint32_t value) {
+    histogram->counts[rt_histogram_bucket_index(value)]++;
+    histogram->total++;
+    if (value > histogram->max) {
+        histogram->max = value;
+    }
+}
+
+/**
+ * @brief Map a value to its bucket index
+ */
+uint32_t rt_histogram_bucket_index(uint32_t value) {
+    if (value < RT_HISTOGRAM_SUB_BUCKETS) {
+        return value;
+    }
+
+    // Octave from the most significant bit, sub-bucket from the bits below
+    uint32_t msb = 31U - (uint32_t)__builtin_clz(value);
+    uint32_t shift = msb - RT_HISTOGRAM_SUB_BUCKET_BITS;
+    uint32_t sub = (value >> shift) & (RT_HISTOGRAM_SUB_BUCKETS - 1U);
+
+    return RT_HISTOGRAM_SUB_BUCKETS + shift * RT_HISTOGRAM_SUB_BUCKETS + sub;
+}
+
+/**
+ * @brief Largest value that falls into a bucket
+ */
+uint32_t rt_histogram_bucket_upper(uint32_t index) {
+    if (index < RT_HISTOGRAM_SUB_BUCKETS) {
+        return index;
+    }
+    if (index >= RT_HISTOGRAM_BUCKETS - 1U) {
+        return UINT32_MAX;
+    }
+
+    uint32_t shift = (index - RT_HISTOGRAM_SUB_BUCKETS) /
+                     RT_HISTOGRAM_SUB_BUCKETS;
+    uint32_t sub = (index - RT_HISTOGRAM_SUB_BUCKETS) %
+                   RT_HISTOGRAM_SUB_BUCKETS;
+    uint32_t lower = (RT_HISTOGRAM_SUB_BUCKETS + sub) << shift;
+
+    return lower + ((1U << shift) - 1U);
+}
+
+/**
+ * @brief Query a percentile
+ */
+uint32_t rt_histogram_percentile(const RTHistogram_t *histogram,
+                                 uint32_t rank_per_100k) {
+    if (histogram == NULL || histogram->total == 0) {
+        return 0;
+    }
+
+    // Rank of the target sample (1-based, rounded up)
+    uint64_t target =
+        ((uint64_t)histogram->total * rank_per_100k + 99999U) / 100000U;
+    if (target == 0) {
+        target = 1;
+    }
+
+    uint64_t cumulative = 0;
+    for (uint32_t i = 0; i < RT_HISTOGRAM_BUCKETS; i++) {
+        cumulative += histogram->counts[i];
+        if (cumulative >= target) {
+            uint32_t upper = rt_histogram_bucket_upper(i);
+            return (upper < histogram->max) ? upper : histogram->max;
+        }
+    }
+
+    return histogram->max;
+}
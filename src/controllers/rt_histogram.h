@@ -0,0 +1,81 @@
+/**
+ * @file rt_histogram.h
+ * @brief Log-bucketed latency histogram for real-time task instrumentation
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @details Fixed-size histogram of 32-bit DWT cycle counts. Values below
+ *          RT_HISTOGRAM_SUB_BUCKETS are counted exactly; larger values are
+ *          binned by power of two with RT_HISTOGRAM_SUB_BUCKETS linear
+ *          sub-buckets each, giving a worst-case relative error of
+ *          1 / RT_HISTOGRAM_SUB_BUCKETS over the full 32-bit range.
+ *          Recording is a CLZ, two shifts and an increment, so it is safe
+ *          to call from the control loop ISR.
+ */
+
+#ifndef RT_HISTOGRAM_H
+#define RT_HISTOGRAM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Histogram geometry: 2^2 = 4 sub-buckets per octave (25% resolution)
+#define RT_HISTOGRAM_SUB_BUCKET_BITS 2
+#define RT_HISTOGRAM_SUB_BUCKETS (1U << RT_HISTOGRAM_SUB_BUCKET_BITS)
+#define RT_HISTOGRAM_BUCKETS                                                  \
+    (RT_HISTOGRAM_SUB_BUCKETS +                                               \
+     (32U - RT_HISTOGRAM_SUB_BUCKET_BITS) * RT_HISTOGRAM_SUB_BUCKETS)
+
+// Percentile ranks in parts per 100000 (p99.9 needs the extra digit)
+#define RT_PERCENTILE_P50 50000U
+#define RT_PERCENTILE_P99 99000U
+#define RT_PERCENTILE_P999 99900U
+
+/**
+ * @brief Log-bucketed histogram of cycle counts
+ */
+typedef struct {
+    uint32_t counts[RT_HISTOGRAM_BUCKETS]; ///< Samples per bucket
+    uint32_t total;                        ///< Total samples recorded
+    uint32_t max;                          ///< Largest value recorded
+} RTHistogram_t;
+
+/**
+ * @brief Clear all samples
+ * @param histogram Histogram to reset
+ */
+void rt_histogram_reset(RTHistogram_t *histogram);
+
+/**
+ * @brief Record one sample
+ * @param histogram Histogram to update
+ * @param value Sample value (cycles)
+ */
+void rt_histogram_record(RTHistogram_t *histogram, uint32_t value);
+
+/**
+ * @brief Map a value to its bucket index
+ * @param value Sample value
+ * @return Bucket index in [0, RT_HISTOGRAM_BUCKETS)
+ */
+uint32_t rt_histogram_bucket_index(uint32_t value);
+
+/**
+ * @brief Largest value that falls into a bucket
+ * @param index Bucket index
+ * @return Inclusive upper bound of the bucket
+ */
+uint32_t rt_histogram_bucket_upper(uint32_t index);
+
+/**
+ * @brief Query a percentile
+ * @param histogram Histogram to query
+ * @param rank_per_100k Percentile rank in parts per 100000
+ *        (e.g. RT_PERCENTILE_P999)
+ * @return Upper bound of the bucket holding the ranked sample, clamped to
+ *         the recorded maximum; 0 if the histogram is empty
+ */
+uint32_t rt_histogram_percentile(const RTHistogram_t *histogram,
+                                 uint32_t rank_per_100k);
+
+#endif // RT_HISTOGRAM_H
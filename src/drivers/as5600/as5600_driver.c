@@ -45,6 +45,7 @@ typedef struct {
   uint32_t last_update_time; // Last calibration/update time
   uint16_t magnitude;
   uint8_t status_flags;
+  uint8_t agc;
   uint32_t read_count;
   uint32_t error_count;
   bool magnet_detected;
@@ -68,9 +69,20 @@ static SystemError_t as5600_i2c_write_register(uint8_t encoder_id,
 static SystemError_t as5600_i2c_read_16bit(uint8_t encoder_id,
                                            uint8_t reg_addr_high,
                                            uint16_t *value);
+static SystemError_t as5600_i2c_read_block(uint8_t encoder_id,
+                                           uint8_t reg_addr, uint8_t *data,
+                                           uint16_t size);
+static uint16_t as5600_burst_word(const uint8_t *block,
+                                  uint8_t reg_addr_high);
+static SystemError_t as5600_burst_transfer(uint8_t encoder_id,
+                                           AS5600_BurstMode_t mode,
+                                           AS5600_Sample_t *sample);
+static void as5600_store_sample(uint8_t encoder_id,
+                                const AS5600_Sample_t *sample,
+                                AS5600_BurstMode_t mode);
 static SystemError_t as5600_validate_encoder_id(uint8_t encoder_id);
 static float as5600_raw_to_degrees(uint16_t raw_value);
-static SystemError_t as5600_check_magnet_status(uint8_t encoder_id);
+static SystemError_t as5600_magnet_status_to_error(uint8_t status);
 static void as5600_calculate_velocity(uint8_t encoder_id);
 
 /* ==========================================================================
@@ -114,9 +126,9 @@ SystemError_t as5600_init(void) {
  * @return System error code
  */
 SystemError_t as5600_init_encoder(uint8_t encoder_id) {
-  SystemError_t result = as5600_validate_encoder_id(encoder_id);
-  if (result != SYSTEM_OK) {
-    return result;
+  // Range check only: the encoder is not initialized yet
+  if (encoder_id >= AS5600_MAX_ENCODERS) {
+    return ERROR_ENCODER_INVALID_ID;
   }
 
   AS5600_EncoderState_t *state = &encoder_state[encoder_id];
@@ -134,28 +146,18 @@ SystemError_t as5600_init_encoder(uint8_t encoder_id) {
   state->simulation_mode = false;
 #endif
 
-  // Test I2C communication by reading status register
-  uint8_t status;
-  result = as5600_i2c_read_register(encoder_id, AS5600_REG_STATUS, &status);
+  // One burst tests communication and reads status, angles and magnitude
+  AS5600_Sample_t sample;
+  SystemError_t result =
+      as5600_burst_transfer(encoder_id, AS5600_BURST_FULL, &sample);
   if (result != SYSTEM_OK) {
     return ERROR_ENCODER_COMMUNICATION;
   }
 
-  state->status_flags = status;
-
-  // Check magnet detection
-  result = as5600_check_magnet_status(encoder_id);
-  if (result != SYSTEM_OK) {
-    return result;
-  }
+  as5600_store_sample(encoder_id, &sample, AS5600_BURST_FULL);
 
-  // Read initial angle values
-  result = as5600_read_raw_angle(encoder_id, &state->raw_angle);
-  if (result != SYSTEM_OK) {
-    return result;
-  }
-
-  result = as5600_read_angle(encoder_id, &state->filtered_angle);
+  // Check magnet detection and strength
+  result = as5600_magnet_status_to_error(sample.status);
   if (result != SYSTEM_OK) {
     return result;
   }
@@ -164,12 +166,6 @@ SystemError_t as5600_init_encoder(uint8_t encoder_id) {
   state->angle_degrees = as5600_raw_to_degrees(state->filtered_angle);
   state->previous_angle = state->angle_degrees;
 
-  // Read magnitude for magnet strength validation
-  result = as5600_read_magnitude(encoder_id, &state->magnitude);
-  if (result != SYSTEM_OK) {
-    return result;
-  }
-
   state->is_initialized = true;
   state->read_count = 1;
 
@@ -319,6 +315,41 @@ SystemError_t as5600_read_status(uint8_t encoder_id, uint8_t *status) {
   return result;
 }
 
+/**
+ * @brief Read status and angles (optionally AGC and magnitude) in one
+ *        I2C transaction
+ * @param encoder_id Encoder identifier
+ * @param mode Register window to fetch
+ * @param sample Pointer to store the decoded sample
+ * @return System error code
+ */
+SystemError_t as5600_read_burst(uint8_t encoder_id, AS5600_BurstMode_t mode,
+                                AS5600_Sample_t *sample) {
+  if (sample == NULL ||
+      (mode != AS5600_BURST_ANGLES && mode != AS5600_BURST_FULL)) {
+    return ERROR_ENCODER_CONFIG_INVALID;
+  }
+
+  SystemError_t result = as5600_validate_encoder_id(encoder_id);
+  if (result != SYSTEM_OK) {
+    return result;
+  }
+
+  result = as5600_burst_transfer(encoder_id, mode, sample);
+  if (result != SYSTEM_OK) {
+    encoder_state[encoder_id].error_count++;
+    return result;
+  }
+
+  as5600_store_sample(encoder_id, sample, mode);
+
+  if ((sample->status & AS5600_STATUS_MD) == 0) {
+    return ERROR_ENCODER_MAGNET_NOT_DETECTED;
+  }
+
+  return SYSTEM_OK;
+}
+
 /**
  * @brief Get encoder velocity in degrees per second
  * @param encoder_id Encoder identifier
@@ -595,6 +626,126 @@ static SystemError_t as5600_i2c_read_16bit(uint8_t encoder_id,
   return SYSTEM_OK;
 }
 
+/**
+ * @brief Read consecutive registers from AS5600 in one transaction
+ * @param encoder_id Encoder identifier
+ * @param reg_addr First register address
+ * @param data Buffer for size bytes
+ * @param size Number of registers to read
+ * @return System error code
+ */
+static SystemError_t as5600_i2c_read_block(uint8_t encoder_id,
+                                           uint8_t reg_addr, uint8_t *data,
+                                           uint16_t size) {
+  AS5600_EncoderState_t *state = &encoder_state[encoder_id];
+
+#if SIMULATION_ENABLED
+  if (state->simulation_mode) {
+    // Simulation backend models registers one at a time
+    for (uint16_t i = 0; i < size; i++) {
+      uint8_t reg = (uint8_t)(reg_addr + i);
+      data[i] = 0;
+      if (reg > AS5600_REG_ANGLE_L && reg < AS5600_REG_AGC) {
+        continue; // Reserved gap between ANGLE and AGC
+      }
+      if (!as5600_sim_read_register(encoder_id, reg, &data[i])) {
+        return ERROR_ENCODER_COMMUNICATION;
+      }
+    }
+    return SYSTEM_OK;
+  }
+#endif
+
+  HAL_I2C_Transaction_t transaction = {.device_address = state->i2c_address,
+                                       .register_address = reg_addr,
+                                       .data = data,
+                                       .data_size = size,
+                                       .timeout_ms = AS5600_I2C_TIMEOUT,
+                                       .use_register_address = true};
+
+  SystemError_t result = HAL_Abstraction_I2C_MemRead(
+      encoder_id == 0 ? HAL_I2C_INSTANCE_1 : HAL_I2C_INSTANCE_2, &transaction);
+
+  if (result != SYSTEM_OK) {
+    return ERROR_ENCODER_COMMUNICATION;
+  }
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief 12-bit value of a register pair inside a burst block
+ * @param block Registers read from AS5600_REG_STATUS onwards
+ * @param reg_addr_high High byte register address
+ * @return Masked 12-bit value
+ */
+static uint16_t as5600_burst_word(const uint8_t *block,
+                                  uint8_t reg_addr_high) {
+  uint8_t offset = reg_addr_high - AS5600_REG_STATUS;
+  return (((uint16_t)block[offset] << 8) | block[offset + 1]) &
+         ENCODER_VALUE_MASK;
+}
+
+/**
+ * @brief Fetch and decode one burst window
+ * @param encoder_id Encoder identifier
+ * @param mode Register window to fetch
+ * @param sample Pointer to store the decoded sample
+ * @return System error code
+ *
+ * @note The read starts at STATUS: the AS5600 only holds its address pointer
+ * on RAW ANGLE, ANGLE and MAGNITUDE when the pointer was set to their high
+ * byte, so starting below them lets it run through all three.
+ */
+static SystemError_t as5600_burst_transfer(uint8_t encoder_id,
+                                           AS5600_BurstMode_t mode,
+                                           AS5600_Sample_t *sample) {
+  uint8_t block[AS5600_BURST_FULL_SIZE];
+  uint16_t size = (mode == AS5600_BURST_FULL) ? AS5600_BURST_FULL_SIZE
+                                              : AS5600_BURST_ANGLES_SIZE;
+
+  SystemError_t result =
+      as5600_i2c_read_block(encoder_id, AS5600_REG_STATUS, block, size);
+  if (result != SYSTEM_OK) {
+    return result;
+  }
+
+  memset(sample, 0, sizeof(*sample));
+  sample->status = block[0]; // STATUS opens the window
+  sample->raw_angle = as5600_burst_word(block, AS5600_REG_RAW_ANGLE_H);
+  sample->angle = as5600_burst_word(block, AS5600_REG_ANGLE_H);
+  if (mode == AS5600_BURST_FULL) {
+    sample->agc = block[AS5600_REG_AGC - AS5600_REG_STATUS];
+    sample->magnitude = as5600_burst_word(block, AS5600_REG_MAGNITUDE_H);
+  }
+  sample->timestamp_us = HAL_Abstraction_GetMicroseconds();
+
+  return SYSTEM_OK;
+}
+
+/**
+ * @brief Update encoder state from a burst sample
+ * @param encoder_id Encoder identifier
+ * @param sample Decoded sample
+ * @param mode Window the sample was read with
+ */
+static void as5600_store_sample(uint8_t encoder_id,
+                                const AS5600_Sample_t *sample,
+                                AS5600_BurstMode_t mode) {
+  AS5600_EncoderState_t *state = &encoder_state[encoder_id];
+
+  state->status_flags = sample->status;
+  state->magnet_detected = (sample->status & AS5600_STATUS_MD) != 0;
+  state->raw_angle = sample->raw_angle;
+  state->filtered_angle = sample->angle;
+  if (mode == AS5600_BURST_FULL) {
+    state->agc = sample->agc;
+    state->magnitude = sample->magnitude;
+  }
+  state->read_count++;
+  state->last_read_time = HAL_Abstraction_GetTick();
+}
+
 /**
  * @brief Validate encoder ID parameter
  * @param encoder_id Encoder identifier to validate
@@ -627,22 +778,13 @@ static float as5600_raw_to_degrees(uint16_t raw_value) {
 }
 
 /**
- * @brief Check magnet status and update state
- * @param encoder_id Encoder identifier
+ * @brief Map STATUS magnet flags to an error code
+ * @param status STATUS register value
  * @return System error code
  */
-static SystemError_t as5600_check_magnet_status(uint8_t encoder_id) {
-  uint8_t status;
-  SystemError_t result = as5600_read_status(encoder_id, &status);
-  if (result != SYSTEM_OK) {
-    return result;
-  }
-
-  AS5600_EncoderState_t *state = &encoder_state[encoder_id];
-
+static SystemError_t as5600_magnet_status_to_error(uint8_t status) {
   // Check magnet detection
   if (!(status & AS5600_STATUS_MD)) {
-    state->magnet_detected = false;
     return ERROR_ENCODER_MAGNET_NOT_DETECTED;
   }
 
@@ -655,7 +797,6 @@ static SystemError_t as5600_check_magnet_status(uint8_t encoder_id) {
     return ERROR_ENCODER_MAGNET_TOO_WEAK;
   }
 
-  state->magnet_detected = true;
   return SYSTEM_OK;
 }
 
@@ -19,6 +19,14 @@
 #include "config/motor_config.h"
 #ifndef UNITY_TESTING
 #include "stm32h7xx_hal.h"
+#elif !defined(STM32H7XX_HAL_H)
+/* Host-test / Unity compatibility stubs for the STM32 HAL types used by the
+ * legacy handle API. Skipped when the mock HAL header (tests/mocks) is
+ * already included. */
+typedef struct {
+  int _dummy;
+} I2C_HandleTypeDef;
+typedef int HAL_StatusTypeDef;
 #endif
 #include <stdbool.h>
 #include <stdint.h>
@@ -71,6 +79,10 @@
 // Burn Commands
 #define AS5600_REG_BURN 0xFF // Burn command
 
+// Burst windows, read from STATUS with an auto-incrementing address pointer
+#define AS5600_BURST_ANGLES_SIZE (AS5600_REG_ANGLE_L - AS5600_REG_STATUS + 1)
+#define AS5600_BURST_FULL_SIZE (AS5600_REG_MAGNITUDE_L - AS5600_REG_STATUS + 1)
+
 /* ==========================================================================
  */
 /* AS5600 Configuration Values                                               */
@@ -120,6 +132,26 @@ typedef struct {
 
 } AS5600_HandleTypeDef;
 
+/**
+ * @brief Register window fetched by as5600_read_burst()
+ */
+typedef enum {
+  AS5600_BURST_ANGLES = 0, // STATUS, RAW_ANGLE, ANGLE (5 bytes)
+  AS5600_BURST_FULL        // Up to MAGNITUDE, adds AGC (18 bytes)
+} AS5600_BurstMode_t;
+
+/**
+ * @brief Encoder sample decoded from one burst read
+ */
+typedef struct {
+  uint16_t raw_angle;    // Unscaled angle (0-4095)
+  uint16_t angle;        // Filtered, scaled angle (0-4095)
+  uint16_t magnitude;    // CORDIC magnitude (AS5600_BURST_FULL only)
+  uint8_t status;        // STATUS flags (MD, ML, MH)
+  uint8_t agc;           // Automatic gain control (AS5600_BURST_FULL only)
+  uint32_t timestamp_us; // HAL microsecond time after the transfer
+} AS5600_Sample_t;
+
 /* ==========================================================================
  */
 /* Public Function Declarations                                              */
@@ -305,6 +337,21 @@ SystemError_t as5600_read_magnitude(uint8_t encoder_id, uint16_t *magnitude);
  */
 SystemError_t as5600_read_status(uint8_t encoder_id, uint8_t *status);
 
+/**
+ * @brief Read status and angles (optionally AGC and magnitude) in one
+ *        I2C transaction
+ * @param encoder_id Encoder identifier
+ * @param mode Register window to fetch
+ * @param sample Pointer to store the decoded sample
+ * @return SystemError_t System error code; ERROR_ENCODER_MAGNET_NOT_DETECTED
+ *         when STATUS.MD is clear (the sample is still filled in)
+ *
+ * @note Replaces one MemRead per register: the sample is coherent and the
+ * address phase is paid once.
+ */
+SystemError_t as5600_read_burst(uint8_t encoder_id, AS5600_BurstMode_t mode,
+                                AS5600_Sample_t *sample);
+
 /**
  * @brief Get encoder velocity in degrees per second
  * @param encoder_id Encoder identifier
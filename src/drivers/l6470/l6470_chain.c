@@ -0,0 +1,321 @@
+/**
+ * @file l6470_chain.c
+ * @brief L6470 daisy-chain frame builder implementation
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Device d's byte k sits at tx[k * L6470_CHAIN_LENGTH + (N - 1 - d)]:
+ * the first byte clocked out in a slot travels through the whole chain and
+ * lands in the farthest device. MISO uses the same position for each
+ * device's reply byte.
+ */
+
+#include "l6470_chain.h"
+#include "l6470_driver.h"
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Function Declarations                                             */
+/* ==========================================================================
+ */
+
+static SystemError_t chain_queue(L6470Chain_t *chain, uint8_t device,
+                                 const uint8_t *bytes, uint8_t length,
+                                 uint8_t reply_bytes);
+static void put_be(uint8_t *dest, uint32_t value, uint8_t length);
+static uint16_t chain_pack(L6470Chain_t *chain);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+void l6470_chain_begin(L6470Chain_t *chain) {
+    if (chain == NULL) {
+        return;
+    }
+    memset(chain, 0, sizeof(*chain));
+}
+
+SystemError_t l6470_chain_command(L6470Chain_t *chain, uint8_t device,
+                                  uint8_t command) {
+    return chain_queue(chain, device, &command, 1U, 0U);
+}
+
+SystemError_t l6470_chain_get_status(L6470Chain_t *chain, uint8_t device) {
+    // Command byte plus two NOPs that clock STATUS out (MSB first)
+    const uint8_t bytes[3] = {L6470_CMD_GET_STATUS, L6470_NOP_COMMAND,
+                              L6470_NOP_COMMAND};
+    return chain_queue(chain, device, bytes, 3U, 2U);
+}
+
+SystemError_t l6470_chain_get_param(L6470Chain_t *chain, uint8_t device,
+                                    uint8_t register_addr) {
+    uint8_t width = l6470_chain_register_bytes(register_addr);
+    if (width == 0U) {
+        return ERROR_MOTOR_PARAMETER_INVALID;
+    }
+
+    uint8_t bytes[L6470_CHAIN_MAX_CMD_BYTES] = {0};
+    bytes[0] = (uint8_t)(L6470_CMD_GET_PARAM | register_addr);
+    return chain_queue(chain, device, bytes, (uint8_t)(width + 1U), width);
+}
+
+SystemError_t l6470_chain_set_param(L6470Chain_t *chain, uint8_t device,
+                                    uint8_t register_addr, uint32_t value) {
+    uint8_t width = l6470_chain_register_bytes(register_addr);
+    if (width == 0U) {
+        return ERROR_MOTOR_PARAMETER_INVALID;
+    }
+
+    uint8_t bytes[L6470_CHAIN_MAX_CMD_BYTES];
+    bytes[0] = (uint8_t)(L6470_CMD_SET_PARAM | register_addr);
+    put_be(&bytes[1], value, width);
+    return chain_queue(chain, device, bytes, (uint8_t)(width + 1U), 0U);
+}
+
+SystemError_t l6470_chain_run(L6470Chain_t *chain, uint8_t device,
+                              bool forward, uint32_t speed) {
+    uint8_t bytes[4];
+    bytes[0] = (uint8_t)(L6470_CMD_RUN | (forward ? 1U : 0U));
+    put_be(&bytes[1], speed & 0x0FFFFFU, 3U);
+    return chain_queue(chain, device, bytes, 4U, 0U);
+}
+
+SystemError_t l6470_chain_move(L6470Chain_t *chain, uint8_t device,
+                               bool forward, uint32_t steps) {
+    uint8_t bytes[4];
+    bytes[0] = (uint8_t)(L6470_CMD_MOVE | (forward ? 1U : 0U));
+    put_be(&bytes[1], steps & 0x3FFFFFU, 3U);
+    return chain_queue(chain, device, bytes, 4U, 0U);
+}
+
+SystemError_t l6470_chain_goto(L6470Chain_t *chain, uint8_t device,
+                               int32_t position) {
+    uint8_t bytes[4];
+    bytes[0] = L6470_CMD_GOTO;
+    put_be(&bytes[1], (uint32_t)position & 0x3FFFFFU, 3U);
+    return chain_queue(chain, device, bytes, 4U, 0U);
+}
+
+SystemError_t l6470_chain_transfer(L6470Chain_t *chain) {
+    if (chain == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (chain->slots == 0U) {
+        return SYSTEM_OK;
+    }
+
+    HAL_SPI_Transaction_t transaction = {
+        .tx_data = chain->tx,
+        .rx_data = chain->rx,
+        .data_size = chain_pack(chain),
+        .timeout_ms = SPI_TIMEOUT_MS,
+        .cs_frame_size = L6470_CHAIN_LENGTH,
+    };
+    SystemError_t result =
+        HAL_Abstraction_SPI_TransmitReceive(L6470_CHAIN_SPI, &transaction);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    l6470_chain_collect(chain);
+    return SYSTEM_OK;
+}
+
+SystemError_t l6470_chain_transfer_burst(L6470Chain_t *chains, uint8_t count) {
+    static uint8_t burst_tx[L6470_CHAIN_BURST_MAX_FRAMES *
+                            L6470_CHAIN_FRAME_SIZE];
+    static uint8_t burst_rx[L6470_CHAIN_BURST_MAX_FRAMES *
+                            L6470_CHAIN_FRAME_SIZE];
+
+    if (chains == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (count > L6470_CHAIN_BURST_MAX_FRAMES) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    uint16_t burst_size = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t frame_size = chain_pack(&chains[i]);
+        memcpy(&burst_tx[burst_size], chains[i].tx, frame_size);
+        burst_size = (uint16_t)(burst_size + frame_size);
+    }
+    if (burst_size == 0U) {
+        return SYSTEM_OK;
+    }
+
+    HAL_SPI_Transaction_t transaction = {
+        .tx_data = burst_tx,
+        .rx_data = burst_rx,
+        .data_size = burst_size,
+        .timeout_ms = SPI_TIMEOUT_MS,
+        .cs_frame_size = L6470_CHAIN_LENGTH,
+    };
+    SystemError_t result =
+        HAL_Abstraction_SPI_TransmitReceive(L6470_CHAIN_SPI, &transaction);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    uint16_t offset = 0;
+    for (uint8_t i = 0; i < count; i++) {
+        uint16_t frame_size =
+            (uint16_t)(chains[i].slots * L6470_CHAIN_LENGTH);
+        memcpy(chains[i].rx, &burst_rx[offset], frame_size);
+        offset = (uint16_t)(offset + frame_size);
+        l6470_chain_collect(&chains[i]);
+    }
+    return SYSTEM_OK;
+}
+
+SystemError_t l6470_chain_submit(L6470Chain_t *chain,
+                                 HAL_Async_Request_t *request) {
+    if (chain == NULL || request == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (chain->slots == 0U) {
+        return ERROR_INVALID_STATE;
+    }
+
+    request->xfer.spi.tx_data = chain->tx;
+    request->xfer.spi.rx_data = chain->rx;
+    request->xfer.spi.data_size = chain_pack(chain);
+    request->xfer.spi.timeout_ms = SPI_TIMEOUT_MS;
+    request->xfer.spi.cs_frame_size = L6470_CHAIN_LENGTH;
+    return HAL_Abstraction_SPI_Submit(L6470_CHAIN_SPI, request);
+}
+
+void l6470_chain_collect(L6470Chain_t *chain) {
+    if (chain == NULL) {
+        return;
+    }
+
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        L6470ChainCommand_t *cmd = &chain->device[dev];
+        uint8_t pos = (uint8_t)(L6470_CHAIN_LENGTH - 1U - dev);
+        uint32_t reply = 0;
+        for (uint8_t k = (uint8_t)(cmd->length - cmd->reply_bytes);
+             k < cmd->length; k++) {
+            reply = (reply << 8) | chain->rx[k * L6470_CHAIN_LENGTH + pos];
+        }
+        cmd->reply = reply;
+    }
+}
+
+uint32_t l6470_chain_reply(const L6470Chain_t *chain, uint8_t device) {
+    if (chain == NULL || device >= L6470_CHAIN_LENGTH) {
+        return 0;
+    }
+    return chain->device[device].reply;
+}
+
+uint8_t l6470_chain_register_bytes(uint8_t register_addr) {
+    switch (register_addr) {
+    case L6470_REG_ABS_POS:
+    case L6470_REG_MARK:
+    case L6470_REG_SPEED:
+        return 3U;
+    case L6470_REG_EL_POS:
+    case L6470_REG_ACC:
+    case L6470_REG_DEC:
+    case L6470_REG_MAX_SPEED:
+    case L6470_REG_MIN_SPEED:
+    case L6470_REG_FS_SPD:
+    case L6470_REG_INT_SPD:
+    case L6470_REG_CONFIG:
+    case L6470_REG_STATUS:
+        return 2U;
+    case L6470_REG_KVAL_HOLD:
+    case L6470_REG_KVAL_RUN:
+    case L6470_REG_KVAL_ACC:
+    case L6470_REG_KVAL_DEC:
+    case L6470_REG_ST_SLP:
+    case L6470_REG_FN_SLP_ACC:
+    case L6470_REG_FN_SLP_DEC:
+    case L6470_REG_K_THERM:
+    case L6470_REG_ADC_OUT:
+    case L6470_REG_OCD_TH:
+    case L6470_REG_STALL_TH:
+    case L6470_REG_STEP_MODE:
+    case L6470_REG_ALARM_EN:
+        return 1U;
+    default:
+        return 0U;
+    }
+}
+
+/* ==========================================================================
+ */
+/* Private Functions Implementation                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Queue one device's command and widen the frame if needed
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param bytes Command and argument bytes
+ * @param length Number of bytes
+ * @param reply_bytes Trailing bytes that carry the reply
+ * @return System error code
+ */
+static SystemError_t chain_queue(L6470Chain_t *chain, uint8_t device,
+                                 const uint8_t *bytes, uint8_t length,
+                                 uint8_t reply_bytes) {
+    if (chain == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (device >= L6470_CHAIN_LENGTH) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+
+    L6470ChainCommand_t *cmd = &chain->device[device];
+    if (cmd->length != 0U) {
+        // One command per device per chip-select frame
+        return ERROR_OPERATION_IN_PROGRESS;
+    }
+
+    memcpy(cmd->bytes, bytes, length);
+    cmd->length = length;
+    cmd->reply_bytes = reply_bytes;
+    cmd->reply = 0;
+    if (length > chain->slots) {
+        chain->slots = length;
+    }
+    return SYSTEM_OK;
+}
+
+/**
+ * @brief Interleave the queued commands into the transmit frame
+ * @param chain Frame under construction
+ * @return Frame size in bytes
+ */
+static uint16_t chain_pack(L6470Chain_t *chain) {
+    // Unused positions stay NOP so idle devices ignore them
+    uint16_t frame_size = (uint16_t)(chain->slots * L6470_CHAIN_LENGTH);
+    memset(chain->tx, L6470_NOP_COMMAND, frame_size);
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        const L6470ChainCommand_t *cmd = &chain->device[dev];
+        uint8_t pos = (uint8_t)(L6470_CHAIN_LENGTH - 1U - dev);
+        for (uint8_t k = 0; k < cmd->length; k++) {
+            chain->tx[k * L6470_CHAIN_LENGTH + pos] = cmd->bytes[k];
+        }
+    }
+    return frame_size;
+}
+
+/**
+ * @brief Store the low bytes of a value MSB first
+ * @param dest Destination buffer
+ * @param value Value to store
+ * @param length Number of bytes
+ */
+static void put_be(uint8_t *dest, uint32_t value, uint8_t length) {
+    for (uint8_t i = 0; i < length; i++) {
+        dest[i] = (uint8_t)(value >> (8U * (length - 1U - i)));
+    }
+}
@@ -0,0 +1,207 @@
+/**
+ * @file l6470_chain.h
+ * @brief L6470 daisy-chain frame builder - one SPI transfer for all devices
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note The IHM02A1 shifts every byte through all L6470_CHAIN_LENGTH
+ * devices, so a command for one motor costs a full chain transfer anyway.
+ * This builder queues at most one command per device, pads the shorter
+ * ones with NOPs and sends the whole frame with a single
+ * HAL_Abstraction_SPI_TransmitReceive call. Replies (GET_STATUS,
+ * GET_PARAM) are demultiplexed per device after the transfer.
+ *
+ * Frame layout: byte slot k carries one byte per device, farthest device
+ * first (X-CUBE-SPN2 order), and chip select is pulsed after every slot
+ * via HAL_SPI_Transaction_t::cs_frame_size.
+ */
+
+#ifndef L6470_CHAIN_H
+#define L6470_CHAIN_H
+
+#include "common/error_codes.h"
+#include "config/comm_config.h"
+#include "hal_abstraction/hal_abstraction.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==========================================================================
+ */
+/* Chain Configuration                                                       */
+/* ==========================================================================
+ */
+
+#define L6470_CHAIN_SPI HAL_SPI_INSTANCE_2 ///< Motor SPI (hspi2)
+#define L6470_CHAIN_MAX_CMD_BYTES 4U ///< Command byte + up to 3 data bytes
+#define L6470_CHAIN_FRAME_SIZE                                                \
+    (L6470_CHAIN_MAX_CMD_BYTES * L6470_CHAIN_LENGTH)
+#define L6470_CHAIN_BURST_MAX_FRAMES 16U ///< Frames per burst transfer
+
+/* ==========================================================================
+ */
+/* Chain Data Structures                                                     */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Command queued for one device in the chain
+ */
+typedef struct {
+    uint8_t bytes[L6470_CHAIN_MAX_CMD_BYTES]; ///< Command and argument bytes
+    uint8_t length;      ///< Bytes queued (0 = device gets NOPs)
+    uint8_t reply_bytes; ///< Trailing bytes that clock a reply out
+    uint32_t reply;      ///< Demultiplexed reply after the transfer
+} L6470ChainCommand_t;
+
+/**
+ * @brief One chip-select frame under construction
+ */
+typedef struct {
+    L6470ChainCommand_t device[L6470_CHAIN_LENGTH]; ///< Per-device commands
+    uint8_t tx[L6470_CHAIN_FRAME_SIZE]; ///< Interleaved transmit frame
+    uint8_t rx[L6470_CHAIN_FRAME_SIZE]; ///< Interleaved receive frame
+    uint8_t slots;                      ///< Byte slots used by the frame
+} L6470Chain_t;
+
+/* ==========================================================================
+ */
+/* Public Function Declarations                                              */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Start a new frame with every device idle (NOP)
+ * @param chain Frame to reset
+ */
+void l6470_chain_begin(L6470Chain_t *chain);
+
+/**
+ * @brief Queue a single-byte command (SOFT_STOP, HARD_HIZ, RESET_POS, ...)
+ * @param chain Frame under construction
+ * @param device Device index (0 = first motor)
+ * @param command L6470 command byte
+ * @return SYSTEM_OK, ERROR_MOTOR_INVALID_ID or ERROR_OPERATION_IN_PROGRESS
+ *         when the device already has a command in this frame
+ */
+SystemError_t l6470_chain_command(L6470Chain_t *chain, uint8_t device,
+                                  uint8_t command);
+
+/**
+ * @brief Queue GET_STATUS; the 16-bit status is the device's reply
+ * @param chain Frame under construction
+ * @param device Device index
+ * @return System error code
+ */
+SystemError_t l6470_chain_get_status(L6470Chain_t *chain, uint8_t device);
+
+/**
+ * @brief Queue GET_PARAM for a register; the value is the device's reply
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param register_addr L6470 register address
+ * @return System error code (ERROR_MOTOR_PARAMETER_INVALID for an unknown
+ *         register)
+ */
+SystemError_t l6470_chain_get_param(L6470Chain_t *chain, uint8_t device,
+                                    uint8_t register_addr);
+
+/**
+ * @brief Queue SET_PARAM for a register
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param register_addr L6470 register address
+ * @param value Register value (sent with the register's width)
+ * @return System error code
+ */
+SystemError_t l6470_chain_set_param(L6470Chain_t *chain, uint8_t device,
+                                    uint8_t register_addr, uint32_t value);
+
+/**
+ * @brief Queue RUN at a raw SPEED register value
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param forward Direction bit
+ * @param speed 20-bit speed in L6470 SPEED units
+ * @return System error code
+ */
+SystemError_t l6470_chain_run(L6470Chain_t *chain, uint8_t device,
+                              bool forward, uint32_t speed);
+
+/**
+ * @brief Queue MOVE by a number of microsteps
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param forward Direction bit
+ * @param steps 22-bit step count
+ * @return System error code
+ */
+SystemError_t l6470_chain_move(L6470Chain_t *chain, uint8_t device,
+                               bool forward, uint32_t steps);
+
+/**
+ * @brief Queue GOTO an absolute position
+ * @param chain Frame under construction
+ * @param device Device index
+ * @param position Target position (22-bit two's complement on the wire)
+ * @return System error code
+ */
+SystemError_t l6470_chain_goto(L6470Chain_t *chain, uint8_t device,
+                               int32_t position);
+
+/**
+ * @brief Send the frame in one SPI transfer and demultiplex the replies
+ * @param chain Frame to send
+ * @return SYSTEM_OK (also when nothing is queued) or the HAL error
+ */
+SystemError_t l6470_chain_transfer(L6470Chain_t *chain);
+
+/**
+ * @brief Send several frames back to back in one SPI transfer
+ * @param chains Frames to send, in order
+ * @param count Number of frames (at most L6470_CHAIN_BURST_MAX_FRAMES)
+ * @return SYSTEM_OK (also when nothing is queued) or the HAL error
+ * @note Every slot is latched by its own chip-select pulse, so frames can
+ * be concatenated. Uses static burst buffers: call from one context only.
+ */
+SystemError_t l6470_chain_transfer_burst(L6470Chain_t *chains, uint8_t count);
+
+/**
+ * @brief Queue the frame on the motor SPI without waiting for the bus
+ * @param chain Frame to send; must stay untouched until the request is done
+ * @param request Caller-owned request (on_complete/context may be set)
+ * @return SYSTEM_OK once queued, ERROR_INVALID_STATE for an empty frame
+ * @note Call l6470_chain_collect() once the request is DONE.
+ */
+SystemError_t l6470_chain_submit(L6470Chain_t *chain,
+                                 HAL_Async_Request_t *request);
+
+/**
+ * @brief Demultiplex the replies of a completed frame
+ * @param chain Frame whose transfer finished
+ */
+void l6470_chain_collect(L6470Chain_t *chain);
+
+/**
+ * @brief Reply received by a device in the last transfer
+ * @param chain Transferred frame
+ * @param device Device index
+ * @return Reply value (0 when the device had no reply-bearing command)
+ */
+uint32_t l6470_chain_reply(const L6470Chain_t *chain, uint8_t device);
+
+/**
+ * @brief Width of an L6470 register on the wire
+ * @param register_addr L6470 register address
+ * @return Number of data bytes (0 for an unknown register)
+ */
+uint8_t l6470_chain_register_bytes(uint8_t register_addr);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* L6470_CHAIN_H */
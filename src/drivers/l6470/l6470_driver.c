@@ -12,9 +12,17 @@
 #include "common/error_codes.h"
 #include "config/comm_config.h"
 #include "config/hardware_config.h"
+#include "config/l6470_registers_generated.h"
 #include "config/motor_config.h"
+#include "hal_abstraction/hal_abstraction.h"
+#include "l6470_chain.h"
+#include "l6470_shadow.h"
+#include "simulation/motor_simulation.h"
 #include <string.h>
 
+// Largest speed passed to l6470_speed_encode(); SPEED saturates far below
+#define L6470_RUN_MAX_MSTEPS_PER_S 1000000000U
+
 /* ==========================================================================
  */
 /* Private Variables and State Management                                    */
@@ -22,6 +30,7 @@
  */
 
 static bool l6470_initialized = false;
+static uint32_t l6470_last_verify_ms = 0;
 
 // Driver state for each motor
 typedef struct {
@@ -41,6 +50,8 @@ static L6470_DriverState_t driver_state[L6470_MAX_DEVICES] = {0};
  */
 
 static SystemError_t l6470_validate_motor_id(uint8_t motor_id);
+static SystemError_t l6470_send_frame(L6470Chain_t *chain);
+static SystemError_t l6470_send_command(uint8_t motor_id, uint8_t command);
 
 /* ==========================================================================
  */
@@ -55,6 +66,8 @@ static SystemError_t l6470_validate_motor_id(uint8_t motor_id);
 SystemError_t l6470_init(void) {
     // Mark as initialized for now - will implement SPI init later
     l6470_initialized = true;
+    l6470_shadow_init();
+    l6470_last_verify_ms = HAL_Abstraction_GetTick();
 
     // Initialize driver state for all motors
     for (uint8_t i = 0; i < L6470_MAX_DEVICES; i++) {
@@ -62,8 +75,11 @@ SystemError_t l6470_init(void) {
         driver_state[i].last_status = 0;
         driver_state[i].last_command_time = 0;
         driver_state[i].fault_count = 0;
-        driver_state[i].simulation_mode =
-            true; // Enable simulation mode for now
+#if SIMULATION_ENABLED
+        driver_state[i].simulation_mode = motor_simulation_is_active();
+#else
+        driver_state[i].simulation_mode = false;
+#endif
     }
 
     return SYSTEM_OK;
@@ -95,11 +111,12 @@ SystemError_t l6470_reset_device(uint8_t motor_id) {
         return result;
     }
 
-    // Reset driver state
+    // Reset driver state; the device reloads its register defaults
     driver_state[motor_id].last_status = 0;
     driver_state[motor_id].fault_count = 0;
+    l6470_shadow_invalidate(motor_id);
 
-    return SYSTEM_OK;
+    return l6470_send_command(motor_id, L6470_CMD_RESET_DEVICE);
 }
 
 /**
@@ -108,6 +125,8 @@ SystemError_t l6470_reset_device(uint8_t motor_id) {
  * @param register_addr Register address
  * @param value Parameter value
  * @return System error code
+ * @note Configuration registers are written to the shadow and reach the
+ * device with the next l6470_flush_parameters() or l6470_service().
  */
 SystemError_t l6470_set_parameter(uint8_t motor_id, uint8_t register_addr,
                                   uint32_t value) {
@@ -116,9 +135,20 @@ SystemError_t l6470_set_parameter(uint8_t motor_id, uint8_t register_addr,
         return result;
     }
 
-    // TODO: Implement actual SPI communication
-    // For now, just return success in simulation mode
-    return SYSTEM_OK;
+    if (driver_state[motor_id].simulation_mode) {
+        return SYSTEM_OK;
+    }
+    if (l6470_shadow_is_cached(register_addr)) {
+        return l6470_shadow_write(motor_id, register_addr, value);
+    }
+
+    L6470Chain_t chain;
+    l6470_chain_begin(&chain);
+    result = l6470_chain_set_param(&chain, motor_id, register_addr, value);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return l6470_send_frame(&chain);
 }
 
 /**
@@ -139,10 +169,51 @@ SystemError_t l6470_get_parameter(uint8_t motor_id, uint8_t register_addr,
         return ERROR_NULL_POINTER;
     }
 
-    // TODO: Implement actual SPI communication
-    // For now, just return a dummy value
     *value = 0;
-    return SYSTEM_OK;
+    if (driver_state[motor_id].simulation_mode) {
+        return SYSTEM_OK;
+    }
+
+    // Configuration registers come from the shadow once known
+    return l6470_shadow_read(motor_id, register_addr, value);
+}
+
+/**
+ * @brief Write all pending configuration registers in one SPI burst
+ * @return System error code
+ */
+SystemError_t l6470_flush_parameters(void) {
+    if (!l6470_initialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    SystemError_t result = l6470_shadow_flush();
+    if (result != SYSTEM_OK) {
+        for (uint8_t i = 0; i < L6470_MAX_DEVICES; i++) {
+            if (l6470_shadow_dirty_count(i) != 0U) {
+                driver_state[i].fault_count++;
+            }
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Periodic register maintenance (call once per control tick)
+ * @return System error code
+ */
+SystemError_t l6470_service(void) {
+    SystemError_t result = l6470_flush_parameters();
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    uint32_t now = HAL_Abstraction_GetTick();
+    if ((now - l6470_last_verify_ms) < L6470_SHADOW_VERIFY_PERIOD_MS) {
+        return SYSTEM_OK;
+    }
+    l6470_last_verify_ms = now;
+    return l6470_shadow_verify();
 }
 
 /**
@@ -161,11 +232,68 @@ SystemError_t l6470_get_status(uint8_t motor_id, uint16_t *status) {
         return ERROR_NULL_POINTER;
     }
 
-    // Return cached status for now
+    if (!driver_state[motor_id].simulation_mode) {
+        L6470Chain_t chain;
+        l6470_chain_begin(&chain);
+        result = l6470_chain_get_status(&chain, motor_id);
+        if (result == SYSTEM_OK) {
+            result = l6470_send_frame(&chain);
+        }
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+        driver_state[motor_id].last_status =
+            (uint16_t)l6470_chain_reply(&chain, motor_id);
+    }
+
     *status = driver_state[motor_id].last_status;
     return SYSTEM_OK;
 }
 
+/**
+ * @brief Read STATUS from every device in one daisy-chain transfer
+ * @param status Array of L6470_MAX_DEVICES entries to fill
+ * @return System error code
+ */
+SystemError_t l6470_get_status_all(uint16_t status[L6470_MAX_DEVICES]) {
+    if (status == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (!l6470_initialized) {
+        return ERROR_NOT_INITIALIZED;
+    }
+
+    // Queue GET_STATUS for every device so N motors cost one transfer
+    L6470Chain_t chain;
+    bool queued = false;
+    l6470_chain_begin(&chain);
+    for (uint8_t i = 0; i < L6470_MAX_DEVICES; i++) {
+        if (!driver_state[i].simulation_mode) {
+            SystemError_t result = l6470_chain_get_status(&chain, i);
+            if (result != SYSTEM_OK) {
+                return result;
+            }
+            queued = true;
+        }
+    }
+
+    if (queued) {
+        SystemError_t result = l6470_send_frame(&chain);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+    }
+
+    for (uint8_t i = 0; i < L6470_MAX_DEVICES; i++) {
+        if (!driver_state[i].simulation_mode) {
+            driver_state[i].last_status =
+                (uint16_t)l6470_chain_reply(&chain, i);
+        }
+        status[i] = driver_state[i].last_status;
+    }
+    return SYSTEM_OK;
+}
+
 /**
  * @brief Move motor to absolute position
  * @param motor_id Motor identifier
@@ -178,8 +306,23 @@ SystemError_t l6470_move_to_position(uint8_t motor_id, int32_t position) {
         return result;
     }
 
-    // TODO: Implement actual motion command
-    return SYSTEM_OK;
+    if (driver_state[motor_id].simulation_mode) {
+        return SYSTEM_OK;
+    }
+
+    // Motion must use the latest ACC/DEC/MAX_SPEED
+    result = l6470_flush_parameters();
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    L6470Chain_t chain;
+    l6470_chain_begin(&chain);
+    result = l6470_chain_goto(&chain, motor_id, position);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return l6470_send_frame(&chain);
 }
 
 /**
@@ -193,8 +336,7 @@ SystemError_t l6470_soft_stop(uint8_t motor_id) {
         return result;
     }
 
-    // TODO: Send soft stop command
-    return SYSTEM_OK;
+    return l6470_send_command(motor_id, L6470_CMD_SOFT_STOP);
 }
 
 /**
@@ -208,8 +350,7 @@ SystemError_t l6470_hard_stop(uint8_t motor_id) {
         return result;
     }
 
-    // TODO: Send hard stop command
-    return SYSTEM_OK;
+    return l6470_send_command(motor_id, L6470_CMD_HARD_STOP);
 }
 
 /**
@@ -223,8 +364,7 @@ SystemError_t l6470_hard_hiz(uint8_t motor_id) {
         return result;
     }
 
-    // TODO: Send HIZ command
-    return SYSTEM_OK;
+    return l6470_send_command(motor_id, L6470_CMD_HARD_HIZ);
 }
 
 /**
@@ -248,8 +388,31 @@ SystemError_t l6470_run(uint8_t motor_id, bool direction, float speed) {
         return result;
     }
 
-    // TODO: Implement run command
-    return SYSTEM_OK;
+    if (driver_state[motor_id].simulation_mode) {
+        return SYSTEM_OK;
+    }
+    if (speed < 0.0f) {
+        return ERROR_MOTOR_INVALID_SPEED;
+    }
+
+    float msteps = speed * 1000.0f;
+    uint32_t speed_reg = l6470_speed_encode(
+        (msteps >= (float)L6470_RUN_MAX_MSTEPS_PER_S)
+            ? L6470_RUN_MAX_MSTEPS_PER_S
+            : (uint32_t)(msteps + 0.5f));
+
+    result = l6470_flush_parameters();
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    L6470Chain_t chain;
+    l6470_chain_begin(&chain);
+    result = l6470_chain_run(&chain, motor_id, direction, speed_reg);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return l6470_send_frame(&chain);
 }
 
 /**
@@ -263,8 +426,7 @@ SystemError_t l6470_reset_position(uint8_t motor_id) {
         return result;
     }
 
-    // TODO: Send reset position command
-    return SYSTEM_OK;
+    return l6470_send_command(motor_id, L6470_CMD_RESET_POS);
 }
 
 /* ==========================================================================
@@ -289,3 +451,45 @@ static SystemError_t l6470_validate_motor_id(uint8_t motor_id) {
 
     return SYSTEM_OK;
 }
+
+/**
+ * @brief Send a chain frame and account the result per device
+ * @param chain Frame with the queued commands
+ * @return System error code
+ */
+static SystemError_t l6470_send_frame(L6470Chain_t *chain) {
+    SystemError_t result = l6470_chain_transfer(chain);
+    uint32_t now = HAL_Abstraction_GetTick();
+
+    for (uint8_t i = 0; i < L6470_MAX_DEVICES; i++) {
+        if (chain->device[i].length == 0U) {
+            continue;
+        }
+        if (result == SYSTEM_OK) {
+            driver_state[i].last_command_time = now;
+        } else {
+            driver_state[i].fault_count++;
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Send a single-byte command to one device (others get NOPs)
+ * @param motor_id Motor identifier (already validated)
+ * @param command L6470 command byte
+ * @return System error code
+ */
+static SystemError_t l6470_send_command(uint8_t motor_id, uint8_t command) {
+    if (driver_state[motor_id].simulation_mode) {
+        return SYSTEM_OK;
+    }
+
+    L6470Chain_t chain;
+    l6470_chain_begin(&chain);
+    SystemError_t result = l6470_chain_command(&chain, motor_id, command);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+    return l6470_send_frame(&chain);
+}
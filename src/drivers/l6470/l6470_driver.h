@@ -21,9 +21,10 @@
 #include "config/motor_config.h"
 #ifndef UNITY_TESTING
 #include "stm32h7xx_hal.h"
-#else
+#elif !defined(STM32H7XX_HAL_H)
 /* Host-test / Unity compatibility stubs for a subset of STM32 HAL types
- * These are intentionally minimal and only for compilation on the host. */
+ * These are intentionally minimal and only for compilation on the host.
+ * Skipped when the mock HAL header (tests/mocks) is already included. */
 typedef struct {
     int _dummy;
 } SPI_HandleTypeDef;
@@ -331,6 +332,7 @@ SystemError_t l6470_reset_device(uint8_t motor_id);
  * @param register_addr Register address
  * @param value Parameter value
  * @return SystemError_t System error code
+ * @note Configuration registers are deferred until the next flush
  */
 SystemError_t l6470_set_parameter(uint8_t motor_id, uint8_t register_addr,
                                   uint32_t value);
@@ -345,6 +347,20 @@ SystemError_t l6470_set_parameter(uint8_t motor_id, uint8_t register_addr,
 SystemError_t l6470_get_parameter(uint8_t motor_id, uint8_t register_addr,
                                   uint32_t *value);
 
+/**
+ * @brief Write all pending configuration registers in one SPI burst
+ * @return SystemError_t System error code
+ */
+SystemError_t l6470_flush_parameters(void);
+
+/**
+ * @brief Periodic register maintenance (call once per control tick)
+ * @return SystemError_t System error code
+ * @note Flushes pending register writes and every
+ * L6470_SHADOW_VERIFY_PERIOD_MS reads one cached register per device back.
+ */
+SystemError_t l6470_service(void);
+
 /**
  * @brief Get L6470 status register
  * @param motor_id Motor identifier
@@ -353,6 +369,13 @@ SystemError_t l6470_get_parameter(uint8_t motor_id, uint8_t register_addr,
  */
 SystemError_t l6470_get_status(uint8_t motor_id, uint16_t *status);
 
+/**
+ * @brief Read STATUS from every device in one daisy-chain transfer
+ * @param status Array of L6470_MAX_DEVICES entries to fill
+ * @return SystemError_t System error code
+ */
+SystemError_t l6470_get_status_all(uint16_t status[L6470_MAX_DEVICES]);
+
 /**
  * @brief Move motor to absolute position
  * @param motor_id Motor identifier
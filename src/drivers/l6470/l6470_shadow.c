@@ -0,0 +1,330 @@
+/**
+ * @file l6470_shadow.c
+ * @brief L6470 register shadow cache implementation
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Each device keeps one value per register address plus a valid and
+ * a dirty bit mask. A dirty register is always valid: its value is the one
+ * the device should hold after the next flush.
+ */
+
+#include "l6470_shadow.h"
+#include "config/l6470_registers_generated.h"
+#include "l6470_driver.h"
+#include <string.h>
+
+/* ==========================================================================
+ */
+/* Private Definitions and State                                             */
+/* ==========================================================================
+ */
+
+#define SHADOW_BIT(addr) (1UL << (addr))
+
+// Configuration registers from l6470_registers_generated.h
+#define SHADOW_CACHED_MASK                                                    \
+    (SHADOW_BIT(L6470_ACC_ADDR) | SHADOW_BIT(L6470_DEC_ADDR) |                \
+     SHADOW_BIT(L6470_MAX_SPEED_ADDR) | SHADOW_BIT(L6470_MIN_SPEED_ADDR) |    \
+     SHADOW_BIT(L6470_KVAL_HOLD_ADDR) | SHADOW_BIT(L6470_KVAL_RUN_ADDR) |     \
+     SHADOW_BIT(L6470_KVAL_ACC_ADDR) | SHADOW_BIT(L6470_KVAL_DEC_ADDR) |      \
+     SHADOW_BIT(L6470_INT_SPD_ADDR) | SHADOW_BIT(L6470_FS_SPD_ADDR) |         \
+     SHADOW_BIT(L6470_OCD_TH_ADDR) | SHADOW_BIT(L6470_STALL_TH_ADDR) |        \
+     SHADOW_BIT(L6470_STEP_MODE_ADDR) | SHADOW_BIT(L6470_ALARM_EN_ADDR) |     \
+     SHADOW_BIT(L6470_CONFIG_ADDR))
+
+typedef struct {
+    uint32_t value[L6470_SHADOW_REG_COUNT]; ///< Last written or read value
+    uint32_t valid;        ///< Bit per register: value is known
+    uint32_t dirty;        ///< Bit per register: not yet on the device
+    uint8_t verify_cursor; ///< Register checked by the last verify
+} L6470Shadow_t;
+
+static L6470Shadow_t shadow[L6470_CHAIN_LENGTH];
+static L6470ShadowStats_t shadow_stats;
+
+// Flush frames are large, keep them off the caller's stack
+static L6470Chain_t flush_frames[L6470_CHAIN_BURST_MAX_FRAMES];
+
+/* ==========================================================================
+ */
+/* Private Function Declarations                                             */
+/* ==========================================================================
+ */
+
+static uint32_t shadow_register_mask(uint8_t register_addr);
+static uint8_t shadow_next_register(uint32_t candidates, uint8_t after);
+
+/* ==========================================================================
+ */
+/* Public API Implementation                                                 */
+/* ==========================================================================
+ */
+
+void l6470_shadow_init(void) {
+    memset(shadow, 0, sizeof(shadow));
+    memset(&shadow_stats, 0, sizeof(shadow_stats));
+}
+
+bool l6470_shadow_is_cached(uint8_t register_addr) {
+    return register_addr < L6470_SHADOW_REG_COUNT &&
+           (SHADOW_CACHED_MASK & SHADOW_BIT(register_addr)) != 0U;
+}
+
+SystemError_t l6470_shadow_write(uint8_t device, uint8_t register_addr,
+                                 uint32_t value) {
+    if (device >= L6470_CHAIN_LENGTH) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+    if (!l6470_shadow_is_cached(register_addr)) {
+        return ERROR_MOTOR_PARAMETER_INVALID;
+    }
+
+    L6470Shadow_t *s = &shadow[device];
+    uint32_t bit = SHADOW_BIT(register_addr);
+    value &= shadow_register_mask(register_addr);
+
+    bool same = (s->valid & bit) != 0U && s->value[register_addr] == value;
+    if (same || (s->dirty & bit) != 0U) {
+        // Repeats the known value or replaces a write not yet flushed
+        shadow_stats.writes_coalesced++;
+    }
+    if (same) {
+        return SYSTEM_OK;
+    }
+
+    s->value[register_addr] = value;
+    s->valid |= bit;
+    s->dirty |= bit;
+    return SYSTEM_OK;
+}
+
+SystemError_t l6470_shadow_read(uint8_t device, uint8_t register_addr,
+                                uint32_t *value) {
+    if (value == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (device >= L6470_CHAIN_LENGTH) {
+        return ERROR_MOTOR_INVALID_ID;
+    }
+
+    L6470Shadow_t *s = &shadow[device];
+    bool cached = l6470_shadow_is_cached(register_addr);
+    if (cached && (s->valid & SHADOW_BIT(register_addr)) != 0U) {
+        shadow_stats.cache_hits++;
+        *value = s->value[register_addr];
+        return SYSTEM_OK;
+    }
+
+    shadow_stats.cache_misses++;
+    L6470Chain_t chain;
+    l6470_chain_begin(&chain);
+    SystemError_t result = l6470_chain_get_param(&chain, device, register_addr);
+    if (result == SYSTEM_OK) {
+        result = l6470_chain_transfer(&chain);
+    }
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    *value = l6470_chain_reply(&chain, device);
+    if (cached) {
+        s->value[register_addr] = *value;
+        s->valid |= SHADOW_BIT(register_addr);
+    }
+    return SYSTEM_OK;
+}
+
+SystemError_t l6470_shadow_flush(void) {
+    uint32_t pending[L6470_CHAIN_LENGTH];
+    uint8_t frames = 0;
+    uint8_t registers = 0;
+
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        pending[dev] = shadow[dev].dirty;
+    }
+
+    // Frame k carries each device's k-th dirty register
+    while (frames < L6470_CHAIN_BURST_MAX_FRAMES) {
+        L6470Chain_t *frame = &flush_frames[frames];
+        bool queued = false;
+        l6470_chain_begin(frame);
+        for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+            if (pending[dev] == 0U) {
+                continue;
+            }
+            uint8_t reg = shadow_next_register(pending[dev], 0xFFU);
+            SystemError_t result = l6470_chain_set_param(
+                frame, dev, reg, shadow[dev].value[reg]);
+            if (result != SYSTEM_OK) {
+                return result;
+            }
+            pending[dev] &= ~SHADOW_BIT(reg);
+            registers++;
+            queued = true;
+        }
+        if (!queued) {
+            break;
+        }
+        frames++;
+    }
+
+    if (frames == 0U) {
+        return SYSTEM_OK;
+    }
+
+    SystemError_t result = l6470_chain_transfer_burst(flush_frames, frames);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    // Registers left in pending did not fit and go out with the next flush
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        shadow[dev].dirty = pending[dev];
+    }
+    shadow_stats.bursts++;
+    shadow_stats.registers_flushed += registers;
+    return SYSTEM_OK;
+}
+
+SystemError_t l6470_shadow_verify(void) {
+    L6470Chain_t chain;
+    uint8_t checked[L6470_CHAIN_LENGTH];
+    bool queued = false;
+
+    l6470_chain_begin(&chain);
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        L6470Shadow_t *s = &shadow[dev];
+        uint32_t clean = s->valid & ~s->dirty;
+        if (clean == 0U) {
+            continue;
+        }
+        uint8_t reg = shadow_next_register(clean, s->verify_cursor);
+        SystemError_t result = l6470_chain_get_param(&chain, dev, reg);
+        if (result != SYSTEM_OK) {
+            return result;
+        }
+        s->verify_cursor = reg;
+        checked[dev] = reg;
+        queued = true;
+    }
+
+    if (!queued) {
+        return SYSTEM_OK;
+    }
+
+    SystemError_t result = l6470_chain_transfer(&chain);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    for (uint8_t dev = 0; dev < L6470_CHAIN_LENGTH; dev++) {
+        if (chain.device[dev].length == 0U) {
+            continue;
+        }
+        L6470Shadow_t *s = &shadow[dev];
+        uint8_t reg = checked[dev];
+        uint32_t actual =
+            l6470_chain_reply(&chain, dev) & shadow_register_mask(reg);
+        if ((s->dirty & SHADOW_BIT(reg)) == 0U && actual != s->value[reg]) {
+            // A brown-out or reset loses every register, not just the one
+            // sampled: rewrite all cached values on the next flush
+            s->dirty |= s->valid;
+            shadow_stats.drift_detected++;
+        }
+    }
+    return SYSTEM_OK;
+}
+
+void l6470_shadow_invalidate(uint8_t device) {
+    if (device >= L6470_CHAIN_LENGTH) {
+        return;
+    }
+    memset(&shadow[device], 0, sizeof(shadow[device]));
+}
+
+uint8_t l6470_shadow_dirty_count(uint8_t device) {
+    if (device >= L6470_CHAIN_LENGTH) {
+        return 0;
+    }
+
+    uint8_t count = 0;
+    for (uint32_t dirty = shadow[device].dirty; dirty != 0U;
+         dirty &= dirty - 1U) {
+        count++;
+    }
+    return count;
+}
+
+void l6470_shadow_get_stats(L6470ShadowStats_t *stats) {
+    if (stats == NULL) {
+        return;
+    }
+    *stats = shadow_stats;
+}
+
+/* ==========================================================================
+ */
+/* Private Functions Implementation                                          */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Valid bits of a cached register
+ * @param register_addr Cached register address
+ * @return Register mask from l6470_registers_generated.h
+ */
+static uint32_t shadow_register_mask(uint8_t register_addr) {
+    switch (register_addr) {
+    case L6470_ACC_ADDR:
+        return L6470_ACC_MASK;
+    case L6470_DEC_ADDR:
+        return L6470_DEC_MASK;
+    case L6470_MAX_SPEED_ADDR:
+        return L6470_MAX_SPEED_MASK;
+    case L6470_MIN_SPEED_ADDR:
+        return L6470_MIN_SPEED_MASK;
+    case L6470_KVAL_HOLD_ADDR:
+        return L6470_KVAL_HOLD_MASK;
+    case L6470_KVAL_RUN_ADDR:
+        return L6470_KVAL_RUN_MASK;
+    case L6470_KVAL_ACC_ADDR:
+        return L6470_KVAL_ACC_MASK;
+    case L6470_KVAL_DEC_ADDR:
+        return L6470_KVAL_DEC_MASK;
+    case L6470_INT_SPD_ADDR:
+        return L6470_INT_SPD_MASK;
+    case L6470_FS_SPD_ADDR:
+        return L6470_FS_SPD_MASK;
+    case L6470_OCD_TH_ADDR:
+        return L6470_OCD_TH_MASK;
+    case L6470_STALL_TH_ADDR:
+        return L6470_STALL_TH_MASK;
+    case L6470_STEP_MODE_ADDR:
+        return L6470_STEP_MODE_MASK;
+    case L6470_ALARM_EN_ADDR:
+        return L6470_ALARM_EN_MASK;
+    case L6470_CONFIG_ADDR:
+        return L6470_CONFIG_MASK;
+    default:
+        return 0xFFFFFFFFUL;
+    }
+}
+
+/**
+ * @brief Next register in a bit mask after a given address (wrapping)
+ * @param candidates Non-empty register bit mask
+ * @param after Address to start after (0xFF starts at 0)
+ * @return Register address
+ */
+static uint8_t shadow_next_register(uint32_t candidates, uint8_t after) {
+    uint8_t start = (after < L6470_SHADOW_REG_COUNT) ? (uint8_t)(after + 1U)
+                                                     : 0U;
+    for (uint8_t i = 0; i < L6470_SHADOW_REG_COUNT; i++) {
+        uint8_t reg = (uint8_t)((start + i) % L6470_SHADOW_REG_COUNT);
+        if ((candidates & SHADOW_BIT(reg)) != 0U) {
+            return reg;
+        }
+    }
+    return 0;
+}
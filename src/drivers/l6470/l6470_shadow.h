@@ -0,0 +1,136 @@
+/**
+ * @file l6470_shadow.h
+ * @brief L6470 register shadow cache with dirty tracking
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Keeps a per-device copy of the configuration registers listed in
+ * l6470_registers_generated.h (ACC, DEC, speeds, KVALs, thresholds,
+ * STEP_MODE, ALARM_EN, CONFIG). Reads of a known register are served
+ * from the copy; writes only mark the register dirty. l6470_shadow_flush()
+ * sends every dirty register of every device as one SPI burst, and
+ * l6470_shadow_verify() reads one clean register per device back so that
+ * registers lost to a brown-out are detected and rewritten.
+ *
+ * Position, speed and status registers change on their own and always go
+ * to the device.
+ */
+
+#ifndef L6470_SHADOW_H
+#define L6470_SHADOW_H
+
+#include "common/error_codes.h"
+#include "l6470_chain.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ==========================================================================
+ */
+/* Shadow Configuration                                                      */
+/* ==========================================================================
+ */
+
+#define L6470_SHADOW_REG_COUNT 0x1AU ///< Register addresses 0x00..0x19
+#define L6470_SHADOW_VERIFY_PERIOD_MS 100U ///< One read-back per device
+
+/* ==========================================================================
+ */
+/* Shadow Data Structures                                                    */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Cache efficiency and drift counters
+ */
+typedef struct {
+    uint32_t cache_hits;        ///< Reads served without a transfer
+    uint32_t cache_misses;      ///< Reads that went to the device
+    uint32_t writes_coalesced;  ///< Writes that needed no extra register
+    uint32_t registers_flushed; ///< Registers written by flushes
+    uint32_t bursts;            ///< SPI transfers issued by flushes
+    uint32_t drift_detected;    ///< Read-backs that differed from the cache
+} L6470ShadowStats_t;
+
+/* ==========================================================================
+ */
+/* Public Function Declarations                                              */
+/* ==========================================================================
+ */
+
+/**
+ * @brief Forget all cached values and clear the statistics
+ */
+void l6470_shadow_init(void);
+
+/**
+ * @brief Check whether a register is held in the shadow
+ * @param register_addr L6470 register address
+ * @return true for cached configuration registers
+ */
+bool l6470_shadow_is_cached(uint8_t register_addr);
+
+/**
+ * @brief Record a register write; it reaches the device on the next flush
+ * @param device Device index
+ * @param register_addr Cached register address
+ * @param value Register value (masked to the register width)
+ * @return SYSTEM_OK, ERROR_MOTOR_INVALID_ID or ERROR_MOTOR_PARAMETER_INVALID
+ *         for a register that is not cached
+ */
+SystemError_t l6470_shadow_write(uint8_t device, uint8_t register_addr,
+                                 uint32_t value);
+
+/**
+ * @brief Read a register, from the shadow when its value is known
+ * @param device Device index
+ * @param register_addr L6470 register address
+ * @param value Pointer to store the value
+ * @return System error code
+ * @note A miss costs one chain transfer; uncached registers always miss.
+ */
+SystemError_t l6470_shadow_read(uint8_t device, uint8_t register_addr,
+                                uint32_t *value);
+
+/**
+ * @brief Write every dirty register of every device in one SPI burst
+ * @return SYSTEM_OK (also when nothing is dirty) or the HAL error; on error
+ *         the registers stay dirty
+ */
+SystemError_t l6470_shadow_flush(void);
+
+/**
+ * @brief Read back the next clean cached register of each device
+ * @return System error code
+ * @note A mismatch marks every cached register of that device dirty so the
+ *       next flush restores the whole configuration.
+ */
+SystemError_t l6470_shadow_verify(void);
+
+/**
+ * @brief Forget a device's cached values (after RESET_DEVICE)
+ * @param device Device index
+ */
+void l6470_shadow_invalidate(uint8_t device);
+
+/**
+ * @brief Number of registers waiting for a flush on one device
+ * @param device Device index
+ * @return Dirty register count (0 for an invalid device)
+ */
+uint8_t l6470_shadow_dirty_count(uint8_t device);
+
+/**
+ * @brief Copy the cache statistics
+ * @param stats Destination
+ */
+void l6470_shadow_get_stats(L6470ShadowStats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* L6470_SHADOW_H */
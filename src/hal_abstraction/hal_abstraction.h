@@ -66,6 +66,7 @@ typedef struct {
     uint8_t *rx_data;       ///< Receive data buffer
     uint16_t data_size;     ///< Data size in bytes
     uint32_t timeout_ms;    ///< Transaction timeout
+    uint16_t cs_frame_size; ///< Bytes per chip-select pulse (0 = whole)
 } HAL_SPI_Transaction_t;
 #endif
 #endif
@@ -169,6 +170,57 @@ typedef enum {
 } HAL_GPIO_Port_t;
 #endif
 
+/**
+ * @brief Progress of an asynchronous bus request
+ */
+typedef enum {
+    HAL_ASYNC_IDLE = 0,  ///< Never submitted
+    HAL_ASYNC_QUEUED,    ///< Waiting behind other requests on its bus
+    HAL_ASYNC_ACTIVE,    ///< DMA transfer in progress
+    HAL_ASYNC_DONE,      ///< Finished; result holds the outcome
+    HAL_ASYNC_CANCELLED  ///< Removed from the queue before it started
+} HAL_Async_State_t;
+
+/**
+ * @brief Bus operation carried by an asynchronous request
+ */
+typedef enum {
+    HAL_ASYNC_SPI_TRANSFER = 0, ///< Full-duplex SPI transfer
+    HAL_ASYNC_I2C_MEM_READ,     ///< I2C (memory) read
+    HAL_ASYNC_I2C_MEM_WRITE     ///< I2C (memory) write
+} HAL_Async_Op_t;
+
+typedef struct HAL_Async_Request HAL_Async_Request_t;
+
+/**
+ * @brief Completion callback, called from the DMA interrupt on target
+ */
+typedef void (*HAL_Async_Callback_t)(HAL_Async_Request_t *request);
+
+/**
+ * @brief Caller-owned asynchronous bus request
+ * @note The request and its data buffers must stay valid until the state
+ *       leaves QUEUED/ACTIVE. Transaction timeouts are ignored.
+ */
+struct HAL_Async_Request {
+    union {
+        HAL_SPI_Transaction_t spi; ///< SPI transfer description
+        HAL_I2C_Transaction_t i2c; ///< I2C transfer description
+    } xfer;
+    HAL_Async_Callback_t on_complete; ///< Optional completion callback
+    void *context;                    ///< Caller data for the callback
+
+    // Filled in by the HAL
+    volatile HAL_Async_State_t state; ///< Current progress
+    volatile SystemError_t result;    ///< Outcome once DONE
+    HAL_Async_Op_t op;                ///< Operation set by the submit call
+    uint8_t bus;                      ///< Internal queue index
+    uint16_t progress;                ///< Bytes transferred so far
+    uint32_t submit_us;               ///< Submit timestamp
+    uint32_t complete_us;             ///< Completion timestamp
+    HAL_Async_Request_t *next;        ///< Queue link
+};
+
 /* ==========================================================================
  */
 /* HAL Abstraction Function Declarations */
@@ -187,9 +239,26 @@ uint32_t HAL_Abstraction_GetTick(void);
  */
 void HAL_Abstraction_Delay(uint32_t delay_ms);
 
+/**
+ * @brief Blocking delay in microseconds
+ * @param delay_us Delay time in microseconds
+ * @note Host simulation routes this through the virtual-time kernel, so
+ *       callers must wait with this function rather than poll a timer.
+ */
+void HAL_Abstraction_DelayMicroseconds(uint32_t delay_us);
+
+/**
+ * @brief Start the cycle counter behind the microsecond delay
+ * @note Call once after the system clock is configured and before any
+ *       driver runs; on target the delay spins on DWT->CYCCNT.
+ */
+void HAL_Abstraction_InitCycleCounter(void);
+
 /**
  * @brief Get high-precision microsecond timestamp
- * @return uint32_t Microsecond timestamp
+ * @return uint32_t Microsecond timestamp, 1 us resolution (wraps at 2^32)
+ * @note On target the HAL tick supplies milliseconds and the TIM6
+ *       timebase counter the microseconds within them. Safe from ISRs.
  */
 uint32_t HAL_Abstraction_GetMicroseconds(void);
 
@@ -262,6 +331,62 @@ SystemError_t HAL_Abstraction_GPIO_EnableInterrupt(HAL_GPIO_Port_t port,
                                                    uint32_t trigger_type,
                                                    uint32_t priority);
 
+/**
+ * @brief Continue a CRC-16/MODBUS on the hardware CRC unit
+ * @param crc Running CRC (reflected, as kept by crc16.h)
+ * @param data Data bytes
+ * @param length Number of bytes
+ * @param result Updated running CRC
+ * @return SystemError_t Success or error code
+ * @note Single shared unit: call from task context only.
+ */
+SystemError_t HAL_Abstraction_CRC16_Update(uint16_t crc, const uint8_t *data,
+                                           uint32_t length, uint16_t *result);
+
+/**
+ * @brief Queue a non-blocking SPI transfer on a bus
+ * @param instance SPI instance identifier
+ * @param request Request with xfer.spi filled in
+ * @return SYSTEM_OK once queued; ERROR_OPERATION_IN_PROGRESS if the request
+ *         is already queued or active
+ * @note Requests on one bus run in submit order; each bus has its own
+ *       queue, so SPI and I2C transfers overlap with each other and with
+ *       the caller's computation. A blocking SPI transfer on the same
+ *       bus waits for the one on the wire and holds later requests back
+ *       until it is done.
+ */
+SystemError_t HAL_Abstraction_SPI_Submit(HAL_SPI_Instance_t instance,
+                                         HAL_Async_Request_t *request);
+
+/**
+ * @brief Queue a non-blocking I2C read (memory read if
+ *        use_register_address is set)
+ * @param instance I2C instance identifier
+ * @param request Request with xfer.i2c filled in
+ * @return SystemError_t Success or error code
+ */
+SystemError_t HAL_Abstraction_I2C_SubmitRead(HAL_I2C_Instance_t instance,
+                                             HAL_Async_Request_t *request);
+
+/**
+ * @brief Queue a non-blocking I2C write (memory write if
+ *        use_register_address is set)
+ * @param instance I2C instance identifier
+ * @param request Request with xfer.i2c filled in
+ * @return SystemError_t Success or error code
+ */
+SystemError_t HAL_Abstraction_I2C_SubmitWrite(HAL_I2C_Instance_t instance,
+                                              HAL_Async_Request_t *request);
+
+/**
+ * @brief Remove a queued request before it reaches the bus
+ * @param request Previously submitted request
+ * @return SYSTEM_OK (state becomes CANCELLED, no callback),
+ *         ERROR_OPERATION_IN_PROGRESS if the DMA transfer already started,
+ *         ERROR_INVALID_STATE if the request is not queued
+ */
+SystemError_t HAL_Abstraction_Async_Cancel(HAL_Async_Request_t *request);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,7 +11,12 @@
 #include "hal_abstraction.h"
 #include "stm32h7xx_hal.h"
 // Include SSOT hardware config for hardware constant definitions
+#include "config/comm_config.h"
 #include "config/hardware_config.h"
+#include "communication/comm_protocol.h"
+#include "drivers/as5600/as5600_driver.h"
+#include "drivers/l6470/l6470_driver.h"
+#include <string.h>
 
 /* ==========================================================================
  */
@@ -27,11 +32,447 @@ void HAL_Abstraction_Delay(uint32_t delay_ms) {
     HAL_Delay(delay_ms);
 }
 
+void HAL_Abstraction_InitCycleCounter(void) {
+    // The counter stays frozen until trace is enabled in the debug core
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+void HAL_Abstraction_DelayMicroseconds(uint32_t delay_us) {
+    // Spin on the DWT cycle counter (HAL_Abstraction_InitCycleCounter)
+    uint32_t start = DWT->CYCCNT;
+    uint32_t cycles = delay_us * (SystemCoreClock / 1000000U);
+    while ((DWT->CYCCNT - start) < cycles) {
+        __NOP();
+    }
+}
+
 uint32_t HAL_Abstraction_GetMicroseconds(void) {
-    // Use DWT counter for microsecond precision
-    // This is a simplified implementation - in production, you might want
-    // a more sophisticated high-resolution timer
-    return HAL_GetTick() * 1000;
+    // The HAL tick counts TIM6 updates (1 MHz counter, 1000-count period),
+    // so the counter holds the microseconds within the current tick
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t ms = HAL_GetTick();
+    uint32_t us = TIM6->CNT;
+    if ((TIM6->SR & TIM_SR_UIF) != 0U) {
+        // Rolled over but the tick interrupt has not run yet
+        us = TIM6->CNT;
+        ms++;
+    }
+    __set_PRIMASK(primask);
+
+    return ms * 1000U + us;
+}
+
+/* ==========================================================================
+ */
+/* SPI Functions */
+/* ==========================================================================
+ */
+
+extern SPI_HandleTypeDef hspi2; // L6470 daisy chain (MOTOR_SPI_INSTANCE)
+
+static bool async_bus_claim(uint8_t bus, uint32_t timeout_ms);
+static void async_bus_release(uint8_t bus);
+
+SystemError_t
+HAL_Abstraction_SPI_TransmitReceive(HAL_SPI_Instance_t instance,
+                                    const HAL_SPI_Transaction_t *transaction) {
+    if (transaction == NULL || transaction->tx_data == NULL ||
+        transaction->rx_data == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    if (instance != HAL_SPI_INSTANCE_2) {
+        return ERROR_NOT_SUPPORTED;
+    }
+
+    // Wait out a DMA transfer on the wire; queued requests start after us
+    if (!async_bus_claim((uint8_t)instance, transaction->timeout_ms)) {
+        return ERROR_TIMEOUT;
+    }
+
+    // The L6470 latches a byte on the CS rising edge, so a daisy-chain
+    // frame pulses CS after every cs_frame_size bytes
+    uint16_t frame = transaction->cs_frame_size;
+    if (frame == 0U) {
+        frame = transaction->data_size;
+    }
+
+    SystemError_t result = SYSTEM_OK;
+    for (uint16_t offset = 0;
+         offset < transaction->data_size && result == SYSTEM_OK;
+         offset += frame) {
+        uint16_t size = transaction->data_size - offset;
+        if (size > frame) {
+            size = frame;
+        }
+
+        HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_RESET);
+        HAL_StatusTypeDef status = HAL_SPI_TransmitReceive(
+            &hspi2, (uint8_t *)&transaction->tx_data[offset],
+            &transaction->rx_data[offset], size, transaction->timeout_ms);
+        HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_SET);
+        HAL_Abstraction_DelayMicroseconds(SPI_CS_HOLD_TIME_US);
+
+        if (status == HAL_TIMEOUT) {
+            result = ERROR_TIMEOUT;
+        } else if (status != HAL_OK) {
+            result = ERROR_MOTOR_SPI_FAILED;
+        }
+    }
+
+    async_bus_release((uint8_t)instance);
+    return result;
+}
+
+/* ==========================================================================
+ */
+/* Asynchronous Bus Queues */
+/* ==========================================================================
+ */
+
+// Queue index: SPI instances first, then I2C instances
+#define ASYNC_I2C_BASE ((uint8_t)HAL_SPI_INSTANCE_MAX)
+#define ASYNC_BUS_COUNT (HAL_SPI_INSTANCE_MAX + HAL_I2C_INSTANCE_MAX)
+
+extern I2C_HandleTypeDef hi2c1; // AS5600 encoder 0
+extern I2C_HandleTypeDef hi2c2; // AS5600 encoder 1
+
+/**
+ * @brief Per-bus FIFO; the head is the transfer on the wire once ACTIVE
+ */
+typedef struct {
+    HAL_Async_Request_t *head;
+    HAL_Async_Request_t *tail;
+} AsyncQueue_t;
+
+static AsyncQueue_t async_queues[ASYNC_BUS_COUNT];
+
+// Set while a blocking transfer owns the bus; queued requests wait
+static volatile bool async_bus_held[ASYNC_BUS_COUNT];
+
+static SPI_HandleTypeDef *async_spi_handle(uint8_t bus) {
+    return (bus == (uint8_t)HAL_SPI_INSTANCE_2) ? &hspi2 : NULL;
+}
+
+static I2C_HandleTypeDef *async_i2c_handle(uint8_t bus) {
+    if (bus == ASYNC_I2C_BASE + (uint8_t)HAL_I2C_INSTANCE_1) {
+        return &hi2c1;
+    }
+    if (bus == ASYNC_I2C_BASE + (uint8_t)HAL_I2C_INSTANCE_2) {
+        return &hi2c2;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Bytes the next SPI DMA chunk covers (one chip-select frame)
+ */
+static uint16_t async_spi_chunk(const HAL_Async_Request_t *request) {
+    uint16_t left = request->xfer.spi.data_size - request->progress;
+    uint16_t frame = request->xfer.spi.cs_frame_size;
+    return (frame != 0U && frame < left) ? frame : left;
+}
+
+/**
+ * @brief Hand the request at the head of a queue to the DMA
+ * @note Buffers must live in DMA-reachable, non-cacheable RAM.
+ */
+static HAL_StatusTypeDef async_kick(uint8_t bus, HAL_Async_Request_t *request) {
+    if (request->op == HAL_ASYNC_SPI_TRANSFER) {
+        const HAL_SPI_Transaction_t *spi = &request->xfer.spi;
+        HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_RESET);
+        return HAL_SPI_TransmitReceive_DMA(
+            async_spi_handle(bus), (uint8_t *)&spi->tx_data[request->progress],
+            &spi->rx_data[request->progress], async_spi_chunk(request));
+    }
+
+    const HAL_I2C_Transaction_t *i2c = &request->xfer.i2c;
+    I2C_HandleTypeDef *hi2c = async_i2c_handle(bus);
+    if (request->op == HAL_ASYNC_I2C_MEM_READ) {
+        return i2c->use_register_address
+                   ? HAL_I2C_Mem_Read_DMA(hi2c, i2c->device_address,
+                                          i2c->register_address,
+                                          I2C_MEMADD_SIZE_8BIT, i2c->data,
+                                          i2c->data_size)
+                   : HAL_I2C_Master_Receive_DMA(hi2c, i2c->device_address,
+                                                i2c->data, i2c->data_size);
+    }
+    return i2c->use_register_address
+               ? HAL_I2C_Mem_Write_DMA(hi2c, i2c->device_address,
+                                       i2c->register_address,
+                                       I2C_MEMADD_SIZE_8BIT, i2c->data,
+                                       i2c->data_size)
+               : HAL_I2C_Master_Transmit_DMA(hi2c, i2c->device_address,
+                                             i2c->data, i2c->data_size);
+}
+
+/**
+ * @brief Retire the head request and report it
+ * @return The request that finished (NULL if the queue was empty)
+ */
+static HAL_Async_Request_t *async_retire(uint8_t bus, SystemError_t result) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    HAL_Async_Request_t *request = async_queues[bus].head;
+    if (request != NULL) {
+        async_queues[bus].head = request->next;
+        if (async_queues[bus].head == NULL) {
+            async_queues[bus].tail = NULL;
+        }
+        request->next = NULL;
+        request->result = result;
+        request->complete_us = HAL_Abstraction_GetMicroseconds();
+        request->state = HAL_ASYNC_DONE;
+    }
+    __set_PRIMASK(primask);
+
+    if (request != NULL && request->on_complete != NULL) {
+        request->on_complete(request);
+    }
+    return request;
+}
+
+/**
+ * @brief Start queued requests until one is on the wire or none are left
+ */
+static void async_start_next(uint8_t bus) {
+    for (;;) {
+        HAL_Async_Request_t *request = async_queues[bus].head;
+        if (request == NULL || request->state == HAL_ASYNC_ACTIVE ||
+            async_bus_held[bus]) {
+            return;
+        }
+        request->state = HAL_ASYNC_ACTIVE;
+        if (async_kick(bus, request) == HAL_OK) {
+            return;
+        }
+        if (request->op == HAL_ASYNC_SPI_TRANSFER) {
+            HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN,
+                              GPIO_PIN_SET);
+        }
+        async_retire(bus, request->op == HAL_ASYNC_SPI_TRANSFER
+                              ? ERROR_SPI_TRANSMISSION_FAILED
+                              : ERROR_I2C_BUS_ERROR);
+    }
+}
+
+/**
+ * @brief Take a bus for a blocking transfer once no DMA transfer is on it
+ * @return false if the bus stayed busy for timeout_ms
+ * @note Call from task context: the wait relies on the DMA interrupt.
+ */
+static bool async_bus_claim(uint8_t bus, uint32_t timeout_ms) {
+    uint32_t start = HAL_GetTick();
+    for (;;) {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+        HAL_Async_Request_t *head = async_queues[bus].head;
+        bool free = !async_bus_held[bus] &&
+                    (head == NULL || head->state != HAL_ASYNC_ACTIVE);
+        if (free) {
+            async_bus_held[bus] = true;
+        }
+        __set_PRIMASK(primask);
+
+        if (free) {
+            return true;
+        }
+        if ((HAL_GetTick() - start) > timeout_ms) {
+            return false;
+        }
+    }
+}
+
+/**
+ * @brief Hand a bus back and start whatever queued up meanwhile
+ */
+static void async_bus_release(uint8_t bus) {
+    async_bus_held[bus] = false;
+    async_start_next(bus);
+}
+
+static SystemError_t async_submit(uint8_t bus, HAL_Async_Op_t op,
+                                  HAL_Async_Request_t *request) {
+    if (request == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+    bool supported = (op == HAL_ASYNC_SPI_TRANSFER)
+                         ? async_spi_handle(bus) != NULL
+                         : async_i2c_handle(bus) != NULL;
+    if (!supported) {
+        return ERROR_NOT_SUPPORTED;
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    if (request->state == HAL_ASYNC_QUEUED ||
+        request->state == HAL_ASYNC_ACTIVE) {
+        __set_PRIMASK(primask);
+        return ERROR_OPERATION_IN_PROGRESS;
+    }
+    request->op = op;
+    request->bus = bus;
+    request->progress = 0;
+    request->result = SYSTEM_OK;
+    request->submit_us = HAL_Abstraction_GetMicroseconds();
+    request->complete_us = 0;
+    request->next = NULL;
+    request->state = HAL_ASYNC_QUEUED;
+
+    bool idle = (async_queues[bus].head == NULL);
+    if (idle) {
+        async_queues[bus].head = request;
+    } else {
+        async_queues[bus].tail->next = request;
+    }
+    async_queues[bus].tail = request;
+    __set_PRIMASK(primask);
+
+    // Only the submitter that found the bus idle starts it; later
+    // requests are started from the completion interrupt
+    if (idle) {
+        async_start_next(bus);
+    }
+    return SYSTEM_OK;
+}
+
+SystemError_t HAL_Abstraction_SPI_Submit(HAL_SPI_Instance_t instance,
+                                         HAL_Async_Request_t *request) {
+    if (instance >= HAL_SPI_INSTANCE_MAX) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    if (request != NULL && (request->xfer.spi.tx_data == NULL ||
+                            request->xfer.spi.rx_data == NULL)) {
+        return ERROR_NULL_POINTER;
+    }
+    return async_submit((uint8_t)instance, HAL_ASYNC_SPI_TRANSFER, request);
+}
+
+SystemError_t HAL_Abstraction_I2C_SubmitRead(HAL_I2C_Instance_t instance,
+                                             HAL_Async_Request_t *request) {
+    if (instance >= HAL_I2C_INSTANCE_MAX) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    return async_submit(ASYNC_I2C_BASE + (uint8_t)instance,
+                        HAL_ASYNC_I2C_MEM_READ, request);
+}
+
+SystemError_t HAL_Abstraction_I2C_SubmitWrite(HAL_I2C_Instance_t instance,
+                                              HAL_Async_Request_t *request) {
+    if (instance >= HAL_I2C_INSTANCE_MAX) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    return async_submit(ASYNC_I2C_BASE + (uint8_t)instance,
+                        HAL_ASYNC_I2C_MEM_WRITE, request);
+}
+
+SystemError_t HAL_Abstraction_Async_Cancel(HAL_Async_Request_t *request) {
+    if (request == NULL) {
+        return ERROR_NULL_POINTER;
+    }
+
+    SystemError_t result = ERROR_INVALID_STATE;
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    AsyncQueue_t *queue = &async_queues[request->bus];
+    if (request->state == HAL_ASYNC_ACTIVE ||
+        (request->state == HAL_ASYNC_QUEUED && queue->head == request)) {
+        // The head is on the wire or about to be started
+        result = ERROR_OPERATION_IN_PROGRESS;
+    } else if (request->state == HAL_ASYNC_QUEUED) {
+        HAL_Async_Request_t *prev = queue->head;
+        while (prev != NULL && prev->next != request) {
+            prev = prev->next;
+        }
+        if (prev != NULL) {
+            prev->next = request->next;
+            if (queue->tail == request) {
+                queue->tail = prev;
+            }
+            request->next = NULL;
+            request->state = HAL_ASYNC_CANCELLED;
+            result = SYSTEM_OK;
+        }
+    }
+    __set_PRIMASK(primask);
+    return result;
+}
+
+/* STM32 HAL DMA completion callbacks */
+
+void HAL_SPI_TxRxCpltCallback(SPI_HandleTypeDef *hspi) {
+    uint8_t bus = (uint8_t)HAL_SPI_INSTANCE_2;
+    HAL_Async_Request_t *request = async_queues[bus].head;
+    if (hspi != &hspi2 || request == NULL) {
+        return;
+    }
+
+    // Raise CS between chip-select frames (L6470 latches on the edge)
+    HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_SET);
+    request->progress += async_spi_chunk(request);
+    if (request->progress < request->xfer.spi.data_size) {
+        HAL_Abstraction_DelayMicroseconds(SPI_CS_HOLD_TIME_US);
+        if (async_kick(bus, request) == HAL_OK) {
+            return;
+        }
+        HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_SET);
+        async_retire(bus, ERROR_SPI_TRANSMISSION_FAILED);
+    } else {
+        async_retire(bus, SYSTEM_OK);
+    }
+    async_start_next(bus);
+}
+
+void HAL_SPI_ErrorCallback(SPI_HandleTypeDef *hspi) {
+    if (hspi != &hspi2) {
+        return;
+    }
+    HAL_GPIO_WritePin(MOTOR_SPI_CS_PORT, MOTOR_SPI_CS_PIN, GPIO_PIN_SET);
+    async_retire((uint8_t)HAL_SPI_INSTANCE_2, ERROR_SPI_TRANSMISSION_FAILED);
+    async_start_next((uint8_t)HAL_SPI_INSTANCE_2);
+}
+
+static void async_i2c_done(I2C_HandleTypeDef *hi2c, SystemError_t result) {
+    for (uint8_t i = 0; i < HAL_I2C_INSTANCE_MAX; i++) {
+        uint8_t bus = ASYNC_I2C_BASE + i;
+        if (async_i2c_handle(bus) == hi2c) {
+            async_retire(bus, result);
+            async_start_next(bus);
+            return;
+        }
+    }
+}
+
+void HAL_I2C_MemRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    async_i2c_done(hi2c, SYSTEM_OK);
+}
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    async_i2c_done(hi2c, SYSTEM_OK);
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    async_i2c_done(hi2c, SYSTEM_OK);
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c) {
+    async_i2c_done(hi2c, SYSTEM_OK);
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c) {
+    async_i2c_done(hi2c, (hi2c->ErrorCode & HAL_I2C_ERROR_AF) != 0U
+                             ? ERROR_I2C_NACK_RECEIVED
+                             : ERROR_I2C_BUS_ERROR);
+}
+
+/* STM32 HAL UART reception callback */
+
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size) {
+    // Idle line, half and full transfer of the circular command DMA;
+    // Size is the DMA write index in the ring
+    comm_uart_rx_event_callback(huart, Size);
 }
 
 /* ==========================================================================
@@ -103,3 +544,85 @@ SystemError_t HAL_Abstraction_GPIO_Read(HAL_GPIO_Port_t port, uint32_t pin,
     }
     return SYSTEM_OK;
 }
+
+/* ==========================================================================
+ */
+/* CRC Functions */
+/* ==========================================================================
+ */
+
+SystemError_t HAL_Abstraction_CRC16_Update(uint16_t crc, const uint8_t *data,
+                                           uint32_t length, uint16_t *result) {
+    static bool crc_clock_enabled = false;
+
+    if (data == NULL || result == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+    if (!crc_clock_enabled) {
+        __HAL_RCC_CRC_CLK_ENABLE();
+        crc_clock_enabled = true;
+    }
+
+    // The unit works on the unreflected polynomial and state; input bytes
+    // and the output are bit-reversed to give the reflected CRC16
+    CRC->POL = __RBIT(CRC16_POLYNOMIAL) >> 16;
+    CRC->INIT = __RBIT(crc) >> 16;
+    CRC->CR = CRC_CR_POLYSIZE_0 | CRC_CR_REV_IN_0 | CRC_CR_REV_OUT |
+              CRC_CR_RESET;
+
+    // Word writes are processed MSB first: byte-swap so data[0] goes first
+    while (length >= 4U) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+        CRC->DR = __REV(word);
+        data += 4;
+        length -= 4U;
+    }
+    while (length-- > 0U) {
+        *(__IO uint8_t *)&CRC->DR = *data++;
+    }
+
+    *result = (uint16_t)CRC->DR;
+    return SYSTEM_OK;
+}
+
+/* ==========================================================================
+ */
+/* L6470 Functions */
+/* ==========================================================================
+ */
+
+SystemError_t HAL_Abstraction_L6470_GetParameter(uint8_t motor_id,
+                                                 uint8_t param,
+                                                 uint32_t *value) {
+    if (value == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    // Configuration registers are served from the driver's shadow cache
+    return l6470_get_parameter(motor_id, param, value);
+}
+
+/* ==========================================================================
+ */
+/* AS5600 Functions */
+/* ==========================================================================
+ */
+
+SystemError_t HAL_Abstraction_AS5600_ReadAngle(uint8_t motor_id,
+                                               float *angle_deg) {
+    if (angle_deg == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    // Status and angle in one I2C transaction; no magnet fails the read
+    AS5600_Sample_t sample;
+    SystemError_t result =
+        as5600_read_burst(motor_id, AS5600_BURST_ANGLES, &sample);
+    if (result != SYSTEM_OK) {
+        return result;
+    }
+
+    *angle_deg = (float)sample.angle * 360.0f / 4096.0f;
+    return SYSTEM_OK;
+}
@@ -150,16 +150,14 @@ void l6470_fault_monitor_flag_interrupt(void) {
         HAL_GPIO_ReadPin(MOTOR_FLAG_PORT, MOTOR_FLAG_PIN);
 
     if (flag_state == GPIO_PIN_RESET) {
-        // Fault detected - read L6470 status to determine fault type
-        uint16_t status_register = 0;
-
-        // Read status from both motors (assuming dual motor setup)
-        for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
-            SystemError_t result =
-                l6470_get_status(motor_id, &status_register);
-            if (result == SYSTEM_OK) {
+        // Fault detected - read L6470 status to determine fault type.
+        // One daisy-chain transfer returns STATUS for every motor.
+        uint16_t status_registers[L6470_MAX_DEVICES] = {0};
+
+        if (l6470_get_status_all(status_registers) == SYSTEM_OK) {
+            for (uint8_t motor_id = 0; motor_id < MAX_MOTORS; motor_id++) {
                 L6470HwFaultType_t fault_type =
-                    decode_l6470_status(status_register);
+                    decode_l6470_status(status_registers[motor_id]);
                 if (fault_type != L6470_HW_FAULT_NONE) {
                     process_l6470_fault(fault_type);
                 }
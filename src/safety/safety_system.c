@@ -69,6 +69,7 @@ typedef struct {
 #include "common/data_types.h"
 #include "common/error_codes.h"
 #include "common/system_state.h"
+#include "communication/comm_protocol.h"
 #include "config/hardware_config.h"
 #include "config/motor_config.h"
 #include "config/safety_config.h"
@@ -881,6 +882,9 @@ static void broadcast_emergency_stop(void) {
         safety_statistics.emergency_stops++;
     }
 
+    // Drop a motion batch staged by the host before it can start
+    comm_cancel_pending_batch();
+
     // Notify communication systems to report emergency stop status
     // This would be expanded in a full implementation to notify:
     // - CAN bus systems
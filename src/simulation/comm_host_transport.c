@@ -0,0 +1,523 @@
+/**
+ * @file comm_host_transport.c
+ * @brief Host UART/FDCAN backend for comm_protocol.c over socketpairs
+ * @details The HAL calls only record what the peripheral would do; every
+ * callback into comm_protocol.c is made from comm_host_transport_poll().
+ * The UART socket is read without blocking and written with blocking
+ * sends, as the UART shifts out every byte it is given.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "comm_host_transport.h"
+#include "communication/comm_can_rx.h"
+#include "communication/comm_protocol.h"
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+/* Private Types */
+typedef struct {
+  bool open;
+  int uart_fd;
+  int can_fd;
+  int peer_uart_fd;
+  int peer_can_fd;
+
+  /* UART and its circular RX DMA */
+  UART_HandleTypeDef *huart;
+  DMA_Stream_TypeDef rx_stream;
+  DMA_HandleTypeDef rx_dma;
+  uint8_t *rx_buffer;
+  uint16_t rx_size;
+  uint16_t rx_position; /**< Next byte the DMA writes */
+  bool rx_active;
+  const uint8_t *tx_data; /**< Transfer in flight */
+  uint16_t tx_length;
+  bool tx_busy;
+
+  /* FDCAN */
+  FDCAN_HandleTypeDef *hfdcan;
+  bool can_started;
+  FDCAN_FilterTypeDef filters[COMM_HOST_CAN_FILTERS];
+  bool filter_valid[COMM_HOST_CAN_FILTERS];
+  uint32_t active_its;
+  uint32_t tx_complete_enabled; /**< Buffers armed for TX complete */
+  uint32_t tx_transmitted;      /**< Buffers sent since the last poll */
+  uint32_t tx_next_buffer;
+  uint32_t tx_latest;
+  CommCanFrame_t rx_fifo[COMM_HOST_CAN_RX_FIFO_DEPTH];
+  uint8_t rx_fifo_filter[COMM_HOST_CAN_RX_FIFO_DEPTH];
+  uint32_t rx_fifo_head;
+  uint32_t rx_fifo_tail;
+
+  comm_host_transport_stats_t stats;
+} host_transport_t;
+
+/* Private Variables */
+static host_transport_t transport = {.uart_fd = -1,
+                                     .can_fd = -1,
+                                     .peer_uart_fd = -1,
+                                     .peer_can_fd = -1};
+
+/* Private Functions */
+static uint32_t deliver_completions(void);
+static void write_uart(const uint8_t *data, uint16_t length);
+static void wait_for_input(uint32_t timeout_ms);
+static uint32_t receive_uart(void);
+static uint32_t receive_can(void);
+static int32_t match_filter(uint32_t id);
+static uint32_t length_to_dlc(uint8_t length);
+static void close_fd(int *fd);
+
+/**
+ * @brief Create the sockets and bind them to the peripheral handles
+ */
+simulation_error_t comm_host_transport_open(UART_HandleTypeDef *huart,
+                                            FDCAN_HandleTypeDef *hfdcan,
+                                            comm_host_transport_peer_t *peer) {
+  int uart_pair[2];
+  int can_pair[2];
+
+  if (transport.open || huart == NULL || hfdcan == NULL || peer == NULL) {
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+
+  if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, uart_pair) != 0) {
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+  if (socketpair(AF_UNIX, SOCK_SEQPACKET | SOCK_CLOEXEC, 0, can_pair) != 0) {
+    close(uart_pair[0]);
+    close(uart_pair[1]);
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+
+  memset(&transport, 0, sizeof(transport));
+  transport.open = true;
+  transport.uart_fd = uart_pair[0];
+  transport.peer_uart_fd = uart_pair[1];
+  transport.can_fd = can_pair[0];
+  transport.peer_can_fd = can_pair[1];
+
+  transport.huart = huart;
+  transport.rx_dma.Instance = &transport.rx_stream;
+  huart->hdmarx = &transport.rx_dma;
+  transport.hfdcan = hfdcan;
+
+  peer->uart_fd = uart_pair[1];
+  peer->can_fd = can_pair[1];
+  return SIM_OK;
+}
+
+/**
+ * @brief Close both ends of the sockets and unbind the handles
+ */
+void comm_host_transport_close(void) {
+  if (!transport.open) {
+    return;
+  }
+
+  close_fd(&transport.uart_fd);
+  close_fd(&transport.can_fd);
+  close_fd(&transport.peer_uart_fd);
+  close_fd(&transport.peer_can_fd);
+  transport.huart->hdmarx = NULL;
+  memset(&transport, 0, sizeof(transport));
+  transport.uart_fd = -1;
+  transport.can_fd = -1;
+  transport.peer_uart_fd = -1;
+  transport.peer_can_fd = -1;
+}
+
+/**
+ * @brief Deliver pending peripheral events to comm_protocol.c
+ */
+uint32_t comm_host_transport_poll(uint32_t timeout_ms) {
+  if (!transport.open) {
+    return 0;
+  }
+
+  uint32_t events = deliver_completions();
+  if (events == 0 && timeout_ms > 0) {
+    wait_for_input(timeout_ms);
+  }
+
+  events += receive_uart();
+  events += receive_can();
+  return events;
+}
+
+/**
+ * @brief Get transport statistics
+ */
+void comm_host_transport_get_stats(comm_host_transport_stats_t *stats) {
+  if (stats != NULL) {
+    *stats = transport.stats;
+  }
+}
+
+/* HAL DMA */
+
+HAL_StatusTypeDef HAL_DMA_Init(DMA_HandleTypeDef *hdma) {
+  return (transport.open && hdma == &transport.rx_dma) ? HAL_OK : HAL_ERROR;
+}
+
+/* HAL UART */
+
+HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart) {
+  return (transport.open && huart == transport.huart) ? HAL_OK : HAL_ERROR;
+}
+
+HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart,
+                                               uint8_t *pData, uint16_t Size) {
+  if (!transport.open || huart != transport.huart || pData == NULL ||
+      Size < 2) {
+    return HAL_ERROR;
+  }
+  /* The ring model below only holds for a circular stream */
+  if (transport.rx_dma.Init.Mode != DMA_CIRCULAR) {
+    return HAL_ERROR;
+  }
+
+  /* (Re)starting the DMA writes from index 0 again */
+  transport.rx_buffer = pData;
+  transport.rx_size = Size;
+  transport.rx_position = 0;
+  transport.rx_stream.NDTR = Size;
+  transport.rx_active = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart,
+                                        const uint8_t *pData, uint16_t Size) {
+  if (!transport.open || huart != transport.huart || pData == NULL) {
+    return HAL_ERROR;
+  }
+  if (transport.tx_busy) {
+    return HAL_BUSY;
+  }
+
+  /* The DMA reads the buffer until the transfer completes */
+  transport.tx_data = pData;
+  transport.tx_length = Size;
+  transport.tx_busy = true;
+  return HAL_OK;
+}
+
+/* HAL FDCAN */
+
+HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan,
+                                         FDCAN_FilterTypeDef *sFilterConfig) {
+  if (!transport.open || hfdcan != transport.hfdcan ||
+      transport.can_started || sFilterConfig == NULL ||
+      sFilterConfig->FilterIndex >= COMM_HOST_CAN_FILTERS) {
+    return HAL_ERROR;
+  }
+
+  /* Only what comm_protocol.c configures is modelled */
+  if (sFilterConfig->IdType != FDCAN_STANDARD_ID ||
+      sFilterConfig->FilterType != FDCAN_FILTER_RANGE ||
+      sFilterConfig->FilterConfig != FDCAN_FILTER_TO_RXFIFO0) {
+    return HAL_ERROR;
+  }
+
+  transport.filters[sFilterConfig->FilterIndex] = *sFilterConfig;
+  transport.filter_valid[sFilterConfig->FilterIndex] = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_ConfigGlobalFilter(FDCAN_HandleTypeDef *hfdcan,
+                                               uint32_t NonMatchingStd,
+                                               uint32_t NonMatchingExt,
+                                               uint32_t RejectRemoteStd,
+                                               uint32_t RejectRemoteExt) {
+  (void)NonMatchingExt;
+  (void)RejectRemoteStd;
+  (void)RejectRemoteExt;
+
+  if (!transport.open || hfdcan != transport.hfdcan ||
+      transport.can_started || NonMatchingStd != FDCAN_REJECT) {
+    return HAL_ERROR;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_Start(FDCAN_HandleTypeDef *hfdcan) {
+  if (!transport.open || hfdcan != transport.hfdcan) {
+    return HAL_ERROR;
+  }
+
+  transport.can_started = true;
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_ActivateNotification(FDCAN_HandleTypeDef *hfdcan,
+                                                 uint32_t ActiveITs,
+                                                 uint32_t BufferIndexes) {
+  if (!transport.open || hfdcan != transport.hfdcan) {
+    return HAL_ERROR;
+  }
+
+  transport.active_its |= ActiveITs;
+  if ((ActiveITs & FDCAN_IT_TX_COMPLETE) != 0U) {
+    transport.tx_complete_enabled |= BufferIndexes;
+  }
+  return HAL_OK;
+}
+
+HAL_StatusTypeDef
+HAL_FDCAN_AddMessageToTxFifoQ(FDCAN_HandleTypeDef *hfdcan,
+                              FDCAN_TxHeaderTypeDef *pTxHeader,
+                              uint8_t *pTxData) {
+  if (!transport.open || hfdcan != transport.hfdcan ||
+      !transport.can_started || pTxHeader == NULL || pTxData == NULL) {
+    return HAL_ERROR;
+  }
+
+  CommCanFrame_t frame = {0};
+  frame.id = pTxHeader->Identifier;
+  frame.length = comm_can_dlc_to_length((uint8_t)pTxHeader->DataLength);
+  memcpy(frame.data, pTxData, frame.length);
+
+  /* A socket that cannot take the frame is a full TX FIFO */
+  if (send(transport.can_fd, &frame, sizeof(frame),
+           MSG_DONTWAIT | MSG_NOSIGNAL) != (ssize_t)sizeof(frame)) {
+    return HAL_ERROR;
+  }
+
+  /* The frame has left once the call returns: it completes at the next
+   * poll, after the caller had the chance to arm the buffer */
+  transport.tx_latest = 1UL << transport.tx_next_buffer;
+  transport.tx_next_buffer =
+      (transport.tx_next_buffer + 1U) % COMM_HOST_CAN_TX_BUFFERS;
+  transport.tx_transmitted |= transport.tx_latest;
+  transport.stats.can_tx_frames++;
+  return HAL_OK;
+}
+
+uint32_t HAL_FDCAN_GetLatestTxFifoQRequestBuffer(FDCAN_HandleTypeDef *hfdcan) {
+  return (hfdcan == transport.hfdcan) ? transport.tx_latest : 0U;
+}
+
+uint32_t HAL_FDCAN_GetRxFifoFillLevel(FDCAN_HandleTypeDef *hfdcan,
+                                      uint32_t RxFifo) {
+  if (hfdcan != transport.hfdcan || RxFifo != FDCAN_RX_FIFO0) {
+    return 0;
+  }
+  return transport.rx_fifo_head - transport.rx_fifo_tail;
+}
+
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan,
+                                         uint32_t RxLocation,
+                                         FDCAN_RxHeaderTypeDef *pRxHeader,
+                                         uint8_t *pRxData) {
+  if (hfdcan != transport.hfdcan || RxLocation != FDCAN_RX_FIFO0 ||
+      pRxHeader == NULL || pRxData == NULL ||
+      transport.rx_fifo_head == transport.rx_fifo_tail) {
+    return HAL_ERROR;
+  }
+
+  uint32_t slot = transport.rx_fifo_tail % COMM_HOST_CAN_RX_FIFO_DEPTH;
+  const CommCanFrame_t *frame = &transport.rx_fifo[slot];
+  uint32_t dlc = length_to_dlc(frame->length);
+
+  memset(pRxHeader, 0, sizeof(*pRxHeader));
+  pRxHeader->Identifier = frame->id;
+  pRxHeader->IdType = FDCAN_STANDARD_ID;
+  pRxHeader->RxFrameType = FDCAN_DATA_FRAME;
+  pRxHeader->DataLength = dlc;
+  pRxHeader->FDFormat = (dlc > 8U) ? FDCAN_FD_CAN : FDCAN_CLASSIC_CAN;
+  pRxHeader->FilterIndex = transport.rx_fifo_filter[slot];
+
+  /* The DLC may round the length up; the padding reads as zero */
+  memset(pRxData, 0, comm_can_dlc_to_length((uint8_t)dlc));
+  memcpy(pRxData, frame->data, frame->length);
+
+  transport.rx_fifo_tail++;
+  return HAL_OK;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Run the transmit complete interrupts
+ */
+static uint32_t deliver_completions(void) {
+  uint32_t events = 0;
+
+  if (transport.tx_busy) {
+    write_uart(transport.tx_data, transport.tx_length);
+    transport.tx_busy = false;
+    transport.stats.uart_tx_completes++;
+    comm_uart_tx_complete_callback(transport.huart);
+    events++;
+  }
+
+  uint32_t completed = transport.tx_transmitted & transport.tx_complete_enabled;
+  transport.tx_transmitted = 0;
+  if (completed != 0U) {
+    comm_can_tx_complete_callback(transport.hfdcan, completed);
+    events++;
+  }
+
+  return events;
+}
+
+/**
+ * @brief Put a finished transfer on the wire
+ * @details Written when the transfer completes rather than when it starts,
+ * so the client cannot see a reply before its TX slot is released.
+ */
+static void write_uart(const uint8_t *data, uint16_t length) {
+  uint16_t sent = 0;
+
+  while (sent < length) {
+    ssize_t n = send(transport.uart_fd, data + sent, length - sent,
+                     MSG_NOSIGNAL);
+    if (n < 0) {
+      if (errno == EINTR) {
+        continue;
+      }
+      return; /* Client gone: the bytes fall off the line */
+    }
+    sent += (uint16_t)n;
+  }
+
+  transport.stats.uart_tx_bytes += length;
+}
+
+/**
+ * @brief Sleep until either socket has input or the timeout expires
+ */
+static void wait_for_input(uint32_t timeout_ms) {
+  struct pollfd fds[2] = {{.fd = transport.uart_fd, .events = POLLIN},
+                          {.fd = transport.can_fd, .events = POLLIN}};
+
+  (void)poll(fds, 2, (int)timeout_ms);
+}
+
+/**
+ * @brief Move received bytes into the RX DMA buffer
+ * @details Events are raised at each half and full buffer, like the HT/TC
+ * interrupts, so the consumer never sees more than half a buffer at once.
+ * At most half a buffer is taken per poll; the rest waits in the socket.
+ */
+static uint32_t receive_uart(void) {
+  if (!transport.rx_active) {
+    return 0;
+  }
+
+  uint16_t half = transport.rx_size / 2U;
+  uint32_t budget = half;
+  uint32_t events = 0;
+
+  while (budget > 0) {
+    uint32_t room = half - (transport.rx_position % half);
+    if (room > budget) {
+      room = budget;
+    }
+
+    ssize_t n = recv(transport.uart_fd,
+                     transport.rx_buffer + transport.rx_position, room,
+                     MSG_DONTWAIT);
+    if (n <= 0) {
+      break;
+    }
+
+    budget -= (uint32_t)n;
+    transport.rx_position += (uint16_t)n;
+    transport.stats.uart_rx_bytes += (uint64_t)n;
+    transport.stats.uart_rx_events++;
+    events++;
+
+    if (transport.rx_position == transport.rx_size) {
+      /* Circular mode: the counter reloads and writing restarts at 0 */
+      transport.rx_position = 0;
+      transport.rx_stream.NDTR = transport.rx_size;
+      comm_uart_rx_complete_callback(transport.huart);
+    } else {
+      transport.rx_stream.NDTR = transport.rx_size - transport.rx_position;
+      comm_uart_rx_event_callback(transport.huart, transport.rx_position);
+    }
+  }
+
+  return events;
+}
+
+/**
+ * @brief Filter received frames into RX FIFO 0 and run its interrupt
+ * @details Frames beyond the free FIFO space stay on the socket, which
+ * stands in for the bus: nothing is lost in the model itself.
+ */
+static uint32_t receive_can(void) {
+  if (!transport.can_started) {
+    return 0;
+  }
+
+  while (transport.rx_fifo_head - transport.rx_fifo_tail <
+         COMM_HOST_CAN_RX_FIFO_DEPTH) {
+    CommCanFrame_t frame;
+    ssize_t n = recv(transport.can_fd, &frame, sizeof(frame), MSG_DONTWAIT);
+    if (n < 0) {
+      break;
+    }
+    if (n != (ssize_t)sizeof(frame) || frame.length > CAN_MAX_MESSAGE_SIZE) {
+      transport.stats.can_malformed++;
+      continue;
+    }
+
+    int32_t filter = match_filter(frame.id);
+    if (filter < 0) {
+      transport.stats.can_rejected++;
+      continue;
+    }
+
+    uint32_t slot = transport.rx_fifo_head % COMM_HOST_CAN_RX_FIFO_DEPTH;
+    transport.rx_fifo[slot] = frame;
+    transport.rx_fifo_filter[slot] = (uint8_t)filter;
+    transport.rx_fifo_head++;
+    transport.stats.can_rx_frames++;
+  }
+
+  if (transport.rx_fifo_head == transport.rx_fifo_tail ||
+      (transport.active_its & FDCAN_IT_RX_FIFO0_NEW_MESSAGE) == 0U) {
+    return 0;
+  }
+
+  comm_can_rx_callback(transport.hfdcan);
+  return 1;
+}
+
+/**
+ * @brief Filter element that accepts an identifier, lowest first
+ */
+static int32_t match_filter(uint32_t id) {
+  for (int32_t i = 0; i < COMM_HOST_CAN_FILTERS; i++) {
+    if (transport.filter_valid[i] && id >= transport.filters[i].FilterID1 &&
+        id <= transport.filters[i].FilterID2) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief Smallest DLC code whose payload holds a length
+ */
+static uint32_t length_to_dlc(uint8_t length) {
+  uint32_t dlc = 0;
+  while (dlc < 15U && comm_can_dlc_to_length((uint8_t)dlc) < length) {
+    dlc++;
+  }
+  return dlc;
+}
+
+static void close_fd(int *fd) {
+  if (*fd >= 0) {
+    close(*fd);
+    *fd = -1;
+  }
+}
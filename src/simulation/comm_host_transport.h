@@ -0,0 +1,106 @@
+/**
+ * @file comm_host_transport.h
+ * @brief Host UART/FDCAN backend for comm_protocol.c over socketpairs
+ * @details Implements the HAL UART and FDCAN calls made by
+ * communication/comm_protocol.c (mock HAL types from tests/mocks) on top
+ * of two socketpairs, so the protocol stack runs unchanged on Linux and a
+ * client drives it from the other end:
+ *   - UART: SOCK_STREAM byte stream. Received bytes are written into the
+ *     buffer given to HAL_UARTEx_ReceiveToIdle_DMA as the circular DMA
+ *     would, at most half a buffer per event, and reported through
+ *     comm_uart_rx_event_callback() (comm_uart_rx_complete_callback() when
+ *     the DMA wraps). Each HAL_UART_Transmit_DMA is written to the socket
+ *     and completed through comm_uart_tx_complete_callback().
+ *   - CAN: SOCK_SEQPACKET, one CommCanFrame_t per datagram (timestamp_us
+ *     unused). Received frames go through the range filters configured
+ *     with HAL_FDCAN_ConfigFilter, lowest element first, into a model of
+ *     RX FIFO 0 drained by comm_can_rx_callback(); unmatched frames are
+ *     rejected as by the global filter. Transmit buffer completions are
+ *     reported through comm_can_tx_complete_callback() for the buffers
+ *     armed with FDCAN_IT_TX_COMPLETE.
+ *
+ * comm_host_transport_poll() plays the interrupt controller: callbacks
+ * only run from it, never from inside a HAL call, so the firmware sees the
+ * same ordering as with real interrupts. Call it from the thread that runs
+ * comm_protocol_task().
+ *
+ * HAL_Abstraction_GetTick() and HAL_Abstraction_GetMicroseconds() are not
+ * provided; link the mock HAL abstraction or a wall clock.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#ifndef COMM_HOST_TRANSPORT_H
+#define COMM_HOST_TRANSPORT_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "communication/comm_can_bus.h"
+#include "simulation/hardware_simulation.h"
+#include "stm32h7xx_hal.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Transport configuration */
+#define COMM_HOST_CAN_RX_FIFO_DEPTH 64 /**< FDCAN RX FIFO 0 elements */
+#define COMM_HOST_CAN_FILTERS 28       /**< Standard filter elements */
+#define COMM_HOST_CAN_TX_BUFFERS 32    /**< FDCAN TX buffers */
+
+/* Client ends of the sockets */
+typedef struct {
+  int uart_fd; /**< UART byte stream */
+  int can_fd;  /**< CAN frames, one CommCanFrame_t per datagram */
+} comm_host_transport_peer_t;
+
+/* Transport statistics */
+typedef struct {
+  uint64_t uart_rx_bytes;     /**< Bytes written into the RX DMA buffer */
+  uint64_t uart_tx_bytes;     /**< Bytes sent to the client */
+  uint32_t uart_rx_events;    /**< RX event callbacks delivered */
+  uint32_t uart_tx_completes; /**< TX complete callbacks delivered */
+  uint32_t can_rx_frames;     /**< Frames accepted into RX FIFO 0 */
+  uint32_t can_tx_frames;     /**< Frames sent to the client */
+  uint32_t can_rejected;      /**< Frames matching no filter element */
+  uint32_t can_malformed;     /**< Datagrams that were not a frame */
+} comm_host_transport_stats_t;
+
+/**
+ * @brief Create the sockets and bind them to the peripheral handles
+ * @param huart UART handle later passed to comm_uart_init()
+ * @param hfdcan FDCAN handle later passed to comm_can_init()
+ * @param peer Client ends of the sockets
+ * @return SIM_OK on success, SIM_ERROR_COMMAND_FAILED if the sockets
+ *         cannot be created or the transport is already open
+ * @note Open before comm_uart_init()/comm_can_init(): both call the HAL
+ */
+simulation_error_t comm_host_transport_open(UART_HandleTypeDef *huart,
+                                            FDCAN_HandleTypeDef *hfdcan,
+                                            comm_host_transport_peer_t *peer);
+
+/**
+ * @brief Close both ends of the sockets and unbind the handles
+ */
+void comm_host_transport_close(void);
+
+/**
+ * @brief Deliver pending peripheral events to comm_protocol.c
+ * @param timeout_ms Longest wait for input when nothing is pending
+ *        (0: do not wait)
+ * @return Number of callbacks delivered
+ */
+uint32_t comm_host_transport_poll(uint32_t timeout_ms);
+
+/**
+ * @brief Get transport statistics
+ * @param stats Statistics output
+ */
+void comm_host_transport_get_stats(comm_host_transport_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* COMM_HOST_TRANSPORT_H */
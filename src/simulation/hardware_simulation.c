@@ -1,11 +1,13 @@
 /**
  * @file hardware_simulation.c
- * @brief Hardware simulation implementation using Python backend
- * @details C wrapper for Python register simulation framework
+ * @brief Hardware simulation implementation
+ * @details Register simulation backed by an in-process model
  *
- * This implementation provides C functions that interface with the
- * Python simulation framework through subprocess calls or embedded
- * Python interpreter.
+ * The native backend loads the L6470/AS5600 register schemas once at
+ * initialization and serves every register access from memory. The
+ * optional co-process backend keeps a single Python simulator process
+ * alive for the whole session and exchanges one line per access over
+ * pipes, instead of spawning an interpreter for every register access.
  *
  * @note Part of STM32H753ZI stepper motor control project
  * @author Generated by Phase 1B simulation framework
@@ -13,21 +15,137 @@
  */
 
 #include "hardware_simulation.h"
+#include "sim_register_model.h"
+#include <math.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/types.h>
 #include <sys/wait.h>
 #include <unistd.h>
 
+/* Private Definitions */
+#define L6470_ABS_POS_REG 0x01
+#define L6470_SPEED_REG 0x04
+#define L6470_MAX_SPEED_REG 0x07
+#define L6470_STATUS_REG 0x19
+#define L6470_ABS_POS_BITS 22
+#define L6470_PARAM_MASK 0x1F
+
+#define L6470_STATUS_HIZ_BIT 0x0001U
+#define L6470_STATUS_DIR_BIT 0x0010U
+#define L6470_STATUS_MOT_MASK 0x0060U
+#define L6470_STATUS_MOT_STOPPED 0x0000U
+#define L6470_STATUS_MOT_ACCEL 0x0020U
+#define L6470_STATUS_MOT_DECEL 0x0040U
+#define L6470_STATUS_MOT_CONST 0x0060U
+#define L6470_STATUS_NOTPERF_BIT 0x0080U
+#define L6470_STATUS_WRONG_CMD_BIT 0x0100U
+
+/* L6470 speed register scaling (datasheet: tick = 250 ns) */
+#define L6470_SPEED_LSB_STEPS_S 0.0149011612f /* 2^-28 / 250 ns */
+#define L6470_MAX_SPEED_TO_SPEED_SHIFT 10     /* 2^-18 vs 2^-28 LSB */
+
+#define AS5600_RAW_ANGLE_H_REG 0x0C
+#define AS5600_RAW_ANGLE_L_REG 0x0D
+#define AS5600_ANGLE_H_REG 0x0E
+#define AS5600_ANGLE_L_REG 0x0F
+#define AS5600_STATUS_REG 0x0B
+#define AS5600_AGC_REG 0x1A
+#define AS5600_MAGNITUDE_H_REG 0x1B
+#define AS5600_MAGNITUDE_L_REG 0x1C
+#define AS5600_STATUS_MD_BIT 0x20U
+#define AS5600_COUNTS_PER_REV 4096U
+
+#define SIM_SINUSOID_FREQUENCY_HZ 0.1f
+
+/* Private Types */
+typedef enum {
+  ENCODER_PATTERN_STATIC = 0,
+  ENCODER_PATTERN_ROTATING,
+  ENCODER_PATTERN_SINUSOIDAL
+} encoder_pattern_t;
+
+typedef struct {
+  sim_register_bank_t l6470;
+  sim_register_bank_t as5600;
+
+  /* Motion state not held in registers */
+  bool position_mode;      /**< MOVE/GOTO in progress */
+  int32_t target_position; /**< Target for position mode */
+  float step_remainder;    /**< Fractional steps carried between updates */
+
+  /* Encoder state */
+  float encoder_angle_deg;
+  encoder_pattern_t pattern;
+  float pattern_parameter;
+  uint32_t pattern_start_ms;
+
+  /* Simulation control */
+  bool linked_motion;
+  bool physics_active;
+  uint32_t steps_per_rev;
+  uint32_t sim_time_ms;
+} native_model_t;
+
+typedef struct {
+  pid_t pid;
+  FILE *request;
+  FILE *response;
+} python_coprocess_t;
+
 /* Private Variables */
 static bool simulation_initialized = false;
+static simulation_backend_t active_backend = SIM_BACKEND_NATIVE;
 static char python_script_path[256] = "scripts/register_simulator.py";
 static char l6470_schema_path[256] = "schemas/l6470_registers.yaml";
 static char as5600_schema_path[256] = "schemas/as5600_registers.yaml";
+static native_model_t native_model;
+static python_coprocess_t coprocess = {-1, NULL, NULL};
+
+/* Persistent co-process request loop (one request per line) */
+static const char coprocess_program[] =
+    "import sys\n"
+    "sys.path.append('.')\n"
+    "from scripts.register_simulator import L6470Simulator, AS5600Simulator\n"
+    "sims = {'l6470': L6470Simulator(sys.argv[1]),\n"
+    "        'as5600': AS5600Simulator(sys.argv[2])}\n"
+    "for line in sys.stdin:\n"
+    "    try:\n"
+    "        chip, op, addr, value = line.split()\n"
+    "        sim = sims[chip]\n"
+    "        addr = int(addr, 0)\n"
+    "        value = int(value, 0)\n"
+    "        if op == 'read':\n"
+    "            print(sim.read_register(addr))\n"
+    "        elif op == 'write':\n"
+    "            print('OK' if sim.write_register(addr, value) else 'ERROR')\n"
+    "        else:\n"
+    "            print('OK' if sim.send_command(addr, value) else 'ERROR')\n"
+    "    except Exception:\n"
+    "        print('ERROR')\n"
+    "    sys.stdout.flush()\n";
 
 /* Private Functions */
-static simulation_error_t
-execute_python_command(const char *command, char *output, size_t output_size);
+static simulation_error_t native_model_init(void);
+static simulation_error_t native_l6470_command(uint8_t command,
+                                               uint32_t parameter);
+static int32_t native_get_position(void);
+static int32_t position_from_abs_pos(uint32_t raw);
+static float speed_from_register(uint32_t raw);
+static simulation_error_t native_only(void);
+static void native_set_position(int32_t position);
+static float native_get_speed(void);
+static void native_set_motion(uint16_t mot_status, uint32_t speed,
+                              bool forward);
+static void native_update_encoder(void);
+static simulation_error_t map_register_result(sim_register_result_t result);
+
+static simulation_error_t coprocess_start(void);
+static void coprocess_stop(void);
+static simulation_error_t coprocess_transact(const char *chip, const char *op,
+                                             uint32_t address, uint32_t value,
+                                             char *output, size_t output_size);
 static simulation_error_t parse_register_response(const char *response,
                                                   uint32_t *value);
 
@@ -51,15 +169,17 @@ simulation_error_t simulation_init(const char *l6470_schema,
     as5600_schema_path[sizeof(as5600_schema_path) - 1] = '\0';
   }
 
-  /* Test if Python script is accessible */
-  if (access(python_script_path, R_OK) != 0) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  /* The native model always backs the control API */
+  simulation_error_t result = native_model_init();
+  if (result != SIM_OK) {
+    return result;
   }
 
-  /* Test if schema files are accessible */
-  if (access(l6470_schema_path, R_OK) != 0 ||
-      access(as5600_schema_path, R_OK) != 0) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    result = coprocess_start();
+    if (result != SIM_OK) {
+      return result;
+    }
   }
 
   simulation_initialized = true;
@@ -69,7 +189,32 @@ simulation_error_t simulation_init(const char *l6470_schema,
 /**
  * @brief Cleanup simulation
  */
-void simulation_cleanup(void) { simulation_initialized = false; }
+void simulation_cleanup(void) {
+  coprocess_stop();
+  simulation_initialized = false;
+}
+
+/**
+ * @brief Select register backend
+ */
+simulation_error_t simulation_set_backend(simulation_backend_t backend) {
+  if (simulation_initialized) {
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+
+  if (backend != SIM_BACKEND_NATIVE &&
+      backend != SIM_BACKEND_PYTHON_COPROCESS) {
+    return SIM_ERROR_INVALID_VALUE;
+  }
+
+  active_backend = backend;
+  return SIM_OK;
+}
+
+/**
+ * @brief Get active register backend
+ */
+simulation_backend_t simulation_get_backend(void) { return active_backend; }
 
 /**
  * @brief Read L6470 register
@@ -79,24 +224,19 @@ simulation_error_t l6470_sim_read_register(uint8_t address, uint32_t *value) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  char command[512];
-  char output[256];
-
-  /* Create Python command to read register */
-  snprintf(command, sizeof(command),
-           "import sys; sys.path.append('.'); "
-           "from scripts.register_simulator import L6470Simulator; "
-           "sim = L6470Simulator('%s'); "
-           "print(sim.read_register(0x%02X))",
-           l6470_schema_path, address);
-
-  simulation_error_t result =
-      execute_python_command(command, output, sizeof(output));
-  if (result != SIM_OK) {
-    return result;
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    char output[64];
+    simulation_error_t result =
+        coprocess_transact("l6470", "read", address, 0, output, sizeof(output));
+    if (result != SIM_OK) {
+      return result;
+    }
+    return parse_register_response(output, value);
   }
 
-  return parse_register_response(output, value);
+  /* Reading STATUS as a parameter does not clear latched flags */
+  return map_register_result(
+      sim_register_bank_read(&native_model.l6470, address, value));
 }
 
 /**
@@ -107,28 +247,24 @@ simulation_error_t l6470_sim_write_register(uint8_t address, uint32_t value) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  char command[512];
-  char output[256];
-
-  /* Create Python command to write register */
-  snprintf(command, sizeof(command),
-           "import sys; sys.path.append('.'); "
-           "from scripts.register_simulator import L6470Simulator; "
-           "sim = L6470Simulator('%s'); "
-           "print('OK' if sim.write_register(0x%02X, 0x%06X) else 'ERROR')",
-           l6470_schema_path, address, value);
-
-  simulation_error_t result =
-      execute_python_command(command, output, sizeof(output));
-  if (result != SIM_OK) {
-    return result;
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    char output[64];
+    simulation_error_t result = coprocess_transact(
+        "l6470", "write", address, value, output, sizeof(output));
+    if (result != SIM_OK) {
+      return result;
+    }
+    return (strstr(output, "ERROR") != NULL) ? SIM_ERROR_INVALID_VALUE
+                                             : SIM_OK;
   }
 
-  if (strstr(output, "ERROR") != NULL) {
-    return SIM_ERROR_INVALID_VALUE;
+  simulation_error_t result = map_register_result(
+      sim_register_bank_write(&native_model.l6470, address, value));
+  if (result == SIM_OK && address == L6470_ABS_POS_REG) {
+    native_update_encoder();
   }
 
-  return SIM_OK;
+  return result;
 }
 
 /**
@@ -139,28 +275,18 @@ simulation_error_t l6470_sim_send_command(uint8_t command, uint32_t parameter) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  char cmd_str[512];
-  char output[256];
-
-  /* Create Python command to send command */
-  snprintf(cmd_str, sizeof(cmd_str),
-           "import sys; sys.path.append('.'); "
-           "from scripts.register_simulator import L6470Simulator; "
-           "sim = L6470Simulator('%s'); "
-           "print('OK' if sim.send_command(0x%02X, 0x%06X) else 'ERROR')",
-           l6470_schema_path, command, parameter);
-
-  simulation_error_t result =
-      execute_python_command(cmd_str, output, sizeof(output));
-  if (result != SIM_OK) {
-    return result;
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    char output[64];
+    simulation_error_t result = coprocess_transact(
+        "l6470", "command", command, parameter, output, sizeof(output));
+    if (result != SIM_OK) {
+      return result;
+    }
+    return (strstr(output, "ERROR") != NULL) ? SIM_ERROR_COMMAND_FAILED
+                                             : SIM_OK;
   }
 
-  if (strstr(output, "ERROR") != NULL) {
-    return SIM_ERROR_COMMAND_FAILED;
-  }
-
-  return SIM_OK;
+  return native_l6470_command(command, parameter);
 }
 
 /**
@@ -171,25 +297,21 @@ simulation_error_t as5600_sim_read_register(uint8_t address, uint16_t *value) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  char command[512];
-  char output[256];
   uint32_t temp_value;
-
-  /* Create Python command to read register */
-  snprintf(command, sizeof(command),
-           "import sys; sys.path.append('.'); "
-           "from scripts.register_simulator import AS5600Simulator; "
-           "sim = AS5600Simulator('%s'); "
-           "print(sim.read_register(0x%02X))",
-           as5600_schema_path, address);
-
-  simulation_error_t result =
-      execute_python_command(command, output, sizeof(output));
-  if (result != SIM_OK) {
-    return result;
+  simulation_error_t result;
+
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    char output[64];
+    result = coprocess_transact("as5600", "read", address, 0, output,
+                                sizeof(output));
+    if (result == SIM_OK) {
+      result = parse_register_response(output, &temp_value);
+    }
+  } else {
+    result = map_register_result(
+        sim_register_bank_read(&native_model.as5600, address, &temp_value));
   }
 
-  result = parse_register_response(output, &temp_value);
   if (result == SIM_OK) {
     *value = (uint16_t)(temp_value & 0xFFFF);
   }
@@ -205,44 +327,86 @@ simulation_error_t as5600_sim_write_register(uint8_t address, uint16_t value) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  char command[512];
-  char output[256];
-
-  /* Create Python command to write register */
-  snprintf(command, sizeof(command),
-           "import sys; sys.path.append('.'); "
-           "from scripts.register_simulator import AS5600Simulator; "
-           "sim = AS5600Simulator('%s'); "
-           "print('OK' if sim.write_register(0x%02X, 0x%04X) else 'ERROR')",
-           as5600_schema_path, address, value);
-
-  simulation_error_t result =
-      execute_python_command(command, output, sizeof(output));
-  if (result != SIM_OK) {
-    return result;
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    char output[64];
+    simulation_error_t result = coprocess_transact(
+        "as5600", "write", address, value, output, sizeof(output));
+    if (result != SIM_OK) {
+      return result;
+    }
+    return (strstr(output, "ERROR") != NULL) ? SIM_ERROR_INVALID_VALUE
+                                             : SIM_OK;
   }
 
-  if (strstr(output, "ERROR") != NULL) {
-    return SIM_ERROR_INVALID_VALUE;
-  }
-
-  return SIM_OK;
+  return map_register_result(
+      sim_register_bank_write(&native_model.as5600, address, value));
 }
 
 /**
- * @brief Get simulation status (simplified version)
+ * @brief Get simulation status from the active register backend
  */
 simulation_error_t simulation_get_status(simulation_status_t *status) {
   if (!simulation_initialized || !status) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  /* For now, return basic status - full implementation would need
-   * more complex Python interaction or shared memory */
+  /* Motion and encoder fields come from the backend serving the registers */
+  uint32_t abs_pos;
+  uint32_t speed;
+  uint32_t status_reg;
+  uint16_t raw_h;
+  uint16_t raw_l;
+  simulation_error_t result =
+      l6470_sim_read_register(L6470_ABS_POS_REG, &abs_pos);
+  if (result == SIM_OK) {
+    result = l6470_sim_read_register(L6470_SPEED_REG, &speed);
+  }
+  if (result == SIM_OK) {
+    result = l6470_sim_read_register(L6470_STATUS_REG, &status_reg);
+  }
+  if (result == SIM_OK) {
+    result = as5600_sim_read_register(AS5600_RAW_ANGLE_H_REG, &raw_h);
+  }
+  if (result == SIM_OK) {
+    result = as5600_sim_read_register(AS5600_RAW_ANGLE_L_REG, &raw_l);
+  }
+  if (result != SIM_OK) {
+    return result;
+  }
+
   memset(status, 0, sizeof(simulation_status_t));
-  status->linked_motion = false;
-  status->physics_active = false;
-  status->steps_per_rev = 200;
+  status->motor_position = position_from_abs_pos(abs_pos);
+  status->motor_speed = speed_from_register(speed);
+  status->motor_direction = (status_reg & L6470_STATUS_DIR_BIT) ? 1 : -1;
+
+  switch (status_reg & L6470_STATUS_MOT_MASK) {
+  case L6470_STATUS_MOT_ACCEL:
+    status->motor_state = MOTOR_ACCELERATING;
+    break;
+  case L6470_STATUS_MOT_DECEL:
+    status->motor_state = MOTOR_DECELERATING;
+    break;
+  case L6470_STATUS_MOT_CONST:
+    status->motor_state = MOTOR_RUNNING;
+    break;
+  default:
+    status->motor_state = MOTOR_STOPPED;
+    break;
+  }
+
+  status->encoder_raw = (uint16_t)(((raw_h & 0x0FU) << 8) | (raw_l & 0xFFU));
+
+  if (active_backend == SIM_BACKEND_PYTHON_COPROCESS) {
+    /* No native controls run in this mode */
+    status->encoder_angle =
+        (float)status->encoder_raw * 360.0f / (float)AS5600_COUNTS_PER_REV;
+    return SIM_OK;
+  }
+
+  status->encoder_angle = native_model.encoder_angle_deg;
+  status->linked_motion = native_model.linked_motion;
+  status->physics_active = native_model.physics_active;
+  status->steps_per_rev = native_model.steps_per_rev;
 
   return SIM_OK;
 }
@@ -252,12 +416,18 @@ simulation_error_t simulation_get_status(simulation_status_t *status) {
  */
 simulation_error_t
 simulation_enable_linked_motion(uint32_t steps_per_revolution) {
-  if (!simulation_initialized) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
   }
 
-  /* TODO: Implement Python call to enable linked motion */
-  (void)steps_per_revolution; /* Suppress unused parameter warning */
+  if (steps_per_revolution == 0) {
+    return SIM_ERROR_INVALID_VALUE;
+  }
+
+  native_model.steps_per_rev = steps_per_revolution;
+  native_model.linked_motion = true;
+  native_update_encoder();
 
   return SIM_OK;
 }
@@ -266,11 +436,12 @@ simulation_enable_linked_motion(uint32_t steps_per_revolution) {
  * @brief Disable linked motion
  */
 simulation_error_t simulation_disable_linked_motion(void) {
-  if (!simulation_initialized) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
   }
 
-  /* TODO: Implement Python call to disable linked motion */
+  native_model.linked_motion = false;
 
   return SIM_OK;
 }
@@ -279,11 +450,13 @@ simulation_error_t simulation_disable_linked_motion(void) {
  * @brief Start physics simulation
  */
 simulation_error_t simulation_start_physics(void) {
-  if (!simulation_initialized) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
   }
 
-  /* TODO: Implement Python call to start physics */
+  native_model.physics_active = true;
+  native_model.step_remainder = 0.0f;
 
   return SIM_OK;
 }
@@ -292,11 +465,70 @@ simulation_error_t simulation_start_physics(void) {
  * @brief Stop physics simulation
  */
 simulation_error_t simulation_stop_physics(void) {
-  if (!simulation_initialized) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
+  }
+
+  native_model.physics_active = false;
+
+  return SIM_OK;
+}
+
+/**
+ * @brief Advance simulated time of the native model
+ */
+simulation_error_t simulation_advance_time(uint32_t delta_time_ms) {
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
+  }
+
+  native_model.sim_time_ms += delta_time_ms;
+
+  uint32_t status_reg = native_model.l6470.value[L6470_STATUS_REG];
+  if (native_model.physics_active &&
+      (status_reg & L6470_STATUS_MOT_MASK) != L6470_STATUS_MOT_STOPPED) {
+    float steps = native_get_speed() * ((float)delta_time_ms / 1000.0f) +
+                  native_model.step_remainder;
+    int32_t whole_steps = (int32_t)steps;
+    native_model.step_remainder = steps - (float)whole_steps;
+
+    bool forward = (status_reg & L6470_STATUS_DIR_BIT) != 0U;
+    int32_t position = native_get_position();
+
+    if (native_model.position_mode) {
+      int32_t remaining = native_model.target_position - position;
+      if (remaining < 0) {
+        remaining = -remaining;
+      }
+      if (whole_steps >= remaining) {
+        native_set_position(native_model.target_position);
+        native_model.position_mode = false;
+        native_set_motion(L6470_STATUS_MOT_STOPPED, 0, forward);
+        return SIM_OK;
+      }
+    }
+
+    native_set_position(forward ? position + whole_steps
+                                : position - whole_steps);
   }
 
-  /* TODO: Implement Python call to stop physics */
+  if (!native_model.linked_motion &&
+      native_model.pattern != ENCODER_PATTERN_STATIC) {
+    float elapsed_s =
+        (float)(native_model.sim_time_ms - native_model.pattern_start_ms) /
+        1000.0f;
+    if (native_model.pattern == ENCODER_PATTERN_ROTATING) {
+      native_model.encoder_angle_deg +=
+          native_model.pattern_parameter * ((float)delta_time_ms / 1000.0f);
+    } else {
+      native_model.encoder_angle_deg =
+          native_model.pattern_parameter *
+          sinf(2.0f * (float)M_PI * SIM_SINUSOID_FREQUENCY_HZ * elapsed_s);
+    }
+    native_update_encoder();
+  }
 
   return SIM_OK;
 }
@@ -305,12 +537,27 @@ simulation_error_t simulation_stop_physics(void) {
  * @brief Set AS5600 angle pattern
  */
 simulation_error_t as5600_sim_set_pattern(const char *pattern, float speed) {
-  if (!simulation_initialized || !pattern) {
+  if (!pattern) {
     return SIM_ERROR_NOT_INITIALIZED;
   }
 
-  /* TODO: Implement Python call to set pattern */
-  (void)speed; /* Suppress unused parameter warning */
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
+  }
+
+  if (strcmp(pattern, "static") == 0) {
+    native_model.pattern = ENCODER_PATTERN_STATIC;
+  } else if (strcmp(pattern, "rotating") == 0) {
+    native_model.pattern = ENCODER_PATTERN_ROTATING;
+  } else if (strcmp(pattern, "sinusoidal") == 0) {
+    native_model.pattern = ENCODER_PATTERN_SINUSOIDAL;
+  } else {
+    return SIM_ERROR_INVALID_VALUE;
+  }
+
+  native_model.pattern_parameter = speed;
+  native_model.pattern_start_ms = native_model.sim_time_ms;
 
   return SIM_OK;
 }
@@ -319,12 +566,17 @@ simulation_error_t as5600_sim_set_pattern(const char *pattern, float speed) {
  * @brief Set AS5600 angle
  */
 simulation_error_t as5600_sim_set_angle(float degrees) {
-  if (!simulation_initialized) {
-    return SIM_ERROR_NOT_INITIALIZED;
+  simulation_error_t result = native_only();
+  if (result != SIM_OK) {
+    return result;
+  }
+
+  if (degrees < 0.0f || degrees > 360.0f) {
+    return SIM_ERROR_INVALID_VALUE;
   }
 
-  /* TODO: Implement Python call to set angle */
-  (void)degrees; /* Suppress unused parameter warning */
+  native_model.encoder_angle_deg = degrees;
+  native_update_encoder();
 
   return SIM_OK;
 }
@@ -332,29 +584,348 @@ simulation_error_t as5600_sim_set_angle(float degrees) {
 /* Private Function Implementations */
 
 /**
- * @brief Execute Python command and capture output
+ * @brief Load schemas and seed device-side register state
+ */
+static simulation_error_t native_model_init(void) {
+  memset(&native_model, 0, sizeof(native_model));
+
+  if (!sim_register_bank_load_schema(&native_model.l6470, l6470_schema_path) ||
+      !sim_register_bank_load_schema(&native_model.as5600,
+                                     as5600_schema_path)) {
+    return SIM_ERROR_NOT_INITIALIZED;
+  }
+
+  /* Power-on state: bridges in high impedance, magnet detected */
+  sim_register_bank_poke(&native_model.l6470, L6470_STATUS_REG,
+                         L6470_STATUS_HIZ_BIT);
+  sim_register_bank_poke(&native_model.as5600, AS5600_STATUS_REG,
+                         AS5600_STATUS_MD_BIT);
+  sim_register_bank_poke(&native_model.as5600, AS5600_AGC_REG, 0x80);
+  sim_register_bank_poke(&native_model.as5600, AS5600_MAGNITUDE_H_REG, 0x08);
+  sim_register_bank_poke(&native_model.as5600, AS5600_MAGNITUDE_L_REG, 0x00);
+
+  native_model.steps_per_rev = 200;
+  native_update_encoder();
+
+  return SIM_OK;
+}
+
+/**
+ * @brief Apply an L6470 application command to the native model
+ */
+static simulation_error_t native_l6470_command(uint8_t command,
+                                               uint32_t parameter) {
+  sim_register_bank_t *bank = &native_model.l6470;
+  bool forward = (command & 0x01U) != 0U;
+  uint32_t max_speed = bank->value[L6470_MAX_SPEED_REG];
+  int32_t position = native_get_position();
+
+  /* SET_PARAM / GET_PARAM carry the register address in the low bits */
+  if ((command & 0xE0U) == 0x00U && command != 0x00U) {
+    return l6470_sim_write_register(command & L6470_PARAM_MASK, parameter);
+  }
+  if ((command & 0xE0U) == 0x20U) {
+    return bank->desc[command & L6470_PARAM_MASK].defined
+               ? SIM_OK
+               : SIM_ERROR_INVALID_ADDR;
+  }
+
+  switch (command & 0xFEU) {
+  case 0x00: /* NOP */
+    return SIM_OK;
+
+  case 0x50: /* RUN */
+    native_model.position_mode = false;
+    native_set_motion(L6470_STATUS_MOT_CONST, parameter, forward);
+    return SIM_OK;
+
+  case 0x40: /* MOVE */
+  case 0x60: /* GOTO (direction bit ignored) */
+  case 0x68: /* GOTO_DIR */
+    if ((command & 0xFEU) == 0x40U) {
+      native_model.target_position =
+          forward ? position + (int32_t)parameter
+                  : position - (int32_t)parameter;
+    } else {
+      native_model.target_position = position_from_abs_pos(parameter);
+      if ((command & 0xFEU) == 0x60U) {
+        forward = native_model.target_position >= position;
+      }
+    }
+
+    if (!native_model.physics_active) {
+      /* Without physics the move completes instantly */
+      native_set_position(native_model.target_position);
+      native_set_motion(L6470_STATUS_MOT_STOPPED, 0, forward);
+      return SIM_OK;
+    }
+
+    native_model.position_mode = true;
+    native_set_motion(L6470_STATUS_MOT_CONST,
+                      max_speed << L6470_MAX_SPEED_TO_SPEED_SHIFT, forward);
+    return SIM_OK;
+
+  case 0x70: /* GO_HOME */
+    native_set_position(0);
+    native_model.position_mode = false;
+    native_set_motion(L6470_STATUS_MOT_STOPPED, 0, forward);
+    return SIM_OK;
+
+  case 0xB0: /* SOFT_STOP */
+  case 0xB8: /* HARD_STOP */
+    native_model.position_mode = false;
+    native_set_motion(L6470_STATUS_MOT_STOPPED, 0, forward);
+    return SIM_OK;
+
+  case 0xA0: /* SOFT_HIZ */
+  case 0xA8: /* HARD_HIZ */
+    native_model.position_mode = false;
+    native_set_motion(L6470_STATUS_MOT_STOPPED, 0, forward);
+    sim_register_bank_poke(bank, L6470_STATUS_REG,
+                           bank->value[L6470_STATUS_REG] |
+                               L6470_STATUS_HIZ_BIT);
+    return SIM_OK;
+
+  case 0xD8: /* RESET_POS */
+    native_set_position(0);
+    return SIM_OK;
+
+  case 0xC0: /* RESET_DEVICE */
+    sim_register_bank_reset(bank);
+    sim_register_bank_poke(bank, L6470_STATUS_REG, L6470_STATUS_HIZ_BIT);
+    native_model.position_mode = false;
+    native_update_encoder();
+    return SIM_OK;
+
+  case 0xD0: /* GET_STATUS clears latched flags */
+    sim_register_bank_poke(bank, L6470_STATUS_REG,
+                           bank->value[L6470_STATUS_REG] &
+                               ~(L6470_STATUS_NOTPERF_BIT |
+                                 L6470_STATUS_WRONG_CMD_BIT));
+    return SIM_OK;
+
+  default:
+    sim_register_bank_poke(bank, L6470_STATUS_REG,
+                           bank->value[L6470_STATUS_REG] |
+                               L6470_STATUS_WRONG_CMD_BIT);
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+}
+
+/**
+ * @brief Read ABS_POS as a signed 22-bit value
+ */
+static int32_t native_get_position(void) {
+  return position_from_abs_pos(native_model.l6470.value[L6470_ABS_POS_REG]);
+}
+
+/**
+ * @brief Sign-extend a 22-bit ABS_POS (or GOTO target) value
+ */
+static int32_t position_from_abs_pos(uint32_t raw) {
+  uint32_t mask = (1UL << L6470_ABS_POS_BITS) - 1U;
+  uint32_t sign = 1UL << (L6470_ABS_POS_BITS - 1);
+  return (int32_t)(((raw & mask) ^ sign) - sign);
+}
+
+/**
+ * @brief Store a signed position into ABS_POS (wraps like the device)
+ */
+static void native_set_position(int32_t position) {
+  sim_register_bank_poke(&native_model.l6470, L6470_ABS_POS_REG,
+                         (uint32_t)position);
+  native_update_encoder();
+}
+
+/**
+ * @brief Current speed in steps/second from the SPEED register
+ */
+static float native_get_speed(void) {
+  return speed_from_register(native_model.l6470.value[L6470_SPEED_REG]);
+}
+
+/**
+ * @brief Convert a SPEED register value to steps/second
+ */
+static float speed_from_register(uint32_t raw) {
+  return (float)raw * L6470_SPEED_LSB_STEPS_S;
+}
+
+/**
+ * @brief Reject native model controls while the co-process serves registers
+ * @details The Python simulator only exchanges register accesses and
+ *          commands; driving the native model here would let the two
+ *          models diverge.
+ */
+static simulation_error_t native_only(void) {
+  if (!simulation_initialized) {
+    return SIM_ERROR_NOT_INITIALIZED;
+  }
+  return (active_backend == SIM_BACKEND_PYTHON_COPROCESS)
+             ? SIM_ERROR_COMMAND_FAILED
+             : SIM_OK;
+}
+
+/**
+ * @brief Update SPEED and STATUS motion fields
  */
-static simulation_error_t
-execute_python_command(const char *command, char *output, size_t output_size) {
-  char full_command[1024];
-  FILE *pipe;
+static void native_set_motion(uint16_t mot_status, uint32_t speed,
+                              bool forward) {
+  sim_register_bank_t *bank = &native_model.l6470;
+  uint32_t status_reg = bank->value[L6470_STATUS_REG];
+
+  status_reg &= ~(L6470_STATUS_MOT_MASK | L6470_STATUS_DIR_BIT);
+  status_reg |= mot_status;
+  if (forward) {
+    status_reg |= L6470_STATUS_DIR_BIT;
+  }
+  if (mot_status != L6470_STATUS_MOT_STOPPED) {
+    status_reg &= ~L6470_STATUS_HIZ_BIT;
+  }
+
+  sim_register_bank_poke(bank, L6470_STATUS_REG, status_reg);
+  sim_register_bank_poke(bank, L6470_SPEED_REG, speed);
+}
 
-  /* Build full Python command */
-  snprintf(full_command, sizeof(full_command), "python3 -c \"%s\" 2>/dev/null",
-           command);
+/**
+ * @brief Refresh AS5600 angle registers from the model angle
+ */
+static void native_update_encoder(void) {
+  if (native_model.linked_motion && native_model.steps_per_rev > 0) {
+    int32_t spr = (int32_t)native_model.steps_per_rev;
+    int32_t step = native_get_position() % spr;
+    if (step < 0) {
+      step += spr;
+    }
+    native_model.encoder_angle_deg = (float)step * 360.0f / (float)spr;
+  }
 
-  /* Execute command and capture output */
-  pipe = popen(full_command, "r");
-  if (!pipe) {
+  float angle = fmodf(native_model.encoder_angle_deg, 360.0f);
+  if (angle < 0.0f) {
+    angle += 360.0f;
+  }
+  native_model.encoder_angle_deg = angle;
+
+  uint16_t counts = (uint16_t)((angle / 360.0f) * AS5600_COUNTS_PER_REV) &
+                    (AS5600_COUNTS_PER_REV - 1U);
+  sim_register_bank_t *bank = &native_model.as5600;
+  sim_register_bank_poke(bank, AS5600_RAW_ANGLE_H_REG, counts >> 8);
+  sim_register_bank_poke(bank, AS5600_RAW_ANGLE_L_REG, counts & 0xFFU);
+  sim_register_bank_poke(bank, AS5600_ANGLE_H_REG, counts >> 8);
+  sim_register_bank_poke(bank, AS5600_ANGLE_L_REG, counts & 0xFFU);
+}
+
+/**
+ * @brief Translate register bank result to simulation error code
+ */
+static simulation_error_t map_register_result(sim_register_result_t result) {
+  switch (result) {
+  case SIM_REG_OK:
+    return SIM_OK;
+  case SIM_REG_ERROR_READ_ONLY:
+    return SIM_ERROR_READ_ONLY;
+  case SIM_REG_ERROR_OUT_OF_RANGE:
+    return SIM_ERROR_INVALID_VALUE;
+  case SIM_REG_ERROR_UNDEFINED:
+  default:
+    return SIM_ERROR_INVALID_ADDR;
+  }
+}
+
+/**
+ * @brief Spawn the persistent Python simulator process
+ */
+static simulation_error_t coprocess_start(void) {
+  int to_child[2];
+  int from_child[2];
+
+  /* Test if Python script is accessible */
+  if (access(python_script_path, R_OK) != 0) {
+    return SIM_ERROR_NOT_INITIALIZED;
+  }
+
+  if (pipe(to_child) != 0) {
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+  if (pipe(from_child) != 0) {
+    close(to_child[0]);
+    close(to_child[1]);
     return SIM_ERROR_COMMAND_FAILED;
   }
 
-  if (fgets(output, output_size, pipe) == NULL) {
-    pclose(pipe);
+  pid_t pid = fork();
+  if (pid < 0) {
+    close(to_child[0]);
+    close(to_child[1]);
+    close(from_child[0]);
+    close(from_child[1]);
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+
+  if (pid == 0) {
+    dup2(to_child[0], STDIN_FILENO);
+    dup2(from_child[1], STDOUT_FILENO);
+    close(to_child[0]);
+    close(to_child[1]);
+    close(from_child[0]);
+    close(from_child[1]);
+    execlp("python3", "python3", "-u", "-c", coprocess_program,
+           l6470_schema_path, as5600_schema_path, (char *)NULL);
+    _exit(127);
+  }
+
+  close(to_child[0]);
+  close(from_child[1]);
+
+  coprocess.pid = pid;
+  coprocess.request = fdopen(to_child[1], "w");
+  coprocess.response = fdopen(from_child[0], "r");
+  if (!coprocess.request || !coprocess.response) {
+    coprocess_stop();
+    return SIM_ERROR_COMMAND_FAILED;
+  }
+
+  return SIM_OK;
+}
+
+/**
+ * @brief Terminate the Python simulator process
+ */
+static void coprocess_stop(void) {
+  if (coprocess.request) {
+    fclose(coprocess.request); /* EOF ends the request loop */
+    coprocess.request = NULL;
+  }
+  if (coprocess.response) {
+    fclose(coprocess.response);
+    coprocess.response = NULL;
+  }
+  if (coprocess.pid > 0) {
+    waitpid(coprocess.pid, NULL, 0);
+    coprocess.pid = -1;
+  }
+}
+
+/**
+ * @brief Send one request line to the co-process and read its reply
+ */
+static simulation_error_t coprocess_transact(const char *chip, const char *op,
+                                             uint32_t address, uint32_t value,
+                                             char *output,
+                                             size_t output_size) {
+  if (!coprocess.request || !coprocess.response) {
+    return SIM_ERROR_NOT_INITIALIZED;
+  }
+
+  if (fprintf(coprocess.request, "%s %s 0x%02X 0x%06X\n", chip, op,
+              (unsigned int)address, (unsigned int)value) < 0 ||
+      fflush(coprocess.request) != 0) {
     return SIM_ERROR_COMMAND_FAILED;
   }
 
-  pclose(pipe);
+  if (fgets(output, (int)output_size, coprocess.response) == NULL) {
+    return SIM_ERROR_COMMAND_FAILED;
+  }
 
   /* Remove trailing newline */
   size_t len = strlen(output);
@@ -370,7 +941,7 @@ execute_python_command(const char *command, char *output, size_t output_size) {
  */
 static simulation_error_t parse_register_response(const char *response,
                                                   uint32_t *value) {
-  if (!response || !value) {
+  if (!response || !value || strstr(response, "ERROR") != NULL) {
     return SIM_ERROR_COMMAND_FAILED;
   }
 
@@ -1,10 +1,13 @@
 /**
  * @file hardware_simulation.h
  * @brief Hardware simulation interface for safe development
- * @details Provides C interface to Python register simulation framework
+ * @details Provides C interface to the register simulation framework
  *
- * This header enables C code to interface with the Python simulation
- * framework for hardware-free testing and development.
+ * This header enables C code to run against simulated L6470/AS5600
+ * register maps for hardware-free testing and development. The default
+ * backend is an in-process register model loaded from the register
+ * schemas; the Python simulator can optionally be attached as a
+ * persistent co-process.
  *
  * @note Part of STM32H753ZI stepper motor control project
  * @author Generated by Phase 1B simulation framework
@@ -41,6 +44,12 @@ typedef enum {
   MOTOR_DECELERATING = 3  /**< Motor slowing down */
 } motor_state_t;
 
+/* Simulation Backend Types */
+typedef enum {
+  SIM_BACKEND_NATIVE = 0,          /**< In-process schema-driven model */
+  SIM_BACKEND_PYTHON_COPROCESS = 1 /**< Persistent Python simulator process */
+} simulation_backend_t;
+
 /* Simulation Status Structure */
 typedef struct {
   /* L6470 Motor Status */
@@ -83,6 +92,34 @@ simulation_error_t simulation_init(const char *l6470_schema_path,
  */
 void simulation_cleanup(void);
 
+/**
+ * @brief Select register backend (call before simulation_init)
+ * @param backend SIM_BACKEND_NATIVE (default) or SIM_BACKEND_PYTHON_COPROCESS
+ * @return SIM_OK on success, SIM_ERROR_COMMAND_FAILED if already initialized
+ * @note The co-process backend forwards register reads, writes and commands
+ *       to scripts/register_simulator.py over a pipe kept open for the
+ *       whole session. Control functions (linked motion, physics, time
+ *       advance, encoder angle and patterns) drive the native model only
+ *       and return SIM_ERROR_COMMAND_FAILED with the co-process backend;
+ *       simulation_get_status() reads the co-process registers.
+ */
+simulation_error_t simulation_set_backend(simulation_backend_t backend);
+
+/**
+ * @brief Get active register backend
+ * @return Selected backend
+ */
+simulation_backend_t simulation_get_backend(void);
+
+/**
+ * @brief Advance simulated time of the native model
+ * @param delta_time_ms Time step in milliseconds
+ * @return SIM_OK on success, error code otherwise
+ * @note Integrates motor position from the SPEED register while physics is
+ *       active and advances AS5600 angle patterns.
+ */
+simulation_error_t simulation_advance_time(uint32_t delta_time_ms);
+
 /**
  * @brief Read L6470 register
  * @param address Register address
@@ -8,6 +8,8 @@
 
 #include "motor_simulation.h"
 #include "config/motor_config.h"
+#include "drivers/as5600/as5600_driver.h"
+#include "drivers/l6470/l6470_driver.h"
 #include <math.h>
 #include <stdlib.h>
 #include <string.h>
@@ -60,8 +62,11 @@ bool motor_simulation_init(SimulationMode_t mode) {
     motor->target_position = 0;
     motor->current_speed = 0.0f;
     motor->target_speed = 0.0f;
-    motor->acceleration = 1000.0f; // steps/s²
-    motor->deceleration = 1000.0f; // steps/s²
+    // steps/s², matching the ACC/DEC register defaults below
+    motor->acceleration =
+        (float)l6470_acc_decode(L6470_SAFE_DEFAULT_ACC) * 1e-3f;
+    motor->deceleration =
+        (float)l6470_dec_decode(L6470_SAFE_DEFAULT_DEC) * 1e-3f;
     motor->motion_state = SIM_MOTOR_STOPPED;
     motor->status_register = L6470_STATUS_HIZ; // Start in high-Z state
     motor->busy = false;
@@ -182,13 +187,12 @@ bool l6470_sim_write_register(uint8_t motor_id, uint8_t reg_addr,
   // Update simulation parameters based on register writes
   switch (reg_addr) {
   case L6470_REG_ACC:
-    motor->acceleration =
-        (float)value * 250e-9f * powf(2, 40); // Convert to steps/s²
+    // Register value to steps/s² (decoder works in milli-steps)
+    motor->acceleration = (float)l6470_acc_decode(value) * 1e-3f;
     break;
 
   case L6470_REG_DEC:
-    motor->deceleration =
-        (float)value * 250e-9f * powf(2, 40); // Convert to steps/s²
+    motor->deceleration = (float)l6470_dec_decode(value) * 1e-3f;
     break;
 
   case L6470_REG_ABS_POS:
@@ -218,7 +222,7 @@ bool l6470_sim_read_register(uint8_t motor_id, uint8_t reg_addr,
     break;
 
   case L6470_REG_SPEED:
-    *value = (uint32_t)(motor->current_speed / (250e-9f * powf(2, 28)));
+    *value = l6470_speed_encode((uint32_t)(motor->current_speed * 1000.0f));
     break;
 
   case L6470_REG_STATUS:
@@ -247,14 +251,15 @@ bool l6470_sim_execute_command(uint8_t motor_id, uint8_t command,
   motor->command_count++;
   g_simulation.total_commands++;
 
-  // Extract base command (remove parameter bits)
-  uint8_t base_command = command & 0xF0;
+  // Extract base command (remove the direction bits; 0xF0 would fold
+  // HARD_STOP into SOFT_STOP and lose RESET_POS)
+  uint8_t base_command = command & 0xF8;
 
   switch (base_command) {
   case L6470_CMD_RUN:
     motor->direction = (command & 0x01) != 0;
     motor->target_speed =
-        (float)parameter * 250e-9f * powf(2, 28); // Convert to steps/s
+        (float)l6470_speed_decode(parameter) * 1e-3f; // steps/s
     motor->motion_state = SIM_MOTOR_ACCELERATING;
     motor->busy = true;
     motor->status_register &= ~L6470_STATUS_HIZ;
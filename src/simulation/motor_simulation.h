@@ -18,6 +18,7 @@
 #define MOTOR_SIMULATION_H
 
 #include "as5600_registers_generated.h"
+#include "config/motor_config.h" // system_config.h checks its loop rates
 #include "l6470_registers_generated.h"
 #include "system_config.h"
 #include <stdbool.h>
@@ -0,0 +1,234 @@
+/**
+ * @file sim_register_model.c
+ * @brief Schema-driven in-process register bank implementation
+ * @details Minimal line-oriented reader for the register schema layout in
+ * schemas/<chip>_registers.yaml: a top-level "registers:" map whose
+ * entries (indent 2) carry address/mask/access/default/valid_range keys
+ * (indent 4). Nested "fields:" blocks are skipped; they are only used by
+ * the header generator.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "sim_register_model.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Private Definitions */
+#define SCHEMA_LINE_MAX 256
+#define SCHEMA_REGISTER_INDENT 2
+#define SCHEMA_PROPERTY_INDENT 4
+
+/* Private Types */
+typedef struct {
+  bool has_address;
+  uint8_t address;
+  sim_register_desc_t desc;
+} schema_entry_t;
+
+/* Private Functions */
+static size_t schema_indent(const char *line);
+static bool schema_key_matches(const char *text, const char *key,
+                               const char **value);
+static void schema_commit_entry(sim_register_bank_t *bank,
+                                schema_entry_t *entry);
+
+/**
+ * @brief Load register descriptors from a YAML register schema
+ */
+bool sim_register_bank_load_schema(sim_register_bank_t *bank,
+                                   const char *schema_path) {
+  if (!bank || !schema_path) {
+    return false;
+  }
+
+  FILE *schema = fopen(schema_path, "r");
+  if (!schema) {
+    return false;
+  }
+
+  memset(bank, 0, sizeof(*bank));
+
+  char line[SCHEMA_LINE_MAX];
+  bool in_registers = false;
+  schema_entry_t entry;
+  memset(&entry, 0, sizeof(entry));
+
+  while (fgets(line, sizeof(line), schema) != NULL) {
+    size_t indent = schema_indent(line);
+    const char *text = line + indent;
+
+    /* Skip blank lines and comments */
+    if (*text == '\0' || *text == '\n' || *text == '\r' || *text == '#') {
+      continue;
+    }
+
+    if (indent == 0) {
+      /* Top-level key: enter or leave the registers section */
+      schema_commit_entry(bank, &entry);
+      in_registers = (strncmp(text, "registers:", 10) == 0);
+      continue;
+    }
+
+    if (!in_registers) {
+      continue;
+    }
+
+    if (indent == SCHEMA_REGISTER_INDENT) {
+      /* New register entry ("  NAME:") */
+      schema_commit_entry(bank, &entry);
+      entry.desc.mask = 0xFFFFFFFFU;
+      continue;
+    }
+
+    if (indent != SCHEMA_PROPERTY_INDENT) {
+      continue; /* Nested fields/values blocks */
+    }
+
+    const char *value;
+    if (schema_key_matches(text, "address:", &value)) {
+      entry.address = (uint8_t)strtoul(value, NULL, 0);
+      entry.has_address = true;
+    } else if (schema_key_matches(text, "mask:", &value)) {
+      entry.desc.mask = (uint32_t)strtoul(value, NULL, 0);
+    } else if (schema_key_matches(text, "default:", &value)) {
+      entry.desc.reset_value = (uint32_t)strtoul(value, NULL, 0);
+    } else if (schema_key_matches(text, "access:", &value)) {
+      entry.desc.read_only = (strstr(value, "read_only") != NULL);
+    } else if (schema_key_matches(text, "valid_range:", &value)) {
+      const char *cursor = strchr(value, '[');
+      char *end = NULL;
+      if (cursor) {
+        entry.desc.range_min = (uint32_t)strtoul(cursor + 1, &end, 0);
+        cursor = end ? strchr(end, ',') : NULL;
+        if (cursor) {
+          entry.desc.range_max = (uint32_t)strtoul(cursor + 1, NULL, 0);
+          entry.desc.has_range = true;
+        }
+      }
+    }
+  }
+
+  schema_commit_entry(bank, &entry);
+  fclose(schema);
+
+  return bank->register_count > 0;
+}
+
+/**
+ * @brief Reset all register values to their schema defaults
+ */
+void sim_register_bank_reset(sim_register_bank_t *bank) {
+  if (!bank) {
+    return;
+  }
+
+  for (uint16_t addr = 0; addr < SIM_REGISTER_SPACE_SIZE; addr++) {
+    bank->value[addr] =
+        bank->desc[addr].defined
+            ? (bank->desc[addr].reset_value & bank->desc[addr].mask)
+            : 0U;
+  }
+}
+
+/**
+ * @brief Read register value
+ */
+sim_register_result_t sim_register_bank_read(const sim_register_bank_t *bank,
+                                             uint8_t address,
+                                             uint32_t *value) {
+  if (!bank || !value || !bank->desc[address].defined) {
+    return SIM_REG_ERROR_UNDEFINED;
+  }
+
+  *value = bank->value[address];
+  return SIM_REG_OK;
+}
+
+/**
+ * @brief Write register value with schema access rules
+ */
+sim_register_result_t sim_register_bank_write(sim_register_bank_t *bank,
+                                              uint8_t address,
+                                              uint32_t value) {
+  if (!bank || !bank->desc[address].defined) {
+    return SIM_REG_ERROR_UNDEFINED;
+  }
+
+  const sim_register_desc_t *desc = &bank->desc[address];
+  if (desc->read_only) {
+    return SIM_REG_ERROR_READ_ONLY;
+  }
+
+  if ((value & ~desc->mask) != 0U) {
+    return SIM_REG_ERROR_OUT_OF_RANGE;
+  }
+
+  if (desc->has_range &&
+      (value < desc->range_min || value > desc->range_max)) {
+    return SIM_REG_ERROR_OUT_OF_RANGE;
+  }
+
+  bank->value[address] = value;
+  return SIM_REG_OK;
+}
+
+/**
+ * @brief Update register value from the device side
+ */
+void sim_register_bank_poke(sim_register_bank_t *bank, uint8_t address,
+                            uint32_t value) {
+  if (!bank || !bank->desc[address].defined) {
+    return;
+  }
+
+  bank->value[address] = value & bank->desc[address].mask;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Count leading spaces of a schema line
+ */
+static size_t schema_indent(const char *line) {
+  size_t indent = 0;
+  while (line[indent] == ' ') {
+    indent++;
+  }
+  return indent;
+}
+
+/**
+ * @brief Match "key:" prefix and return pointer to its value text
+ */
+static bool schema_key_matches(const char *text, const char *key,
+                               const char **value) {
+  size_t key_len = strlen(key);
+  if (strncmp(text, key, key_len) != 0) {
+    return false;
+  }
+
+  *value = text + key_len;
+  while (**value == ' ') {
+    (*value)++;
+  }
+  return true;
+}
+
+/**
+ * @brief Store a completed schema entry into the bank
+ */
+static void schema_commit_entry(sim_register_bank_t *bank,
+                                schema_entry_t *entry) {
+  if (entry->has_address) {
+    sim_register_desc_t *desc = &bank->desc[entry->address];
+    *desc = entry->desc;
+    desc->defined = true;
+    bank->value[entry->address] = desc->reset_value & desc->mask;
+    bank->register_count++;
+  }
+
+  memset(entry, 0, sizeof(*entry));
+}
@@ -0,0 +1,102 @@
+/**
+ * @file sim_register_model.h
+ * @brief Schema-driven in-process register bank for hardware simulation
+ * @details Loads register descriptors (address, mask, access, default,
+ * valid range) from the same YAML schemas used by the header generator
+ * and serves register accesses from memory.
+ *
+ * This replaces the per-access Python subprocess bridge as the default
+ * backend of hardware_simulation.c.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#ifndef SIM_REGISTER_MODEL_H
+#define SIM_REGISTER_MODEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Register bank configuration */
+#define SIM_REGISTER_SPACE_SIZE 256 /**< 8-bit register address space */
+
+/* Register access result */
+typedef enum {
+  SIM_REG_OK = 0,            /**< Access successful */
+  SIM_REG_ERROR_UNDEFINED,   /**< Address not present in schema */
+  SIM_REG_ERROR_READ_ONLY,   /**< Write to read-only register */
+  SIM_REG_ERROR_OUT_OF_RANGE /**< Value outside schema valid_range */
+} sim_register_result_t;
+
+/* Register descriptor loaded from schema */
+typedef struct {
+  bool defined;         /**< Register present in schema */
+  bool read_only;       /**< access: "read_only" */
+  bool has_range;       /**< valid_range present */
+  uint32_t mask;        /**< Register value mask */
+  uint32_t reset_value; /**< Schema default (power-on value) */
+  uint32_t range_min;   /**< Lower bound of valid_range */
+  uint32_t range_max;   /**< Upper bound of valid_range */
+} sim_register_desc_t;
+
+/* Register bank: descriptors plus live values, indexed by address */
+typedef struct {
+  sim_register_desc_t desc[SIM_REGISTER_SPACE_SIZE];
+  uint32_t value[SIM_REGISTER_SPACE_SIZE];
+  uint16_t register_count; /**< Number of registers loaded */
+} sim_register_bank_t;
+
+/**
+ * @brief Load register descriptors from a YAML register schema
+ * @param bank Register bank to populate (values reset to schema defaults)
+ * @param schema_path Path to schemas/<chip>_registers.yaml
+ * @return true if at least one register was loaded
+ */
+bool sim_register_bank_load_schema(sim_register_bank_t *bank,
+                                   const char *schema_path);
+
+/**
+ * @brief Reset all register values to their schema defaults
+ * @param bank Register bank
+ */
+void sim_register_bank_reset(sim_register_bank_t *bank);
+
+/**
+ * @brief Read register value as seen by the bus master
+ * @param bank Register bank
+ * @param address Register address
+ * @param value Pointer to store value
+ * @return SIM_REG_OK on success
+ */
+sim_register_result_t sim_register_bank_read(const sim_register_bank_t *bank,
+                                             uint8_t address, uint32_t *value);
+
+/**
+ * @brief Write register value from the bus master (access rules enforced)
+ * @param bank Register bank
+ * @param address Register address
+ * @param value Value to write
+ * @return SIM_REG_OK on success
+ */
+sim_register_result_t sim_register_bank_write(sim_register_bank_t *bank,
+                                              uint8_t address, uint32_t value);
+
+/**
+ * @brief Update register value from the device side (ignores access rules)
+ * @param bank Register bank
+ * @param address Register address
+ * @param value New value (masked to register width)
+ */
+void sim_register_bank_poke(sim_register_bank_t *bank, uint8_t address,
+                            uint32_t value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SIM_REGISTER_MODEL_H */
@@ -0,0 +1,225 @@
+/**
+ * @file virtual_time.c
+ * @brief Virtual-time lockstep kernel implementation
+ * @details Time is kept as an integer microsecond count so dispatch order
+ * never depends on floating-point rounding or on the host's wall clock.
+ * The next release is found by a linear scan; with at most
+ * VIRTUAL_TIME_MAX_TASKS tasks this is cheaper than maintaining a queue.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "virtual_time.h"
+#include <string.h>
+
+/* Private Types */
+typedef struct {
+  bool active;
+  bool running; /**< Task is on the call stack (nested wait) */
+  char name[VIRTUAL_TIME_TASK_NAME_MAX];
+  uint32_t period_us;
+  uint64_t next_release_us;
+  uint64_t dispatch_count;
+  virtual_time_task_fn_t function;
+  void *context;
+} virtual_time_task_t;
+
+typedef struct {
+  uint64_t now_us;
+  uint64_t dispatched_events;
+  uint64_t waits;
+  uint8_t task_count;
+  virtual_time_task_t tasks[VIRTUAL_TIME_MAX_TASKS];
+  virtual_time_clock_sink_t clock_sink;
+} virtual_time_kernel_t;
+
+/* Private Variables */
+static virtual_time_kernel_t kernel;
+
+/* Private Functions */
+static void set_time(uint64_t time_us);
+static int next_due_task(uint64_t limit_us);
+static void dispatch_task(virtual_time_task_t *task);
+
+/**
+ * @brief Reset simulated time to zero and remove all tasks
+ */
+void virtual_time_reset(void) {
+  virtual_time_clock_sink_t sink = kernel.clock_sink;
+
+  memset(&kernel, 0, sizeof(kernel));
+  kernel.clock_sink = sink;
+  set_time(0);
+}
+
+/**
+ * @brief Register a periodic task
+ */
+int virtual_time_add_task(const char *name, uint32_t period_us,
+                          uint32_t offset_us, virtual_time_task_fn_t function,
+                          void *context) {
+  if (period_us == 0 || function == NULL ||
+      kernel.task_count >= VIRTUAL_TIME_MAX_TASKS) {
+    return -1;
+  }
+
+  int task_id = kernel.task_count;
+  virtual_time_task_t *task = &kernel.tasks[task_id];
+
+  memset(task, 0, sizeof(*task));
+  task->active = true;
+  task->period_us = period_us;
+  task->next_release_us = kernel.now_us + offset_us;
+  task->function = function;
+  task->context = context;
+  if (name) {
+    strncpy(task->name, name, VIRTUAL_TIME_TASK_NAME_MAX - 1);
+  }
+
+  kernel.task_count++;
+  return task_id;
+}
+
+/**
+ * @brief Install the simulated clock sink
+ */
+void virtual_time_set_clock_sink(virtual_time_clock_sink_t sink) {
+  kernel.clock_sink = sink;
+  if (sink) {
+    sink(kernel.now_us);
+  }
+}
+
+/**
+ * @brief Current simulated time in microseconds
+ */
+uint64_t virtual_time_now_us(void) { return kernel.now_us; }
+
+/**
+ * @brief Current simulated time in milliseconds
+ */
+uint32_t virtual_time_now_ms(void) { return (uint32_t)(kernel.now_us / 1000U); }
+
+/**
+ * @brief Dispatch all task releases up to and including an absolute time
+ */
+void virtual_time_run_until(uint64_t time_us) {
+  if (time_us < kernel.now_us) {
+    return;
+  }
+
+  int task_id;
+  while ((task_id = next_due_task(time_us)) >= 0) {
+    virtual_time_task_t *task = &kernel.tasks[task_id];
+
+    /* A release missed during a nested wait runs late, never in the past */
+    if (task->next_release_us > kernel.now_us) {
+      set_time(task->next_release_us);
+    }
+    dispatch_task(task);
+  }
+
+  if (time_us > kernel.now_us) {
+    set_time(time_us);
+  }
+}
+
+/**
+ * @brief Advance simulated time by a duration, dispatching due tasks
+ */
+void virtual_time_run_for(uint64_t duration_us) {
+  virtual_time_run_until(kernel.now_us + duration_us);
+}
+
+/**
+ * @brief Block the calling code for a simulated duration
+ */
+void virtual_time_wait(uint32_t delay_us) {
+  kernel.waits++;
+  virtual_time_run_until(kernel.now_us + delay_us);
+}
+
+/**
+ * @brief Get kernel statistics
+ */
+void virtual_time_get_stats(virtual_time_stats_t *stats) {
+  if (!stats) {
+    return;
+  }
+
+  stats->now_us = kernel.now_us;
+  stats->dispatched_events = kernel.dispatched_events;
+  stats->waits = kernel.waits;
+  stats->task_count = kernel.task_count;
+}
+
+/**
+ * @brief Get dispatch statistics of one task
+ */
+bool virtual_time_get_task_stats(int task_id,
+                                 virtual_time_task_stats_t *stats) {
+  if (!stats || task_id < 0 || task_id >= kernel.task_count) {
+    return false;
+  }
+
+  const virtual_time_task_t *task = &kernel.tasks[task_id];
+  memcpy(stats->name, task->name, sizeof(stats->name));
+  stats->period_us = task->period_us;
+  stats->next_release_us = task->next_release_us;
+  stats->dispatch_count = task->dispatch_count;
+  return true;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Move simulated time and notify the clock sink
+ */
+static void set_time(uint64_t time_us) {
+  kernel.now_us = time_us;
+  if (kernel.clock_sink) {
+    kernel.clock_sink(time_us);
+  }
+}
+
+/**
+ * @brief Find the earliest release at or before limit_us
+ * @return Task id, or -1 if none is due; ties go to the lowest id
+ */
+static int next_due_task(uint64_t limit_us) {
+  int due = -1;
+  uint64_t earliest = limit_us;
+
+  for (int i = 0; i < kernel.task_count; i++) {
+    const virtual_time_task_t *task = &kernel.tasks[i];
+    if (!task->active || task->running) {
+      continue;
+    }
+    if (task->next_release_us < earliest ||
+        (due < 0 && task->next_release_us == earliest)) {
+      earliest = task->next_release_us;
+      due = i;
+    }
+  }
+
+  return due;
+}
+
+/**
+ * @brief Run one task release and schedule the next one
+ */
+static void dispatch_task(virtual_time_task_t *task) {
+  task->running = true;
+  task->function(task->context);
+  task->running = false;
+
+  task->dispatch_count++;
+  kernel.dispatched_events++;
+
+  /* Releases that fell entirely inside a nested wait are dropped, like a
+   * timer interrupt that stays pending only once */
+  do {
+    task->next_release_us += task->period_us;
+  } while (task->next_release_us <= kernel.now_us);
+}
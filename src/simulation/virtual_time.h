@@ -0,0 +1,139 @@
+/**
+ * @file virtual_time.h
+ * @brief Virtual-time lockstep kernel for host-side simulation
+ * @details Owns simulated time for host runs and dispatches periodic tasks
+ * (control loop, safety monitor, plant update) in a fixed, reproducible
+ * order. Time only moves when the kernel is told to run, so a simulated
+ * hour completes as fast as the tasks execute and every run of the same
+ * scenario produces identical results.
+ *
+ * Typical lockstep wiring on the host:
+ *   - clock sink: MockHAL_SetVirtualTime() so HAL_Abstraction_GetTick(),
+ *     HAL_Abstraction_GetMicroseconds() and the telemetry timer follow
+ *     simulated time
+ *   - delay hook: MockHAL_SetDelayHook(virtual_time_wait) so blocking
+ *     waits (HAL_Abstraction_Delay*) advance simulated time instead of
+ *     spinning
+ *   - tasks: safety monitor at 100 us, control loop at 1000 us, plant
+ *     (simulation_advance_time / motor_simulation_update) at 1000 us
+ *
+ * Tasks released at the same instant run in registration order, so
+ * register higher-priority handlers first.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#ifndef VIRTUAL_TIME_H
+#define VIRTUAL_TIME_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* Kernel configuration */
+#define VIRTUAL_TIME_MAX_TASKS 8      /**< Periodic task slots */
+#define VIRTUAL_TIME_TASK_NAME_MAX 16 /**< Task name length incl. NUL */
+
+/* Periodic task entry point */
+typedef void (*virtual_time_task_fn_t)(void *context);
+
+/* Called with the new simulated time before tasks at that instant run */
+typedef void (*virtual_time_clock_sink_t)(uint64_t now_us);
+
+/* Per-task dispatch statistics */
+typedef struct {
+  char name[VIRTUAL_TIME_TASK_NAME_MAX]; /**< Task name */
+  uint32_t period_us;                    /**< Release period */
+  uint64_t next_release_us;              /**< Next release time */
+  uint64_t dispatch_count;               /**< Number of dispatches */
+} virtual_time_task_stats_t;
+
+/* Kernel statistics */
+typedef struct {
+  uint64_t now_us;            /**< Current simulated time */
+  uint64_t dispatched_events; /**< Total task dispatches */
+  uint64_t waits;             /**< virtual_time_wait() calls */
+  uint8_t task_count;         /**< Registered tasks */
+} virtual_time_stats_t;
+
+/**
+ * @brief Reset simulated time to zero and remove all tasks
+ * @note The clock sink is kept and notified of time zero
+ */
+void virtual_time_reset(void);
+
+/**
+ * @brief Register a periodic task
+ * @param name Task name (truncated to VIRTUAL_TIME_TASK_NAME_MAX - 1)
+ * @param period_us Release period in microseconds (non-zero)
+ * @param offset_us First release relative to the current simulated time
+ * @param function Task entry point
+ * @param context Opaque pointer passed to the task
+ * @return Task id, or -1 if no slot is free or parameters are invalid
+ */
+int virtual_time_add_task(const char *name, uint32_t period_us,
+                          uint32_t offset_us, virtual_time_task_fn_t function,
+                          void *context);
+
+/**
+ * @brief Install the simulated clock sink (NULL to detach)
+ * @param sink Function receiving every time update
+ */
+void virtual_time_set_clock_sink(virtual_time_clock_sink_t sink);
+
+/**
+ * @brief Current simulated time in microseconds
+ */
+uint64_t virtual_time_now_us(void);
+
+/**
+ * @brief Current simulated time in milliseconds
+ */
+uint32_t virtual_time_now_ms(void);
+
+/**
+ * @brief Dispatch all task releases up to and including an absolute time
+ * @param time_us Absolute simulated time to stop at
+ * @note Does nothing if time_us is in the past
+ */
+void virtual_time_run_until(uint64_t time_us);
+
+/**
+ * @brief Advance simulated time by a duration, dispatching due tasks
+ * @param duration_us Duration in microseconds
+ */
+void virtual_time_run_for(uint64_t duration_us);
+
+/**
+ * @brief Block the calling code for a simulated duration
+ * @param delay_us Delay in microseconds
+ * @details Intended as the HAL delay hook. When called from inside a task
+ *          the other tasks keep being released while the caller waits;
+ *          the waiting task itself is not re-entered.
+ */
+void virtual_time_wait(uint32_t delay_us);
+
+/**
+ * @brief Get kernel statistics
+ * @param stats Pointer to statistics structure
+ */
+void virtual_time_get_stats(virtual_time_stats_t *stats);
+
+/**
+ * @brief Get dispatch statistics of one task
+ * @param task_id Id returned by virtual_time_add_task()
+ * @param stats Pointer to statistics structure
+ * @return true if task_id is valid
+ */
+bool virtual_time_get_task_stats(int task_id,
+                                 virtual_time_task_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* VIRTUAL_TIME_H */
@@ -18,6 +18,7 @@
 
 #include "optimization_telemetry.h"
 #include "common/system_state.h"
+#include "communication/crc16.h"
 #include "config/hardware_config.h"
 #include "config/telemetry_config.h" // SSOT: All telemetry config here
 #include "hal_abstraction.h"
@@ -56,11 +57,6 @@ static FILE *host_safe_fopen(const char *path, const char *mode) {
 }
 #endif
 
-/* Provide a portable no-op for assembly NOP when building for host tests */
-#ifndef __NOP
-#define __NOP() ((void)0)
-#endif
-
 // ================================================================================================
 // PRIVATE DATA STRUCTURES AND CONSTANTS
 // ================================================================================================
@@ -444,12 +440,10 @@ SystemError_t optimization_telemetry_collect_dataset(
         sample_index++;
         uint32_t now = telemetry_get_microsecond_timer();
         uint32_t elapsed = now - start_time_us;
-        if (elapsed < sample_interval_us * sample_index) {
-            // Busy-wait for precise timing
-            while ((telemetry_get_microsecond_timer() - start_time_us) <
-                   sample_interval_us * sample_index) {
-                __NOP();
-            }
+        uint32_t next_sample_us = sample_interval_us * sample_index;
+        if (elapsed < next_sample_us) {
+            // Wait through the HAL so simulated time can advance on host
+            HAL_Abstraction_DelayMicroseconds(next_sample_us - elapsed);
         }
     }
     dataset->sample_count = sample_index;
@@ -523,6 +517,7 @@ static SystemError_t telemetry_read_as5600_burst(uint8_t motor_id,
                                                  float *velocity_dps,
                                                  float *acceleration_dps2) {
     TelemetryContext_t *context = &telemetry_contexts[motor_id];
+    // One AS5600 burst (status + angle); fails when the magnet is lost
     SystemError_t result =
         HAL_Abstraction_AS5600_ReadAngle(motor_id, position_degrees);
     if (result != SYSTEM_OK)
@@ -664,24 +659,20 @@ static uint32_t telemetry_get_microsecond_timer(void) {
 
 static uint32_t
 telemetry_calculate_checksum(const CharacterizationDataSet_t *dataset) {
-    uint32_t checksum = 0;
-    checksum ^= dataset->sample_count;
-    checksum ^= dataset->sample_rate_hz;
-    checksum ^= dataset->test_duration_ms;
-    checksum ^= (uint32_t)dataset->test_type;
-    checksum ^= dataset->motor_id;
-    if (dataset->sample_count > 0) {
-        checksum ^= (uint32_t)(dataset->samples[0].position_degrees * 1000.0f);
-        checksum ^= dataset->samples[0].timestamp_us;
-        if (dataset->sample_count > 1) {
-            uint32_t last_idx = dataset->sample_count - 1;
-            checksum ^=
-                (uint32_t)(dataset->samples[last_idx].position_degrees *
-                           1000.0f);
-            checksum ^= dataset->samples[last_idx].timestamp_us;
-        }
-    }
-    return checksum;
+    // CRC16 over every collected sample plus the identifying metadata
+    uint16_t crc = crc16_init();
+    crc = crc16_update(crc, (const uint8_t *)dataset->samples,
+                       dataset->sample_count * sizeof(dataset->samples[0]));
+    crc = crc16_update(crc, (const uint8_t *)&dataset->sample_count,
+                       sizeof(dataset->sample_count));
+    crc = crc16_update(crc, (const uint8_t *)&dataset->sample_rate_hz,
+                       sizeof(dataset->sample_rate_hz));
+    crc = crc16_update(crc, (const uint8_t *)&dataset->test_duration_ms,
+                       sizeof(dataset->test_duration_ms));
+    crc = crc16_update(crc, (const uint8_t *)&dataset->test_type,
+                       sizeof(dataset->test_type));
+    crc = crc16_update(crc, &dataset->motor_id, sizeof(dataset->motor_id));
+    return crc16_final(crc);
 }
 
 static void telemetry_update_performance_metrics(TelemetryContext_t *context,
@@ -0,0 +1,507 @@
+/**
+ * @file bench_comm_transport.c
+ * @brief Command throughput, latency and CPU cost of the protocol stack
+ * @details Runs communication/comm_protocol.c unchanged on the host
+ * transport (simulation/comm_host_transport.c) in a firmware thread that
+ * alternates comm_host_transport_poll() and comm_protocol_task(), as the
+ * communication task does on target. The main thread is the client and
+ * sends STOP commands over each path:
+ *   - ASCII:  "STOP 0" lines on the UART; done when the "OK" reply is read
+ *   - binary: MessageHeader_t + MotorCommand_t frames on the UART
+ *   - CAN:    CAN_ID_STOP_COMMAND frames
+ * Binary and CAN commands have no reply, so they count as done when the
+ * motor controller (stubbed here) executes them.
+ *
+ * Per path it reports:
+ *   - commands/s with BENCH_WINDOW commands in flight (the CAN route queue
+ *     depth, so no path is measured past the point where CAN drops)
+ *   - latency percentiles, one command in flight: send to reply (ASCII)
+ *     or to execution (binary, CAN), through the kernel sockets
+ *   - firmware thread CPU time per command, transport included
+ *
+ * The controller, safety and fault monitor calls are stubbed so that only
+ * the communication path is measured. Time is the host monotonic clock,
+ * so CAN telemetry and time sync frames go out at their real rates.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "communication/comm_can_rx.h"
+#include "communication/comm_frame_decoder.h"
+#include "communication/comm_protocol.h"
+#include "controllers/motion_lookahead.h"
+#include "controllers/motion_profile.h"
+#include "controllers/motion_pvt.h"
+#include "controllers/motor_controller.h"
+#include "controllers/multi_motor_coordinator.h"
+#include "controllers/position_control.h"
+#include "controllers/position_safety.h"
+#include "hal_abstraction/hal_abstraction.h"
+#include "safety/fault_monitor.h"
+#include "simulation/comm_host_transport.h"
+#include <poll.h>
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <time.h>
+
+/* Benchmark Configuration */
+#define BENCH_COMMANDS 20000
+#define BENCH_WARMUP 1000
+#define BENCH_WINDOW COMM_CAN_RX_QUEUE_DEPTH
+#define BENCH_POLL_TIMEOUT_MS 1
+#define BENCH_REPLY_TIMEOUT_MS 1000
+
+/* Private Types */
+typedef struct {
+  const char *name;
+  CommProtocol_t protocol;
+  bool replies; /**< Completion is the ASCII reply line */
+  int fd;
+  const void *message;
+  size_t length;
+} bench_path_t;
+
+typedef struct {
+  double commands_per_s;
+  double p50_us;
+  double p90_us;
+  double p99_us;
+  double max_us;
+  double cpu_us_per_msg;
+} bench_result_t;
+
+/* Private Variables */
+static UART_HandleTypeDef huart;
+static FDCAN_HandleTypeDef hfdcan;
+static comm_host_transport_peer_t peer;
+static uint32_t executed;         /**< STOP commands run by the stub */
+static bool firmware_running;     /**< Firmware thread keeps polling */
+static uint64_t firmware_cpu_ns;  /**< Firmware thread CPU time */
+static uint32_t replies_read;     /**< ASCII reply lines seen */
+static double latency_us[BENCH_COMMANDS];
+
+/* Private Functions */
+static double elapsed_us(const struct timespec *start,
+                         const struct timespec *end);
+static void *firmware_thread(void *arg);
+static void send_message(const bench_path_t *path);
+static uint32_t completed(const bench_path_t *path);
+static bool wait_completed(const bench_path_t *path, uint32_t target);
+static void drain_can(void);
+static void drain_uart(void);
+static int compare_double(const void *a, const void *b);
+static bool run_path(const bench_path_t *path, bench_result_t *result);
+
+/**
+ * @brief Benchmark entry point
+ */
+int main(void) {
+  static const char ascii_stop[] = "STOP 0\r\n";
+  static uint8_t binary_stop[sizeof(MessageHeader_t) +
+                             sizeof(MotorCommand_t)];
+  CommCanFrame_t can_stop = {.id = CAN_ID_STOP_COMMAND, .length = 8U};
+  bool ok = true;
+
+  MotorCommand_t command = {.motor_id = 0, .command = MOTOR_CMD_STOP};
+  MessageHeader_t header = {.magic = MESSAGE_HEADER_MAGIC,
+                            .payload_length = sizeof(command),
+                            .protocol_type = PROTOCOL_UART_BINARY};
+  header.checksum = comm_frame_checksum((const uint8_t *)&header,
+                                        (const uint8_t *)&command,
+                                        sizeof(command));
+  memcpy(binary_stop, &header, sizeof(header));
+  memcpy(binary_stop + sizeof(header), &command, sizeof(command));
+
+  if (comm_protocol_init() != SYSTEM_OK ||
+      comm_host_transport_open(&huart, &hfdcan, &peer) != SIM_OK ||
+      comm_uart_init(&huart, PROTOCOL_UART_ASCII) != SYSTEM_OK ||
+      comm_can_init(&hfdcan) != SYSTEM_OK) {
+    printf("Host transport setup failed\n");
+    return 1;
+  }
+
+  const bench_path_t paths[] = {
+      {"ASCII", PROTOCOL_UART_ASCII, true, peer.uart_fd, ascii_stop,
+       sizeof(ascii_stop) - 1U},
+      {"binary", PROTOCOL_UART_BINARY, false, peer.uart_fd, binary_stop,
+       sizeof(binary_stop)},
+      {"CAN", PROTOCOL_CAN_MOTOR, false, peer.can_fd, &can_stop,
+       sizeof(can_stop)},
+  };
+
+  printf("Host Transport Command Benchmark\n");
+  printf("================================\n");
+  printf("%d commands per path, %d in flight for throughput\n\n",
+         BENCH_COMMANDS, BENCH_WINDOW);
+  printf("%-8s %12s %9s %9s %9s %9s %12s\n", "Path", "commands/s",
+         "p50 us", "p90 us", "p99 us", "max us", "CPU us/msg");
+
+  for (size_t i = 0; i < sizeof(paths) / sizeof(paths[0]); i++) {
+    bench_result_t result;
+    if (!run_path(&paths[i], &result)) {
+      printf("%-8s commands lost or timed out\n", paths[i].name);
+      ok = false;
+      continue;
+    }
+    printf("%-8s %12.0f %9.1f %9.1f %9.1f %9.1f %12.2f\n", paths[i].name,
+           result.commands_per_s, result.p50_us, result.p90_us,
+           result.p99_us, result.max_us, result.cpu_us_per_msg);
+  }
+
+  comm_host_transport_stats_t stats;
+  comm_host_transport_get_stats(&stats);
+  printf("\nTransport: %llu UART bytes in, %llu out; %u CAN frames in, "
+         "%u out, %u rejected\n",
+         (unsigned long long)stats.uart_rx_bytes,
+         (unsigned long long)stats.uart_tx_bytes, stats.can_rx_frames,
+         stats.can_tx_frames, stats.can_rejected);
+
+  comm_host_transport_close();
+  return ok ? 0 : 1;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Microseconds between two timestamps
+ */
+static double elapsed_us(const struct timespec *start,
+                         const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) * 1e6 +
+         (double)(end->tv_nsec - start->tv_nsec) * 1e-3;
+}
+
+/**
+ * @brief Communication task: interrupts, then the protocol task
+ */
+static void *firmware_thread(void *arg) {
+  struct timespec start;
+  struct timespec end;
+  (void)arg;
+
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &start);
+  while (__atomic_load_n(&firmware_running, __ATOMIC_ACQUIRE)) {
+    comm_host_transport_poll(BENCH_POLL_TIMEOUT_MS);
+    comm_protocol_task();
+  }
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &end);
+
+  firmware_cpu_ns = (uint64_t)(elapsed_us(&start, &end) * 1e3);
+  return NULL;
+}
+
+/**
+ * @brief Send one command on a path
+ */
+static void send_message(const bench_path_t *path) {
+  size_t sent = 0;
+
+  while (sent < path->length) {
+    ssize_t n = send(path->fd, (const uint8_t *)path->message + sent,
+                     path->length - sent, MSG_NOSIGNAL);
+    if (n <= 0) {
+      return;
+    }
+    sent += (size_t)n;
+  }
+}
+
+/**
+ * @brief Commands of a path completed so far
+ */
+static uint32_t completed(const bench_path_t *path) {
+  if (path->replies) {
+    drain_uart();
+    return replies_read;
+  }
+  return __atomic_load_n(&executed, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Wait until a path has completed a number of commands
+ * @return false on timeout
+ */
+static bool wait_completed(const bench_path_t *path, uint32_t target) {
+  struct timespec start;
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (;;) {
+    drain_can();
+    if ((int32_t)(completed(path) - target) >= 0) {
+      return true;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    if (elapsed_us(&start, &now) > BENCH_REPLY_TIMEOUT_MS * 1e3) {
+      return false;
+    }
+
+    if (path->replies) {
+      struct pollfd fd = {.fd = peer.uart_fd, .events = POLLIN};
+      (void)poll(&fd, 1, 1);
+    } else {
+      sched_yield();
+    }
+  }
+}
+
+/**
+ * @brief Discard CAN frames published by the node (telemetry, time sync)
+ */
+static void drain_can(void) {
+  CommCanFrame_t frame;
+
+  while (recv(peer.can_fd, &frame, sizeof(frame), MSG_DONTWAIT) > 0) {
+  }
+}
+
+/**
+ * @brief Count reply lines received on the UART
+ */
+static void drain_uart(void) {
+  char buffer[256];
+  ssize_t n;
+
+  while ((n = recv(peer.uart_fd, buffer, sizeof(buffer), MSG_DONTWAIT)) > 0) {
+    for (ssize_t i = 0; i < n; i++) {
+      if (buffer[i] == '\n') {
+        replies_read++;
+      }
+    }
+  }
+}
+
+static int compare_double(const void *a, const void *b) {
+  double x = *(const double *)a;
+  double y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+/**
+ * @brief Measure one path
+ * @return false if a command was lost or not completed in time
+ */
+static bool run_path(const bench_path_t *path, bench_result_t *result) {
+  struct timespec start;
+  struct timespec end;
+  pthread_t thread;
+  bool ok = true;
+
+  // The UART protocol can only be switched while the task is stopped
+  if (path->protocol != PROTOCOL_CAN_MOTOR &&
+      comm_uart_init(&huart, path->protocol) != SYSTEM_OK) {
+    return false;
+  }
+
+  uint32_t base = completed(path);
+  __atomic_store_n(&firmware_running, true, __ATOMIC_RELEASE);
+  if (pthread_create(&thread, NULL, firmware_thread, NULL) != 0) {
+    return false;
+  }
+
+  for (uint32_t i = 0; i < BENCH_WARMUP && ok; i++) {
+    send_message(path);
+    ok = wait_completed(path, base + i + 1U);
+  }
+  base += BENCH_WARMUP;
+
+  // Latency: one command in flight
+  for (uint32_t i = 0; i < BENCH_COMMANDS && ok; i++) {
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    send_message(path);
+    ok = wait_completed(path, base + i + 1U);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    latency_us[i] = elapsed_us(&start, &end);
+  }
+  base += BENCH_COMMANDS;
+
+  // Throughput: a window of commands in flight
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  uint32_t sent = 0;
+  while (ok && sent < BENCH_COMMANDS) {
+    uint32_t done = completed(path) - base;
+    while (sent < BENCH_COMMANDS && sent - done < BENCH_WINDOW) {
+      send_message(path);
+      sent++;
+    }
+    ok = wait_completed(path, base + done + 1U);
+  }
+  ok = ok && wait_completed(path, base + BENCH_COMMANDS);
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  __atomic_store_n(&firmware_running, false, __ATOMIC_RELEASE);
+  pthread_join(thread, NULL);
+  if (!ok) {
+    return false;
+  }
+
+  qsort(latency_us, BENCH_COMMANDS, sizeof(latency_us[0]), compare_double);
+  result->commands_per_s = BENCH_COMMANDS / (elapsed_us(&start, &end) * 1e-6);
+  result->p50_us = latency_us[BENCH_COMMANDS / 2];
+  result->p90_us = latency_us[BENCH_COMMANDS * 90 / 100];
+  result->p99_us = latency_us[BENCH_COMMANDS * 99 / 100];
+  result->max_us = latency_us[BENCH_COMMANDS - 1];
+  result->cpu_us_per_msg =
+      (double)firmware_cpu_ns * 1e-3 /
+      (double)(BENCH_WARMUP + 2 * BENCH_COMMANDS);
+  return true;
+}
+
+/* Host clock for comm_protocol.c */
+
+uint32_t HAL_Abstraction_GetTick(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000U +
+                    (uint64_t)now.tv_nsec / 1000000U);
+}
+
+uint32_t HAL_Abstraction_GetMicroseconds(void) {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t)((uint64_t)now.tv_sec * 1000000U +
+                    (uint64_t)now.tv_nsec / 1000U);
+}
+
+/* Controller, safety and fault monitor stubs */
+
+SystemError_t motor_controller_stop_motor(uint8_t motor_id) {
+  (void)motor_id;
+  __atomic_fetch_add(&executed, 1U, __ATOMIC_RELEASE);
+  return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_emergency_stop(uint8_t motor_id) {
+  (void)motor_id;
+  return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_move_to_position(uint8_t motor_id,
+                                                float target_position_deg) {
+  (void)motor_id;
+  (void)target_position_deg;
+  return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_home_motor(uint8_t motor_id) {
+  (void)motor_id;
+  return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_get_state(uint8_t motor_id,
+                                         MotorState_t *state) {
+  (void)motor_id;
+  memset(state, 0, sizeof(*state));
+  return SYSTEM_OK;
+}
+
+SystemError_t position_control_get_status(uint8_t motor_id,
+                                          PositionControlStatus_t *status) {
+  (void)motor_id;
+  memset(status, 0, sizeof(*status));
+  return SYSTEM_OK;
+}
+
+SystemError_t
+position_safety_validate_target(uint8_t motor_id, float target_position_deg,
+                                PositionValidationResult_t *result) {
+  (void)motor_id;
+  (void)target_position_deg;
+  memset(result, 0, sizeof(*result));
+  result->position_valid = true;
+  return SYSTEM_OK;
+}
+
+/* Batches are not benchmarked; the control task side is never reached */
+
+SystemError_t motion_profile_generate_trapezoidal(MotionProfile_t *profile,
+                                                  int32_t start_pos,
+                                                  int32_t end_pos,
+                                                  uint32_t max_vel,
+                                                  uint32_t acceleration) {
+  (void)profile;
+  (void)start_pos;
+  (void)end_pos;
+  (void)max_vel;
+  (void)acceleration;
+  return SYSTEM_OK;
+}
+
+SystemError_t motion_profile_start(uint8_t motor_id, MotionProfile_t *profile) {
+  (void)motor_id;
+  (void)profile;
+  return SYSTEM_OK;
+}
+
+SystemError_t motion_profile_stop(uint8_t motor_id) {
+  (void)motor_id;
+  return SYSTEM_OK;
+}
+
+SystemError_t multi_motor_queue_move(const CoordinatedMoveCommand_t *move_cmd) {
+  (void)move_cmd;
+  return SYSTEM_OK;
+}
+
+uint8_t motion_lookahead_free_slots(void) {
+  return 0;
+}
+
+SystemError_t motion_pvt_begin(uint8_t motor_id, int32_t start_position) {
+  (void)motor_id;
+  (void)start_position;
+  return SYSTEM_OK;
+}
+
+SystemError_t motion_pvt_push(uint8_t motor_id, const PvtPoint_t *points,
+                              uint8_t count) {
+  (void)motor_id;
+  (void)points;
+  (void)count;
+  return SYSTEM_OK;
+}
+
+void motion_pvt_abort(uint8_t motor_id) {
+  (void)motor_id;
+}
+
+SystemError_t motion_pvt_get_status(uint8_t motor_id, PvtStatus_t *status) {
+  (void)motor_id;
+  memset(status, 0, sizeof(*status));
+  return SYSTEM_OK;
+}
+
+uint32_t fault_monitor_get_motor_faults(uint8_t motor_id) {
+  (void)motor_id;
+  return 0;
+}
+
+SystemError_t fault_monitor_record_system_fault(SystemFaultType_t fault_type,
+                                                FaultSeverity_t severity,
+                                                uint32_t additional_data) {
+  (void)fault_type;
+  (void)severity;
+  (void)additional_data;
+  return SYSTEM_OK;
+}
+
+bool safety_system_is_operational(void) {
+  return true;
+}
+
+bool safety_get_emergency_stop_state(void) {
+  return false;
+}
+
+void safety_log_event(SafetyEventType_t event, uint8_t motor_id,
+                      uint32_t additional_data) {
+  (void)event;
+  (void)motor_id;
+  (void)additional_data;
+}
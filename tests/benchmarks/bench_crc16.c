@@ -0,0 +1,118 @@
+/**
+ * @file bench_crc16.c
+ * @brief CRC16 throughput benchmark
+ * @details Compares, for frame-sized and bulk buffers:
+ *   - bitwise: the shift-and-XOR loop previously used for message
+ *     checksums (before)
+ *   - sliced: crc16_update(), CRC16_SLICE_BY bytes per table step (after)
+ *
+ * Throughput is reported in MB/s; both paths must agree on every buffer.
+ * Build with -DCRC16_SLICE_BY=4 to measure the smaller table set.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "communication/crc16.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Benchmark Configuration */
+#define BENCH_BYTES_PER_RUN (64U * 1024U * 1024U)
+#define BENCH_MAX_LENGTH 4096U
+
+/* Keeps the optimiser from discarding computed CRCs */
+static volatile uint16_t crc_sink;
+
+/* Private Functions */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end);
+static uint16_t crc16_bitwise(const uint8_t *data, size_t length);
+static double bench_mb_per_s(uint16_t (*crc)(const uint8_t *, size_t),
+                             const uint8_t *data, size_t length);
+
+/**
+ * @brief Benchmark entry point
+ */
+int main(void) {
+  static uint8_t data[BENCH_MAX_LENGTH];
+  const size_t lengths[] = {16U, 64U, 144U, 1024U, BENCH_MAX_LENGTH};
+  int mismatches = 0;
+
+  srand(1U);
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)rand();
+  }
+
+  printf("CRC16 Throughput Benchmark (slice-by-%d)\n", CRC16_SLICE_BY);
+  printf("========================================\n\n");
+  printf("%-14s %14s %14s %10s\n", "Buffer bytes", "bitwise MB/s",
+         "sliced MB/s", "speed-up");
+
+  for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    size_t length = lengths[i];
+    if (crc16_bitwise(data, length) != crc16_compute(data, length)) {
+      mismatches++;
+    }
+
+    double bitwise = bench_mb_per_s(crc16_bitwise, data, length);
+    double sliced = bench_mb_per_s(crc16_compute, data, length);
+    printf("%-14zu %14.1f %14.1f %9.1fx\n", length, bitwise, sliced,
+           sliced / bitwise);
+  }
+
+  if (mismatches != 0) {
+    printf("\n%d CRC mismatches\n", mismatches);
+  }
+  return (mismatches == 0) ? 0 : 1;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Seconds between two monotonic timestamps
+ */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) +
+         (double)(end->tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+/**
+ * @brief Reference bit-at-a-time CRC16
+ */
+static uint16_t crc16_bitwise(const uint8_t *data, size_t length) {
+  uint16_t crc = CRC16_INIT_VALUE;
+
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int j = 0; j < 8; j++) {
+      if (crc & 1) {
+        crc = (crc >> 1) ^ CRC16_POLYNOMIAL;
+      } else {
+        crc >>= 1;
+      }
+    }
+  }
+  return crc;
+}
+
+/**
+ * @brief Throughput of one CRC implementation on one buffer size
+ * @return Megabytes (10^6 bytes) per second
+ */
+static double bench_mb_per_s(uint16_t (*crc)(const uint8_t *, size_t),
+                             const uint8_t *data, size_t length) {
+  struct timespec start;
+  struct timespec end;
+  size_t runs = BENCH_BYTES_PER_RUN / length;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (size_t r = 0; r < runs; r++) {
+    crc_sink = crc(data, length);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return (double)(runs * length) / elapsed_seconds(&start, &end) / 1e6;
+}
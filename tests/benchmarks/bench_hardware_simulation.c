@@ -0,0 +1,143 @@
+/**
+ * @file bench_hardware_simulation.c
+ * @brief Register access throughput benchmark for hardware simulation
+ * @details Compares register accesses per second for:
+ *   - legacy bridge: one `python3 -c` process per access via popen
+ *     (measured as interpreter start-up only, i.e. a lower bound)
+ *   - persistent Python co-process backend (if the simulator is present)
+ *   - native in-process register model (default backend)
+ *
+ * Run from the repository root so the schema paths resolve.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "simulation/hardware_simulation.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Benchmark Configuration */
+#define BENCH_LEGACY_ACCESSES 20
+#define BENCH_COPROCESS_ACCESSES 2000
+#define BENCH_NATIVE_ACCESSES 2000000
+
+#define L6470_SCHEMA "schemas/l6470_registers.yaml"
+#define AS5600_SCHEMA "schemas/as5600_registers.yaml"
+
+/* Private Functions */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end);
+static double bench_legacy_popen(uint32_t accesses);
+static double bench_backend(simulation_backend_t backend, uint32_t accesses);
+static void print_rate(const char *label, double accesses_per_s);
+
+/**
+ * @brief Benchmark entry point
+ */
+int main(void) {
+  printf("Hardware Simulation Register Access Benchmark\n");
+  printf("=============================================\n\n");
+
+  double legacy = bench_legacy_popen(BENCH_LEGACY_ACCESSES);
+  double coprocess =
+      bench_backend(SIM_BACKEND_PYTHON_COPROCESS, BENCH_COPROCESS_ACCESSES);
+  double native = bench_backend(SIM_BACKEND_NATIVE, BENCH_NATIVE_ACCESSES);
+
+  print_rate("Legacy popen per access (before)", legacy);
+  print_rate("Python co-process backend", coprocess);
+  print_rate("Native register model (after)", native);
+
+  if (legacy > 0.0 && native > 0.0) {
+    printf("\nNative speed-up over legacy bridge: %.0fx\n", native / legacy);
+  }
+
+  /* 1 kHz loop with ~8 register accesses per tick needs 8000 accesses/s */
+  return (native >= 8000.0) ? 0 : 1;
+}
+
+/**
+ * @brief Time difference in seconds
+ */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) +
+         (double)(end->tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+/**
+ * @brief Cost of spawning one interpreter per access (legacy bridge)
+ * @return Accesses per second, or 0 if python3 is unavailable
+ */
+static double bench_legacy_popen(uint32_t accesses) {
+  struct timespec start, end;
+  char output[64];
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t i = 0; i < accesses; i++) {
+    FILE *pipe = popen("python3 -c \"print(0)\" 2>/dev/null", "r");
+    if (!pipe) {
+      return 0.0;
+    }
+    if (fgets(output, sizeof(output), pipe) == NULL) {
+      pclose(pipe);
+      return 0.0;
+    }
+    pclose(pipe);
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return (double)accesses / elapsed_seconds(&start, &end);
+}
+
+/**
+ * @brief Mixed L6470/AS5600 register access loop on a backend
+ * @return Accesses per second, or 0 if the backend could not start
+ */
+static double bench_backend(simulation_backend_t backend, uint32_t accesses) {
+  struct timespec start, end;
+  uint32_t l6470_value;
+  uint16_t as5600_value;
+  uint32_t checksum = 0;
+
+  if (simulation_set_backend(backend) != SIM_OK ||
+      simulation_init(L6470_SCHEMA, AS5600_SCHEMA) != SIM_OK) {
+    simulation_cleanup();
+    return 0.0;
+  }
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t i = 0; i < accesses; i += 4) {
+    l6470_sim_read_register(0x19, &l6470_value); /* STATUS */
+    checksum += l6470_value;
+    l6470_sim_write_register(0x0A, i & 0xFF); /* KVAL_RUN */
+    as5600_sim_read_register(0x0C, &as5600_value); /* RAW_ANGLE_H */
+    checksum += as5600_value;
+    as5600_sim_read_register(0x0D, &as5600_value); /* RAW_ANGLE_L */
+    checksum += as5600_value;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  simulation_cleanup();
+  simulation_set_backend(SIM_BACKEND_NATIVE);
+
+  /* Keep the loop observable to the optimizer */
+  if (checksum == 0xFFFFFFFFU) {
+    printf("checksum %u\n", checksum);
+  }
+
+  return (double)accesses / elapsed_seconds(&start, &end);
+}
+
+/**
+ * @brief Print one benchmark row
+ */
+static void print_rate(const char *label, double accesses_per_s) {
+  if (accesses_per_s <= 0.0) {
+    printf("  %-36s skipped (backend unavailable)\n", label);
+    return;
+  }
+  printf("  %-36s %14.0f accesses/s  (%10.3f us/access)\n", label,
+         accesses_per_s, 1e6 / accesses_per_s);
+}
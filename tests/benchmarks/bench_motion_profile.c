@@ -0,0 +1,222 @@
+/**
+ * @file bench_motion_profile.c
+ * @brief Trajectory evaluation cost and accuracy benchmark
+ * @details Compares, per motor and per 1 ms update tick:
+ *   - closed-form evaluation: motion_profile_execute() recomputing the
+ *     position from elapsed time with float arithmetic (before)
+ *   - incremental evaluation: motion_profile_trajectory_step() advancing
+ *     Q32.32 forward differences (after)
+ *
+ * Accuracy is reported as the largest setpoint difference between the two
+ * paths over a whole move, plus the final position error of the
+ * incremental path (must be zero).
+ *
+ * Mid-motion replanning (motion_profile_trajectory_replan()) is timed from
+ * states spread over a move, reporting mean and worst case against the
+ * 1 ms control period.
+ *
+ * @note Part of STM32H753ZI stepper motor control project
+ * @date 2025
+ */
+
+#include "controllers/motion_profile.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/* Benchmark Configuration */
+#define BENCH_REPEATS 200
+#define BENCH_REPLANS 5000
+#define BENCH_CONTROL_PERIOD_NS 1000000.0
+
+/* Keeps the optimiser from discarding evaluated setpoints */
+static volatile int32_t position_sink;
+
+/* Private Functions */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end);
+static double bench_closed_form(MotionProfile_t *profile);
+static double bench_incremental(const MotionProfile_t *profile);
+static int32_t compare_paths(const char *label, MotionProfile_t *profile);
+static double bench_replan(const MotionProfile_t *profile, double *worst_ns);
+
+/**
+ * @brief Benchmark entry point
+ */
+int main(void) {
+  MotionProfile_t trapezoid;
+  MotionProfile_t scurve;
+
+  motion_profile_init();
+  motion_profile_generate_trapezoidal(&trapezoid, 0, 20000, 3200, 1600);
+  motion_profile_generate_scurve(&scurve, 0, 20000, 3200, 1600, 200);
+
+  printf("Motion Profile Evaluation Benchmark\n");
+  printf("===================================\n\n");
+
+  printf("%-28s %14s %14s\n", "Profile", "closed ns/tick",
+         "incr. ns/tick");
+  printf("%-28s %14.1f %14.1f\n", "Trapezoidal 20000 steps",
+         bench_closed_form(&trapezoid), bench_incremental(&trapezoid));
+  printf("%-28s %14.1f %14.1f\n\n", "S-curve 20000 steps",
+         bench_closed_form(&scurve), bench_incremental(&scurve));
+
+  double replan_worst_ns = 0.0;
+  double replan_mean_ns = bench_replan(&scurve, &replan_worst_ns);
+  printf("%-28s %14.1f %14.1f\n\n", "Replan mean / worst ns",
+         replan_mean_ns, replan_worst_ns);
+
+  int32_t end_error = compare_paths("Trapezoidal", &trapezoid);
+  /* The closed-form S-curve only models the first jerk phase, so large
+   * differences there reflect that approximation, not the generator */
+  end_error |= compare_paths("S-curve", &scurve);
+
+  bool replan_in_period = replan_worst_ns < BENCH_CONTROL_PERIOD_NS;
+  return (end_error == 0 && replan_in_period) ? 0 : 1;
+}
+
+/* Private Function Implementations */
+
+/**
+ * @brief Seconds between two monotonic timestamps
+ */
+static double elapsed_seconds(const struct timespec *start,
+                              const struct timespec *end) {
+  return (double)(end->tv_sec - start->tv_sec) +
+         (double)(end->tv_nsec - start->tv_nsec) * 1e-9;
+}
+
+/**
+ * @brief Cost of evaluating a whole move with the closed form
+ * @return Nanoseconds per tick
+ */
+static double bench_closed_form(MotionProfile_t *profile) {
+  struct timespec start;
+  struct timespec end;
+  int32_t pos;
+  uint32_t vel;
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t r = 0; r < BENCH_REPEATS; r++) {
+    for (uint32_t t = 1; t <= profile->total_time_ms; t++) {
+      motion_profile_execute(0, profile, t, &pos, &vel);
+      position_sink = pos;
+    }
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return elapsed_seconds(&start, &end) * 1e9 /
+         ((double)BENCH_REPEATS * profile->total_time_ms);
+}
+
+/**
+ * @brief Cost of evaluating a whole move incrementally
+ * @return Nanoseconds per tick (planning excluded)
+ */
+static double bench_incremental(const MotionProfile_t *profile) {
+  static MotionTrajectory_t plan;
+  static MotionTrajectory_t trajectory;
+  struct timespec start;
+  struct timespec end;
+  int32_t pos;
+  int32_t vel;
+  uint64_t ticks = 0;
+
+  motion_profile_trajectory_plan(&plan, profile);
+
+  clock_gettime(CLOCK_MONOTONIC, &start);
+  for (uint32_t r = 0; r < BENCH_REPEATS; r++) {
+    trajectory = plan;
+    while (motion_profile_trajectory_step(&trajectory, &pos, &vel)) {
+      position_sink = pos;
+    }
+    ticks += trajectory.elapsed_ticks;
+  }
+  clock_gettime(CLOCK_MONOTONIC, &end);
+
+  return elapsed_seconds(&start, &end) * 1e9 / (double)ticks;
+}
+
+/**
+ * @brief Print the largest setpoint difference between both paths
+ * @return Final position error of the incremental path
+ */
+static int32_t compare_paths(const char *label, MotionProfile_t *profile) {
+  static MotionTrajectory_t trajectory;
+  int32_t pos = 0;
+  int32_t vel = 0;
+  int32_t ref_pos;
+  uint32_t ref_vel;
+  int32_t max_pos_diff = 0;
+  int32_t max_vel_diff = 0;
+  uint32_t t = 0;
+  bool running = true;
+
+  motion_profile_trajectory_plan(&trajectory, profile);
+
+  while (running) {
+    running = motion_profile_trajectory_step(&trajectory, &pos, &vel);
+    motion_profile_execute(0, profile, ++t, &ref_pos, &ref_vel);
+
+    int32_t pos_diff = abs(pos - ref_pos);
+    int32_t vel_diff = abs(vel - (int32_t)ref_vel);
+    if (pos_diff > max_pos_diff) {
+      max_pos_diff = pos_diff;
+    }
+    if (vel_diff > max_vel_diff) {
+      max_vel_diff = vel_diff;
+    }
+  }
+
+  int32_t end_error = pos - profile->end_position;
+  printf("%-12s ticks %5u (closed form %5u)  max |dpos| %6d steps  "
+         "max |dvel| %5d steps/s  end error %d\n",
+         label, (unsigned)t, (unsigned)profile->total_time_ms, max_pos_diff,
+         max_vel_diff, end_error);
+
+  return end_error;
+}
+
+/**
+ * @brief Cost of replanning from states spread over a move
+ * @param worst_ns Output: slowest single replan
+ * @return Mean nanoseconds per replan
+ */
+static double bench_replan(const MotionProfile_t *profile, double *worst_ns) {
+  static MotionTrajectory_t plan;
+  static MotionTrajectory_t trajectory;
+  const MotionLimits_t limits = {3200, 1600, 8000};
+  struct timespec start;
+  struct timespec end;
+  int32_t pos;
+  int32_t vel;
+  double total_ns = 0.0;
+
+  motion_profile_trajectory_plan(&plan, profile);
+  srand(1);
+
+  for (uint32_t i = 0; i < BENCH_REPLANS; i++) {
+    /* Replan from a state part-way through the move to a random target */
+    trajectory = plan;
+    uint32_t ticks = (uint32_t)((uint64_t)i * plan.total_ticks / BENCH_REPLANS);
+    for (uint32_t t = 0; t < ticks; t++) {
+      motion_profile_trajectory_step(&trajectory, &pos, &vel);
+    }
+    int32_t target = (rand() % 60001) - 20000;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    motion_profile_trajectory_replan(&trajectory, target, &limits);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double ns = elapsed_seconds(&start, &end) * 1e9;
+    total_ns += ns;
+    if (ns > *worst_ns) {
+      *worst_ns = ns;
+    }
+  }
+
+  return total_ns / BENCH_REPLANS;
+}
+
+/* Position control stub: the benchmark never stops a running profile */
+void position_control_clear_feedforward(uint8_t motor_id) { (void)motor_id; }
@@ -60,3 +60,7 @@ SystemError_t watchdog_init(void) {
 SystemError_t watchdog_refresh(void) {
     return SYSTEM_OK;
 }
+
+// The communication stack is not linked; nothing can be staged to cancel.
+void comm_cancel_pending_batch(void) {
+}
@@ -8,6 +8,7 @@
  */
 
 #include "mock_hal_abstraction.h"
+#include "config/comm_config.h"
 #include "config/error_codes.h"
 #include "config/hardware_config.h"
 #include "config/motor_config.h"
@@ -55,6 +56,7 @@ void HAL_Abstraction_Mock_Reset(void) {
     mock_hal_state.interrupts_enabled = true;
     test_mock_state.interrupts_enabled = true;
     mock_hal_state.system_tick = 1;
+    mock_hal_state.system_time_us = 1000u;
     test_mock_state.system_tick = 1;
 
     printf("[mock_hal] Calling Test_ResetApplication() from Mock Reset\n");
@@ -178,6 +180,32 @@ HAL_Abstraction_I2C_MemWrite(HAL_I2C_Instance_t instance,
     return i2c->return_value;
 }
 
+SystemError_t
+HAL_Abstraction_I2C_MemRead(HAL_I2C_Instance_t instance,
+                            const HAL_I2C_Transaction_t *transaction) {
+    if (transaction == NULL || instance >= HAL_I2C_INSTANCE_MAX)
+        return ERROR_NULL_POINTER;
+    if (mock_hal_state.inject_i2c_failure)
+        return ERROR_HARDWARE_FAULT;
+    MockI2C_Internal_t *i2c = &mock_hal_state.i2c_instances[instance];
+    i2c->last_device_address = transaction->device_address;
+    i2c->last_register_address = transaction->register_address;
+    if (transaction->data && transaction->data_size <= sizeof(i2c->last_data)) {
+        /* One-shot programmed response, otherwise zeros */
+        if (i2c->response_set && i2c->response_size >= transaction->data_size) {
+            memcpy(transaction->data, i2c->response_data,
+                   transaction->data_size);
+            i2c->response_set = false;
+        } else {
+            memset(transaction->data, 0, transaction->data_size);
+        }
+        memcpy(i2c->last_data, transaction->data, transaction->data_size);
+    }
+    i2c->last_data_size = transaction->data_size;
+    i2c->call_count++;
+    return i2c->return_value;
+}
+
 /* HAL GPIO / Timer / SPI wrappers and implementations follow */
 
 /* If CMSIS device headers are included (firmware build) these types and
@@ -343,10 +371,208 @@ HAL_Abstraction_SPI_TransmitReceive(HAL_SPI_Instance_t instance,
         }
     }
     spi->last_data_size = transaction->data_size;
+    spi->last_cs_frame_size = transaction->cs_frame_size;
     spi->call_count++;
     return spi->return_value;
 }
 
+/* Asynchronous bus model: requests run back to back per bus and complete
+ * after setup + bytes * us_per_byte of mock time. The data moves through
+ * the blocking mocks at completion, so programmed responses, fault
+ * injection and call counts apply unchanged. */
+
+#define MOCK_ASYNC_I2C_BASE ((uint8_t)HAL_SPI_INSTANCE_MAX)
+#define MOCK_SPI_SETUP_US 1u
+#define MOCK_SPI_US_PER_BYTE 2u  /* ~4 MHz SCK */
+#define MOCK_I2C_SETUP_US 70u    /* start + address + register at 400 kHz */
+#define MOCK_I2C_US_PER_BYTE 23u /* 9 bit times at 400 kHz */
+
+/* Completion callbacks run "at" their DMA interrupt time, so a transfer
+ * submitted from a callback starts there rather than at the mock clock */
+static bool mock_async_in_callback;
+static uint32_t mock_async_callback_us;
+
+static uint32_t mock_async_now(void) {
+    return mock_async_in_callback ? mock_async_callback_us
+                                  : mock_hal_state.system_time_us;
+}
+
+void MockHAL_SetSPITiming(HAL_SPI_Instance_t instance, uint32_t setup_us,
+                          uint32_t us_per_byte) {
+    if (instance >= HAL_SPI_INSTANCE_MAX)
+        return;
+    mock_hal_state.async_setup_us[instance] = setup_us;
+    mock_hal_state.async_us_per_byte[instance] = us_per_byte;
+    mock_hal_state.async_timing_set[instance] = true;
+}
+
+void MockHAL_SetI2CTiming(HAL_I2C_Instance_t instance, uint32_t setup_us,
+                          uint32_t us_per_byte) {
+    if (instance >= HAL_I2C_INSTANCE_MAX)
+        return;
+    uint8_t bus = MOCK_ASYNC_I2C_BASE + (uint8_t)instance;
+    mock_hal_state.async_setup_us[bus] = setup_us;
+    mock_hal_state.async_us_per_byte[bus] = us_per_byte;
+    mock_hal_state.async_timing_set[bus] = true;
+}
+
+static uint32_t mock_async_duration(const HAL_Async_Request_t *request) {
+    uint8_t bus = request->bus;
+    bool spi = request->op == HAL_ASYNC_SPI_TRANSFER;
+    uint32_t setup = spi ? MOCK_SPI_SETUP_US : MOCK_I2C_SETUP_US;
+    uint32_t per_byte = spi ? MOCK_SPI_US_PER_BYTE : MOCK_I2C_US_PER_BYTE;
+    if (mock_hal_state.async_timing_set[bus]) {
+        setup = mock_hal_state.async_setup_us[bus];
+        per_byte = mock_hal_state.async_us_per_byte[bus];
+    }
+    uint32_t bytes =
+        spi ? request->xfer.spi.data_size : request->xfer.i2c.data_size;
+    return setup + bytes * per_byte;
+}
+
+static void mock_async_start(uint8_t bus, uint32_t start_us) {
+    HAL_Async_Request_t *request = mock_hal_state.async_head[bus];
+    if (request == NULL)
+        return;
+    request->state = HAL_ASYNC_ACTIVE;
+    mock_hal_state.async_done_us[bus] =
+        start_us + mock_async_duration(request);
+}
+
+static SystemError_t mock_async_submit(uint8_t bus, HAL_Async_Op_t op,
+                                       HAL_Async_Request_t *request) {
+    if (request == NULL)
+        return ERROR_NULL_POINTER;
+    if (request->state == HAL_ASYNC_QUEUED ||
+        request->state == HAL_ASYNC_ACTIVE)
+        return ERROR_OPERATION_IN_PROGRESS;
+
+    request->op = op;
+    request->bus = bus;
+    request->progress = 0;
+    request->result = SYSTEM_OK;
+    request->submit_us = mock_async_now();
+    request->complete_us = 0;
+    request->next = NULL;
+    request->state = HAL_ASYNC_QUEUED;
+
+    if (mock_hal_state.async_head[bus] == NULL) {
+        mock_hal_state.async_head[bus] = request;
+        mock_hal_state.async_tail[bus] = request;
+        mock_async_start(bus, request->submit_us);
+    } else {
+        mock_hal_state.async_tail[bus]->next = request;
+        mock_hal_state.async_tail[bus] = request;
+    }
+    return SYSTEM_OK;
+}
+
+SystemError_t HAL_Abstraction_SPI_Submit(HAL_SPI_Instance_t instance,
+                                         HAL_Async_Request_t *request) {
+    if (instance >= HAL_SPI_INSTANCE_MAX)
+        return ERROR_INVALID_PARAMETER;
+    return mock_async_submit((uint8_t)instance, HAL_ASYNC_SPI_TRANSFER,
+                             request);
+}
+
+SystemError_t HAL_Abstraction_I2C_SubmitRead(HAL_I2C_Instance_t instance,
+                                             HAL_Async_Request_t *request) {
+    if (instance >= HAL_I2C_INSTANCE_MAX)
+        return ERROR_INVALID_PARAMETER;
+    return mock_async_submit(MOCK_ASYNC_I2C_BASE + (uint8_t)instance,
+                             HAL_ASYNC_I2C_MEM_READ, request);
+}
+
+SystemError_t HAL_Abstraction_I2C_SubmitWrite(HAL_I2C_Instance_t instance,
+                                              HAL_Async_Request_t *request) {
+    if (instance >= HAL_I2C_INSTANCE_MAX)
+        return ERROR_INVALID_PARAMETER;
+    return mock_async_submit(MOCK_ASYNC_I2C_BASE + (uint8_t)instance,
+                             HAL_ASYNC_I2C_MEM_WRITE, request);
+}
+
+SystemError_t HAL_Abstraction_Async_Cancel(HAL_Async_Request_t *request) {
+    if (request == NULL)
+        return ERROR_NULL_POINTER;
+    if (request->state == HAL_ASYNC_ACTIVE)
+        return ERROR_OPERATION_IN_PROGRESS;
+    if (request->state != HAL_ASYNC_QUEUED)
+        return ERROR_INVALID_STATE;
+
+    HAL_Async_Request_t *prev = mock_hal_state.async_head[request->bus];
+    while (prev != NULL && prev->next != request)
+        prev = prev->next;
+    if (prev == NULL)
+        return ERROR_INVALID_STATE;
+    prev->next = request->next;
+    if (mock_hal_state.async_tail[request->bus] == request)
+        mock_hal_state.async_tail[request->bus] = prev;
+    request->next = NULL;
+    request->state = HAL_ASYNC_CANCELLED;
+    return SYSTEM_OK;
+}
+
+static void mock_async_complete(uint8_t bus) {
+    HAL_Async_Request_t *request = mock_hal_state.async_head[bus];
+    uint32_t done_us = mock_hal_state.async_done_us[bus];
+
+    SystemError_t result;
+    if (request->op == HAL_ASYNC_SPI_TRANSFER)
+        result = HAL_Abstraction_SPI_TransmitReceive((HAL_SPI_Instance_t)bus,
+                                                     &request->xfer.spi);
+    else if (request->op == HAL_ASYNC_I2C_MEM_READ)
+        result = HAL_Abstraction_I2C_MemRead(
+            (HAL_I2C_Instance_t)(bus - MOCK_ASYNC_I2C_BASE),
+            &request->xfer.i2c);
+    else
+        result = HAL_Abstraction_I2C_MemWrite(
+            (HAL_I2C_Instance_t)(bus - MOCK_ASYNC_I2C_BASE),
+            &request->xfer.i2c);
+
+    mock_hal_state.async_head[bus] = request->next;
+    if (request->next == NULL)
+        mock_hal_state.async_tail[bus] = NULL;
+    request->next = NULL;
+    request->progress = (request->op == HAL_ASYNC_SPI_TRANSFER)
+                            ? request->xfer.spi.data_size
+                            : request->xfer.i2c.data_size;
+    request->result = result;
+    request->complete_us = done_us;
+    request->state = HAL_ASYNC_DONE;
+
+    /* The next request starts when this one left the wire */
+    mock_async_start(bus, done_us);
+    if (request->on_complete != NULL) {
+        bool nested = mock_async_in_callback;
+        mock_async_in_callback = true;
+        mock_async_callback_us = done_us;
+        request->on_complete(request);
+        mock_async_in_callback = nested;
+    }
+}
+
+uint32_t MockHAL_AsyncService(void) {
+    uint32_t completed = 0;
+    for (;;) {
+        /* Earliest due completion first, across all buses */
+        int due_bus = -1;
+        for (int bus = 0; bus < MOCK_ASYNC_BUS_COUNT; bus++) {
+            if (mock_hal_state.async_head[bus] == NULL)
+                continue;
+            uint32_t done = mock_hal_state.async_done_us[bus];
+            if ((int32_t)(done - mock_hal_state.system_time_us) > 0)
+                continue;
+            if (due_bus < 0 ||
+                (int32_t)(done - mock_hal_state.async_done_us[due_bus]) < 0)
+                due_bus = bus;
+        }
+        if (due_bus < 0)
+            return completed;
+        mock_async_complete((uint8_t)due_bus);
+        completed++;
+    }
+}
+
 #endif // UNITY_TESTING
 
 /* Helper implementations required by unit tests and other mocks */
@@ -382,15 +608,80 @@ void MockHAL_SetGPIOState(HAL_GPIO_Port_t port, uint32_t pin,
     HAL_Abstraction_Mock_SetGPIOState(port, pin, state);
 }
 
+void MockHAL_SetVirtualTime(uint64_t now_us) {
+    mock_hal_state.system_time_us = (uint32_t)now_us;
+    mock_hal_state.system_tick = (uint32_t)(now_us / 1000u);
+    MockHAL_AsyncService();
+}
+void MockHAL_SetDelayHook(void (*hook)(uint32_t delay_us)) {
+    mock_hal_state.delay_hook = hook;
+}
+
+/* Advance the mock clock, or hand the wait to the virtual-time kernel */
+static void mock_hal_wait_us(uint32_t delay_us) {
+    if (mock_hal_state.delay_hook != NULL) {
+        mock_hal_state.delay_hook(delay_us);
+        return;
+    }
+    mock_hal_state.system_time_us += delay_us;
+    mock_hal_state.system_tick = mock_hal_state.system_time_us / 1000u;
+    MockHAL_AsyncService();
+}
+
 uint32_t HAL_Abstraction_GetTick(void) {
     return mock_hal_state.system_tick;
 }
 void HAL_Abstraction_Delay(uint32_t delay_ms) {
     mock_hal_state.delay_call_count++;
+    if (mock_hal_state.delay_hook != NULL) {
+        mock_hal_state.delay_hook(delay_ms * 1000u);
+        return;
+    }
+    /* Millisecond delays keep the legacy tick-only arithmetic */
     mock_hal_state.system_tick += delay_ms;
+    mock_hal_state.system_time_us = mock_hal_state.system_tick * 1000u;
+    MockHAL_AsyncService();
+}
+void HAL_Abstraction_DelayMicroseconds(uint32_t delay_us) {
+    mock_hal_state.delay_call_count++;
+    mock_hal_wait_us(delay_us);
 }
 uint32_t HAL_Abstraction_GetMicroseconds(void) {
-    return mock_hal_state.system_tick * 1000u;
+    return mock_hal_state.system_time_us;
+}
+void HAL_Abstraction_InitCycleCounter(void) {
+}
+
+SystemError_t HAL_Abstraction_Timer_Init(HAL_Timer_Instance_t instance,
+                                         const HAL_Timer_Config_t *config) {
+    if (instance >= HAL_TIMER_INSTANCE_MAX || config == NULL)
+        return ERROR_INVALID_PARAMETER;
+    if (mock_hal_state.inject_timer_failure)
+        return ERROR_HARDWARE_FAULT;
+    mock_hal_state.timer_instances[instance].config = *config;
+    mock_hal_state.timer_instances[instance].initialized = true;
+    return SYSTEM_OK;
+}
+SystemError_t HAL_Abstraction_Timer_Start(HAL_Timer_Instance_t instance) {
+    if (instance >= HAL_TIMER_INSTANCE_MAX)
+        return ERROR_INVALID_PARAMETER;
+    mock_hal_state.timer_instances[instance].running = true;
+    return SYSTEM_OK;
+}
+SystemError_t HAL_Abstraction_Timer_Stop(HAL_Timer_Instance_t instance) {
+    if (instance >= HAL_TIMER_INSTANCE_MAX)
+        return ERROR_INVALID_PARAMETER;
+    mock_hal_state.timer_instances[instance].running = false;
+    return SYSTEM_OK;
+}
+/* Timers are modelled as 1 MHz free-running counters on the mock clock */
+SystemError_t HAL_Abstraction_Timer_GetCounter(HAL_Timer_Instance_t instance,
+                                               uint32_t *counter) {
+    if (instance >= HAL_TIMER_INSTANCE_MAX || counter == NULL)
+        return ERROR_INVALID_PARAMETER;
+    *counter = mock_hal_state.system_time_us;
+    mock_hal_state.timer_instances[instance].counter_value = *counter;
+    return SYSTEM_OK;
 }
 
 SystemError_t HAL_Abstraction_GPIO_EnableInterrupt(HAL_GPIO_Port_t port,
@@ -403,3 +694,22 @@ SystemError_t HAL_Abstraction_GPIO_EnableInterrupt(HAL_GPIO_Port_t port,
     (void)priority;
     return SYSTEM_OK;
 }
+
+SystemError_t HAL_Abstraction_CRC16_Update(uint16_t crc, const uint8_t *data,
+                                           uint32_t length, uint16_t *result) {
+    if (data == NULL || result == NULL) {
+        return ERROR_INVALID_PARAMETER;
+    }
+
+    // Bitwise reference in place of the CRC unit
+    for (uint32_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1U) ? (uint16_t)((crc >> 1) ^ CRC16_POLYNOMIAL)
+                             : (uint16_t)(crc >> 1);
+        }
+    }
+
+    *result = crc;
+    return SYSTEM_OK;
+}
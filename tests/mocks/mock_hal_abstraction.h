@@ -24,6 +24,7 @@ typedef struct {
     uint8_t *rx_data;
     uint16_t data_size;
     uint32_t timeout_ms;
+    uint16_t cs_frame_size;
 } HAL_SPI_Transaction_t;
 #endif
 
@@ -53,6 +54,8 @@ typedef struct {
 #define HAL_TIMER_INSTANCE_MAX 3
 #endif
 
+#define MOCK_ASYNC_BUS_COUNT (HAL_SPI_INSTANCE_MAX + HAL_I2C_INSTANCE_MAX)
+
 // Internal mock types and state for use in mock_hal_abstraction.c
 #ifndef MOCK_GPIOPORT_INTERNAL_T_DEFINED
 #define MOCK_GPIOPORT_INTERNAL_T_DEFINED
@@ -69,6 +72,7 @@ typedef struct {
     uint8_t last_tx_data[256];
     uint8_t last_rx_data[256];
     uint16_t last_data_size;
+    uint16_t last_cs_frame_size;
     uint32_t call_count;
     SystemError_t return_value;
     bool initialized;
@@ -113,11 +117,23 @@ typedef struct {
     MockTimer_Internal_t timer_instances[HAL_TIMER_INSTANCE_MAX];
 
     uint32_t system_tick;
+    uint32_t system_time_us; // Microsecond clock (follows virtual time)
     uint32_t delay_call_count;
     uint32_t watchdog_refresh_count;
     bool interrupts_enabled;
     bool hal_initialized;
 
+    // Virtual-time delay hook (NULL = delays advance the clock directly)
+    void (*delay_hook)(uint32_t delay_us);
+
+    // Asynchronous bus model: one FIFO per bus, SPI instances then I2C
+    HAL_Async_Request_t *async_head[MOCK_ASYNC_BUS_COUNT];
+    HAL_Async_Request_t *async_tail[MOCK_ASYNC_BUS_COUNT];
+    uint32_t async_done_us[MOCK_ASYNC_BUS_COUNT]; // Head completion time
+    uint32_t async_setup_us[MOCK_ASYNC_BUS_COUNT];
+    uint32_t async_us_per_byte[MOCK_ASYNC_BUS_COUNT];
+    bool async_timing_set[MOCK_ASYNC_BUS_COUNT];
+
     // Fault injection
     bool inject_spi_failure;
     bool inject_i2c_failure;
@@ -181,6 +197,50 @@ void MockHAL_SetFaultPinActive(bool active);
  */
 void MockHAL_TriggerWatchdogTimeout(bool trigger);
 
+/**
+ * @brief Set mock clock from simulated time (virtual-time clock sink)
+ * @param now_us Simulated time in microseconds
+ * @note Drives HAL_Abstraction_GetTick(), HAL_Abstraction_GetMicroseconds()
+ *       and HAL_Abstraction_Timer_GetCounter() (1 MHz free-running)
+ */
+void MockHAL_SetVirtualTime(uint64_t now_us);
+
+/**
+ * @brief Route HAL delays through a virtual-time kernel
+ * @param hook Called with the delay in microseconds; expected to advance
+ *             the clock via MockHAL_SetVirtualTime(). NULL restores the
+ *             default behaviour of advancing the clock directly.
+ */
+void MockHAL_SetDelayHook(void (*hook)(uint32_t delay_us));
+
+/**
+ * @brief Set the modelled duration of asynchronous SPI transfers
+ * @param instance SPI instance
+ * @param setup_us Fixed cost per transfer (CS, DMA start)
+ * @param us_per_byte Wire time per byte
+ * @note Defaults model the L6470 bus (~4 MHz SCK).
+ */
+void MockHAL_SetSPITiming(HAL_SPI_Instance_t instance, uint32_t setup_us,
+                          uint32_t us_per_byte);
+
+/**
+ * @brief Set the modelled duration of asynchronous I2C transfers
+ * @param instance I2C instance
+ * @param setup_us Fixed cost per transfer (start, address, register)
+ * @param us_per_byte Wire time per data byte
+ * @note Defaults model a 400 kHz bus.
+ */
+void MockHAL_SetI2CTiming(HAL_I2C_Instance_t instance, uint32_t setup_us,
+                          uint32_t us_per_byte);
+
+/**
+ * @brief Complete every asynchronous transfer due by the mock clock
+ * @return Number of requests completed
+ * @note Runs automatically whenever the mock clock advances; completions
+ *       are delivered in time order across buses, like DMA interrupts.
+ */
+uint32_t MockHAL_AsyncService(void);
+
 /**
  * @brief Reset all mock states to default
  */
@@ -58,6 +58,118 @@ typedef struct {
     uint32_t ErrorCode;   // Mock error code
 } SPI_HandleTypeDef;
 
+// Mock DMA stream and handle (NDTR counts the transfers left)
+typedef struct {
+    uint32_t NDTR; // Mock number of data register
+} DMA_Stream_TypeDef;
+
+typedef struct {
+    uint32_t Mode; // Mock DMA mode (DMA_NORMAL / DMA_CIRCULAR)
+} DMA_InitTypeDef;
+
+typedef struct {
+    DMA_Stream_TypeDef *Instance; // Mock DMA stream
+    DMA_InitTypeDef Init;         // Mock DMA configuration
+} DMA_HandleTypeDef;
+
+#define DMA_NORMAL 0x00000000U
+#define DMA_CIRCULAR 0x00000100U
+#define __HAL_DMA_GET_COUNTER(h) ((h)->Instance->NDTR)
+
+// Mock UART Handle (fields used by communication/comm_protocol.c)
+typedef struct {
+    uint32_t BaudRate;
+    uint32_t WordLength;
+    uint32_t StopBits;
+    uint32_t Parity;
+    uint32_t Mode;
+    uint32_t HwFlowCtl;
+    uint32_t OverSampling;
+    uint32_t OneBitSampling;
+    uint32_t ClockPrescaler;
+} UART_InitTypeDef;
+
+typedef struct {
+    void *Instance;            // Mock USART instance pointer
+    UART_InitTypeDef Init;     // Mock UART init structure
+    struct {
+        uint32_t AdvFeatureInit;
+    } AdvancedInit;            // Mock advanced features
+    DMA_HandleTypeDef *hdmatx; // Mock TX DMA handle
+    DMA_HandleTypeDef *hdmarx; // Mock RX DMA handle
+    uint32_t ErrorCode;        // Mock error code
+} UART_HandleTypeDef;
+
+#define UART_WORDLENGTH_8B 0x00000000U
+#define UART_STOPBITS_1 0x00000000U
+#define UART_PARITY_NONE 0x00000000U
+#define UART_MODE_TX_RX 0x0000000CU
+#define UART_HWCONTROL_NONE 0x00000000U
+#define UART_OVERSAMPLING_16 0x00000000U
+#define UART_ONE_BIT_SAMPLE_DISABLE 0x00000000U
+#define UART_ADVFEATURE_NO_INIT 0x00000000U
+#define HAL_UART_ERROR_DMA 0x00000010U
+
+// Mock FDCAN Handle and message headers
+typedef struct {
+    void *Instance; // Mock FDCAN instance pointer
+    uint32_t State; // Mock FDCAN state
+} FDCAN_HandleTypeDef;
+
+typedef struct {
+    uint32_t Identifier;
+    uint32_t IdType;
+    uint32_t TxFrameType;
+    uint32_t DataLength;
+    uint32_t ErrorStateIndicator;
+    uint32_t BitRateSwitch;
+    uint32_t FDFormat;
+    uint32_t TxEventFifoControl;
+    uint32_t MessageMarker;
+} FDCAN_TxHeaderTypeDef;
+
+typedef struct {
+    uint32_t Identifier;
+    uint32_t IdType;
+    uint32_t RxFrameType;
+    uint32_t DataLength;
+    uint32_t ErrorStateIndicator;
+    uint32_t BitRateSwitch;
+    uint32_t FDFormat;
+    uint32_t RxTimestamp;
+    uint32_t FilterIndex;
+    uint32_t IsFilterMatchingFrame;
+} FDCAN_RxHeaderTypeDef;
+
+typedef struct {
+    uint32_t IdType;
+    uint32_t FilterIndex;
+    uint32_t FilterType;
+    uint32_t FilterConfig;
+    uint32_t FilterID1;
+    uint32_t FilterID2;
+    uint32_t RxBufferIndex;
+    uint32_t IsCalibrationMsg;
+} FDCAN_FilterTypeDef;
+
+#define FDCAN_STANDARD_ID 0x00000000U
+#define FDCAN_DATA_FRAME 0x00000000U
+#define FDCAN_DLC_BYTES_8 0x00000008U
+#define FDCAN_DLC_BYTES_64 0x0000000FU
+#define FDCAN_ESI_ACTIVE 0x00000000U
+#define FDCAN_BRS_OFF 0x00000000U
+#define FDCAN_BRS_ON 0x00100000U
+#define FDCAN_CLASSIC_CAN 0x00000000U
+#define FDCAN_FD_CAN 0x00200000U
+#define FDCAN_NO_TX_EVENTS 0x00000000U
+#define FDCAN_RX_FIFO0 0x00000040U
+#define FDCAN_FILTER_RANGE 0x00000000U
+#define FDCAN_FILTER_TO_RXFIFO0 0x00000001U
+#define FDCAN_REJECT 0x00000002U
+#define FDCAN_REJECT_REMOTE 0x00000001U
+#define FDCAN_IT_RX_FIFO0_NEW_MESSAGE 0x00000001U
+#define FDCAN_IT_TX_COMPLETE 0x00000200U
+
 // Minimal watchdog handle types for host testing (expanded to match
 // expectations from safety/watchdog code)
 typedef struct {
@@ -149,6 +261,13 @@ typedef enum { GPIO_PIN_RESET = 0, GPIO_PIN_SET } GPIO_PinState;
 #define VDD_VALUE 3300UL
 #endif
 
+// Interrupt masking intrinsics (host tests run single-threaded)
+#ifndef __disable_irq
+#define __get_PRIMASK() (0U)
+#define __set_PRIMASK(primask) ((void)(primask))
+#define __disable_irq() ((void)0)
+#endif
+
 #endif // STM32H7xx_HAL_H
 
 #ifdef __cplusplus
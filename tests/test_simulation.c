@@ -1,7 +1,7 @@
 /**
  * @file test_simulation.c
  * @brief Test program for hardware simulation interface
- * @details Demonstrates C code using Python simulation backend
+ * @details Demonstrates C code using the native register model backend
  *
  * This test program shows how C drivers can use the simulation
  * framework for safe development and testing.
@@ -12,16 +12,49 @@
  */
 
 #include "simulation/hardware_simulation.h"
+#include "simulation/virtual_time.h"
 #include <assert.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+/* Lockstep scenario configuration */
+#define LOCKSTEP_SAFETY_PERIOD_US 100
+#define LOCKSTEP_CONTROL_PERIOD_US 1000
+#define LOCKSTEP_DURATION_US 60000000ULL /* 60 s of simulated time */
+#define LOCKSTEP_WAIT_AT_MS 10000
+#define LOCKSTEP_WAIT_US 5000
+
+/* Lockstep scenario observations */
+typedef struct {
+    uint64_t safety_runs;
+    uint64_t control_runs;
+    uint64_t plant_runs;
+    uint64_t safety_during_wait;
+    uint32_t checksum;
+    uint32_t last_clock_ms;
+    int32_t peak_position;
+    int32_t final_position;
+} lockstep_result_t;
 
 /* Test function prototypes */
 static void test_l6470_basic_operations(void);
 static void test_as5600_basic_operations(void);
 static void test_simulation_control(void);
+static void test_register_model_behaviour(void);
+static void test_virtual_time_lockstep(void);
+static void run_lockstep_scenario(lockstep_result_t *result);
+static void lockstep_clock_sink(uint64_t now_us);
+static void lockstep_safety_task(void *context);
+static void lockstep_control_task(void *context);
+static void lockstep_plant_task(void *context);
 static void print_test_result(const char *test_name, bool passed);
 
+static int failed_tests = 0;
+static uint32_t *lockstep_clock_ms = NULL;
+static bool lockstep_waiting = false;
+
 /**
  * @brief Main test function
  */
@@ -36,8 +69,7 @@ int main(void) {
     if (result != SIM_OK) {
         printf("ERROR: Failed to initialize simulation (error code: %d)\n",
                result);
-        printf(
-            "Make sure schema files exist and Python environment is set up\n");
+        printf("Make sure schema files exist (run from repository root)\n");
         return 1;
     }
 
@@ -47,10 +79,17 @@ int main(void) {
     test_l6470_basic_operations();
     test_as5600_basic_operations();
     test_simulation_control();
+    test_register_model_behaviour();
+    test_virtual_time_lockstep();
 
     /* Cleanup */
     simulation_cleanup();
 
+    if (failed_tests > 0) {
+        printf("\n❌ %d test(s) failed\n", failed_tests);
+        return 1;
+    }
+
     printf("\n✅ All tests completed!\n");
     printf("The simulation framework is ready for driver integration.\n");
 
@@ -226,9 +265,253 @@ static void test_simulation_control(void) {
     printf("\n");
 }
 
+/**
+ * @brief Test schema-driven register model semantics
+ */
+static void test_register_model_behaviour(void) {
+    printf("Testing Register Model Behaviour\n");
+    printf("--------------------------------\n");
+
+    simulation_error_t result;
+    simulation_status_t status;
+    uint32_t value;
+    uint16_t angle_h, angle_l;
+    bool test_passed;
+
+    /* Test 1: STATUS is read-only in the L6470 schema */
+    result = l6470_sim_write_register(0x19, 0x0000);
+    test_passed = (result == SIM_ERROR_READ_ONLY);
+    print_test_result("L6470 STATUS write rejected", test_passed);
+
+    /* Test 2: ACC valid_range starts at 0x001 */
+    result = l6470_sim_write_register(0x05, 0x0000);
+    test_passed = (result == SIM_ERROR_INVALID_VALUE);
+    print_test_result("L6470 ACC out-of-range write rejected", test_passed);
+
+    /* Test 3: Undefined address */
+    result = l6470_sim_read_register(0x1F, &value);
+    test_passed = (result == SIM_ERROR_INVALID_ADDR);
+    print_test_result("L6470 undefined register rejected", test_passed);
+
+    /* Test 4: RUN updates SPEED and clears HiZ */
+    result = l6470_sim_send_command(0x51, 0x4000);
+    test_passed = (result == SIM_OK) &&
+                  (l6470_sim_read_register(0x04, &value) == SIM_OK) &&
+                  (value == 0x4000);
+    if (test_passed) {
+        test_passed = (l6470_sim_read_register(0x19, &value) == SIM_OK) &&
+                      ((value & 0x0001) == 0) && ((value & 0x0060) == 0x0060);
+    }
+    print_test_result("L6470 RUN updates SPEED/STATUS", test_passed);
+    l6470_sim_send_command(0xB8, 0);
+
+    /* Test 5: MOVE without physics completes instantly */
+    l6470_sim_send_command(0xD8, 0); /* RESET_POS */
+    result = l6470_sim_send_command(0x41, 50);
+    test_passed = (result == SIM_OK) &&
+                  (simulation_get_status(&status) == SIM_OK) &&
+                  (status.motor_position == 50);
+    print_test_result("L6470 MOVE updates ABS_POS", test_passed);
+
+    /* Test 6: Linked motion maps position onto AS5600 angle */
+    simulation_enable_linked_motion(200);
+    test_passed = (as5600_sim_read_register(0x0C, &angle_h) == SIM_OK) &&
+                  (as5600_sim_read_register(0x0D, &angle_l) == SIM_OK) &&
+                  ((((angle_h & 0x0F) << 8) | angle_l) == 1024);
+    print_test_result("Linked motion quarter turn = 1024 counts",
+                      test_passed);
+    simulation_disable_linked_motion();
+
+    /* Test 7: Physics integrates position from SPEED */
+    l6470_sim_send_command(0xD8, 0);
+    simulation_start_physics();
+    l6470_sim_send_command(0x51, 0x4000); /* ~244 steps/s */
+    for (int i = 0; i < 1000; i++) {
+        simulation_advance_time(1);
+    }
+    simulation_stop_physics();
+    l6470_sim_send_command(0xB8, 0);
+    test_passed = (simulation_get_status(&status) == SIM_OK) &&
+                  (status.motor_position >= 243) &&
+                  (status.motor_position <= 245);
+    print_test_result("Physics integrates 1 s of RUN", test_passed);
+
+    /* Test 8: GOTO takes a 22-bit two's-complement target */
+    result = l6470_sim_send_command(0x60, 0x3FFF9C); /* -100 */
+    test_passed = (result == SIM_OK) &&
+                  (simulation_get_status(&status) == SIM_OK) &&
+                  (status.motor_position == -100) &&
+                  (status.motor_direction == -1);
+    print_test_result("L6470 GOTO to a negative position", test_passed);
+    l6470_sim_send_command(0xD8, 0);
+
+    printf("\n");
+}
+
+/**
+ * @brief Test virtual-time lockstep kernel with a closed control loop
+ */
+static void test_virtual_time_lockstep(void) {
+    printf("Testing Virtual-Time Lockstep Kernel\n");
+    printf("------------------------------------\n");
+
+    lockstep_result_t first, second;
+    struct timespec start, end;
+    bool test_passed;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    run_lockstep_scenario(&first);
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    run_lockstep_scenario(&second);
+
+    double wall_s = (double)(end.tv_sec - start.tv_sec) +
+                    (double)(end.tv_nsec - start.tv_nsec) * 1e-9;
+    printf("   60 s simulated in %.3f s wall clock (%.0fx real time)\n",
+           wall_s, wall_s > 0.0 ? 60.0 / wall_s : 0.0);
+
+    /* Test 1: 10 kHz and 1 kHz release counts (t = 0 inclusive) */
+    test_passed = (first.safety_runs == 600001) &&
+                  (first.plant_runs == 60001);
+    print_test_result("Safety 10 kHz / plant 1 kHz release counts",
+                      test_passed);
+
+    /* Test 2: Nested wait keeps safety running, skips own releases */
+    test_passed = (first.safety_during_wait == LOCKSTEP_WAIT_US / 100) &&
+                  (first.control_runs ==
+                   60001 - LOCKSTEP_WAIT_US / LOCKSTEP_CONTROL_PERIOD_US);
+    print_test_result("Nested wait releases other tasks only", test_passed);
+
+    /* Test 3: Clock sink follows simulated time */
+    test_passed = (first.last_clock_ms == 60000) &&
+                  (virtual_time_now_ms() == 60000);
+    print_test_result("Clock sink tracks simulated time", test_passed);
+
+    /* Test 4: Controller tracks the 400-step square wave back to zero */
+    test_passed = (first.peak_position >= 395) &&
+                  (first.peak_position <= 405) &&
+                  (first.final_position >= -5) && (first.final_position <= 5);
+    print_test_result("Closed loop tracks square-wave target", test_passed);
+
+    /* Test 5: Bit-identical replay */
+    test_passed = (first.checksum == second.checksum) &&
+                  (first.final_position == second.final_position) &&
+                  (first.control_runs == second.control_runs);
+    print_test_result("Repeated run is deterministic", test_passed);
+
+    printf("\n");
+}
+
+/**
+ * @brief Run 60 s of safety/control/plant tasks on the virtual clock
+ */
+static void run_lockstep_scenario(lockstep_result_t *result) {
+    memset(result, 0, sizeof(*result));
+
+    l6470_sim_send_command(0xB8, 0); /* HardStop */
+    l6470_sim_send_command(0xD8, 0); /* RESET_POS */
+    simulation_start_physics();
+
+    virtual_time_set_clock_sink(NULL);
+    virtual_time_reset();
+    virtual_time_add_task("safety", LOCKSTEP_SAFETY_PERIOD_US, 0,
+                          lockstep_safety_task, result);
+    virtual_time_add_task("control", LOCKSTEP_CONTROL_PERIOD_US, 0,
+                          lockstep_control_task, result);
+    virtual_time_add_task("plant", LOCKSTEP_CONTROL_PERIOD_US, 0,
+                          lockstep_plant_task, result);
+    lockstep_clock_ms = &result->last_clock_ms;
+    virtual_time_set_clock_sink(lockstep_clock_sink);
+
+    virtual_time_run_for(LOCKSTEP_DURATION_US);
+
+    virtual_time_set_clock_sink(NULL);
+    simulation_stop_physics();
+    l6470_sim_send_command(0xB8, 0);
+
+    simulation_status_t status;
+    simulation_get_status(&status);
+    result->final_position = status.motor_position;
+}
+
+/**
+ * @brief Clock sink standing in for the mock HAL clock
+ */
+static void lockstep_clock_sink(uint64_t now_us) {
+    if (lockstep_clock_ms) {
+        *lockstep_clock_ms = (uint32_t)(now_us / 1000U);
+    }
+}
+
+/**
+ * @brief 10 kHz task: sample STATUS and ABS_POS
+ */
+static void lockstep_safety_task(void *context) {
+    lockstep_result_t *result = (lockstep_result_t *)context;
+    uint32_t status_reg = 0;
+    uint32_t position = 0;
+
+    l6470_sim_read_register(0x19, &status_reg);
+    l6470_sim_read_register(0x01, &position);
+    result->checksum = (result->checksum * 31U) ^ status_reg ^ position;
+    if ((int32_t)position > result->peak_position && position < 0x200000U) {
+        result->peak_position = (int32_t)position;
+    }
+    result->safety_runs++;
+    if (lockstep_waiting) {
+        result->safety_during_wait++;
+    }
+}
+
+/**
+ * @brief 1 kHz task: proportional speed control towards a square wave
+ */
+static void lockstep_control_task(void *context) {
+    lockstep_result_t *result = (lockstep_result_t *)context;
+    uint32_t now_ms = virtual_time_now_ms();
+    simulation_status_t status;
+
+    result->control_runs++;
+
+    /* Target toggles between 0 and 400 steps every 2 s */
+    int32_t target = ((now_ms / 2000U) % 2U == 0U) ? 400 : 0;
+    simulation_get_status(&status);
+    int32_t error = target - status.motor_position;
+
+    if (error == 0) {
+        l6470_sim_send_command(0xB0, 0); /* SoftStop */
+    } else {
+        int32_t magnitude = (error < 0) ? -error : error;
+        uint32_t speed = (uint32_t)(magnitude * 0x400);
+        if (speed > 0x8000) {
+            speed = 0x8000;
+        }
+        l6470_sim_send_command(error > 0 ? 0x51 : 0x50, speed);
+    }
+
+    /* Exercise a blocking wait from inside a task once */
+    if (now_ms == LOCKSTEP_WAIT_AT_MS) {
+        lockstep_waiting = true;
+        virtual_time_wait(LOCKSTEP_WAIT_US);
+        lockstep_waiting = false;
+    }
+}
+
+/**
+ * @brief 1 kHz task: advance motor physics by one control period
+ */
+static void lockstep_plant_task(void *context) {
+    lockstep_result_t *result = (lockstep_result_t *)context;
+
+    simulation_advance_time(LOCKSTEP_CONTROL_PERIOD_US / 1000U);
+    result->plant_runs++;
+}
+
 /**
  * @brief Print test result
  */
 static void print_test_result(const char *test_name, bool passed) {
     printf("   %s %s\n", passed ? "✅" : "❌", test_name);
+    if (!passed) {
+        failed_tests++;
+    }
 }
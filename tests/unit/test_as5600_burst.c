@@ -0,0 +1,183 @@
+/**
+ * @file test_as5600_burst.c
+ * @brief Unit tests for the AS5600 single-transaction burst read
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Runs drivers/as5600/as5600_driver.c against the mock HAL with the
+ * simulation backend stubbed out, so every read goes through
+ * HAL_Abstraction_I2C_MemRead().
+ */
+
+#include "mock_hal_abstraction.h"
+#include "drivers/as5600/as5600_driver.h"
+#include "simulation/motor_simulation.h"
+#include "unity.h"
+#include <string.h>
+
+// Offsets inside a burst that starts at STATUS
+#define BURST_OFFSET(reg) ((reg) - AS5600_REG_STATUS)
+
+static HAL_I2C_Instance_t encoder_bus(uint8_t encoder_id) {
+    return encoder_id == 0 ? HAL_I2C_INSTANCE_1 : HAL_I2C_INSTANCE_2;
+}
+
+static MockI2C_Internal_t *encoder_i2c(uint8_t encoder_id) {
+    return &mock_hal_state.i2c_instances[encoder_bus(encoder_id)];
+}
+
+/**
+ * @brief Program a full register window; reserved bytes are non-zero so a
+ *        decode that reads the gap shows up
+ */
+static void respond_full(uint8_t encoder_id, uint8_t status) {
+    uint8_t block[AS5600_BURST_FULL_SIZE];
+    memset(block, 0xEE, sizeof(block));
+    block[BURST_OFFSET(AS5600_REG_STATUS)] = status;
+    block[BURST_OFFSET(AS5600_REG_RAW_ANGLE_H)] = 0xF4;
+    block[BURST_OFFSET(AS5600_REG_RAW_ANGLE_L)] = 0x56;
+    block[BURST_OFFSET(AS5600_REG_ANGLE_H)] = 0xF7;
+    block[BURST_OFFSET(AS5600_REG_ANGLE_L)] = 0x89;
+    block[BURST_OFFSET(AS5600_REG_AGC)] = 0x80;
+    block[BURST_OFFSET(AS5600_REG_MAGNITUDE_H)] = 0xF1;
+    block[BURST_OFFSET(AS5600_REG_MAGNITUDE_L)] = 0x23;
+    MockHAL_SetI2CResponse(encoder_bus(encoder_id), block, sizeof(block));
+}
+
+static void init_encoders(void) {
+    respond_full(0, AS5600_STATUS_MD);
+    respond_full(1, AS5600_STATUS_MD);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, as5600_init());
+}
+
+void setUp(void) {
+    MockHAL_Reset();
+}
+
+void tearDown(void) {
+}
+
+void test_init_reads_each_encoder_with_one_full_burst(void) {
+    // as5600_init_encoder runs before the driver is marked initialized
+    init_encoders();
+    TEST_ASSERT_TRUE(as5600_is_initialized());
+
+    for (uint8_t id = 0; id < AS5600_MAX_ENCODERS; id++) {
+        TEST_ASSERT_EQUAL_UINT32(1U, encoder_i2c(id)->call_count);
+        TEST_ASSERT_EQUAL_HEX16(AS5600_I2C_ADDRESS_8BIT,
+                                encoder_i2c(id)->last_device_address);
+        TEST_ASSERT_EQUAL_HEX16(AS5600_REG_STATUS,
+                                encoder_i2c(id)->last_register_address);
+        TEST_ASSERT_EQUAL_UINT16(18U, encoder_i2c(id)->last_data_size);
+    }
+}
+
+void test_init_fails_without_a_magnet(void) {
+    respond_full(0, 0x00);
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_MAGNET_NOT_DETECTED,
+                      as5600_init_encoder(0));
+}
+
+void test_angles_burst_reads_five_registers_from_status(void) {
+    const uint8_t block[AS5600_BURST_ANGLES_SIZE] = {AS5600_STATUS_MD, 0xFA,
+                                                     0xBC, 0xF1, 0x23};
+    AS5600_Sample_t sample;
+
+    init_encoders();
+    MockHAL_SetI2CResponse(encoder_bus(1), block, sizeof(block));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      as5600_read_burst(1, AS5600_BURST_ANGLES, &sample));
+
+    TEST_ASSERT_EQUAL_UINT32(2U, encoder_i2c(1)->call_count);
+    TEST_ASSERT_EQUAL_HEX16(AS5600_REG_STATUS,
+                            encoder_i2c(1)->last_register_address);
+    TEST_ASSERT_EQUAL_UINT16(5U, encoder_i2c(1)->last_data_size);
+
+    // The reserved top nibbles are masked off
+    TEST_ASSERT_EQUAL_HEX8(AS5600_STATUS_MD, sample.status);
+    TEST_ASSERT_EQUAL_HEX16(0x0ABC, sample.raw_angle);
+    TEST_ASSERT_EQUAL_HEX16(0x0123, sample.angle);
+    TEST_ASSERT_EQUAL_HEX8(0x00, sample.agc);
+    TEST_ASSERT_EQUAL_HEX16(0x0000, sample.magnitude);
+}
+
+void test_full_burst_skips_the_reserved_gap(void) {
+    AS5600_Sample_t sample;
+
+    init_encoders();
+    respond_full(0, AS5600_STATUS_MD | AS5600_STATUS_ML);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      as5600_read_burst(0, AS5600_BURST_FULL, &sample));
+
+    TEST_ASSERT_EQUAL_UINT16(18U, encoder_i2c(0)->last_data_size);
+    TEST_ASSERT_EQUAL_HEX8(AS5600_STATUS_MD | AS5600_STATUS_ML, sample.status);
+    TEST_ASSERT_EQUAL_HEX16(0x0456, sample.raw_angle);
+    TEST_ASSERT_EQUAL_HEX16(0x0789, sample.angle);
+    TEST_ASSERT_EQUAL_HEX8(0x80, sample.agc);
+    TEST_ASSERT_EQUAL_HEX16(0x0123, sample.magnitude);
+}
+
+void test_missing_magnet_is_reported_with_the_sample(void) {
+    const uint8_t block[AS5600_BURST_ANGLES_SIZE] = {0x00, 0x01, 0x00, 0x02,
+                                                     0x00};
+    AS5600_Sample_t sample;
+    bool magnet_ok = true;
+
+    init_encoders();
+    MockHAL_SetI2CResponse(encoder_bus(0), block, sizeof(block));
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_MAGNET_NOT_DETECTED,
+                      as5600_read_burst(0, AS5600_BURST_ANGLES, &sample));
+    TEST_ASSERT_EQUAL_HEX16(0x0100, sample.raw_angle);
+    TEST_ASSERT_EQUAL_HEX16(0x0200, sample.angle);
+
+    // STATUS is read back as zero by default: still no magnet
+    TEST_ASSERT_EQUAL(SYSTEM_OK, as5600_check_magnet(0, &magnet_ok));
+    TEST_ASSERT_FALSE(magnet_ok);
+}
+
+void test_burst_rejects_bad_arguments_and_counts_bus_errors(void) {
+    AS5600_Sample_t sample;
+    uint32_t errors = 0;
+
+    init_encoders();
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_CONFIG_INVALID,
+                      as5600_read_burst(0, AS5600_BURST_ANGLES, NULL));
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_CONFIG_INVALID,
+                      as5600_read_burst(0, (AS5600_BurstMode_t)7, &sample));
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_INVALID_ID,
+                      as5600_read_burst(AS5600_MAX_ENCODERS,
+                                        AS5600_BURST_ANGLES, &sample));
+
+    mock_hal_state.inject_i2c_failure = true;
+    TEST_ASSERT_EQUAL(ERROR_ENCODER_COMMUNICATION,
+                      as5600_read_burst(0, AS5600_BURST_ANGLES, &sample));
+    mock_hal_state.inject_i2c_failure = false;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, as5600_get_error_count(0, &errors));
+    TEST_ASSERT_EQUAL_UINT32(1U, errors);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_init_reads_each_encoder_with_one_full_burst);
+    RUN_TEST(test_init_fails_without_a_magnet);
+    RUN_TEST(test_angles_burst_reads_five_registers_from_status);
+    RUN_TEST(test_full_burst_skips_the_reserved_gap);
+    RUN_TEST(test_missing_magnet_is_reported_with_the_sample);
+    RUN_TEST(test_burst_rejects_bad_arguments_and_counts_bus_errors);
+    return UNITY_END();
+}
+
+/* Simulation backend stubs: hardware mode only */
+
+bool motor_simulation_is_active(void) {
+    return false;
+}
+
+bool as5600_sim_read_register(uint8_t encoder_id, uint8_t reg_addr,
+                              uint8_t *value) {
+    (void)encoder_id;
+    (void)reg_addr;
+    (void)value;
+    TEST_FAIL_MESSAGE("simulation backend used in hardware mode");
+    return false;
+}
@@ -0,0 +1,162 @@
+/**
+ * @file test_comm_ascii.c
+ * @brief Unit tests for the ASCII tokenizer and verb dispatch
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_ascii.h"
+#include "config/motor_config.h"
+#include "unity.h"
+#include <string.h>
+
+static const CommAsciiVerb_t *last_verb;
+static CommAsciiArgs_t last_args;
+static uint32_t calls;
+
+static SystemError_t record(const CommAsciiVerb_t *verb,
+                            const CommAsciiArgs_t *args) {
+    last_verb = verb;
+    last_args = *args;
+    calls++;
+    return SYSTEM_OK;
+}
+
+static const CommAsciiVerb_t verbs[COMM_ASCII_VERB_SLOTS] = {
+    [COMM_ASCII_VERB_SLOT('M', 'E', 4)] = {"MOVE", "mii", 1, record},
+    [COMM_ASCII_VERB_SLOT('S', 'P', 4)] = {"STOP", "m", 2, record},
+    [COMM_ASCII_VERB_SLOT('E', 'P', 5)] = {"ESTOP", "m", 3, record},
+    [COMM_ASCII_VERB_SLOT('H', 'E', 4)] = {"HOME", "m", 4, record},
+    [COMM_ASCII_VERB_SLOT('S', 'S', 6)] = {"STATUS", "m", 5, record},
+    [COMM_ASCII_VERB_SLOT('Q', 'E', 5)] = {"QUEUE", "i*", 6, record},
+};
+
+void setUp(void) {
+    last_verb = NULL;
+    memset(&last_args, 0, sizeof(last_args));
+    calls = 0;
+}
+
+void tearDown(void) {
+}
+
+static SystemError_t parse(const char *line) {
+    return comm_ascii_parse(verbs, line, &last_verb, &last_args);
+}
+
+void test_tokenize_in_place(void) {
+    const char *line = "  MOVE\t0   -1200 800 ";
+    CommAsciiToken_t tokens[COMM_ASCII_MAX_TOKENS];
+
+    TEST_ASSERT_EQUAL_UINT8(4U, comm_ascii_tokenize(line, tokens, 8));
+    TEST_ASSERT_EQUAL_PTR(line + 2, tokens[0].text);
+    TEST_ASSERT_EQUAL_UINT16(4U, tokens[0].length);
+    TEST_ASSERT_EQUAL_PTR(line + 11, tokens[2].text);
+    TEST_ASSERT_EQUAL_UINT16(5U, tokens[2].length);
+
+    // Tokens beyond the capacity are counted, not stored
+    TEST_ASSERT_EQUAL_UINT8(4U, comm_ascii_tokenize(line, tokens, 2));
+    TEST_ASSERT_EQUAL_UINT8(0U, comm_ascii_tokenize("   ", tokens, 8));
+}
+
+void test_parse_int32_limits(void) {
+    int32_t value;
+    CommAsciiToken_t token;
+
+    token = (CommAsciiToken_t){"2147483647", 10};
+    TEST_ASSERT_TRUE(comm_ascii_parse_int32(&token, &value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MAX, value);
+    token = (CommAsciiToken_t){"-2147483648", 11};
+    TEST_ASSERT_TRUE(comm_ascii_parse_int32(&token, &value));
+    TEST_ASSERT_EQUAL_INT32(INT32_MIN, value);
+    token = (CommAsciiToken_t){"+42 trailing", 3};
+    TEST_ASSERT_TRUE(comm_ascii_parse_int32(&token, &value));
+    TEST_ASSERT_EQUAL_INT32(42, value);
+
+    token = (CommAsciiToken_t){"2147483648", 10};
+    TEST_ASSERT_FALSE(comm_ascii_parse_int32(&token, &value));
+    token = (CommAsciiToken_t){"12a", 3};
+    TEST_ASSERT_FALSE(comm_ascii_parse_int32(&token, &value));
+    token = (CommAsciiToken_t){"-", 1};
+    TEST_ASSERT_FALSE(comm_ascii_parse_int32(&token, &value));
+}
+
+void test_every_verb_is_found(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_ascii_check_table(verbs));
+
+    for (uint32_t slot = 0; slot < COMM_ASCII_VERB_SLOTS; slot++) {
+        if (verbs[slot].name == NULL) {
+            continue;
+        }
+        CommAsciiToken_t token = {verbs[slot].name,
+                                  (uint16_t)strlen(verbs[slot].name)};
+        TEST_ASSERT_EQUAL_PTR(&verbs[slot],
+                              comm_ascii_find_verb(verbs, &token));
+    }
+}
+
+void test_unknown_and_prefix_verbs_are_rejected(void) {
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("JUMP 0"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("MOV 0 1 2"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("MOVEE 0 1 2"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("move 0 1 2"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse(""));
+}
+
+void test_typed_arguments(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, parse("MOVE 1 -5000 1600"));
+    TEST_ASSERT_EQUAL_UINT8(1U, last_verb->code);
+    TEST_ASSERT_EQUAL_UINT8(3U, last_args.count);
+    TEST_ASSERT_EQUAL_INT32(1, last_args.values[0]);
+    TEST_ASSERT_EQUAL_INT32(-5000, last_args.values[1]);
+    TEST_ASSERT_EQUAL_INT32(1600, last_args.values[2]);
+
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("MOVE 1 -5000"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("STOP 0 1"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("STOP x"));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_INVALID_ID, parse("HOME 9"));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_INVALID_ID, parse("HOME -1"));
+}
+
+void test_repeated_arguments(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, parse("QUEUE 100 -200 300 400"));
+    TEST_ASSERT_EQUAL_UINT8(4U, last_args.count);
+    TEST_ASSERT_EQUAL_INT32(400, last_args.values[3]);
+
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND, parse("QUEUE"));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND,
+                      parse("QUEUE 1 2 3 4 5 6 7 8"));
+}
+
+void test_dispatch_runs_handler(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_ascii_dispatch(verbs, "ESTOP 0"));
+    TEST_ASSERT_EQUAL_UINT32(1U, calls);
+    TEST_ASSERT_EQUAL_STRING("ESTOP", last_verb->name);
+
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_COMMAND,
+                      comm_ascii_dispatch(verbs, "ESTOP"));
+    TEST_ASSERT_EQUAL_UINT32(1U, calls);
+}
+
+void test_misplaced_verb_is_detected(void) {
+    CommAsciiVerb_t table[COMM_ASCII_VERB_SLOTS] = {0};
+    table[COMM_ASCII_VERB_SLOT('M', 'E', 4)] =
+        (CommAsciiVerb_t){"MAKE", "", 0, record};
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_ascii_check_table(table));
+
+    table[0] = (CommAsciiVerb_t){"MOVE", "", 0, record};
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER, comm_ascii_check_table(table));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_tokenize_in_place);
+    RUN_TEST(test_parse_int32_limits);
+    RUN_TEST(test_every_verb_is_found);
+    RUN_TEST(test_unknown_and_prefix_verbs_are_rejected);
+    RUN_TEST(test_typed_arguments);
+    RUN_TEST(test_repeated_arguments);
+    RUN_TEST(test_dispatch_runs_handler);
+    RUN_TEST(test_misplaced_verb_is_detected);
+    return UNITY_END();
+}
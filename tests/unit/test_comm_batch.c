@@ -0,0 +1,517 @@
+/**
+ * @file test_comm_batch.c
+ * @brief Unit tests for MOTOR_CMD_BATCH staging, scheduling and cancel,
+ *        and for the binary replies to batched commands
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Runs communication/comm_protocol.c unchanged on the host transport
+ * (simulation/comm_host_transport.c) with the mock HAL clock. Frames are
+ * written to the client end of the UART socket; the test plays both the
+ * communication task (poll + comm_protocol_task) and the control task
+ * (comm_apply_pending_batch). Batches start the real motion profiles; the
+ * motor controller is stubbed and records the stops it is asked for.
+ */
+
+#include "communication/comm_frame_decoder.h"
+#include "communication/comm_protocol.h"
+#include "controllers/motion_lookahead.h"
+#include "controllers/motion_profile.h"
+#include "controllers/motion_pvt.h"
+#include "controllers/motor_controller.h"
+#include "controllers/multi_motor_coordinator.h"
+#include "controllers/position_control.h"
+#include "controllers/position_safety.h"
+#include "hal_abstraction/hal_abstraction.h"
+#include "mock_hal_abstraction.h"
+#include "safety/fault_monitor.h"
+#include "simulation/comm_host_transport.h"
+#include "unity.h"
+#include <math.h>
+#include <string.h>
+#include <sys/socket.h>
+
+#define START_US 1000000U
+#define SOFT_LIMIT_DEG 90.0f ///< Symmetric soft limit of the safety stub
+
+static UART_HandleTypeDef huart;
+static FDCAN_HandleTypeDef hfdcan;
+static comm_host_transport_peer_t peer;
+static bool transport_ready;
+static uint16_t next_message_id;
+
+static uint32_t stops;       ///< motor_controller_stop_motor calls
+static uint32_t estops;      ///< motor_controller_emergency_stop calls
+static uint8_t pvt_queued;   ///< Points pushed to the PVT stub
+static uint8_t pvt_aborted;  ///< Motors whose PVT stream was aborted (bits)
+static int32_t setpoint[MAX_MOTORS]; ///< Position control setpoint stub
+
+static void run_comm_task(void) {
+    for (int i = 0; i < 8; i++) {
+        comm_host_transport_poll(0);
+        comm_protocol_task();
+    }
+}
+
+static void advance_us(uint32_t us) {
+    MockHAL_SetVirtualTime(HAL_Abstraction_GetMicroseconds() + us);
+}
+
+/**
+ * @brief Send a command followed by entry_length bytes of entries
+ * @return message_id of the frame
+ */
+static uint16_t send_frame(const MotorCommand_t *command, const void *entries,
+                           uint16_t entry_length) {
+    uint8_t payload[MAX_MESSAGE_PAYLOAD];
+    uint16_t length = sizeof(*command);
+
+    memcpy(payload, command, sizeof(*command));
+    if (entry_length != 0) {
+        memcpy(payload + length, entries, entry_length);
+        length += entry_length;
+    }
+
+    MessageHeader_t header = {.magic = MESSAGE_HEADER_MAGIC,
+                              .message_id = ++next_message_id,
+                              .payload_length = length,
+                              .protocol_type = PROTOCOL_UART_BINARY};
+    header.checksum =
+        comm_frame_checksum((const uint8_t *)&header, payload, length);
+
+    uint8_t frame[sizeof(header) + sizeof(payload)];
+    memcpy(frame, &header, sizeof(header));
+    memcpy(frame + sizeof(header), payload, length);
+    TEST_ASSERT_EQUAL((ssize_t)(sizeof(header) + length),
+                      send(peer.uart_fd, frame, sizeof(header) + length,
+                           MSG_NOSIGNAL));
+    run_comm_task();
+    return header.message_id;
+}
+
+static void fill_moves(MotorCommand_t *entries, uint8_t count) {
+    memset(entries, 0, (size_t)count * sizeof(entries[0]));
+    for (uint8_t i = 0; i < count; i++) {
+        entries[i].motor_id = i;
+        entries[i].command = MOTOR_CMD_MOVE_ABSOLUTE;
+        entries[i].data.move.position_steps = 200 * (i + 1);
+        entries[i].data.move.speed_steps_per_sec = 500;
+    }
+}
+
+static uint16_t send_entries(const MotorCommand_t *entries, uint8_t count,
+                             uint8_t flags, uint32_t start_sync_us) {
+    MotorCommand_t command = {.command = MOTOR_CMD_BATCH};
+
+    command.data.batch.command_count = count;
+    command.data.batch.flags = flags;
+    command.data.batch.start_sync_us = start_sync_us;
+    return send_frame(&command, entries, count * sizeof(entries[0]));
+}
+
+/**
+ * @brief Send a batch moving motors 0..count-1
+ * @return message_id of the frame
+ */
+static uint16_t send_batch(uint8_t count, uint8_t flags,
+                           uint32_t start_sync_us) {
+    MotorCommand_t entries[COMM_BATCH_MAX_COMMANDS];
+
+    fill_moves(entries, count);
+    return send_entries(entries, count, flags, start_sync_us);
+}
+
+static uint32_t moves(void) {
+    uint32_t active = 0;
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        active += motion_profile_is_active(i) ? 1U : 0U;
+    }
+    return active;
+}
+
+static void send_motor_command(MotorCommandType_t type) {
+    MotorCommand_t command = {.motor_id = 0, .command = type};
+    send_frame(&command, NULL, 0U);
+}
+
+/**
+ * @brief Read one binary reply frame carrying a CommAck_t
+ * @return message_id of the reply
+ */
+static uint16_t read_ack(CommAck_t *ack) {
+    MessageHeader_t header;
+    uint8_t frame[sizeof(header) + sizeof(*ack)];
+
+    run_comm_task();
+    TEST_ASSERT_EQUAL((ssize_t)sizeof(frame),
+                      recv(peer.uart_fd, frame, sizeof(frame), MSG_DONTWAIT));
+    memcpy(&header, frame, sizeof(header));
+    memcpy(ack, frame + sizeof(header), sizeof(*ack));
+
+    TEST_ASSERT_EQUAL_HEX32(MESSAGE_HEADER_MAGIC, header.magic);
+    TEST_ASSERT_EQUAL(PROTOCOL_UART_BINARY, header.protocol_type);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(*ack), header.payload_length);
+    TEST_ASSERT_EQUAL_HEX16(
+        comm_frame_checksum(frame, frame + sizeof(header), sizeof(*ack)),
+        header.checksum);
+    return header.message_id;
+}
+
+/**
+ * @brief Read the ack of a batch frame
+ * @return Result carried by the ack
+ */
+static SystemError_t read_batch_ack(uint16_t message_id, uint8_t count) {
+    CommAck_t ack;
+
+    TEST_ASSERT_EQUAL_UINT16(message_id, read_ack(&ack));
+    TEST_ASSERT_EQUAL_UINT8(MOTOR_CMD_BATCH, ack.command);
+    TEST_ASSERT_EQUAL_UINT8(count, ack.motor_id);
+    return (SystemError_t)ack.result;
+}
+
+static void expect_no_reply(void) {
+    char c;
+    run_comm_task();
+    TEST_ASSERT_TRUE(recv(peer.uart_fd, &c, 1, MSG_DONTWAIT) < 0);
+}
+
+void setUp(void) {
+    if (!transport_ready) {
+        MockHAL_Reset();
+        MockHAL_SetVirtualTime(START_US);
+        TEST_ASSERT_EQUAL(SYSTEM_OK, comm_protocol_init());
+        TEST_ASSERT_EQUAL(SIM_OK,
+                          comm_host_transport_open(&huart, &hfdcan, &peer));
+        TEST_ASSERT_EQUAL(SYSTEM_OK,
+                          comm_uart_init(&huart, PROTOCOL_UART_BINARY));
+        // This node is the time sync master: sync time is the local tick
+        TEST_ASSERT_EQUAL(SYSTEM_OK, comm_can_init(&hfdcan));
+        transport_ready = true;
+    }
+    motion_profile_init();
+    stops = 0;
+    estops = 0;
+    pvt_queued = 0;
+    pvt_aborted = 0;
+    memset(setpoint, 0, sizeof(setpoint));
+}
+
+void tearDown(void) {
+    char buffer[256];
+
+    // Leave no batch behind for the next test
+    comm_cancel_pending_batch();
+    run_comm_task();
+    while (recv(peer.uart_fd, buffer, sizeof(buffer), MSG_DONTWAIT) > 0) {
+    }
+}
+
+void test_batch_starts_every_axis_in_the_same_tick(void) {
+    setpoint[1] = 1000;
+    uint16_t id = send_batch(2, 0, 0);
+
+    // Nothing moves before the control task runs
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+    expect_no_reply();
+
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(2, moves());
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(id, 2));
+
+    // Each profile runs from its motor's setpoint towards the entry target
+    int32_t pos;
+    int32_t vel;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_update(1, &pos, &vel));
+    TEST_ASSERT_TRUE(pos <= 1000 && pos > 400);
+    TEST_ASSERT_EQUAL_HEX8(0x03, pvt_aborted);
+}
+
+void test_batch_is_all_or_nothing(void) {
+    MotorCommand_t entries[COMM_BATCH_MAX_COMMANDS];
+
+    // Beyond the soft limit
+    fill_moves(entries, 2);
+    entries[1].data.move.position_steps =
+        (int32_t)(2.0f * SOFT_LIMIT_DEG / STEPS_TO_DEGREES);
+    uint16_t id = send_entries(entries, 2, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_POSITION_LIMIT_EXCEEDED, read_batch_ack(id, 2));
+
+    // Two entries for one motor
+    fill_moves(entries, 2);
+    entries[1].motor_id = 0;
+    id = send_entries(entries, 2, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_MESSAGE, read_batch_ack(id, 2));
+
+    // A command that needs the driver or encoder bus
+    fill_moves(entries, 2);
+    entries[1].command = MOTOR_CMD_HOME;
+    id = send_entries(entries, 2, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_COMM_UNSUPPORTED_COMMAND, read_batch_ack(id, 2));
+
+    // A zero speed
+    fill_moves(entries, 2);
+    entries[0].data.move.speed_steps_per_sec = 0;
+    id = send_entries(entries, 2, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_SPEED_LIMIT, read_batch_ack(id, 2));
+
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+    TEST_ASSERT_EQUAL_HEX8(0, pvt_aborted);
+    expect_no_reply();
+}
+
+void test_batch_stop_entry_ends_a_profile(void) {
+    uint16_t id = send_batch(2, 0, 0);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(2, moves());
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(id, 2));
+
+    MotorCommand_t stop = {.motor_id = 1, .command = MOTOR_CMD_STOP};
+    id = send_entries(&stop, 1, 0, 0);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(id, 1));
+    TEST_ASSERT_TRUE(motion_profile_is_active(0));
+    TEST_ASSERT_FALSE(motion_profile_is_active(1));
+    TEST_ASSERT_EQUAL_UINT32(0, stops); // No driver command from the tick
+}
+
+void test_busy_frame_keeps_the_pending_start_time(void) {
+    uint32_t start = HAL_Abstraction_GetMicroseconds() + 10000U;
+    uint16_t pending = send_batch(2, BATCH_FLAG_SYNC_START, start);
+
+    // A second batch is refused and must not release the first early
+    uint16_t id = send_batch(1, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_COMM_BUSY, read_batch_ack(id, 1));
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+
+    // So is a malformed one
+    id = send_batch(0, 0, 0);
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_MESSAGE, read_batch_ack(id, 0));
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+
+    // The pending batch is still answered under its own message_id
+    advance_us(10000U);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(2, moves());
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(pending, 2));
+}
+
+void test_stop_cancels_a_pending_batch(void) {
+    uint32_t start = HAL_Abstraction_GetMicroseconds() + 10000U;
+    uint16_t id = send_batch(2, BATCH_FLAG_SYNC_START, start);
+
+    send_motor_command(MOTOR_CMD_STOP);
+    TEST_ASSERT_EQUAL_UINT32(1, stops);
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_MOVE_ABORTED, read_batch_ack(id, 2));
+
+    advance_us(10000U);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+
+    // The next batch is accepted straight away
+    id = send_batch(1, 0, 0);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(1, moves());
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(id, 1));
+}
+
+void test_emergency_stop_cancels_a_pending_batch(void) {
+    uint32_t start = HAL_Abstraction_GetMicroseconds() + 10000U;
+    uint16_t id = send_batch(2, BATCH_FLAG_SYNC_START, start);
+
+    send_motor_command(MOTOR_CMD_EMERGENCY_STOP);
+    TEST_ASSERT_EQUAL_UINT32(1, estops);
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_MOVE_ABORTED, read_batch_ack(id, 2));
+
+    advance_us(10000U);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+}
+
+void test_cancel_leaves_an_applied_batch_alone(void) {
+    uint16_t id = send_batch(1, 0, 0);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(1, moves());
+
+    // Coordinated and safety stops cancel unconditionally
+    comm_cancel_pending_batch();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, read_batch_ack(id, 1));
+    expect_no_reply();
+}
+
+void test_start_beyond_the_horizon_is_refused(void) {
+    uint32_t now = HAL_Abstraction_GetMicroseconds();
+
+    uint16_t id = send_batch(1, BATCH_FLAG_SYNC_START,
+                             now + (uint32_t)INT32_MAX + 1U);
+    TEST_ASSERT_EQUAL(ERROR_TIMEOUT, read_batch_ack(id, 1));
+    id = send_batch(1, BATCH_FLAG_SYNC_START, now);
+    TEST_ASSERT_EQUAL(ERROR_TIMEOUT, read_batch_ack(id, 1));
+
+    // Nothing was staged; the furthest start the control task can compare
+    // against is accepted
+    send_batch(1, BATCH_FLAG_SYNC_START, now + (uint32_t)INT32_MAX);
+    comm_apply_pending_batch();
+    TEST_ASSERT_EQUAL_UINT32(0, moves());
+    expect_no_reply();
+}
+
+void test_pvt_batch_is_acked_in_binary(void) {
+    MotorCommand_t command = {.motor_id = 1,
+                              .command = MOTOR_CMD_PVT_POINTS};
+    PvtPoint_t points[2] = {{100, 0, 10}, {200, 0, 10}};
+    CommAck_t ack;
+
+    command.data.pvt.point_count = 2;
+    command.data.pvt.flags = PVT_BATCH_FLAG_BEGIN;
+    uint16_t id = send_frame(&command, points, sizeof(points));
+    TEST_ASSERT_EQUAL_UINT16(id, read_ack(&ack));
+    TEST_ASSERT_EQUAL_UINT8(MOTOR_CMD_PVT_POINTS, ack.command);
+    TEST_ASSERT_EQUAL_UINT8(1, ack.motor_id);
+    TEST_ASSERT_EQUAL_INT32(SYSTEM_OK, ack.result);
+    TEST_ASSERT_EQUAL_UINT8(2, ack.queued);
+
+    // Refusals are acked the same way
+    command.data.pvt.point_count = 3;
+    id = send_frame(&command, points, sizeof(points));
+    TEST_ASSERT_EQUAL_UINT16(id, read_ack(&ack));
+    TEST_ASSERT_EQUAL_INT32(ERROR_COMM_INVALID_MESSAGE, ack.result);
+    expect_no_reply();
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_batch_starts_every_axis_in_the_same_tick);
+    RUN_TEST(test_batch_is_all_or_nothing);
+    RUN_TEST(test_batch_stop_entry_ends_a_profile);
+    RUN_TEST(test_busy_frame_keeps_the_pending_start_time);
+    RUN_TEST(test_stop_cancels_a_pending_batch);
+    RUN_TEST(test_emergency_stop_cancels_a_pending_batch);
+    RUN_TEST(test_cancel_leaves_an_applied_batch_alone);
+    RUN_TEST(test_start_beyond_the_horizon_is_refused);
+    RUN_TEST(test_pvt_batch_is_acked_in_binary);
+    comm_host_transport_close();
+    return UNITY_END();
+}
+
+/* Controller, safety and fault monitor stubs */
+
+SystemError_t motor_controller_stop_motor(uint8_t motor_id) {
+    (void)motor_id;
+    stops++;
+    return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_emergency_stop(uint8_t motor_id) {
+    (void)motor_id;
+    estops++;
+    return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_move_to_position(uint8_t motor_id,
+                                                float target_position_deg) {
+    (void)motor_id;
+    (void)target_position_deg;
+    return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_home_motor(uint8_t motor_id) {
+    (void)motor_id;
+    return SYSTEM_OK;
+}
+
+SystemError_t motor_controller_get_state(uint8_t motor_id,
+                                         MotorState_t *state) {
+    (void)motor_id;
+    memset(state, 0, sizeof(*state));
+    return SYSTEM_OK;
+}
+
+SystemError_t position_control_get_status(uint8_t motor_id,
+                                          PositionControlStatus_t *status) {
+    memset(status, 0, sizeof(*status));
+    status->target_position = setpoint[motor_id];
+    status->current_position = setpoint[motor_id];
+    return SYSTEM_OK;
+}
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    (void)motor_id;
+}
+
+SystemError_t
+position_safety_validate_target(uint8_t motor_id, float target_position_deg,
+                                PositionValidationResult_t *result) {
+    (void)motor_id;
+    memset(result, 0, sizeof(*result));
+    result->soft_limit_ok = fabsf(target_position_deg) <= SOFT_LIMIT_DEG;
+    result->position_valid = result->soft_limit_ok;
+    return SYSTEM_OK;
+}
+
+SystemError_t multi_motor_queue_move(const CoordinatedMoveCommand_t *move_cmd) {
+    (void)move_cmd;
+    return SYSTEM_OK;
+}
+
+uint8_t motion_lookahead_free_slots(void) {
+    return 0;
+}
+
+SystemError_t motion_pvt_begin(uint8_t motor_id, int32_t start_position) {
+    (void)motor_id;
+    (void)start_position;
+    return SYSTEM_OK;
+}
+
+SystemError_t motion_pvt_push(uint8_t motor_id, const PvtPoint_t *points,
+                              uint8_t count) {
+    (void)motor_id;
+    (void)points;
+    pvt_queued += count;
+    return SYSTEM_OK;
+}
+
+void motion_pvt_abort(uint8_t motor_id) {
+    pvt_aborted |= (uint8_t)(1U << motor_id);
+}
+
+SystemError_t motion_pvt_get_status(uint8_t motor_id, PvtStatus_t *status) {
+    (void)motor_id;
+    memset(status, 0, sizeof(*status));
+    status->queued = pvt_queued;
+    status->free = (uint8_t)(MOTION_PVT_DEPTH - pvt_queued);
+    return SYSTEM_OK;
+}
+
+uint32_t fault_monitor_get_motor_faults(uint8_t motor_id) {
+    (void)motor_id;
+    return 0;
+}
+
+SystemError_t fault_monitor_record_system_fault(SystemFaultType_t fault_type,
+                                                FaultSeverity_t severity,
+                                                uint32_t additional_data) {
+    (void)fault_type;
+    (void)severity;
+    (void)additional_data;
+    return SYSTEM_OK;
+}
+
+bool safety_system_is_operational(void) {
+    return true;
+}
+
+bool safety_get_emergency_stop_state(void) {
+    return false;
+}
+
+void safety_log_event(SafetyEventType_t event, uint8_t motor_id,
+                      uint32_t additional_data) {
+    (void)event;
+    (void)motor_id;
+    (void)additional_data;
+}
@@ -0,0 +1,157 @@
+/**
+ * @file test_comm_can_rx.c
+ * @brief Unit tests for CAN receive routing over the loopback bus
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_can_rx.h"
+#include "unity.h"
+#include <string.h>
+
+static CommCanRx_t rx;
+static CommCanLoopback_t bus;
+static uint32_t move_frames;
+static uint32_t stop_frames;
+static uint8_t last_stop_motor;
+
+static SystemError_t on_move(const CommCanFrame_t *frame) {
+    TEST_ASSERT_EQUAL_HEX32(CAN_ID_MOVE_COMMAND, frame->id);
+    move_frames++;
+    return SYSTEM_OK;
+}
+
+static SystemError_t on_stop(const CommCanFrame_t *frame) {
+    if (frame->length < 1U) {
+        return ERROR_COMM_INVALID_MESSAGE;
+    }
+    last_stop_motor = frame->data[0];
+    stop_frames++;
+    return SYSTEM_OK;
+}
+
+static const CommCanRoute_t routes[] = {
+    {CAN_ID_MOVE_COMMAND, CAN_ID_MOVE_COMMAND, on_move},
+    {CAN_ID_STOP_COMMAND, CAN_ID_STOP_COMMAND, on_stop},
+};
+
+// Stands in for the FDCAN: filter, then hand the filter index to the ISR
+static uint32_t receive_all(void) {
+    CommCanFrame_t frame;
+    uint32_t accepted = 0;
+
+    while (comm_can_loopback_receive(&bus, &frame)) {
+        int32_t filter = comm_can_rx_match(&rx, frame.id);
+        if (filter >= 0 &&
+            comm_can_rx_dispatch(&rx, (uint32_t)filter, frame.id, frame.data,
+                                 frame.length, 0U)) {
+            accepted++;
+        }
+    }
+    return accepted;
+}
+
+static void send(uint32_t id, uint8_t byte0) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_can_loopback_send(&bus, id, &byte0, 1U));
+}
+
+void setUp(void) {
+    move_frames = 0;
+    stop_frames = 0;
+    last_stop_motor = 0xFFU;
+    comm_can_loopback_init(&bus);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_can_rx_init(&rx, routes, 2U));
+}
+
+void tearDown(void) {
+}
+
+void test_frames_route_to_their_handlers(void) {
+    send(CAN_ID_STOP_COMMAND, 1U);
+    send(CAN_ID_MOVE_COMMAND, 0U);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, receive_all());
+    // Nothing runs until the task drains the queues
+    TEST_ASSERT_EQUAL_UINT32(0U, stop_frames);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, comm_can_rx_process(&rx));
+    TEST_ASSERT_EQUAL_UINT32(1U, move_frames);
+    TEST_ASSERT_EQUAL_UINT32(1U, stop_frames);
+    TEST_ASSERT_EQUAL_UINT8(1U, last_stop_motor);
+}
+
+void test_other_nodes_traffic_is_filtered(void) {
+    send(CAN_ID_HEARTBEAT + 1U, 0U); // Another node's heartbeat
+    send(CAN_ID_TELEMETRY + 1U, 0U); // Another node's telemetry
+    send(CAN_ID_CALIBRATE_CMD, 0U);  // No route
+    send(CAN_ID_STOP_COMMAND, 0U);
+
+    TEST_ASSERT_EQUAL_UINT32(1U, receive_all());
+    TEST_ASSERT_EQUAL_UINT32(1U, comm_can_rx_process(&rx));
+    TEST_ASSERT_EQUAL_UINT32(0U, rx.unrouted);
+}
+
+void test_full_queue_drops_only_its_route(void) {
+    for (uint32_t i = 0; i < COMM_CAN_RX_QUEUE_DEPTH + 2U; i++) {
+        send(CAN_ID_STOP_COMMAND, (uint8_t)i);
+    }
+    send(CAN_ID_MOVE_COMMAND, 0U);
+
+    TEST_ASSERT_EQUAL_UINT32(COMM_CAN_RX_QUEUE_DEPTH + 1U, receive_all());
+    TEST_ASSERT_EQUAL_UINT32(2U, rx.queues[1].overflows);
+    TEST_ASSERT_EQUAL_UINT32(0U, rx.queues[0].overflows);
+
+    comm_can_rx_process(&rx);
+    TEST_ASSERT_EQUAL_UINT32(1U, move_frames);
+    TEST_ASSERT_EQUAL_UINT32(COMM_CAN_RX_QUEUE_DEPTH, stop_frames);
+    // Oldest frames are kept, newest dropped
+    TEST_ASSERT_EQUAL_UINT8(COMM_CAN_RX_QUEUE_DEPTH - 1U, last_stop_motor);
+}
+
+void test_unknown_filter_index_and_handler_errors_are_counted(void) {
+    uint8_t byte = 0;
+    TEST_ASSERT_FALSE(
+        comm_can_rx_dispatch(&rx, 2U, CAN_ID_STOP_COMMAND, &byte, 1U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, rx.unrouted);
+
+    TEST_ASSERT_TRUE(
+        comm_can_rx_dispatch(&rx, 1U, CAN_ID_STOP_COMMAND, NULL, 0U, 0U));
+    TEST_ASSERT_EQUAL_UINT32(1U, comm_can_rx_process(&rx));
+    TEST_ASSERT_EQUAL_UINT32(1U, rx.queues[1].errors);
+}
+
+void test_malformed_route_tables_are_refused(void) {
+    const CommCanRoute_t reversed[] = {{0x202U, 0x201U, on_move}};
+    const CommCanRoute_t extended[] = {{0x100U, 0x800U, on_move}};
+    const CommCanRoute_t no_handler[] = {{0x100U, 0x100U, NULL}};
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_rx_init(&rx, reversed, 1U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_rx_init(&rx, extended, 1U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_rx_init(&rx, no_handler, 1U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_rx_init(&rx, routes, 0U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_rx_init(&rx, routes, COMM_CAN_RX_ROUTES + 1U));
+}
+
+void test_dlc_codes_map_to_fd_lengths(void) {
+    TEST_ASSERT_EQUAL_UINT8(8U, comm_can_dlc_to_length(8U));
+    TEST_ASSERT_EQUAL_UINT8(12U, comm_can_dlc_to_length(9U));
+    TEST_ASSERT_EQUAL_UINT8(48U, comm_can_dlc_to_length(14U));
+    TEST_ASSERT_EQUAL_UINT8(64U, comm_can_dlc_to_length(15U));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frames_route_to_their_handlers);
+    RUN_TEST(test_other_nodes_traffic_is_filtered);
+    RUN_TEST(test_full_queue_drops_only_its_route);
+    RUN_TEST(test_unknown_filter_index_and_handler_errors_are_counted);
+    RUN_TEST(test_malformed_route_tables_are_refused);
+    RUN_TEST(test_dlc_codes_map_to_fd_lengths);
+    return UNITY_END();
+}
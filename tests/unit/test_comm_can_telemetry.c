@@ -0,0 +1,144 @@
+/**
+ * @file test_comm_can_telemetry.c
+ * @brief Unit tests for the CAN-FD telemetry publisher over the loopback bus
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_can_telemetry.h"
+#include "unity.h"
+#include <string.h>
+
+static CommCanTelemetry_t telemetry;
+static CommCanLoopback_t bus;
+static bool source_fails;
+
+static SystemError_t fake_source(uint8_t motor_id,
+                                 CommCanTelemetryMotor_t *sample) {
+    if (source_fails) {
+        return ERROR_MOTOR_COMMUNICATION_FAILED;
+    }
+    sample->position_steps = 1000 * (motor_id + 1);
+    sample->velocity_steps_per_sec = -50 * (motor_id + 1);
+    sample->fault_flags = 0x10U << motor_id;
+    sample->state = 2;
+    sample->status_flags = CAN_TELEMETRY_STATUS_ENABLED;
+    return SYSTEM_OK;
+}
+
+static CommCanTelemetryFrame_t receive_frame(void) {
+    CommCanFrame_t frame;
+    CommCanTelemetryFrame_t payload;
+
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    TEST_ASSERT_EQUAL_HEX32(CAN_ID_TELEMETRY, frame.id);
+    TEST_ASSERT_EQUAL_UINT8(CAN_MAX_MESSAGE_SIZE, frame.length);
+    memcpy(&payload, frame.data, sizeof(payload));
+    return payload;
+}
+
+void setUp(void) {
+    source_fails = false;
+    comm_can_loopback_init(&bus);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_can_telemetry_init(&telemetry, 1000U, fake_source,
+                                              comm_can_loopback_send, &bus));
+}
+
+void tearDown(void) {
+}
+
+void test_frame_packs_every_motor(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_can_telemetry_publish(&telemetry, 123456U));
+
+    CommCanTelemetryFrame_t frame = receive_frame();
+    TEST_ASSERT_EQUAL_UINT16(0U, frame.sequence);
+    TEST_ASSERT_EQUAL_UINT8(0U, frame.frame_index);
+    TEST_ASSERT_EQUAL_UINT8(COMM_CAN_TELEMETRY_FRAMES, frame.frame_count);
+    TEST_ASSERT_EQUAL_UINT32(123456U, frame.timestamp_us);
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        TEST_ASSERT_EQUAL_UINT8(i, frame.motors[i].motor_id);
+        TEST_ASSERT_EQUAL_INT32(1000 * (i + 1), frame.motors[i].position_steps);
+        TEST_ASSERT_EQUAL_INT32(-50 * (i + 1),
+                                frame.motors[i].velocity_steps_per_sec);
+        TEST_ASSERT_EQUAL_HEX32(0x10U << i, frame.motors[i].fault_flags);
+    }
+    // Records past the last motor are marked unused
+    TEST_ASSERT_EQUAL_UINT8(INVALID_DEVICE_ID,
+                            frame.motors[MAX_MOTORS].motor_id);
+}
+
+void test_poll_follows_rate_and_sequences_frames(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_can_telemetry_set_rate(&telemetry, 500U));
+
+    // First poll publishes; then once per 2 ms on the same grid
+    uint32_t published = 0;
+    for (uint32_t now = 10000U; now < 20000U; now += 250U) {
+        published += comm_can_telemetry_poll(&telemetry, now) ? 1U : 0U;
+    }
+    TEST_ASSERT_EQUAL_UINT32(5U, published);
+    TEST_ASSERT_EQUAL_UINT32(0U, telemetry.missed);
+
+    for (uint16_t i = 0; i < 5U; i++) {
+        TEST_ASSERT_EQUAL_UINT16(i, receive_frame().sequence);
+    }
+}
+
+void test_late_poll_skips_missed_periods(void) {
+    TEST_ASSERT_TRUE(comm_can_telemetry_poll(&telemetry, 0xFFFFF000U));
+
+    // 3.5 periods late (across the microsecond wrap): one publication
+    TEST_ASSERT_TRUE(comm_can_telemetry_poll(&telemetry, 0xFFFFF000U + 4500U));
+    TEST_ASSERT_FALSE(
+        comm_can_telemetry_poll(&telemetry, 0xFFFFF000U + 4900U));
+    TEST_ASSERT_TRUE(comm_can_telemetry_poll(&telemetry, 0xFFFFF000U + 5000U));
+    TEST_ASSERT_EQUAL_UINT32(3U, telemetry.missed);
+    TEST_ASSERT_EQUAL_UINT32(3U, telemetry.publications);
+}
+
+void test_failed_sample_is_marked_stale(void) {
+    source_fails = true;
+    comm_can_telemetry_publish(&telemetry, 0U);
+
+    CommCanTelemetryFrame_t frame = receive_frame();
+    TEST_ASSERT_EQUAL_UINT8(1U, frame.motors[1].motor_id);
+    TEST_ASSERT_EQUAL_HEX16(CAN_TELEMETRY_STATUS_STALE,
+                            frame.motors[1].status_flags);
+    TEST_ASSERT_EQUAL_INT32(0, frame.motors[1].position_steps);
+}
+
+void test_full_bus_counts_send_errors(void) {
+    for (uint32_t i = 0; i < COMM_CAN_LOOPBACK_DEPTH; i++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK,
+                          comm_can_telemetry_publish(&telemetry, i));
+    }
+    TEST_ASSERT_EQUAL(ERROR_COMM_BUSY,
+                      comm_can_telemetry_publish(&telemetry, 99U));
+    TEST_ASSERT_EQUAL_UINT32(COMM_CAN_LOOPBACK_DEPTH, telemetry.frames_sent);
+    TEST_ASSERT_EQUAL_UINT32(1U, telemetry.send_errors);
+    TEST_ASSERT_EQUAL_UINT32(1U, bus.overflows);
+}
+
+void test_rate_limits(void) {
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_telemetry_set_rate(&telemetry, 0U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_telemetry_set_rate(
+                          &telemetry, CAN_TELEMETRY_MAX_RATE_HZ + 1U));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_telemetry_init(&telemetry, 100U, NULL,
+                                              comm_can_loopback_send, &bus));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_packs_every_motor);
+    RUN_TEST(test_poll_follows_rate_and_sequences_frames);
+    RUN_TEST(test_late_poll_skips_missed_periods);
+    RUN_TEST(test_failed_sample_is_marked_stale);
+    RUN_TEST(test_full_bus_counts_send_errors);
+    RUN_TEST(test_rate_limits);
+    return UNITY_END();
+}
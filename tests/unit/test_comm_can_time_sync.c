@@ -0,0 +1,189 @@
+/**
+ * @file test_comm_can_time_sync.c
+ * @brief Unit tests for CAN time sync between a master and a drifting slave
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_can_time_sync.h"
+#include "unity.h"
+#include <string.h>
+
+#define SLAVE_OFFSET_US 0xFFF80000U // Slave tick wraps 0.52 s in
+#define SLAVE_DRIFT_PPM 150          // Slave crystal runs fast
+
+static CommCanTimeSync_t master;
+static CommCanTimeSync_t slave;
+static CommCanLoopback_t bus;
+
+// Slave tick at master tick t: offset, plus the crystal error
+static uint32_t slave_clock(uint32_t t) {
+    return SLAVE_OFFSET_US + t + (uint32_t)((uint64_t)t * SLAVE_DRIFT_PPM /
+                                            1000000U);
+}
+
+// One SYNC exchange at master tick t: the frame leaves the master at t and
+// is received by the slave at the same instant
+static void exchange(uint32_t t) {
+    CommCanFrame_t frame;
+
+    comm_can_time_sync_poll(&master, t);
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    TEST_ASSERT_EQUAL_HEX32(CAN_ID_TIME_SYNC, frame.id);
+    comm_can_time_sync_sent(&master, t);
+    frame.timestamp_us = slave_clock(t);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_can_time_sync_receive(&slave, &frame));
+
+    // FOLLOW_UP goes out on the next poll
+    comm_can_time_sync_poll(&master, t + 500U);
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    frame.timestamp_us = slave_clock(t + 500U);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_can_time_sync_receive(&slave, &frame));
+}
+
+static void run_syncs(uint32_t start, uint32_t count) {
+    for (uint32_t i = 0; i < count; i++) {
+        exchange(start + i * CAN_TIME_SYNC_PERIOD_MS * 1000U);
+    }
+}
+
+void setUp(void) {
+    comm_can_loopback_init(&bus);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_can_time_sync_init(&master, true,
+                                              comm_can_loopback_send, &bus));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_can_time_sync_init(&slave, false, NULL, NULL));
+}
+
+void tearDown(void) {
+}
+
+void test_slave_locks_after_two_pairs(void) {
+    uint32_t sync_us;
+
+    run_syncs(1000U, 1U);
+    TEST_ASSERT_FALSE(
+        comm_can_time_sync_get_time(&slave, slave_clock(1000U), &sync_us));
+
+    run_syncs(1000U + CAN_TIME_SYNC_PERIOD_MS * 1000U, 1U);
+    TEST_ASSERT_TRUE(
+        comm_can_time_sync_get_time(&slave, slave_clock(1000U), &sync_us));
+    TEST_ASSERT_EQUAL_UINT32(2U, slave.syncs);
+    TEST_ASSERT_EQUAL_UINT32(1U, slave.steps);
+}
+
+void test_timebase_tracks_master_between_syncs(void) {
+    run_syncs(0U, 10U);
+    // Against the fast slave tick, the master runs slow. 1 us ticks over
+    // a 100 ms period resolve the rate to a few ppm.
+    TEST_ASSERT_INT32_WITHIN(5000, -SLAVE_DRIFT_PPM * 1000, slave.drift_ppb);
+
+    // Half a period after the last sync, across the slave tick wrap
+    uint32_t t = 9U * CAN_TIME_SYNC_PERIOD_MS * 1000U + 50000U;
+    uint32_t sync_us;
+    TEST_ASSERT_TRUE(
+        comm_can_time_sync_get_time(&slave, slave_clock(t), &sync_us));
+    TEST_ASSERT_INT32_WITHIN(2, 0, (int32_t)(sync_us - t));
+}
+
+void test_sync_start_time_maps_to_local_tick(void) {
+    run_syncs(0U, 10U);
+
+    // A start 200 ms past the last sync lands on the right slave tick
+    uint32_t start = 9U * CAN_TIME_SYNC_PERIOD_MS * 1000U + 200000U;
+    uint32_t local_us;
+    TEST_ASSERT_TRUE(comm_can_time_sync_to_local(&slave, start, &local_us));
+    TEST_ASSERT_INT32_WITHIN(2, 0, (int32_t)(local_us - slave_clock(start)));
+
+    // On the master the timebase is its own tick
+    TEST_ASSERT_TRUE(comm_can_time_sync_to_local(&master, start, &local_us));
+    TEST_ASSERT_EQUAL_UINT32(start, local_us);
+}
+
+void test_unmatched_follow_up_is_discarded(void) {
+    CommCanFrame_t frame;
+
+    // SYNC lost on the way to the slave
+    comm_can_time_sync_poll(&master, 0U);
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    comm_can_time_sync_sent(&master, 0U);
+    comm_can_time_sync_poll(&master, 500U);
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    comm_can_time_sync_receive(&slave, &frame);
+
+    TEST_ASSERT_EQUAL_UINT32(0U, slave.syncs);
+    TEST_ASSERT_EQUAL_UINT32(1U, slave.discarded);
+}
+
+void test_untimed_sync_sends_no_follow_up(void) {
+    CommCanFrame_t frame;
+
+    comm_can_time_sync_poll(&master, 0U);
+    TEST_ASSERT_TRUE(comm_can_loopback_receive(&bus, &frame));
+    comm_can_time_sync_poll(&master, 500U);
+    TEST_ASSERT_FALSE(comm_can_loopback_receive(&bus, &frame));
+}
+
+void test_master_jump_steps_the_timebase(void) {
+    run_syncs(0U, 5U);
+    TEST_ASSERT_EQUAL_UINT32(1U, slave.steps);
+
+    // Master restarted: its tick no longer follows the slave's estimate
+    CommCanFrame_t frame;
+    comm_can_time_sync_poll(&master, 5U * CAN_TIME_SYNC_PERIOD_MS * 1000U);
+    comm_can_loopback_receive(&bus, &frame);
+    comm_can_time_sync_sent(&master, 42U);
+    frame.timestamp_us = slave_clock(5U * CAN_TIME_SYNC_PERIOD_MS * 1000U);
+    comm_can_time_sync_receive(&slave, &frame);
+    comm_can_time_sync_poll(&master, 5U * CAN_TIME_SYNC_PERIOD_MS * 1000U +
+                                         500U);
+    comm_can_loopback_receive(&bus, &frame);
+    comm_can_time_sync_receive(&slave, &frame);
+
+    TEST_ASSERT_EQUAL_UINT32(2U, slave.steps);
+    uint32_t sync_us;
+    TEST_ASSERT_FALSE(comm_can_time_sync_get_time(&slave, 0U, &sync_us));
+}
+
+void test_lock_times_out(void) {
+    run_syncs(0U, 3U);
+    uint32_t last = slave_clock(2U * CAN_TIME_SYNC_PERIOD_MS * 1000U);
+    uint32_t sync_us;
+
+    comm_can_time_sync_poll(&slave, last + CAN_TIME_SYNC_TIMEOUT_MS * 1000U);
+    TEST_ASSERT_TRUE(comm_can_time_sync_get_time(&slave, last, &sync_us));
+
+    comm_can_time_sync_poll(&slave,
+                            last + CAN_TIME_SYNC_TIMEOUT_MS * 1000U + 1U);
+    TEST_ASSERT_FALSE(comm_can_time_sync_get_time(&slave, last, &sync_us));
+}
+
+void test_malformed_frames_are_refused(void) {
+    CommCanFrame_t frame = {.id = CAN_ID_TIME_SYNC, .length = 4U};
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_MESSAGE,
+                      comm_can_time_sync_receive(&slave, &frame));
+
+    CommCanTimeSyncMsg_t msg = {.type = 0x7FU,
+                                .master_node = CAN_TIME_SYNC_MASTER_NODE};
+    frame.length = sizeof(msg);
+    memcpy(frame.data, &msg, sizeof(msg));
+    TEST_ASSERT_EQUAL(ERROR_COMM_INVALID_MESSAGE,
+                      comm_can_time_sync_receive(&slave, &frame));
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_can_time_sync_init(&master, true, NULL, NULL));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_slave_locks_after_two_pairs);
+    RUN_TEST(test_timebase_tracks_master_between_syncs);
+    RUN_TEST(test_sync_start_time_maps_to_local_tick);
+    RUN_TEST(test_unmatched_follow_up_is_discarded);
+    RUN_TEST(test_untimed_sync_sends_no_follow_up);
+    RUN_TEST(test_master_jump_steps_the_timebase);
+    RUN_TEST(test_lock_times_out);
+    RUN_TEST(test_malformed_frames_are_refused);
+    return UNITY_END();
+}
@@ -0,0 +1,234 @@
+/**
+ * @file test_comm_frame_decoder.c
+ * @brief Unit tests for the incremental binary frame decoder
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_frame_decoder.h"
+#include "config/project_constants.h"
+#include "unity.h"
+#include <string.h>
+
+#define RING_SIZE 128U
+#define MAX_PAYLOAD 32U
+#define FRAME_MAGIC SSOT_SYSTEM_STATE_MAGIC
+
+static uint8_t dma_buffer[RING_SIZE];
+static uint8_t scratch[COMM_FRAME_HEADER_SIZE + MAX_PAYLOAD];
+static uint16_t dma_index;
+static CommRxRing_t ring;
+static CommFrameDecoder_t decoder;
+
+void setUp(void) {
+    memset(dma_buffer, 0, sizeof(dma_buffer));
+    dma_index = 0;
+    comm_rx_ring_init(&ring, dma_buffer, RING_SIZE);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_frame_decoder_init(&decoder, FRAME_MAGIC,
+                                                         MAX_PAYLOAD, &ring));
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Emulate the DMA writing bytes, then an idle-line event
+ */
+static void dma_receive(const uint8_t *data, uint32_t length) {
+    for (uint32_t i = 0; i < length; i++) {
+        dma_buffer[dma_index] = data[i];
+        dma_index = (uint16_t)((dma_index + 1U) % RING_SIZE);
+    }
+    comm_rx_ring_dma_event(&ring, dma_index);
+}
+
+/**
+ * @brief Build a frame with a correct checksum
+ * @return Frame size (bytes)
+ */
+static uint32_t build_frame(uint8_t *out, uint16_t id, const char *payload) {
+    uint16_t length = (uint16_t)strlen(payload);
+
+    memset(out, 0, COMM_FRAME_HEADER_SIZE);
+    for (uint32_t i = 0; i < COMM_FRAME_MAGIC_SIZE; i++) {
+        out[i] = (uint8_t)(FRAME_MAGIC >> (8U * i));
+    }
+    out[4] = (uint8_t)id;
+    out[5] = (uint8_t)(id >> 8);
+    out[COMM_FRAME_LENGTH_OFFSET] = (uint8_t)length;
+    out[COMM_FRAME_LENGTH_OFFSET + 1U] = (uint8_t)(length >> 8);
+    out[COMM_FRAME_HEADER_SIZE - 1U] = 0x5A; // Timestamp, not covered
+    memcpy(&out[COMM_FRAME_HEADER_SIZE], payload, length);
+
+    uint16_t crc =
+        comm_frame_checksum(out, &out[COMM_FRAME_HEADER_SIZE], length);
+    out[COMM_FRAME_CHECKSUM_OFFSET] = (uint8_t)crc;
+    out[COMM_FRAME_CHECKSUM_OFFSET + 1U] = (uint8_t)(crc >> 8);
+
+    return COMM_FRAME_HEADER_SIZE + length;
+}
+
+static bool poll(CommFrame_t *frame) {
+    return comm_frame_decoder_poll(&decoder, &ring, scratch, frame);
+}
+
+static uint16_t frame_id(const CommFrame_t *frame) {
+    return (uint16_t)(frame->data[4] | (frame->data[5] << 8));
+}
+
+void test_checksum_matches_crc16_modbus(void) {
+    // Bytes after the checksum offset (checksum, timestamp) are excluded
+    const uint8_t header[COMM_FRAME_HEADER_SIZE] = "1234567890ABCDEF";
+    TEST_ASSERT_EQUAL_HEX16(0xC20A, comm_frame_checksum(header, NULL, 0));
+}
+
+void test_frame_split_across_events_is_in_place(void) {
+    uint8_t bytes[64];
+    uint32_t size = build_frame(bytes, 7, "MOVE 1000");
+    CommFrame_t frame;
+
+    dma_receive(bytes, 3);
+    TEST_ASSERT_FALSE(poll(&frame));
+    dma_receive(&bytes[3], 15);
+    TEST_ASSERT_FALSE(poll(&frame));
+    dma_receive(&bytes[18], size - 18U);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_PTR(dma_buffer, frame.data);
+    TEST_ASSERT_EQUAL_UINT16(9U, frame.payload_length);
+    TEST_ASSERT_EQUAL_MEMORY("MOVE 1000", frame.data + COMM_FRAME_HEADER_SIZE,
+                             9);
+    TEST_ASSERT_EQUAL_UINT16(7U, frame_id(&frame));
+
+    // Released on the next poll
+    TEST_ASSERT_FALSE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT32(0U, comm_rx_ring_available(&ring));
+}
+
+void test_noise_before_frame_is_skipped(void) {
+    uint8_t bytes[64];
+    const uint8_t noise[] = {0x00, 0xFF, 0x54, 0x53, 0x54, 0x11};
+    uint32_t size = build_frame(bytes, 1, "A");
+    CommFrame_t frame;
+
+    dma_receive(noise, sizeof(noise)); // Includes a partial magic match
+    dma_receive(bytes, size);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_PTR(&dma_buffer[sizeof(noise)], frame.data);
+    TEST_ASSERT_EQUAL_UINT32(sizeof(noise), decoder.skipped);
+}
+
+void test_back_to_back_frames(void) {
+    uint8_t bytes[96];
+    uint32_t size = build_frame(bytes, 1, "first");
+    size += build_frame(&bytes[size], 2, "");
+    size += build_frame(&bytes[size], 3, "third frame");
+    CommFrame_t frame;
+
+    dma_receive(bytes, size);
+    for (uint16_t id = 1; id <= 3U; id++) {
+        TEST_ASSERT_TRUE(poll(&frame));
+        TEST_ASSERT_EQUAL_UINT16(id, frame_id(&frame));
+    }
+    TEST_ASSERT_FALSE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT32(3U, decoder.frames);
+}
+
+void test_bad_checksum_is_rejected(void) {
+    uint8_t bytes[96];
+    uint32_t first = build_frame(bytes, 1, "corrupt");
+    uint32_t size = first + build_frame(&bytes[first], 2, "good");
+    CommFrame_t frame;
+
+    bytes[COMM_FRAME_HEADER_SIZE + 2U] ^= 0x01;
+    dma_receive(bytes, size);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT16(2U, frame_id(&frame));
+    TEST_ASSERT_EQUAL_UINT32(1U, decoder.crc_errors);
+}
+
+void test_bad_length_is_rejected(void) {
+    uint8_t bytes[96];
+    uint32_t first = build_frame(bytes, 1, "x");
+    uint32_t size = first + build_frame(&bytes[first], 2, "y");
+    CommFrame_t frame;
+
+    bytes[COMM_FRAME_LENGTH_OFFSET + 1U] = 0x10; // 4097 bytes
+    dma_receive(bytes, size);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT16(2U, frame_id(&frame));
+    TEST_ASSERT_EQUAL_UINT32(1U, decoder.length_errors);
+}
+
+void test_truncated_frame_does_not_swallow_next(void) {
+    uint8_t bytes[96];
+    uint32_t first = build_frame(bytes, 1, "lost in transit");
+    uint32_t second = build_frame(&bytes[20], 2, "next");
+    CommFrame_t frame;
+
+    // Only 20 bytes of the first frame made it onto the wire
+    dma_receive(bytes, 20U + second);
+    TEST_ASSERT_TRUE(first > 20U);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT16(2U, frame_id(&frame));
+    TEST_ASSERT_EQUAL_UINT32(1U, decoder.crc_errors);
+}
+
+void test_wrapped_frame_is_copied(void) {
+    uint8_t bytes[96];
+    CommFrame_t frame;
+
+    // Move the ring position close to the end of the buffer
+    uint8_t filler[110];
+    memset(filler, 0xEE, sizeof(filler));
+    dma_receive(filler, sizeof(filler));
+    TEST_ASSERT_FALSE(poll(&frame));
+
+    uint32_t size = build_frame(bytes, 9, "wraps around");
+    dma_receive(bytes, size);
+
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_PTR(scratch, frame.data);
+    TEST_ASSERT_EQUAL_UINT16(9U, frame_id(&frame));
+    TEST_ASSERT_EQUAL_MEMORY("wraps around",
+                             frame.data + COMM_FRAME_HEADER_SIZE, 12);
+}
+
+void test_ring_overrun_restarts_search(void) {
+    uint8_t bytes[96];
+    uint32_t size = build_frame(bytes, 1, "partial frame");
+    CommFrame_t frame;
+
+    dma_receive(bytes, 10);
+    TEST_ASSERT_FALSE(poll(&frame));
+
+    // The DMA laps the consumer; the half frame is gone
+    uint8_t filler[RING_SIZE];
+    memset(filler, 0xEE, sizeof(filler));
+    dma_receive(filler, 64);
+    dma_receive(filler, 64);
+    TEST_ASSERT_FALSE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT32(1U, ring.overruns);
+
+    dma_receive(bytes, size);
+    TEST_ASSERT_TRUE(poll(&frame));
+    TEST_ASSERT_EQUAL_UINT16(1U, frame_id(&frame));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_checksum_matches_crc16_modbus);
+    RUN_TEST(test_frame_split_across_events_is_in_place);
+    RUN_TEST(test_noise_before_frame_is_skipped);
+    RUN_TEST(test_back_to_back_frames);
+    RUN_TEST(test_bad_checksum_is_rejected);
+    RUN_TEST(test_bad_length_is_rejected);
+    RUN_TEST(test_truncated_frame_does_not_swallow_next);
+    RUN_TEST(test_wrapped_frame_is_copied);
+    RUN_TEST(test_ring_overrun_restarts_search);
+    return UNITY_END();
+}
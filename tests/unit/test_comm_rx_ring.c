@@ -0,0 +1,161 @@
+/**
+ * @file test_comm_rx_ring.c
+ * @brief Unit tests for the circular-DMA receive ring
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_rx_ring.h"
+#include "unity.h"
+#include <string.h>
+
+#define RING_SIZE 32U
+#define SCRATCH_SIZE 16U
+
+static uint8_t dma_buffer[RING_SIZE];
+static CommRxRing_t ring;
+static char scratch[SCRATCH_SIZE];
+static uint16_t dma_index;
+
+void setUp(void) {
+    memset(dma_buffer, 0, sizeof(dma_buffer));
+    dma_index = 0;
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_rx_ring_init(&ring, dma_buffer, RING_SIZE));
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Emulate the DMA writing bytes, then an idle-line event
+ */
+static void dma_receive(const char *data) {
+    for (const char *c = data; *c != '\0'; c++) {
+        dma_buffer[dma_index] = (uint8_t)*c;
+        dma_index = (uint16_t)((dma_index + 1U) % RING_SIZE);
+    }
+    comm_rx_ring_dma_event(&ring, dma_index);
+}
+
+static uint32_t next_line(const char **line) {
+    return comm_rx_ring_next_line(&ring, scratch, SCRATCH_SIZE, line);
+}
+
+void test_init_rejects_bad_size(void) {
+    CommRxRing_t other;
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_rx_ring_init(&other, dma_buffer, 24));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_rx_ring_init(&other, NULL, RING_SIZE));
+}
+
+void test_event_accounts_for_wrap(void) {
+    const uint8_t *data;
+
+    dma_receive("0123456789ABCDEFGHIJ"); // 20 bytes
+    comm_rx_ring_consume(&ring, 20);
+    dma_receive("abcdefghijklmnop"); // Wraps: 12 at the end, 4 at start
+
+    TEST_ASSERT_EQUAL_UINT32(16U, comm_rx_ring_available(&ring));
+    TEST_ASSERT_EQUAL_UINT32(12U, comm_rx_ring_contiguous(&ring, &data));
+    TEST_ASSERT_EQUAL_PTR(&dma_buffer[20], data);
+    TEST_ASSERT_EQUAL_UINT8('m', comm_rx_ring_peek(&ring, 12));
+}
+
+void test_line_is_returned_in_place(void) {
+    const char *line;
+
+    dma_receive("STATUS\r\n");
+    TEST_ASSERT_EQUAL_UINT32(6U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("STATUS", line);
+    TEST_ASSERT_EQUAL_PTR(dma_buffer, line);
+
+    // "\r\n" yields one line; the '\n' is skipped as an empty line
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+    TEST_ASSERT_EQUAL_UINT32(0U, comm_rx_ring_available(&ring));
+}
+
+void test_wrapped_line_is_copied(void) {
+    const char *line;
+
+    dma_receive("0123456789012345678901234\n"); // Overlong, 26 bytes
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+
+    dma_receive("MOVE 1 20\n"); // Starts at 26, wraps at 32
+    TEST_ASSERT_EQUAL_UINT32(9U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("MOVE 1 20", line);
+    TEST_ASSERT_EQUAL_PTR(scratch, line);
+}
+
+void test_line_split_across_events(void) {
+    const char *line;
+
+    dma_receive("HOM");
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+    dma_receive("E 1");
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+    dma_receive("\rSTOP\n");
+
+    TEST_ASSERT_EQUAL_UINT32(6U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("HOME 1", line);
+    TEST_ASSERT_EQUAL_UINT32(4U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("STOP", line);
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+}
+
+void test_overlong_line_is_discarded(void) {
+    const char *line;
+
+    // Longer than the scratch buffer, arriving in two parts
+    dma_receive("ABCDEFGHIJKLMNOPQRST");
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+    dma_receive("UVW\nSTOP\n");
+
+    TEST_ASSERT_EQUAL_UINT32(4U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("STOP", line);
+    TEST_ASSERT_EQUAL_UINT32(24U, ring.discarded);
+}
+
+void test_overrun_drops_data_and_fragment(void) {
+    const char *line;
+
+    // Two idle events lap the unread ring
+    dma_receive("0123456789ABCDEFGHIJ");
+    dma_receive("KLMNOPQ\nRSTUVWXYZ");
+    TEST_ASSERT_EQUAL_UINT32(0U, next_line(&line));
+    TEST_ASSERT_EQUAL_UINT32(1U, ring.overruns);
+
+    // The tail of the lost line is not run as a command
+    dma_receive("XYZ\nSTOP\n");
+    TEST_ASSERT_EQUAL_UINT32(4U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("STOP", line);
+}
+
+void test_restart_resyncs_to_buffer_start(void) {
+    const char *line;
+
+    dma_receive("PART");
+    comm_rx_ring_dma_restart(&ring);
+    dma_index = 0;
+
+    // Bytes were lost at the error: the interrupted line is dropped
+    dma_receive("IAL\nSTATUS\n");
+    TEST_ASSERT_EQUAL_UINT32(6U, next_line(&line));
+    TEST_ASSERT_EQUAL_STRING("STATUS", line);
+    TEST_ASSERT_EQUAL_PTR(&dma_buffer[4], line);
+    TEST_ASSERT_EQUAL_UINT32(8U, ring.discarded);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_init_rejects_bad_size);
+    RUN_TEST(test_event_accounts_for_wrap);
+    RUN_TEST(test_line_is_returned_in_place);
+    RUN_TEST(test_wrapped_line_is_copied);
+    RUN_TEST(test_line_split_across_events);
+    RUN_TEST(test_overlong_line_is_discarded);
+    RUN_TEST(test_overrun_drops_data_and_fragment);
+    RUN_TEST(test_restart_resyncs_to_buffer_start);
+    return UNITY_END();
+}
@@ -0,0 +1,164 @@
+/**
+ * @file test_comm_tx_queue.c
+ * @brief Unit tests for the prioritised UART transmit queue
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/comm_tx_queue.h"
+#include "unity.h"
+#include <string.h>
+
+static CommTxQueue_t queue;
+
+// Fake DMA: records each started transfer
+static char started[16][8];
+static uint32_t start_count;
+static bool fail_next_start;
+
+static SystemError_t fake_start(void *context, const uint8_t *data,
+                                uint16_t length) {
+    (void)context;
+    if (fail_next_start) {
+        fail_next_start = false;
+        return ERROR_COMM_SEND_FAILED;
+    }
+    memcpy(started[start_count], data, length);
+    started[start_count][length] = '\0';
+    start_count++;
+    return SYSTEM_OK;
+}
+
+static void push(uint8_t priority, const char *text) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, comm_tx_queue_push(&queue, priority,
+                                                    (const uint8_t *)text,
+                                                    (uint16_t)strlen(text)));
+}
+
+void setUp(void) {
+    memset(started, 0, sizeof(started));
+    start_count = 0;
+    fail_next_start = false;
+    comm_tx_queue_init(&queue, fake_start, NULL);
+}
+
+void tearDown(void) {
+}
+
+void test_idle_queue_starts_immediately(void) {
+    push(MSG_PRIORITY_NORMAL, "A");
+    TEST_ASSERT_EQUAL_UINT32(1U, start_count);
+    TEST_ASSERT_EQUAL_STRING("A", started[0]);
+
+    // Completion releases the slot and leaves the transmitter idle
+    comm_tx_queue_dma_complete(&queue);
+    TEST_ASSERT_EQUAL_UINT32(1U, start_count);
+    TEST_ASSERT_EQUAL_UINT8(0U, queue.busy);
+}
+
+void test_completion_chains_by_priority_then_fifo(void) {
+    push(MSG_PRIORITY_LOW, "L0"); // Goes straight out
+    push(MSG_PRIORITY_LOW, "L1");
+    push(MSG_PRIORITY_NORMAL, "N0");
+    push(MSG_PRIORITY_NORMAL, "N1");
+    push(MSG_PRIORITY_EMERGENCY, "E0");
+    TEST_ASSERT_EQUAL_UINT32(1U, start_count);
+
+    const char *expected[] = {"L0", "E0", "N0", "N1", "L1"};
+    for (uint32_t i = 1; i < 5U; i++) {
+        comm_tx_queue_dma_complete(&queue);
+        TEST_ASSERT_EQUAL_UINT32(i + 1U, start_count);
+        TEST_ASSERT_EQUAL_STRING(expected[i], started[i]);
+    }
+    comm_tx_queue_dma_complete(&queue);
+    TEST_ASSERT_EQUAL_UINT32(5U, start_count);
+}
+
+void test_full_lane_drops_and_counts(void) {
+    CommTxLaneStats_t stats;
+
+    // One slot in flight plus the rest of the lane queued
+    for (uint32_t i = 0; i < COMM_TX_QUEUE_DEPTH; i++) {
+        push(MSG_PRIORITY_NORMAL, "S");
+    }
+    TEST_ASSERT_EQUAL(ERROR_COMM_BUSY,
+                      comm_tx_queue_push(&queue, MSG_PRIORITY_NORMAL,
+                                         (const uint8_t *)"X", 1U));
+
+    // Other lanes are unaffected by a full one
+    push(MSG_PRIORITY_EMERGENCY, "E");
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      comm_tx_queue_get_stats(&queue, MSG_PRIORITY_NORMAL,
+                                              &stats));
+    TEST_ASSERT_EQUAL_UINT32(COMM_TX_QUEUE_DEPTH, stats.occupancy);
+    TEST_ASSERT_EQUAL_UINT32(COMM_TX_QUEUE_DEPTH, stats.high_water);
+    TEST_ASSERT_EQUAL_UINT32(COMM_TX_QUEUE_DEPTH, stats.committed);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.dropped);
+
+    comm_tx_queue_dma_complete(&queue); // Emergency message next
+    comm_tx_queue_dma_complete(&queue);
+    comm_tx_queue_get_stats(&queue, MSG_PRIORITY_NORMAL, &stats);
+    TEST_ASSERT_EQUAL_UINT32(COMM_TX_QUEUE_DEPTH - 1U, stats.occupancy);
+    TEST_ASSERT_EQUAL_UINT32(COMM_TX_QUEUE_DEPTH, stats.high_water);
+}
+
+void test_uncommitted_slot_holds_back_its_lane_only(void) {
+    push(MSG_PRIORITY_LOW, "busy");
+
+    // Claimed first, committed last (a preempted producer)
+    CommTxSlot_t *slow = comm_tx_queue_claim(&queue, MSG_PRIORITY_HIGH, 1U);
+    TEST_ASSERT_NOT_NULL(slow);
+    push(MSG_PRIORITY_HIGH, "H1");
+    push(MSG_PRIORITY_NORMAL, "N");
+
+    comm_tx_queue_dma_complete(&queue);
+    TEST_ASSERT_EQUAL_STRING("N", started[1]);
+
+    // Transmitter is idle now; the commit restarts it in lane order
+    comm_tx_queue_dma_complete(&queue);
+    slow->data[0] = 'H';
+    comm_tx_queue_commit(&queue, slow);
+    TEST_ASSERT_EQUAL_STRING("H", started[2]);
+    comm_tx_queue_dma_complete(&queue);
+    TEST_ASSERT_EQUAL_STRING("H1", started[3]);
+}
+
+void test_failed_start_moves_on(void) {
+    fail_next_start = true;
+    push(MSG_PRIORITY_NORMAL, "lost");
+    TEST_ASSERT_EQUAL_UINT32(0U, start_count);
+    TEST_ASSERT_EQUAL_UINT32(1U, queue.start_errors);
+    TEST_ASSERT_EQUAL_UINT8(0U, queue.busy);
+
+    push(MSG_PRIORITY_NORMAL, "ok");
+    TEST_ASSERT_EQUAL_STRING("ok", started[0]);
+}
+
+void test_rejects_oversized_and_clamps_priority(void) {
+    static uint8_t big[COMM_TX_SLOT_SIZE + 1];
+    CommTxLaneStats_t stats;
+
+    TEST_ASSERT_EQUAL(ERROR_COMM_MESSAGE_TOO_LARGE,
+                      comm_tx_queue_push(&queue, MSG_PRIORITY_NORMAL, big,
+                                         sizeof(big)));
+    TEST_ASSERT_EQUAL_UINT32(1U, queue.oversized);
+
+    push(200U, "P");
+    comm_tx_queue_get_stats(&queue, MSG_PRIORITY_LOW, &stats);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats.committed);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      comm_tx_queue_get_stats(&queue, COMM_TX_QUEUE_LANES,
+                                              &stats));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_queue_starts_immediately);
+    RUN_TEST(test_completion_chains_by_priority_then_fifo);
+    RUN_TEST(test_full_lane_drops_and_counts);
+    RUN_TEST(test_uncommitted_slot_holds_back_its_lane_only);
+    RUN_TEST(test_failed_start_moves_on);
+    RUN_TEST(test_rejects_oversized_and_clamps_priority);
+    return UNITY_END();
+}
@@ -0,0 +1,82 @@
+/**
+ * @file test_crc16.c
+ * @brief Unit tests for the CRC16 engine
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "communication/crc16.h"
+#include "unity.h"
+#include <stdlib.h>
+
+static uint8_t data[300];
+
+void setUp(void) {
+    srand(7U);
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)rand();
+    }
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Bit-at-a-time reference
+ */
+static uint16_t crc16_reference(const uint8_t *bytes, size_t length) {
+    uint16_t crc = CRC16_INIT_VALUE;
+
+    for (size_t i = 0; i < length; i++) {
+        crc ^= bytes[i];
+        for (int j = 0; j < 8; j++) {
+            crc = (crc & 1U) ? (uint16_t)((crc >> 1) ^ CRC16_POLYNOMIAL)
+                             : (uint16_t)(crc >> 1);
+        }
+    }
+    return crc;
+}
+
+void test_check_value(void) {
+    const uint8_t check[] = "123456789";
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, crc16_compute(check, 9));
+    TEST_ASSERT_EQUAL_HEX16(CRC16_INIT_VALUE, crc16_compute(check, 0));
+}
+
+void test_matches_reference_for_all_lengths_and_offsets(void) {
+    // Covers every tail length after the 8- and 4-byte steps
+    for (size_t offset = 0; offset < 8U; offset++) {
+        for (size_t length = 0; length <= 40U; length++) {
+            TEST_ASSERT_EQUAL_HEX16(crc16_reference(&data[offset], length),
+                                    crc16_compute(&data[offset], length));
+        }
+    }
+    TEST_ASSERT_EQUAL_HEX16(crc16_reference(data, sizeof(data)),
+                            crc16_compute(data, sizeof(data)));
+}
+
+void test_incremental_equals_one_shot(void) {
+    uint16_t expected = crc16_compute(data, sizeof(data));
+
+    for (size_t split = 0; split <= sizeof(data); split += 13U) {
+        uint16_t crc = crc16_init();
+        crc = crc16_update(crc, data, split);
+        crc = crc16_update(crc, &data[split], sizeof(data) - split);
+        TEST_ASSERT_EQUAL_HEX16(expected, crc16_final(crc));
+    }
+}
+
+void test_software_path_matches(void) {
+    uint16_t crc = crc16_update_sw(crc16_init(), data, sizeof(data));
+    TEST_ASSERT_EQUAL_HEX16(crc16_compute(data, sizeof(data)),
+                            crc16_final(crc));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_check_value);
+    RUN_TEST(test_matches_reference_for_all_lengths_and_offsets);
+    RUN_TEST(test_incremental_equals_one_shot);
+    RUN_TEST(test_software_path_matches);
+    return UNITY_END();
+}
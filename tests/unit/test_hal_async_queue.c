@@ -0,0 +1,212 @@
+/**
+ * @file test_hal_async_queue.c
+ * @brief Unit tests for the asynchronous SPI/I2C submit/complete API
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Runs against the mock bus model: transfers take setup +
+ * bytes * us_per_byte of mock time and complete as the clock advances.
+ */
+
+#include "hal_abstraction/hal_abstraction.h"
+#include "mock_hal_abstraction.h"
+#include "unity.h"
+#include <string.h>
+
+#define SPI_BUS HAL_SPI_INSTANCE_2
+#define I2C_BUS HAL_I2C_INSTANCE_1
+
+static uint8_t tx[8];
+static uint8_t rx[8];
+static uint8_t i2c_data[6];
+
+static HAL_Async_Request_t *completed[8];
+static uint32_t completed_count;
+
+static void record_completion(HAL_Async_Request_t *request) {
+    if (completed_count < 8U) {
+        completed[completed_count] = request;
+    }
+    completed_count++;
+}
+
+static void make_spi(HAL_Async_Request_t *request, uint16_t size) {
+    memset(request, 0, sizeof(*request));
+    request->xfer.spi.tx_data = tx;
+    request->xfer.spi.rx_data = rx;
+    request->xfer.spi.data_size = size;
+    request->on_complete = record_completion;
+}
+
+static void make_i2c(HAL_Async_Request_t *request, uint16_t size) {
+    memset(request, 0, sizeof(*request));
+    request->xfer.i2c.device_address = 0x6C;
+    request->xfer.i2c.register_address = 0x0C;
+    request->xfer.i2c.data = i2c_data;
+    request->xfer.i2c.data_size = size;
+    request->xfer.i2c.use_register_address = true;
+    request->on_complete = record_completion;
+}
+
+static void advance_us(uint32_t us) {
+    MockHAL_SetVirtualTime(HAL_Abstraction_GetMicroseconds() + us);
+}
+
+void setUp(void) {
+    MockHAL_Reset();
+    MockHAL_SetSPITiming(SPI_BUS, 1U, 2U);
+    MockHAL_SetI2CTiming(I2C_BUS, 70U, 23U);
+    completed_count = 0;
+    memset(completed, 0, sizeof(completed));
+}
+
+void tearDown(void) {
+}
+
+void test_submit_returns_before_the_transfer_finishes(void) {
+    HAL_Async_Request_t request;
+    make_spi(&request, 6U); // 1 + 6 * 2 = 13 us
+
+    uint32_t start = HAL_Abstraction_GetMicroseconds();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &request));
+    TEST_ASSERT_EQUAL(HAL_ASYNC_ACTIVE, request.state);
+    TEST_ASSERT_EQUAL_UINT32(0U, completed_count);
+
+    advance_us(12U);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_ACTIVE, request.state);
+
+    advance_us(1U);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_DONE, request.state);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, request.result);
+    TEST_ASSERT_EQUAL_UINT32(1U, completed_count);
+    TEST_ASSERT_EQUAL_PTR(&request, completed[0]);
+    TEST_ASSERT_EQUAL_UINT32(start, request.submit_us);
+    TEST_ASSERT_EQUAL_UINT32(start + 13U, request.complete_us);
+}
+
+void test_requests_on_one_bus_run_in_order_back_to_back(void) {
+    HAL_Async_Request_t first, second;
+    make_spi(&first, 4U);  // 9 us
+    make_spi(&second, 2U); // 5 us
+
+    uint32_t start = HAL_Abstraction_GetMicroseconds();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &first));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &second));
+    TEST_ASSERT_EQUAL(HAL_ASYNC_QUEUED, second.state);
+
+    // One large step still delivers both completions in order
+    advance_us(100U);
+    TEST_ASSERT_EQUAL_UINT32(2U, completed_count);
+    TEST_ASSERT_EQUAL_PTR(&first, completed[0]);
+    TEST_ASSERT_EQUAL_PTR(&second, completed[1]);
+    TEST_ASSERT_EQUAL_UINT32(start + 9U, first.complete_us);
+    TEST_ASSERT_EQUAL_UINT32(start + 14U, second.complete_us);
+}
+
+void test_spi_and_i2c_transfers_overlap(void) {
+    HAL_Async_Request_t spi, i2c;
+    make_spi(&spi, 8U); // 17 us
+    make_i2c(&i2c, 6U); // 70 + 6 * 23 = 208 us
+
+    uint32_t start = HAL_Abstraction_GetMicroseconds();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_I2C_SubmitRead(I2C_BUS, &i2c));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &spi));
+
+    advance_us(1000U);
+    TEST_ASSERT_EQUAL_UINT32(2U, completed_count);
+    // Completions arrive in time order, not submit order
+    TEST_ASSERT_EQUAL_PTR(&spi, completed[0]);
+    TEST_ASSERT_EQUAL_PTR(&i2c, completed[1]);
+    TEST_ASSERT_EQUAL_UINT32(start + 17U, spi.complete_us);
+    TEST_ASSERT_EQUAL_UINT32(start + 208U, i2c.complete_us);
+}
+
+void test_i2c_read_delivers_the_bus_data(void) {
+    const uint8_t response[6] = {0x0A, 0xBC, 0x0A, 0xBD, 0x20, 0x80};
+    HAL_Async_Request_t request;
+    make_i2c(&request, 6U);
+    MockHAL_SetI2CResponse(I2C_BUS, response, sizeof(response));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      HAL_Abstraction_I2C_SubmitRead(I2C_BUS, &request));
+    TEST_ASSERT_EQUAL_UINT8(0U, i2c_data[0]);
+
+    advance_us(1000U);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_DONE, request.state);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(response, i2c_data, sizeof(response));
+}
+
+void test_cancel_only_removes_queued_requests(void) {
+    HAL_Async_Request_t active, queued, tail;
+    make_spi(&active, 4U);
+    make_spi(&queued, 4U);
+    make_spi(&tail, 4U);
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &active));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &queued));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &tail));
+
+    TEST_ASSERT_EQUAL(ERROR_OPERATION_IN_PROGRESS,
+                      HAL_Abstraction_SPI_Submit(SPI_BUS, &queued));
+    TEST_ASSERT_EQUAL(ERROR_OPERATION_IN_PROGRESS,
+                      HAL_Abstraction_Async_Cancel(&active));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_Async_Cancel(&queued));
+    TEST_ASSERT_EQUAL(HAL_ASYNC_CANCELLED, queued.state);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      HAL_Abstraction_Async_Cancel(&queued));
+
+    advance_us(100U);
+    TEST_ASSERT_EQUAL_UINT32(2U, completed_count);
+    TEST_ASSERT_EQUAL_PTR(&active, completed[0]);
+    TEST_ASSERT_EQUAL_PTR(&tail, completed[1]);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_CANCELLED, queued.state);
+}
+
+void test_bus_fault_completes_with_error(void) {
+    HAL_Async_Request_t request;
+    make_spi(&request, 2U);
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, true);
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &request));
+    advance_us(100U);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_DONE, request.state);
+    TEST_ASSERT_NOT_EQUAL(SYSTEM_OK, request.result);
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, false);
+}
+
+static HAL_Async_Request_t chained;
+
+static void resubmit_once(HAL_Async_Request_t *request) {
+    record_completion(request);
+    if (request != &chained) {
+        make_spi(&chained, 2U);
+        HAL_Abstraction_SPI_Submit(SPI_BUS, &chained);
+    }
+}
+
+void test_callback_may_submit_the_next_transfer(void) {
+    HAL_Async_Request_t request;
+    make_spi(&request, 2U); // 5 us each
+    request.on_complete = resubmit_once;
+
+    uint32_t start = HAL_Abstraction_GetMicroseconds();
+    TEST_ASSERT_EQUAL(SYSTEM_OK, HAL_Abstraction_SPI_Submit(SPI_BUS, &request));
+    advance_us(100U);
+    TEST_ASSERT_EQUAL_UINT32(2U, completed_count);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_DONE, chained.state);
+    // The chained transfer started at the first one's completion
+    TEST_ASSERT_EQUAL_UINT32(start + 5U, chained.submit_us);
+    TEST_ASSERT_EQUAL_UINT32(start + 10U, chained.complete_us);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_submit_returns_before_the_transfer_finishes);
+    RUN_TEST(test_requests_on_one_bus_run_in_order_back_to_back);
+    RUN_TEST(test_spi_and_i2c_transfers_overlap);
+    RUN_TEST(test_i2c_read_delivers_the_bus_data);
+    RUN_TEST(test_cancel_only_removes_queued_requests);
+    RUN_TEST(test_bus_fault_completes_with_error);
+    RUN_TEST(test_callback_may_submit_the_next_transfer);
+    return UNITY_END();
+}
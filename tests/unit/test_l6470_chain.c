@@ -0,0 +1,161 @@
+/**
+ * @file test_l6470_chain.c
+ * @brief Unit tests for the L6470 daisy-chain frame builder
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "drivers/l6470/l6470_chain.h"
+#include "drivers/l6470/l6470_driver.h"
+#include "mock_hal_abstraction.h"
+#include "unity.h"
+#include <string.h>
+
+#if L6470_CHAIN_LENGTH != 2
+#error "Frame layouts below assume the two-device IHM02A1 chain"
+#endif
+
+static L6470Chain_t chain;
+
+static MockSPI_Internal_t *motor_spi(void) {
+    return &mock_hal_state.spi_instances[L6470_CHAIN_SPI];
+}
+
+void setUp(void) {
+    MockHAL_Reset();
+    l6470_chain_begin(&chain);
+}
+
+void tearDown(void) {
+}
+
+void test_status_poll_for_all_devices_is_one_transfer(void) {
+    // Slot 0 carries the commands, slots 1-2 clock STATUS out; position 1
+    // of each slot belongs to device 0, position 0 to device 1
+    const uint8_t rx[6] = {0x00, 0x00, 0x12, 0x34, 0x56, 0x78};
+    const uint8_t expected_tx[6] = {0xD0, 0xD0, 0x00, 0x00, 0x00, 0x00};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 1));
+    MockHAL_SetSPIResponse(L6470_CHAIN_SPI, rx, sizeof(rx));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT16(6U, motor_spi()->last_data_size);
+    TEST_ASSERT_EQUAL_UINT16(L6470_CHAIN_LENGTH,
+                             motor_spi()->last_cs_frame_size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tx, motor_spi()->last_tx_data, 6);
+    TEST_ASSERT_EQUAL_HEX32(0x3478U, l6470_chain_reply(&chain, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x1256U, l6470_chain_reply(&chain, 1));
+}
+
+void test_mixed_commands_share_a_frame(void) {
+    // MOVE (4 bytes) on device 0 widens the frame; device 1's GET_STATUS
+    // is padded with a trailing NOP
+    const uint8_t expected_tx[8] = {0xD0, 0x41, 0x00, 0x01,
+                                    0x00, 0x02, 0x00, 0x03};
+    const uint8_t rx[8] = {0, 0, 0xAB, 0, 0xCD, 0, 0xEE, 0};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_chain_move(&chain, 0, true, 0x010203U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 1));
+    MockHAL_SetSPIResponse(L6470_CHAIN_SPI, rx, sizeof(rx));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tx, motor_spi()->last_tx_data, 8);
+    TEST_ASSERT_EQUAL_HEX32(0xABCDU, l6470_chain_reply(&chain, 1));
+    TEST_ASSERT_EQUAL_HEX32(0U, l6470_chain_reply(&chain, 0));
+}
+
+void test_idle_device_receives_nops(void) {
+    const uint8_t expected_tx[4] = {0x00, 0x0A, 0x00, 0x29};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_set_param(
+                                     &chain, 0, L6470_REG_KVAL_RUN, 0x29U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tx, motor_spi()->last_tx_data, 4);
+}
+
+void test_get_param_reads_register_width(void) {
+    // ABS_POS is 22 bits: three reply bytes behind the command
+    const uint8_t rx[8] = {0, 0, 0, 0x3F, 0, 0xFF, 0, 0xFE};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_chain_get_param(&chain, 0, L6470_REG_ABS_POS));
+    MockHAL_SetSPIResponse(L6470_CHAIN_SPI, rx, sizeof(rx));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+
+    TEST_ASSERT_EQUAL_UINT16(8U, motor_spi()->last_data_size);
+    TEST_ASSERT_EQUAL_HEX8(0x21, motor_spi()->last_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX32(0x3FFFFEU, l6470_chain_reply(&chain, 0));
+}
+
+void test_run_and_goto_encode_arguments(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_run(&chain, 1, false, 0xFFFFFFU));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_goto(&chain, 0, -1));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+
+    const uint8_t expected_tx[8] = {0x50, 0x60, 0x0F, 0x3F,
+                                    0xFF, 0xFF, 0xFF, 0xFF};
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tx, motor_spi()->last_tx_data, 8);
+}
+
+void test_one_command_per_device_per_frame(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_chain_command(&chain, 0, L6470_CMD_SOFT_STOP));
+    TEST_ASSERT_EQUAL(ERROR_OPERATION_IN_PROGRESS,
+                      l6470_chain_get_status(&chain, 0));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_INVALID_ID,
+                      l6470_chain_get_status(&chain, L6470_CHAIN_LENGTH));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_PARAMETER_INVALID,
+                      l6470_chain_set_param(&chain, 1, 0x1F, 0));
+}
+
+void test_empty_frame_skips_the_bus(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+    TEST_ASSERT_EQUAL_UINT32(0U, motor_spi()->call_count);
+}
+
+void test_bus_error_is_reported(void) {
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, true);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 0));
+    TEST_ASSERT_NOT_EQUAL(SYSTEM_OK, l6470_chain_transfer(&chain));
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, false);
+}
+
+void test_submitted_frame_is_collected_after_completion(void) {
+    const uint8_t rx[6] = {0x00, 0x00, 0x12, 0x34, 0x56, 0x78};
+    HAL_Async_Request_t request;
+    memset(&request, 0, sizeof(request));
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      l6470_chain_submit(&chain, &request));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_get_status(&chain, 1));
+    MockHAL_SetSPIResponse(L6470_CHAIN_SPI, rx, sizeof(rx));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_chain_submit(&chain, &request));
+    TEST_ASSERT_EQUAL(HAL_ASYNC_ACTIVE, request.state);
+
+    MockHAL_SetVirtualTime(HAL_Abstraction_GetMicroseconds() + 1000U);
+    TEST_ASSERT_EQUAL(HAL_ASYNC_DONE, request.state);
+    l6470_chain_collect(&chain);
+    TEST_ASSERT_EQUAL_UINT16(L6470_CHAIN_LENGTH,
+                             motor_spi()->last_cs_frame_size);
+    TEST_ASSERT_EQUAL_HEX32(0x3478U, l6470_chain_reply(&chain, 0));
+    TEST_ASSERT_EQUAL_HEX32(0x1256U, l6470_chain_reply(&chain, 1));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_status_poll_for_all_devices_is_one_transfer);
+    RUN_TEST(test_mixed_commands_share_a_frame);
+    RUN_TEST(test_idle_device_receives_nops);
+    RUN_TEST(test_get_param_reads_register_width);
+    RUN_TEST(test_run_and_goto_encode_arguments);
+    RUN_TEST(test_one_command_per_device_per_frame);
+    RUN_TEST(test_empty_frame_skips_the_bus);
+    RUN_TEST(test_bus_error_is_reported);
+    RUN_TEST(test_submitted_frame_is_collected_after_completion);
+    return UNITY_END();
+}
@@ -0,0 +1,235 @@
+/**
+ * @file test_l6470_shadow.c
+ * @brief Unit tests for the L6470 register shadow cache
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "drivers/l6470/l6470_driver.h"
+#include "drivers/l6470/l6470_shadow.h"
+#include "mock_hal_abstraction.h"
+#include "unity.h"
+#include <string.h>
+
+#if L6470_CHAIN_LENGTH != 2
+#error "Frame layouts below assume the two-device IHM02A1 chain"
+#endif
+
+static MockSPI_Internal_t *motor_spi(void) {
+    return &mock_hal_state.spi_instances[L6470_CHAIN_SPI];
+}
+
+static L6470ShadowStats_t stats(void) {
+    L6470ShadowStats_t s;
+    l6470_shadow_get_stats(&s);
+    return s;
+}
+
+// GET_PARAM of a one-byte register on device 0 only: slot 1, position 1
+static void respond_device0_byte(uint8_t value) {
+    const uint8_t rx[4] = {0x00, 0x00, 0x00, value};
+    MockHAL_SetSPIResponse(L6470_CHAIN_SPI, rx, sizeof(rx));
+}
+
+void setUp(void) {
+    MockHAL_Reset();
+    l6470_shadow_init();
+}
+
+void tearDown(void) {
+}
+
+void test_cached_register_is_read_from_the_device_once(void) {
+    uint32_t value = 0;
+
+    respond_device0_byte(0x29);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_KVAL_RUN, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x29U, value);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_KVAL_RUN, &value));
+    TEST_ASSERT_EQUAL_HEX32(0x29U, value);
+
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().cache_hits);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().cache_misses);
+}
+
+void test_writes_are_deferred_and_flushed_as_one_burst(void) {
+    // Frame 0: KVAL_HOLD on device 0, ACC on device 1 (3 slots);
+    // frame 1: the last KVAL_RUN value on device 0 (2 slots)
+    const uint8_t expected_tx[10] = {0x05, 0x09, 0x01, 0x11, 0x23,
+                                     0x00, 0x00, 0x0A, 0x00, 0x20};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_write(0, L6470_REG_KVAL_RUN,
+                                                    0x10U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_write(0, L6470_REG_KVAL_RUN,
+                                                    0x20U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_write(0, L6470_REG_KVAL_HOLD,
+                                                    0x11U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(1, L6470_REG_ACC, 0x123U));
+    TEST_ASSERT_EQUAL_UINT32(0U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT8(2U, l6470_shadow_dirty_count(0));
+    TEST_ASSERT_EQUAL_UINT8(1U, l6470_shadow_dirty_count(1));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT16(sizeof(expected_tx), motor_spi()->last_data_size);
+    TEST_ASSERT_EQUAL_UINT16(L6470_CHAIN_LENGTH,
+                             motor_spi()->last_cs_frame_size);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(expected_tx, motor_spi()->last_tx_data,
+                                 sizeof(expected_tx));
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(0));
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(1));
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().writes_coalesced);
+    TEST_ASSERT_EQUAL_UINT32(3U, stats().registers_flushed);
+
+    // Nothing dirty: no bus traffic
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().bursts);
+}
+
+void test_rewriting_the_known_value_is_free(void) {
+    uint32_t value = 0;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_ACC, 0x30U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_ACC, 0x30U));
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(0));
+
+    // Pending and flushed values are both served from the shadow
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_DEC, 0x1FFU));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_KVAL_DEC, &value));
+    TEST_ASSERT_EQUAL_HEX32(0xFFU, value);
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+}
+
+void test_verify_detects_drift_and_flush_restores_it(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_RUN, 0x29U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+
+    respond_device0_byte(0x29);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_HEX8(0x2A, motor_spi()->last_tx_data[1]);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats().drift_detected);
+
+    // Brown-out: the device came back with a different value
+    respond_device0_byte(0x00);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().drift_detected);
+    TEST_ASSERT_EQUAL_UINT8(1U, l6470_shadow_dirty_count(0));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL_HEX8(0x0A, motor_spi()->last_tx_data[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x29, motor_spi()->last_tx_data[3]);
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(0));
+}
+
+void test_drift_rewrites_every_cached_register_of_the_device(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_HOLD, 0x10U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_RUN, 0x20U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_ACC, 0x30U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+
+    // Only KVAL_HOLD is sampled, but the reset cleared all three
+    respond_device0_byte(0x00);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_HEX8(0x29, motor_spi()->last_tx_data[1]);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().drift_detected);
+    TEST_ASSERT_EQUAL_UINT8(3U, l6470_shadow_dirty_count(0));
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(1));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(0));
+    TEST_ASSERT_EQUAL_UINT32(6U, stats().registers_flushed);
+}
+
+void test_verify_walks_the_cached_registers(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_HOLD, 0x10U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_KVAL_RUN, 0x20U));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+
+    respond_device0_byte(0x10);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_HEX8(0x29, motor_spi()->last_tx_data[1]);
+    respond_device0_byte(0x20);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_HEX8(0x2A, motor_spi()->last_tx_data[1]);
+    respond_device0_byte(0x10);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_verify());
+    TEST_ASSERT_EQUAL_HEX8(0x29, motor_spi()->last_tx_data[1]);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats().drift_detected);
+}
+
+void test_failed_flush_keeps_registers_dirty(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(1, L6470_REG_MAX_SPEED, 0x41U));
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, true);
+    TEST_ASSERT_NOT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    MockHAL_InjectFault(MOCK_FAULT_SPI_INIT, false);
+    TEST_ASSERT_EQUAL_UINT8(1U, l6470_shadow_dirty_count(1));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, l6470_shadow_flush());
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(1));
+}
+
+void test_dynamic_registers_bypass_the_shadow(void) {
+    uint32_t value = 0;
+
+    TEST_ASSERT_FALSE(l6470_shadow_is_cached(L6470_REG_ABS_POS));
+    TEST_ASSERT_FALSE(l6470_shadow_is_cached(L6470_REG_STATUS));
+    TEST_ASSERT_TRUE(l6470_shadow_is_cached(L6470_REG_CONFIG));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_PARAMETER_INVALID,
+                      l6470_shadow_write(0, L6470_REG_ABS_POS, 0));
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_INVALID_ID,
+                      l6470_shadow_write(L6470_CHAIN_LENGTH,
+                                         L6470_REG_KVAL_RUN, 0));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_ABS_POS, &value));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_ABS_POS, &value));
+    TEST_ASSERT_EQUAL_UINT32(2U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT32(0U, stats().cache_hits);
+}
+
+void test_invalidate_forgets_a_device(void) {
+    uint32_t value = 0;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_write(0, L6470_REG_STALL_TH, 0x40U));
+    l6470_shadow_invalidate(0);
+    TEST_ASSERT_EQUAL_UINT8(0U, l6470_shadow_dirty_count(0));
+
+    respond_device0_byte(0x40);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      l6470_shadow_read(0, L6470_REG_STALL_TH, &value));
+    TEST_ASSERT_EQUAL_UINT32(1U, motor_spi()->call_count);
+    TEST_ASSERT_EQUAL_UINT32(1U, stats().cache_misses);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cached_register_is_read_from_the_device_once);
+    RUN_TEST(test_writes_are_deferred_and_flushed_as_one_burst);
+    RUN_TEST(test_rewriting_the_known_value_is_free);
+    RUN_TEST(test_verify_detects_drift_and_flush_restores_it);
+    RUN_TEST(test_drift_rewrites_every_cached_register_of_the_device);
+    RUN_TEST(test_verify_walks_the_cached_registers);
+    RUN_TEST(test_failed_flush_keeps_registers_dirty);
+    RUN_TEST(test_dynamic_registers_bypass_the_shadow);
+    RUN_TEST(test_invalidate_forgets_a_device);
+    return UNITY_END();
+}
@@ -0,0 +1,79 @@
+/**
+ * @file test_l6470_units.c
+ * @brief Unit tests for the generated L6470 fixed-point unit conversions
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Expected values are the datasheet formulas evaluated exactly and
+ * rounded to nearest (tick = 250 ns, host values in milli-steps).
+ */
+
+#include "config/l6470_registers_generated.h"
+#include "unity.h"
+
+void setUp(void) {
+}
+
+void tearDown(void) {
+}
+
+void test_speed_matches_datasheet_scale(void) {
+    // SPEED = steps/s * 2^28 * 250 ns
+    TEST_ASSERT_EQUAL_UINT32(67109U, l6470_speed_encode(1000000U));
+    TEST_ASSERT_EQUAL_UINT32(15U, l6470_speed_decode(1U));
+    TEST_ASSERT_EQUAL_UINT32(15624985U, l6470_speed_decode(0xFFFFFU));
+    TEST_ASSERT_EQUAL_UINT32(0U, l6470_speed_encode(0U));
+}
+
+void test_acceleration_matches_datasheet_scale(void) {
+    // ACC = steps/s^2 * 2^40 * (250 ns)^2; default 0x08A ~ 2008 steps/s^2
+    TEST_ASSERT_EQUAL_UINT32(2008164U, l6470_acc_decode(0x08AU));
+    TEST_ASSERT_EQUAL_UINT32(0x08AU, l6470_acc_encode(2008164U));
+    TEST_ASSERT_EQUAL_UINT32(69U, l6470_dec_encode(1000000U));
+    TEST_ASSERT_EQUAL_UINT32(59590093U, l6470_dec_decode(0xFFFU));
+}
+
+void test_max_speed_matches_datasheet_scale(void) {
+    // MAX_SPEED = steps/s * 2^18 * 250 ns; default 0x041 ~ 992 steps/s
+    TEST_ASSERT_EQUAL_UINT32(991821U, l6470_max_speed_decode(0x041U));
+    TEST_ASSERT_EQUAL_UINT32(0x041U, l6470_max_speed_encode(991821U));
+    TEST_ASSERT_EQUAL_UINT32(15609741U, l6470_max_speed_decode(0x3FFU));
+}
+
+void test_encode_saturates_at_the_register_mask(void) {
+    TEST_ASSERT_EQUAL_HEX32(L6470_SPEED_MASK, l6470_speed_encode(0xFFFFFFFFU));
+    TEST_ASSERT_EQUAL_HEX32(L6470_ACC_MASK, l6470_acc_encode(0xFFFFFFFFU));
+    TEST_ASSERT_EQUAL_HEX32(L6470_MAX_SPEED_MASK,
+                            l6470_max_speed_encode(0xFFFFFFFFU));
+    TEST_ASSERT_EQUAL_HEX32(L6470_MIN_SPEED_MASK,
+                            l6470_min_speed_encode(0xFFFFFFFFU));
+}
+
+void test_every_register_value_round_trips(void) {
+    for (uint32_t v = 0; v <= L6470_ACC_MASK; v++) {
+        TEST_ASSERT_EQUAL_UINT32(v, l6470_acc_encode(l6470_acc_decode(v)));
+    }
+    for (uint32_t v = 0; v <= L6470_MAX_SPEED_MASK; v++) {
+        TEST_ASSERT_EQUAL_UINT32(
+            v, l6470_max_speed_encode(l6470_max_speed_decode(v)));
+    }
+    for (uint32_t v = 0; v <= L6470_MIN_SPEED_MASK; v++) {
+        TEST_ASSERT_EQUAL_UINT32(
+            v, l6470_min_speed_encode(l6470_min_speed_decode(v)));
+    }
+    // SPEED steps are ~15 msteps/s apart, still distinct after rounding
+    for (uint32_t v = 0; v <= L6470_SPEED_MASK; v += 97U) {
+        TEST_ASSERT_EQUAL_UINT32(v,
+                                 l6470_speed_encode(l6470_speed_decode(v)));
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_speed_matches_datasheet_scale);
+    RUN_TEST(test_acceleration_matches_datasheet_scale);
+    RUN_TEST(test_max_speed_matches_datasheet_scale);
+    RUN_TEST(test_encode_saturates_at_the_register_mask);
+    RUN_TEST(test_every_register_value_round_trips);
+    return UNITY_END();
+}
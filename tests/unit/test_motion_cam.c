@@ -0,0 +1,213 @@
+/**
+ * @file test_motion_cam.c
+ * @brief Unit tests for electronic gearing and cam-table following
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "controllers/motion_cam.h"
+#include "unity.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define CAM_SPACING 250U
+#define CAM_POINTS 9U
+#define CAM_CYCLE ((int32_t)((CAM_POINTS - 1U) * CAM_SPACING))
+
+// Reciprocating cam: out 800 steps and back over one cycle
+static const int32_t lift_points[CAM_POINTS] = {0,   100, 350, 650, 800,
+                                                650, 350, 100, 0};
+static const MotionCamTable_t lift_cam = {
+    .points = lift_points, .point_count = CAM_POINTS,
+    .master_spacing = CAM_SPACING};
+
+// Rolling cam: 1000 slave steps per cycle with a dwell in the middle
+static const int32_t roll_points[5] = {0, 400, 500, 600, 1000};
+static const MotionCamTable_t roll_cam = {
+    .points = roll_points, .point_count = 5, .master_spacing = 500U};
+
+static MotionFollower_t follower;
+
+void setUp(void) {
+    motion_cam_follower_init(&follower);
+}
+
+void tearDown(void) {
+}
+
+static MotionFollowLaw_t gear_law(int32_t numerator, uint32_t denominator) {
+    MotionFollowLaw_t law = {.mode = MOTION_FOLLOW_GEAR,
+                             .gear_numerator = numerator,
+                             .gear_denominator = denominator,
+                             .cam = NULL};
+    return law;
+}
+
+static MotionFollowLaw_t cam_law(const MotionCamTable_t *cam) {
+    MotionFollowLaw_t law = {.mode = MOTION_FOLLOW_CAM,
+                             .gear_numerator = 0,
+                             .gear_denominator = 0,
+                             .cam = cam};
+    return law;
+}
+
+/**
+ * @brief Reference cam value computed in double precision
+ */
+static double cam_reference(const MotionCamTable_t *cam, int64_t master) {
+    int64_t length = (int64_t)(cam->point_count - 1U) * cam->master_spacing;
+    double cycles = floor((double)master / (double)length);
+    double phase = (double)master - cycles * (double)length;
+    double x = phase / cam->master_spacing;
+    uint32_t index = (uint32_t)x;
+    double stroke =
+        (double)(cam->points[cam->point_count - 1U] - cam->points[0]);
+
+    return cycles * stroke + cam->points[index] - cam->points[0] +
+           (x - index) * (cam->points[index + 1U] - cam->points[index]);
+}
+
+void test_gear_ratio_is_exact_without_drift(void) {
+    MotionFollowLaw_t law = gear_law(3, 7);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_cam_engage(&follower, &law, 1000, -200));
+
+    // 700k ticks forward one step at a time, then back to the origin
+    for (int32_t m = 1000; m <= 701000; m++) {
+        int32_t slave = motion_cam_evaluate(&follower, m);
+        double ideal = -200.0 + (m - 1000) * 3.0 / 7.0;
+        TEST_ASSERT_TRUE(fabs(slave - ideal) <= 0.5);
+    }
+    TEST_ASSERT_EQUAL_INT32(-200 + 300000,
+                            motion_cam_evaluate(&follower, 701000));
+    TEST_ASSERT_EQUAL_INT32(-200, motion_cam_evaluate(&follower, 1000));
+}
+
+void test_negative_gear_ratio_and_master_direction(void) {
+    MotionFollowLaw_t law = gear_law(-5, 2);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &law, 0, 0));
+
+    TEST_ASSERT_EQUAL_INT32(-25, motion_cam_evaluate(&follower, 10));
+    TEST_ASSERT_EQUAL_INT32(25, motion_cam_evaluate(&follower, -10));
+    // -2.5 and 7.5 round half up
+    TEST_ASSERT_EQUAL_INT32(-2, motion_cam_evaluate(&follower, 1));
+    TEST_ASSERT_EQUAL_INT32(8, motion_cam_evaluate(&follower, -3));
+}
+
+void test_cam_interpolation_within_half_step(void) {
+    MotionFollowLaw_t law = cam_law(&lift_cam);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &law, 0, 500));
+
+    // Both directions, across several cycles either side of the origin
+    for (int32_t m = -3 * CAM_CYCLE; m <= 3 * CAM_CYCLE; m += 7) {
+        int32_t slave = motion_cam_evaluate(&follower, m);
+        double ideal = 500.0 + cam_reference(&lift_cam, m);
+        TEST_ASSERT_TRUE(fabs(slave - ideal) <= 0.5);
+    }
+    TEST_ASSERT_EQUAL_INT32(500 + 800,
+                            motion_cam_evaluate(&follower, CAM_CYCLE / 2));
+    TEST_ASSERT_EQUAL_INT32(500, motion_cam_evaluate(&follower, CAM_CYCLE));
+}
+
+void test_rolling_cam_accumulates_stroke(void) {
+    MotionFollowLaw_t law = cam_law(&roll_cam);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &law, 100, 0));
+
+    TEST_ASSERT_EQUAL_INT32(1000, motion_cam_evaluate(&follower, 2100));
+    TEST_ASSERT_EQUAL_INT32(3400, motion_cam_evaluate(&follower, 6600));
+    TEST_ASSERT_EQUAL_INT32(-1600, motion_cam_evaluate(&follower, -3400));
+    TEST_ASSERT_EQUAL_INT32(-800, motion_cam_evaluate(&follower, -1650));
+}
+
+void test_immediate_switch_is_continuous(void) {
+    MotionFollowLaw_t law = gear_law(1, 1);
+    MotionFollowLaw_t faster = gear_law(2, 1);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &law, 0, 0));
+
+    int32_t before = motion_cam_evaluate(&follower, 1234);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_switch(&follower, &faster, false));
+
+    // Next tick: same master position holds the setpoint, then 2:1
+    TEST_ASSERT_EQUAL_INT32(before, motion_cam_evaluate(&follower, 1234));
+    TEST_ASSERT_EQUAL_INT32(before + 20, motion_cam_evaluate(&follower, 1244));
+
+    // Gear to cam: the gear carries the slave to the switch tick, the cam
+    // starts from there at phase 0
+    MotionFollowLaw_t cam = cam_law(&lift_cam);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_switch(&follower, &cam, false));
+    int32_t held = motion_cam_evaluate(&follower, 1300);
+    TEST_ASSERT_EQUAL_INT32(before + 20 + 112, held);
+    TEST_ASSERT_EQUAL_INT32(held + 800,
+                            motion_cam_evaluate(&follower,
+                                                1300 + CAM_CYCLE / 2));
+}
+
+void test_cycle_end_switch_waits_for_boundary(void) {
+    MotionFollowLaw_t lift = cam_law(&lift_cam);
+    MotionFollowLaw_t roll = cam_law(&roll_cam);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &lift, 0, 0));
+
+    motion_cam_evaluate(&follower, 700);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_switch(&follower, &roll, true));
+
+    // Still on the lift cam until the master crosses CAM_CYCLE
+    int32_t previous = 0;
+    for (int32_t m = 701; m < CAM_CYCLE; m += 3) {
+        int32_t slave = motion_cam_evaluate(&follower, m);
+        TEST_ASSERT_TRUE(fabs(slave - cam_reference(&lift_cam, m)) <= 0.5);
+        previous = slave;
+    }
+    TEST_ASSERT_TRUE(previous <= 1);
+
+    // Crossed by 40 steps in one tick: the roll cam is anchored exactly on
+    // the boundary, not at the sampled master position
+    int32_t slave = motion_cam_evaluate(&follower, CAM_CYCLE + 40);
+    TEST_ASSERT_EQUAL_INT32(32, slave);
+    TEST_ASSERT_EQUAL_INT32(1000,
+                            motion_cam_evaluate(&follower, 2 * CAM_CYCLE));
+}
+
+void test_cycle_end_switch_running_backwards(void) {
+    MotionFollowLaw_t lift = cam_law(&lift_cam);
+    MotionFollowLaw_t gear = gear_law(1, 2);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_engage(&follower, &lift, 0, 0));
+
+    motion_cam_evaluate(&follower, 100);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_cam_switch(&follower, &gear, true));
+    TEST_ASSERT_EQUAL_INT32(4, motion_cam_evaluate(&follower, 10));
+
+    // Boundary crossed at master 0 going backwards
+    TEST_ASSERT_EQUAL_INT32(-5, motion_cam_evaluate(&follower, -10));
+    TEST_ASSERT_EQUAL_INT32(-500, motion_cam_evaluate(&follower, -1000));
+}
+
+void test_invalid_laws_rejected(void) {
+    MotionFollowLaw_t zero_den = gear_law(1, 0);
+    MotionFollowLaw_t huge = gear_law(MOTION_CAM_MAX_GEAR_TERM + 1, 1);
+    const MotionCamTable_t short_cam = {
+        .points = lift_points, .point_count = 1, .master_spacing = 10U};
+    MotionFollowLaw_t bad_cam = cam_law(&short_cam);
+    MotionFollowLaw_t gear = gear_law(1, 1);
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      motion_cam_engage(&follower, &zero_den, 0, 0));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      motion_cam_engage(&follower, &huge, 0, 0));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      motion_cam_engage(&follower, &bad_cam, 0, 0));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_cam_switch(&follower, &gear, false));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_gear_ratio_is_exact_without_drift);
+    RUN_TEST(test_negative_gear_ratio_and_master_direction);
+    RUN_TEST(test_cam_interpolation_within_half_step);
+    RUN_TEST(test_rolling_cam_accumulates_stroke);
+    RUN_TEST(test_immediate_switch_is_continuous);
+    RUN_TEST(test_cycle_end_switch_waits_for_boundary);
+    RUN_TEST(test_cycle_end_switch_running_backwards);
+    RUN_TEST(test_invalid_laws_rejected);
+    return UNITY_END();
+}
@@ -0,0 +1,283 @@
+/**
+ * @file test_motion_lookahead.c
+ * @brief Unit tests for the look-ahead segment queue and junction blending
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "controllers/motion_lookahead.h"
+#include "unity.h"
+#include <math.h>
+#include <stdlib.h>
+
+#define TEST_SPEED 3000U
+#define TEST_ACCEL 1600U
+#define TEST_MAX_TICKS 200000U
+
+/**
+ * @brief Path statistics collected while running the executor
+ */
+typedef struct {
+    uint32_t ticks;                ///< Ticks until the queue drained
+    float min_cruise_speed;        ///< Lowest speed between start and end
+    uint32_t max_axis_speed;       ///< Largest per-axis speed setpoint
+    int32_t final_pos[MAX_MOTORS]; ///< Last position setpoints
+} PathRun_t;
+
+static const int32_t origin[MAX_MOTORS] = {0};
+static uint32_t feedforward_cleared; ///< Motors whose feedforward was dropped
+
+void setUp(void) {
+    motion_lookahead_init();
+    feedforward_cleared = 0;
+    motion_lookahead_set_origin(origin);
+}
+
+void tearDown(void) {
+}
+
+static void push_point(int32_t x, int32_t y, uint32_t speed) {
+    const int32_t point[2] = {x, y};
+    CoordinatedMoveCommand_t move = {0};
+
+    for (uint8_t i = 0; i < MAX_MOTORS && i < 2; i++) {
+        move.motor_targets[i].enabled = true;
+        move.motor_targets[i].target_position = point[i];
+        move.motor_targets[i].max_velocity = speed;
+        move.motor_targets[i].acceleration = TEST_ACCEL;
+        move.motor_targets[i].deceleration = TEST_ACCEL;
+    }
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_push(&move));
+}
+
+/**
+ * @brief Run the queue dry; speeds near both path ends are not counted
+ */
+static void run_path(PathRun_t *run, float settle_steps, float total_steps) {
+    int32_t pos[MAX_MOTORS];
+    int32_t vel[MAX_MOTORS];
+    float travelled = 0.0f;
+    int32_t prev[MAX_MOTORS] = {0};
+
+    run->ticks = 0;
+    run->min_cruise_speed = 1e9f;
+    run->max_axis_speed = 0;
+
+    while (motion_lookahead_is_active() && run->ticks < TEST_MAX_TICKS) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_update(1, pos, vel));
+        run->ticks++;
+
+        float step_sq = 0.0f;
+        for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+            float d = (float)(pos[i] - prev[i]);
+            step_sq += d * d;
+            prev[i] = pos[i];
+            if ((uint32_t)abs(vel[i]) > run->max_axis_speed) {
+                run->max_axis_speed = (uint32_t)abs(vel[i]);
+            }
+        }
+        travelled += sqrtf(step_sq);
+
+        LookaheadStatus_t status;
+        motion_lookahead_get_status(&status);
+        if (travelled > settle_steps &&
+            travelled < total_steps - settle_steps &&
+            status.path_speed < run->min_cruise_speed) {
+            run->min_cruise_speed = status.path_speed;
+        }
+    }
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        run->final_pos[i] = pos[i];
+    }
+    TEST_ASSERT_FALSE(motion_lookahead_is_active());
+}
+
+void test_collinear_segments_blend_without_stopping(void) {
+    PathRun_t run;
+    LookaheadStatus_t status;
+
+    for (int32_t i = 1; i <= 4; i++) {
+        push_point(2000 * i, 0, TEST_SPEED);
+    }
+    // Accel / decel distance at 3000 steps/s is ~2800 steps
+    run_path(&run, 3000.0f, 8000.0f);
+
+    motion_lookahead_get_status(&status);
+    TEST_ASSERT_EQUAL_UINT32(4U, status.completed);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.full_stops);
+    TEST_ASSERT_TRUE(run.min_cruise_speed > 0.9f * TEST_SPEED);
+    TEST_ASSERT_EQUAL_INT32(8000, run.final_pos[0]);
+    TEST_ASSERT_EQUAL_INT32(0, run.final_pos[1]);
+}
+
+void test_blending_is_faster_than_stop_and_go(void) {
+    PathRun_t blended;
+    PathRun_t stop_go;
+    uint32_t stop_go_ticks = 0;
+
+    for (int32_t i = 1; i <= 4; i++) {
+        push_point(2000 * i, 0, TEST_SPEED);
+    }
+    run_path(&blended, 0.0f, 0.0f);
+
+    // Same path, but each segment drains the queue before the next
+    motion_lookahead_init();
+    motion_lookahead_set_origin(origin);
+    for (int32_t i = 1; i <= 4; i++) {
+        push_point(2000 * i, 0, TEST_SPEED);
+        run_path(&stop_go, 0.0f, 0.0f);
+        stop_go_ticks += stop_go.ticks;
+    }
+
+    TEST_ASSERT_EQUAL_INT32(8000, stop_go.final_pos[0]);
+    TEST_ASSERT_TRUE(blended.ticks * 10U < stop_go_ticks * 7U);
+}
+
+void test_right_angle_corner_respects_junction_deviation(void) {
+    int32_t pos[MAX_MOTORS];
+    int32_t vel[MAX_MOTORS];
+    LookaheadStatus_t status;
+    float corner_speed = -1.0f;
+
+    push_point(4000, 0, TEST_SPEED);
+    push_point(4000, 4000, TEST_SPEED);
+
+    // cos(theta) = 0: v^2 = a * deviation * sin(45) / (1 - sin(45))
+    float sin_half = sqrtf(0.5f);
+    float limit =
+        sqrtf((float)TEST_ACCEL * MOTION_LOOKAHEAD_JUNCTION_DEVIATION *
+              sin_half / (1.0f - sin_half));
+
+    while (motion_lookahead_is_active()) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_update(1, pos, vel));
+        motion_lookahead_get_status(&status);
+        if (status.completed == 1U && corner_speed < 0.0f) {
+            corner_speed = status.path_speed;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(1U, status.full_stops);
+    TEST_ASSERT_TRUE(corner_speed > 0.5f * limit);
+    TEST_ASSERT_TRUE(corner_speed <= limit + (float)TEST_ACCEL * 0.002f);
+    TEST_ASSERT_EQUAL_INT32(4000, pos[0]);
+    TEST_ASSERT_EQUAL_INT32(4000, pos[1]);
+}
+
+void test_reversal_comes_to_rest(void) {
+    PathRun_t run;
+
+    push_point(4000, 0, TEST_SPEED);
+    push_point(0, 0, TEST_SPEED);
+    run_path(&run, 1000.0f, 8000.0f);
+
+    // Speed must drop to (almost) zero at the turning point
+    TEST_ASSERT_TRUE(run.min_cruise_speed < (float)TEST_ACCEL * 0.002f);
+    TEST_ASSERT_EQUAL_INT32(0, run.final_pos[0]);
+}
+
+void test_axis_speed_limits_on_diagonal(void) {
+    PathRun_t run;
+
+    push_point(6000, 3000, 1000U);
+    run_path(&run, 0.0f, 0.0f);
+
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1000U, run.max_axis_speed);
+    TEST_ASSERT_GREATER_THAN_UINT32(990U, run.max_axis_speed);
+    TEST_ASSERT_EQUAL_INT32(6000, run.final_pos[0]);
+    TEST_ASSERT_EQUAL_INT32(3000, run.final_pos[1]);
+}
+
+void test_streamed_segment_extends_running_path(void) {
+    int32_t pos[MAX_MOTORS];
+    int32_t vel[MAX_MOTORS];
+    LookaheadStatus_t status;
+    float junction = -1.0f;
+
+    push_point(6000, 0, TEST_SPEED);
+    for (uint32_t t = 0; t < 2500U; t++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_update(1, pos, vel));
+    }
+
+    // Arrives while the first segment is already braking for its end
+    push_point(12000, 0, TEST_SPEED);
+    while (motion_lookahead_is_active()) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_update(1, pos, vel));
+        motion_lookahead_get_status(&status);
+        if (status.completed == 1U && junction < 0.0f) {
+            junction = status.path_speed;
+        }
+    }
+
+    // Braking had started at ~2050 steps/s; the junction is crossed
+    // accelerating again instead of at rest
+    TEST_ASSERT_EQUAL_UINT32(1U, status.full_stops);
+    TEST_ASSERT_TRUE(junction > 2500.0f);
+    TEST_ASSERT_EQUAL_INT32(12000, pos[0]);
+}
+
+void test_full_ring_rejects_push(void) {
+    CoordinatedMoveCommand_t move = {0};
+
+    for (uint32_t i = 1; i <= MOTION_LOOKAHEAD_DEPTH; i++) {
+        push_point((int32_t)(100U * i), 0, TEST_SPEED);
+    }
+    TEST_ASSERT_EQUAL_UINT8(0U, motion_lookahead_free_slots());
+
+    move.motor_targets[0].enabled = true;
+    move.motor_targets[0].target_position = 5000;
+    move.motor_targets[0].max_velocity = TEST_SPEED;
+    move.motor_targets[0].acceleration = TEST_ACCEL;
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_OVERFLOW, motion_lookahead_push(&move));
+    TEST_ASSERT_EQUAL(ERROR_MOTION_ACTIVE,
+                      motion_lookahead_set_origin(origin));
+}
+
+void test_abort_drops_queue(void) {
+    int32_t pos[MAX_MOTORS];
+    int32_t vel[MAX_MOTORS];
+
+    push_point(4000, 0, TEST_SPEED);
+    push_point(8000, 0, TEST_SPEED);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_lookahead_update(1, pos, vel));
+
+    motion_lookahead_abort();
+    TEST_ASSERT_EQUAL_HEX32((1U << MAX_MOTORS) - 1U, feedforward_cleared);
+
+    // Busy until the executor has dropped the queue on its next tick
+    const int32_t origin[MAX_MOTORS] = {0};
+    CoordinatedMoveCommand_t move = {0};
+    move.motor_targets[0].enabled = true;
+    move.motor_targets[0].target_position = 100;
+    move.motor_targets[0].max_velocity = TEST_SPEED;
+    move.motor_targets[0].acceleration = TEST_ACCEL;
+    TEST_ASSERT_TRUE(motion_lookahead_is_active());
+    TEST_ASSERT_EQUAL(ERROR_MOTION_ACTIVE, motion_lookahead_push(&move));
+    TEST_ASSERT_EQUAL(ERROR_MOTION_ACTIVE,
+                      motion_lookahead_set_origin(origin));
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_lookahead_update(1, pos, vel));
+    TEST_ASSERT_FALSE(motion_lookahead_is_active());
+    TEST_ASSERT_EQUAL_UINT8(MOTION_LOOKAHEAD_DEPTH,
+                            motion_lookahead_free_slots());
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_collinear_segments_blend_without_stopping);
+    RUN_TEST(test_blending_is_faster_than_stop_and_go);
+    RUN_TEST(test_right_angle_corner_respects_junction_deviation);
+    RUN_TEST(test_reversal_comes_to_rest);
+    RUN_TEST(test_axis_speed_limits_on_diagonal);
+    RUN_TEST(test_streamed_segment_extends_running_path);
+    RUN_TEST(test_full_ring_rejects_push);
+    RUN_TEST(test_abort_drops_queue);
+    return UNITY_END();
+}
+
+/* Position control stub */
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    feedforward_cleared |= 1U << motor_id;
+}
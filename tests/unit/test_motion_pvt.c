@@ -0,0 +1,309 @@
+/**
+ * @file test_motion_pvt.c
+ * @brief Unit tests for the streamed PVT trajectory buffer
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "controllers/motion_pvt.h"
+#include "controllers/position_control.h"
+#include "controllers/position_safety.h"
+#include "unity.h"
+#include <math.h>
+#include <string.h>
+
+#define TEST_MOTOR 0U
+
+static float soft_limit_deg; ///< Symmetric soft limit of the safety stub
+static uint32_t feedforward_cleared; ///< Motors whose feedforward was dropped
+static uint32_t preempt_ticks; ///< Consumer ticks run inside the safety stub
+
+void setUp(void) {
+    motion_pvt_init();
+    soft_limit_deg = 1.0e6f;
+    feedforward_cleared = 0;
+    preempt_ticks = 0;
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Run a stream dry, recording positions per tick
+ * @return Ticks until the stream stopped
+ */
+static uint32_t run_stream(int32_t *positions, uint32_t max_ticks) {
+    uint32_t ticks = 0;
+    int32_t vel;
+
+    while (motion_pvt_is_active(TEST_MOTOR) && ticks < max_ticks) {
+        int32_t pos;
+        TEST_ASSERT_EQUAL(SYSTEM_OK,
+                          motion_pvt_update(TEST_MOTOR, 1, &pos, &vel));
+        if (positions != NULL) {
+            positions[ticks] = pos;
+        }
+        ticks++;
+    }
+    return ticks;
+}
+
+void test_hermite_reproduces_cubic_path(void) {
+    // x(t) = 100 + 2000 t^2 - 800 t^3 sampled every 100 ms, t in seconds
+    PvtPoint_t points[10];
+    static int32_t positions[1000];
+
+    for (uint8_t i = 0; i < 10; i++) {
+        float t = 0.1f * (float)(i + 1);
+        points[i].position =
+            (int32_t)lroundf(100.0f + 2000.0f * t * t - 800.0f * t * t * t);
+        points[i].velocity =
+            (int32_t)lroundf(4000.0f * t - 2400.0f * t * t);
+        points[i].duration_ms = 100;
+    }
+    points[9].velocity = 1600; // Exact value at t = 1 s
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 100));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, points, 10));
+
+    uint32_t ticks = run_stream(positions, 1000);
+    TEST_ASSERT_EQUAL_UINT32(1000U, ticks);
+
+    // A cubic is reproduced exactly by Hermite segments up to rounding
+    for (uint32_t k = 0; k < ticks - 1U; k++) {
+        float t = (float)(k + 1U) / 1000.0f;
+        float ideal = 100.0f + 2000.0f * t * t - 800.0f * t * t * t;
+        TEST_ASSERT_FLOAT_WITHIN(1.0f, ideal, (float)positions[k]);
+    }
+    TEST_ASSERT_EQUAL_INT32(1300, positions[ticks - 1U]);
+}
+
+void test_constant_velocity_is_linear(void) {
+    // From rest to 2000 steps/s, then steady 2000 steps/s
+    PvtPoint_t points[3] = {{1000, 2000, 1000}, {2000, 2000, 500},
+                            {2100, 0, 100}};
+    int32_t vel;
+    int32_t pos;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, points, 3));
+
+    for (uint32_t k = 0; k < 1250U; k++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK,
+                          motion_pvt_update(TEST_MOTOR, 1, &pos, &vel));
+    }
+    TEST_ASSERT_EQUAL_INT32(1500, pos);
+    TEST_ASSERT_INT32_WITHIN(1, 2000, vel);
+}
+
+void test_reverse_motion_has_negative_velocity(void) {
+    PvtPoint_t points[3] = {{-1000, -2000, 1000}, {-2000, -2000, 500},
+                            {-2100, 0, 100}};
+    int32_t vel;
+    int32_t pos;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, points, 3));
+
+    for (uint32_t k = 0; k < 1250U; k++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK,
+                          motion_pvt_update(TEST_MOTOR, 1, &pos, &vel));
+    }
+    TEST_ASSERT_EQUAL_INT32(-1500, pos);
+    TEST_ASSERT_INT32_WITHIN(1, -2000, vel);
+}
+
+void test_batch_is_all_or_nothing(void) {
+    PvtPoint_t points[MOTION_PVT_DEPTH];
+    PvtStatus_t status;
+
+    for (uint32_t i = 0; i < MOTION_PVT_DEPTH; i++) {
+        points[i] = (PvtPoint_t){(int32_t)(10U * (i + 1U)), 0, 10};
+    }
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, points, 40));
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_OVERFLOW,
+                      motion_pvt_push(TEST_MOTOR, &points[40], 30));
+
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT8(40U, status.queued);
+    TEST_ASSERT_EQUAL_UINT8(MOTION_PVT_DEPTH - 40U, status.free);
+
+    // A bad point rejects the whole batch
+    points[41].duration_ms = 0;
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      motion_pvt_push(TEST_MOTOR, &points[40], 5));
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT8(40U, status.queued);
+}
+
+void test_underrun_when_drained_while_moving(void) {
+    PvtPoint_t moving[2] = {{500, 1000, 1000}, {1500, 1000, 1000}};
+    PvtPoint_t stop = {1600, 0, 200};
+    PvtStatus_t status;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, moving, 2));
+    TEST_ASSERT_EQUAL_UINT32(2000U, run_stream(NULL, 5000));
+
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_FALSE(status.running);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.underruns);
+    TEST_ASSERT_EQUAL_INT32(1500, status.position);
+
+    // Streams ending at rest are not underruns
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 1500));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &stop, 1));
+    run_stream(NULL, 5000);
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.underruns);
+    TEST_ASSERT_EQUAL_INT32(1600, status.position);
+    TEST_ASSERT_EQUAL_UINT32(3U, status.points_done);
+}
+
+void test_streaming_while_running_extends_path(void) {
+    PvtPoint_t first = {200, 400, 1000};
+    PvtPoint_t second = {600, 400, 1000};
+    PvtPoint_t last = {700, 0, 500};
+    int32_t pos;
+    int32_t vel;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &first, 1));
+    for (uint32_t k = 0; k < 500U; k++) {
+        motion_pvt_update(TEST_MOTOR, 1, &pos, &vel);
+    }
+
+    // Push without begin() is only accepted while the stream runs
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &second, 1));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &last, 1));
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE, motion_pvt_begin(TEST_MOTOR, 0));
+
+    TEST_ASSERT_EQUAL_UINT32(2000U, run_stream(NULL, 5000));
+
+    PvtStatus_t status;
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT32(0U, status.underruns);
+    TEST_ASSERT_EQUAL_INT32(700, status.position);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_pvt_push(TEST_MOTOR, &last, 1));
+}
+
+void test_push_racing_an_underrun_is_refused(void) {
+    PvtPoint_t first = {200, 400, 1000};
+    PvtPoint_t second = {600, 400, 1000};
+    PvtStatus_t status;
+    int32_t pos;
+    int32_t vel;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &first, 1));
+    for (uint32_t k = 0; k < 999U; k++) {
+        motion_pvt_update(TEST_MOTOR, 1, &pos, &vel);
+    }
+
+    // The control tick drains the stream while the batch is validated
+    preempt_ticks = 1;
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_pvt_push(TEST_MOTOR, &second, 1));
+
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_FALSE(status.running);
+    TEST_ASSERT_EQUAL_UINT8(0U, status.queued);
+    TEST_ASSERT_EQUAL_UINT32(1U, status.underruns);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 200));
+}
+
+void test_abort_stops_stream(void) {
+    PvtPoint_t points[2] = {{1000, 1000, 1000}, {2000, 0, 1000}};
+    int32_t pos;
+    int32_t vel;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, points, 2));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_update(TEST_MOTOR, 1, &pos, &vel));
+
+    motion_pvt_abort(TEST_MOTOR);
+    TEST_ASSERT_EQUAL_HEX32(1U << TEST_MOTOR, feedforward_cleared);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_pvt_update(TEST_MOTOR, 1, &pos, &vel));
+    TEST_ASSERT_FALSE(motion_pvt_is_active(TEST_MOTOR));
+
+    PvtStatus_t status;
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT8(0U, status.queued);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, pos));
+}
+
+void test_abort_after_drain_does_not_block_begin(void) {
+    PvtPoint_t point = {500, 0, 10};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &point, 1));
+    run_stream(NULL, 100);
+    TEST_ASSERT_FALSE(motion_pvt_is_active(TEST_MOTOR));
+
+    // A stop that lost the race with the drain leaves a stale request
+    motion_pvt_abort(TEST_MOTOR);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 500));
+    point.position = 800;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_push(TEST_MOTOR, &point, 1));
+    TEST_ASSERT_EQUAL_UINT32(10U, run_stream(NULL, 100));
+
+    PvtStatus_t status;
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_INT32(800, status.position);
+}
+
+void test_point_beyond_soft_limit_is_refused(void) {
+    PvtPoint_t points[2] = {{1000, 0, 10}, {4000, 0, 10}};
+    PvtStatus_t status;
+
+    soft_limit_deg = 2000.0f * STEPS_TO_DEGREES;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_pvt_begin(TEST_MOTOR, 0));
+    TEST_ASSERT_EQUAL(ERROR_POSITION_LIMIT_EXCEEDED,
+                      motion_pvt_push(TEST_MOTOR, points, 2));
+    motion_pvt_get_status(TEST_MOTOR, &status);
+    TEST_ASSERT_EQUAL_UINT8(0U, status.queued);
+    TEST_ASSERT_FALSE(motion_pvt_is_active(TEST_MOTOR));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hermite_reproduces_cubic_path);
+    RUN_TEST(test_constant_velocity_is_linear);
+    RUN_TEST(test_reverse_motion_has_negative_velocity);
+    RUN_TEST(test_batch_is_all_or_nothing);
+    RUN_TEST(test_underrun_when_drained_while_moving);
+    RUN_TEST(test_streaming_while_running_extends_path);
+    RUN_TEST(test_push_racing_an_underrun_is_refused);
+    RUN_TEST(test_abort_stops_stream);
+    RUN_TEST(test_abort_after_drain_does_not_block_begin);
+    RUN_TEST(test_point_beyond_soft_limit_is_refused);
+    return UNITY_END();
+}
+
+/* Position safety stub: symmetric soft limits on every motor */
+
+SystemError_t
+position_safety_validate_target(uint8_t motor_id, float target_position_deg,
+                                PositionValidationResult_t *result) {
+    // Stands in for the control tick preempting the producer
+    for (; preempt_ticks > 0; preempt_ticks--) {
+        int32_t pos;
+        int32_t vel;
+        motion_pvt_update(motor_id, 1, &pos, &vel);
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->soft_limit_ok = fabsf(target_position_deg) <= soft_limit_deg;
+    result->position_valid = result->soft_limit_ok;
+    return SYSTEM_OK;
+}
+
+/* Position control stub */
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    feedforward_cleared |= 1U << motor_id;
+}
@@ -0,0 +1,448 @@
+/**
+ * @file test_motion_trajectory.c
+ * @brief Unit tests for the incremental fixed-point trajectory generator
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "controllers/motion_profile.h"
+#include "unity.h"
+#include <math.h>
+#include <stdlib.h>
+
+static MotionProfile_t profile;
+static MotionTrajectory_t trajectory;
+static uint32_t feedforward_cleared; ///< Motors whose feedforward was dropped
+
+void setUp(void) {
+    motion_profile_init();
+    feedforward_cleared = 0;
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Run a planned trajectory to completion, checking basic invariants
+ * @return Number of ticks executed
+ */
+static uint32_t run_to_end(int32_t start, int32_t end, uint32_t max_vel) {
+    int32_t pos = 0;
+    int32_t last = start;
+    int32_t vel = 0;
+    uint32_t ticks = 0;
+    bool running = true;
+
+    while (running) {
+        running = motion_profile_trajectory_step(&trajectory, &pos, &vel);
+        ticks++;
+
+        // Setpoints never overshoot and never move backwards, and the
+        // velocity carries the direction of travel
+        if (end >= start) {
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(last, pos);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(end, pos);
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(0, vel);
+        } else {
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(last, pos);
+            TEST_ASSERT_GREATER_OR_EQUAL_INT32(end, pos);
+            TEST_ASSERT_LESS_OR_EQUAL_INT32(0, vel);
+        }
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(max_vel + 1U, (uint32_t)abs(vel));
+        last = pos;
+    }
+
+    TEST_ASSERT_EQUAL_INT32(end, pos);
+    TEST_ASSERT_EQUAL_INT32(0, vel);
+    return ticks;
+}
+
+void test_trapezoid_lands_exactly_on_target(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_generate_trapezoidal(
+                                     &profile, 0, 20000, 3200, 1600));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_trajectory_plan(&trajectory, &profile));
+
+    // 2 s accel + 4.25 s cruise + 2 s decel
+    TEST_ASSERT_EQUAL_UINT8(3U, trajectory.segment_count);
+    TEST_ASSERT_EQUAL_UINT32(8250U, trajectory.total_ticks);
+    TEST_ASSERT_EQUAL_UINT32(8250U, run_to_end(0, 20000, 3200));
+}
+
+void test_reverse_triangular_move(void) {
+    // Too short to reach cruise velocity
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_generate_trapezoidal(
+                                     &profile, 5000, 4000, 3200, 1600));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_trajectory_plan(&trajectory, &profile));
+    run_to_end(5000, 4000, 3200);
+}
+
+void test_scurve_lands_exactly_on_target(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_generate_scurve(
+                                     &profile, -1000, 30001, 3200, 1600, 200));
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_trajectory_plan(&trajectory, &profile));
+    TEST_ASSERT_EQUAL_UINT8(7U, trajectory.segment_count);
+    run_to_end(-1000, 30001, 3200);
+}
+
+void test_segment_boundaries_snap_to_plan(void) {
+    int32_t pos;
+    int32_t vel;
+
+    motion_profile_generate_scurve(&profile, 0, 30000, 3200, 1600, 200);
+    motion_profile_trajectory_plan(&trajectory, &profile);
+
+    uint32_t boundary = 0;
+    for (uint8_t i = 0; i + 1U < trajectory.segment_count; i++) {
+        boundary += trajectory.segments[i].ticks;
+        while (trajectory.elapsed_ticks < boundary) {
+            motion_profile_trajectory_step(&trajectory, &pos, &vel);
+        }
+
+        // Accumulator equals the planned start of the next segment exactly
+        TEST_ASSERT_TRUE(trajectory.position ==
+                         trajectory.segments[i + 1U].position);
+        TEST_ASSERT_TRUE(trajectory.delta1 ==
+                         trajectory.segments[i + 1U].delta1);
+    }
+}
+
+void test_matches_closed_form_trapezoid(void) {
+    int32_t pos;
+    int32_t vel;
+    int32_t ref_pos;
+    uint32_t ref_vel;
+
+    motion_profile_generate_trapezoidal(&profile, 0, 20000, 3200, 1600);
+    motion_profile_trajectory_plan(&trajectory, &profile);
+
+    for (uint32_t t = 1; t <= trajectory.total_ticks; t++) {
+        motion_profile_trajectory_step(&trajectory, &pos, &vel);
+        motion_profile_execute(0, &profile, t, &ref_pos, &ref_vel);
+        TEST_ASSERT_INT32_WITHIN(2, ref_pos, pos);
+        TEST_ASSERT_INT32_WITHIN(2, (int32_t)ref_vel, vel);
+    }
+}
+
+void test_zero_length_move_completes_immediately(void) {
+    int32_t pos;
+    int32_t vel;
+
+    motion_profile_generate_trapezoidal(&profile, 1234, 1234, 3200, 1600);
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_trajectory_plan(&trajectory, &profile));
+    TEST_ASSERT_FALSE(motion_profile_trajectory_step(&trajectory, &pos, &vel));
+    TEST_ASSERT_EQUAL_INT32(1234, pos);
+    TEST_ASSERT_EQUAL_INT32(0, vel);
+}
+
+void test_update_deactivates_profile_at_end(void) {
+    int32_t pos = 0;
+    int32_t vel = 0;
+
+    motion_profile_generate_trapezoidal(&profile, 0, 100, 3200, 1600);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_start(0, &profile));
+
+    while (motion_profile_is_active(0)) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_update(0, &pos, &vel));
+    }
+
+    TEST_ASSERT_EQUAL_INT32(100, pos);
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_profile_update(0, &pos, &vel));
+}
+
+void test_stop_drops_velocity_feedforward(void) {
+    int32_t pos = 0;
+    int32_t vel = 0;
+
+    motion_profile_generate_trapezoidal(&profile, 0, 10000, 3200, 1600);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_start(1, &profile));
+    for (int i = 0; i < 50; i++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_update(1, &pos, &vel));
+    }
+    TEST_ASSERT_NOT_EQUAL(0, vel);
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_stop(1));
+    TEST_ASSERT_FALSE(motion_profile_is_active(1));
+    TEST_ASSERT_EQUAL_HEX32(1U << 1, feedforward_cleared);
+}
+
+/**
+ * @brief Step to the end after a replan, checking limits and continuity
+ * @return Lowest velocity seen in the first half of the remaining ticks
+ */
+static uint32_t run_replanned(int32_t end, const MotionLimits_t *limits) {
+    int32_t pos = trajectory.target_position;
+    int32_t last = pos;
+    int32_t vel = 0;
+    uint32_t min_vel = UINT32_MAX;
+    int64_t q_prev = trajectory.position;
+    int64_t q_prev2 = trajectory.position;
+    uint8_t segment_prev = trajectory.segment_index;
+    uint8_t segment_prev2 = trajectory.segment_index;
+    uint32_t half = trajectory.total_ticks / 2U;
+    bool running = true;
+
+    while (running) {
+        running = motion_profile_trajectory_step(&trajectory, &pos, &vel);
+
+        // Acceleration from the Q32.32 accumulator second difference,
+        // skipping windows that straddle a boundary snap (sub-1e-3 step
+        // corrections look like large accelerations here)
+        if (running && trajectory.elapsed_ticks >= 2U &&
+            segment_prev2 == trajectory.segment_index) {
+            double accel = (double)(trajectory.position - 2 * q_prev +
+                                    q_prev2) /
+                           4294967296.0 * 1e6;
+            TEST_ASSERT_TRUE(fabs(accel) <=
+                             limits->max_acceleration * 1.01 + 1.0);
+        }
+        q_prev2 = q_prev;
+        q_prev = trajectory.position;
+        segment_prev2 = segment_prev;
+        segment_prev = trajectory.segment_index;
+
+        uint32_t speed = (uint32_t)abs(vel);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(limits->max_velocity + 1U, speed);
+        TEST_ASSERT_INT32_WITHIN(limits->max_velocity / 1000U + 1U, last,
+                                 pos);
+        if (trajectory.elapsed_ticks < half && speed < min_vel) {
+            min_vel = speed;
+        }
+        last = pos;
+    }
+
+    TEST_ASSERT_EQUAL_INT32(end, pos);
+    return min_vel;
+}
+
+void test_replan_extends_move_without_stopping(void) {
+    const MotionLimits_t limits = {3200, 1600, 8000};
+    int32_t pos;
+    int32_t vel;
+
+    motion_profile_generate_scurve(&profile, 0, 20000, 3200, 1600, 200);
+    motion_profile_trajectory_plan(&trajectory, &profile);
+    for (uint32_t t = 0; t < 4000; t++) {
+        motion_profile_trajectory_step(&trajectory, &pos, &vel);
+    }
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_trajectory_replan(
+                                     &trajectory, 40000, &limits));
+    TEST_ASSERT_GREATER_THAN_UINT32(3100U, run_replanned(40000, &limits));
+}
+
+void test_replan_reverses_when_target_is_behind(void) {
+    const MotionLimits_t limits = {3200, 1600, 8000};
+    int32_t pos;
+    int32_t vel;
+
+    motion_profile_generate_trapezoidal(&profile, 0, 20000, 3200, 1600);
+    motion_profile_trajectory_plan(&trajectory, &profile);
+    for (uint32_t t = 0; t < 3000; t++) {
+        motion_profile_trajectory_step(&trajectory, &pos, &vel);
+    }
+
+    // Moving at full speed; stopping alone overshoots the new target
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_trajectory_replan(
+                                     &trajectory, pos - 100, &limits));
+    run_replanned(pos - 100, &limits);
+}
+
+void test_replan_from_rest_after_move(void) {
+    const MotionLimits_t limits = {1000, 500, 5000};
+    int32_t pos;
+    int32_t vel;
+
+    motion_profile_generate_trapezoidal(&profile, 0, 300, 3200, 1600);
+    motion_profile_trajectory_plan(&trajectory, &profile);
+    while (motion_profile_trajectory_step(&trajectory, &pos, &vel)) {
+    }
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_trajectory_replan(
+                                     &trajectory, -700, &limits));
+    run_replanned(-700, &limits);
+
+    // Replanning onto the current position is an empty trajectory
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_trajectory_replan(
+                                     &trajectory, -700, &limits));
+    TEST_ASSERT_EQUAL_UINT32(0U, trajectory.total_ticks);
+}
+
+void test_retarget_is_applied_by_update(void) {
+    const MotionLimits_t limits = {3200, 1600, 8000};
+    int32_t pos = 0;
+    int32_t vel = 0;
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE,
+                      motion_profile_retarget(0, 500, &limits));
+
+    motion_profile_generate_trapezoidal(&profile, 0, 10000, 3200, 1600);
+    motion_profile_start(0, &profile);
+    for (uint32_t t = 0; t < 1000; t++) {
+        motion_profile_update(0, &pos, &vel);
+    }
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_retarget(0, 5000, &limits));
+    while (motion_profile_is_active(0)) {
+        motion_profile_update(0, &pos, &vel);
+    }
+    TEST_ASSERT_EQUAL_INT32(5000, pos);
+
+    // Idle motor restarts from its last setpoint
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_retarget(0, 4000, &limits));
+    TEST_ASSERT_TRUE(motion_profile_is_active(0));
+    while (motion_profile_is_active(0)) {
+        motion_profile_update(0, &pos, &vel);
+    }
+    TEST_ASSERT_EQUAL_INT32(4000, pos);
+}
+
+/**
+ * @brief Step two synchronised trajectories, checking they stay on the
+ *        joint-space line and within each axis' velocity limit
+ * @return Number of ticks executed
+ */
+static uint32_t run_synchronized(MotionTrajectory_t plans[2],
+                                 const MotionSyncAxis_t axes[2]) {
+    int32_t pos[2];
+    int32_t vel[2];
+    uint32_t ticks = 0;
+    bool running = true;
+
+    TEST_ASSERT_EQUAL_UINT32(plans[0].total_ticks, plans[1].total_ticks);
+
+    while (running) {
+        bool running0 = motion_profile_trajectory_step(&plans[0], &pos[0],
+                                                       &vel[0]);
+        bool running1 = motion_profile_trajectory_step(&plans[1], &pos[1],
+                                                       &vel[1]);
+        TEST_ASSERT_EQUAL(running0, running1);
+        running = running0;
+        ticks++;
+
+        double progress = (double)(pos[0] - axes[0].start_position) /
+                          (axes[0].end_position - axes[0].start_position);
+        double expected =
+            axes[1].start_position +
+            progress * (axes[1].end_position - axes[1].start_position);
+        TEST_ASSERT_TRUE(fabs(pos[1] - expected) <= 1.5);
+
+        for (uint8_t i = 0; i < 2; i++) {
+            TEST_ASSERT_LESS_OR_EQUAL_UINT32(axes[i].max_velocity + 1U,
+                                             (uint32_t)abs(vel[i]));
+        }
+    }
+
+    TEST_ASSERT_EQUAL_INT32(axes[0].end_position, pos[0]);
+    TEST_ASSERT_EQUAL_INT32(axes[1].end_position, pos[1]);
+    return ticks;
+}
+
+void test_synchronized_axes_finish_together_on_line(void) {
+    static MotionTrajectory_t plans[2];
+    const MotionSyncAxis_t axes[2] = {{0, 0, 20000, 3200, 1600, 0},
+                                      {1, 1000, -4000, 3200, 1600, 0}};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_plan_synchronized(plans, axes, 2));
+    run_synchronized(plans, axes);
+}
+
+void test_synchronized_time_is_slowest_axis_minimum(void) {
+    static MotionTrajectory_t plans[2];
+    // Axis 1 is short but slow: it, not the long axis, sets the pace
+    const MotionSyncAxis_t axes[2] = {{0, 0, 20000, 3200, 1600, 0},
+                                      {1, 0, 8000, 500, 400, 0}};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_plan_synchronized(plans, axes, 2));
+    uint32_t ticks = run_synchronized(plans, axes);
+
+    // Axis 1 alone: 1.25 s ramps + 14.75 s cruise + 1.25 s ramps
+    static MotionTrajectory_t single;
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_plan_synchronized(&single, &axes[1], 1));
+    TEST_ASSERT_EQUAL_UINT32(single.total_ticks, plans[0].total_ticks);
+    TEST_ASSERT_UINT32_WITHIN(1U, 17250U, ticks);
+}
+
+void test_synchronized_respects_asymmetric_decel(void) {
+    static MotionTrajectory_t plans[2];
+    const MotionSyncAxis_t axes[2] = {{0, 0, 10000, 2000, 1600, 400},
+                                      {1, 0, 10000, 2000, 1600, 1600}};
+    int32_t pos = 0;
+    int32_t vel = 0;
+    int32_t last_vel = 0;
+    uint32_t max_drop = 0;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      motion_profile_plan_synchronized(plans, axes, 2));
+    while (motion_profile_trajectory_step(&plans[0], &pos, &vel)) {
+        if (last_vel > vel && (uint32_t)(last_vel - vel) > max_drop) {
+            max_drop = (uint32_t)(last_vel - vel);
+        }
+        last_vel = vel;
+    }
+
+    // 400 steps/s^2 at 1 kHz is 0.4 steps/s per tick (+1 for rounding)
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(1U, max_drop);
+    TEST_ASSERT_EQUAL_INT32(10000, pos);
+}
+
+void test_start_synchronized_steps_motors_from_same_tick(void) {
+    const MotionSyncAxis_t axes[2] = {{0, 0, 6000, 3200, 1600, 0},
+                                      {1, 0, -3000, 3200, 1600, 0}};
+    int32_t pos;
+    int32_t vel;
+    uint32_t ticks[2] = {0, 0};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, motion_profile_start_synchronized(axes, 2));
+    TEST_ASSERT_TRUE(motion_profile_is_active(0));
+    TEST_ASSERT_TRUE(motion_profile_is_active(1));
+
+    while (motion_profile_is_active(0) || motion_profile_is_active(1)) {
+        for (uint8_t motor = 0; motor < 2; motor++) {
+            if (motion_profile_update(motor, &pos, &vel) == SYSTEM_OK) {
+                ticks[motor]++;
+            }
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(ticks[0], ticks[1]);
+
+    const MotionSyncAxis_t duplicate[2] = {{0, 0, 100, 3200, 1600, 0},
+                                           {0, 0, 200, 3200, 1600, 0}};
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      motion_profile_start_synchronized(duplicate, 2));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_trapezoid_lands_exactly_on_target);
+    RUN_TEST(test_reverse_triangular_move);
+    RUN_TEST(test_scurve_lands_exactly_on_target);
+    RUN_TEST(test_segment_boundaries_snap_to_plan);
+    RUN_TEST(test_matches_closed_form_trapezoid);
+    RUN_TEST(test_zero_length_move_completes_immediately);
+    RUN_TEST(test_update_deactivates_profile_at_end);
+    RUN_TEST(test_stop_drops_velocity_feedforward);
+    RUN_TEST(test_replan_extends_move_without_stopping);
+    RUN_TEST(test_replan_reverses_when_target_is_behind);
+    RUN_TEST(test_replan_from_rest_after_move);
+    RUN_TEST(test_retarget_is_applied_by_update);
+    RUN_TEST(test_synchronized_axes_finish_together_on_line);
+    RUN_TEST(test_synchronized_time_is_slowest_axis_minimum);
+    RUN_TEST(test_synchronized_respects_asymmetric_decel);
+    RUN_TEST(test_start_synchronized_steps_motors_from_same_tick);
+    return UNITY_END();
+}
+
+/* Position control stub */
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    feedforward_cleared |= 1U << motor_id;
+}
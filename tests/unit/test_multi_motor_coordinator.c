@@ -0,0 +1,382 @@
+/**
+ * @file test_multi_motor_coordinator.c
+ * @brief Unit tests for the multi-motor coordinator's synchronised-move
+ *        error tracking and gear / cam followers
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Runs controllers/multi_motor_coordinator.c with the real look-ahead
+ * planner and cam evaluator. Position control, motion profiles, safety and
+ * the fault monitor are stubbed; the stubs hold the positions the
+ * coordinator reads back.
+ */
+
+#include "communication/comm_protocol.h"
+#include "controllers/motion_profile.h"
+#include "controllers/motion_pvt.h"
+#include "controllers/multi_motor_coordinator.h"
+#include "controllers/position_control.h"
+#include "controllers/position_safety.h"
+#include "safety/fault_monitor.h"
+#include "safety/safety_system.h"
+#include "unity.h"
+#include <string.h>
+
+static int32_t position[MAX_MOTORS]; ///< Measured position stub
+static int32_t setpoint[MAX_MOTORS]; ///< Position control setpoint stub
+static bool settled[MAX_MOTORS];     ///< Position control settled flag stub
+static int32_t velocity[MAX_MOTORS]; ///< Profile setpoint velocity stub
+static int32_t soft_limit;           ///< Soft limit stub (+/- steps)
+static uint32_t sync_faults;         ///< FAULT_SYNCHRONIZATION_ERROR reports
+static uint32_t limit_events;        ///< SAFETY_EVENT_LIMIT_VIOLATION logs
+
+void setUp(void) {
+    memset(position, 0, sizeof(position));
+    memset(setpoint, 0, sizeof(setpoint));
+    memset(settled, 0, sizeof(settled));
+    memset(velocity, 0, sizeof(velocity));
+    soft_limit = MAX_POSITION_STEPS;
+    sync_faults = 0;
+    limit_events = 0;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_init());
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_enable_motor(i, true));
+    }
+}
+
+void tearDown(void) {
+}
+
+/**
+ * @brief Start a synchronised move from the current setpoints
+ */
+static void start_sync_move(int32_t target0, int32_t target1) {
+    CoordinatedMoveCommand_t move = {0};
+    const int32_t targets[MAX_MOTORS] = {target0, target1};
+
+    for (uint8_t i = 0; i < MAX_MOTORS; i++) {
+        move.motor_targets[i].enabled = true;
+        move.motor_targets[i].target_position = targets[i];
+        move.motor_targets[i].max_velocity = 1000;
+        move.motor_targets[i].acceleration = 1000;
+        move.motor_targets[i].deceleration = 1000;
+    }
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_SYNCHRONIZED));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_coordinated_move(&move));
+}
+
+static int32_t sync_error(void) {
+    CoordinationStatus_t status;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_get_status(&status));
+    return status.max_sync_error;
+}
+
+static CoordinationStatus_t coordination_status(void) {
+    CoordinationStatus_t status;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_get_status(&status));
+    return status;
+}
+
+static bool motion_active(void) {
+    CoordinationStatus_t status;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_get_status(&status));
+    return status.active;
+}
+
+void test_sync_error_is_exact_on_long_moves(void) {
+    setpoint[0] = -1000000;
+    setpoint[1] = -999999;
+    start_sync_move(1000000, 999998);
+
+    // Points on the line, rounded to whole steps: a float progress misses
+    // these by a step
+    position[0] = -704946;
+    position[1] = -704945;
+    TEST_ASSERT_EQUAL_INT32(0, sync_error());
+    position[0] = -702015;
+    position[1] = -702014;
+    TEST_ASSERT_EQUAL_INT32(0, sync_error());
+
+    position[1] += 7;
+    TEST_ASSERT_EQUAL_INT32(7, sync_error());
+}
+
+void test_sync_error_follows_a_backward_reference(void) {
+    setpoint[0] = 3000;
+    setpoint[1] = 0;
+    start_sync_move(0, 1000);
+
+    position[0] = 1500;
+    position[1] = 500;
+    TEST_ASSERT_EQUAL_INT32(0, sync_error());
+    position[1] = 490;
+    TEST_ASSERT_EQUAL_INT32(10, sync_error());
+}
+
+void test_stop_drops_the_sync_line(void) {
+    start_sync_move(1000, 500);
+    position[0] = 500;
+    position[1] = 250;
+    TEST_ASSERT_EQUAL_INT32(0, sync_error());
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_stop_coordinated_motion());
+
+    // Back to the spread between the axes
+    TEST_ASSERT_EQUAL_INT32(250, sync_error());
+}
+
+void test_completion_drops_the_sync_line(void) {
+    start_sync_move(1000, 500);
+    position[0] = 1000;
+    position[1] = 500;
+    settled[0] = true;
+    settled[1] = true;
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_update(1));
+    TEST_ASSERT_FALSE(motion_active());
+    TEST_ASSERT_EQUAL_UINT32(0, sync_faults);
+    TEST_ASSERT_EQUAL_INT32(500, sync_error());
+}
+
+void test_queued_move_drops_the_sync_line(void) {
+    CoordinatedMoveCommand_t move = {0};
+
+    start_sync_move(1000, 500);
+    position[0] = 1000;
+    position[1] = 500;
+    settled[0] = true;
+    settled[1] = true;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_update(1));
+
+    // A blended path is not measured against the last synchronised move
+    move.motor_targets[0].enabled = true;
+    move.motor_targets[0].target_position = 2000;
+    move.motor_targets[0].max_velocity = 1000;
+    move.motor_targets[0].acceleration = 1000;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_queue_move(&move));
+    position[0] = 1500;
+    TEST_ASSERT_EQUAL_INT32(1000, sync_error());
+}
+
+void test_gear_follower_engages_at_the_current_setpoints(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_MASTER_SLAVE));
+    setpoint[0] = 1000;
+    setpoint[1] = 500;
+
+    // The master cannot follow itself
+    TEST_ASSERT_EQUAL(ERROR_MOTOR_INVALID_ID,
+                      multi_motor_set_gear_ratio(0, 1, 1));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_set_gear_ratio(1, -3, 2));
+    TEST_ASSERT_FALSE(coordination_status().motor_following[0]);
+    TEST_ASSERT_TRUE(coordination_status().motor_following[1]);
+
+    // No setpoint jump until the master moves
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(500, setpoint[1]);
+
+    setpoint[0] = 1100;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(2));
+    TEST_ASSERT_EQUAL_INT32(350, setpoint[1]);
+    TEST_ASSERT_EQUAL_INT32(-75000, velocity[1]); // 150 steps in 2 ms
+}
+
+void test_followers_need_master_slave_mode(void) {
+    TEST_ASSERT_EQUAL(ERROR_INVALID_STATE, multi_motor_set_gear_ratio(1, 1, 1));
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_MASTER_SLAVE));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_set_gear_ratio(1, 1, 1));
+
+    // Leaving the mode releases the follower and stops evaluation
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_INDEPENDENT));
+    TEST_ASSERT_FALSE(coordination_status().motor_following[1]);
+    setpoint[0] = 100;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(0, setpoint[1]);
+}
+
+void test_following_error_is_setpoint_minus_position(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_MASTER_SLAVE));
+    setpoint[1] = 500;
+    position[1] = 500;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_set_gear_ratio(1, 1, 1));
+
+    setpoint[0] = 100;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(0, coordination_status().following_error[1]);
+    TEST_ASSERT_EQUAL_INT32(600, setpoint[1]);
+
+    // Measured against the setpoint of the previous tick
+    position[1] = 590;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(10, coordination_status().following_error[1]);
+
+    position[1] = 605;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    CoordinationStatus_t status = coordination_status();
+    TEST_ASSERT_EQUAL_INT32(-5, status.following_error[1]);
+    TEST_ASSERT_EQUAL_INT32(10, status.peak_following_error[1]);
+}
+
+void test_cam_follower_velocity_is_the_setpoint_step_rate(void) {
+    static const int32_t points[] = {0, 100, 100, 0};
+    const MotionCamTable_t cam = {
+        .points = points, .point_count = 4, .master_spacing = 100};
+
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_MASTER_SLAVE));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_set_cam(1, &cam, false));
+
+    setpoint[0] = 50;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(50, setpoint[1]);
+    TEST_ASSERT_EQUAL_INT32(50000, velocity[1]);
+
+    setpoint[0] = 150;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(2));
+    TEST_ASSERT_EQUAL_INT32(100, setpoint[1]);
+    TEST_ASSERT_EQUAL_INT32(25000, velocity[1]);
+
+    // Falling flank: the follower runs backwards
+    setpoint[0] = 280;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(4));
+    TEST_ASSERT_EQUAL_INT32(20, setpoint[1]);
+    TEST_ASSERT_EQUAL_INT32(-20000, velocity[1]);
+}
+
+void test_follower_stops_at_the_soft_limit(void) {
+    TEST_ASSERT_EQUAL(SYSTEM_OK,
+                      multi_motor_set_mode(COORDINATION_MODE_MASTER_SLAVE));
+    soft_limit = 150;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_set_gear_ratio(1, 1, 1));
+
+    setpoint[0] = 100;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(100, setpoint[1]);
+
+    // Holds the last setpoint inside the limit, at rest
+    setpoint[0] = 200;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(100, setpoint[1]);
+    TEST_ASSERT_EQUAL_INT32(0, velocity[1]);
+    TEST_ASSERT_EQUAL_UINT32(1U, limit_events);
+    TEST_ASSERT_FALSE(coordination_status().motor_following[1]);
+
+    setpoint[0] = 120;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, multi_motor_follow_update(1));
+    TEST_ASSERT_EQUAL_INT32(100, setpoint[1]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_sync_error_is_exact_on_long_moves);
+    RUN_TEST(test_sync_error_follows_a_backward_reference);
+    RUN_TEST(test_stop_drops_the_sync_line);
+    RUN_TEST(test_completion_drops_the_sync_line);
+    RUN_TEST(test_queued_move_drops_the_sync_line);
+    RUN_TEST(test_gear_follower_engages_at_the_current_setpoints);
+    RUN_TEST(test_followers_need_master_slave_mode);
+    RUN_TEST(test_following_error_is_setpoint_minus_position);
+    RUN_TEST(test_cam_follower_velocity_is_the_setpoint_step_rate);
+    RUN_TEST(test_follower_stops_at_the_soft_limit);
+    return UNITY_END();
+}
+
+/* Position control stubs */
+
+SystemError_t position_control_get_status(uint8_t motor_id,
+                                          PositionControlStatus_t *status) {
+    memset(status, 0, sizeof(*status));
+    status->current_position = position[motor_id];
+    status->target_position = setpoint[motor_id];
+    status->position_settled = settled[motor_id];
+    return SYSTEM_OK;
+}
+
+SystemError_t position_control_set_target(uint8_t motor_id,
+                                          int32_t target_position) {
+    setpoint[motor_id] = target_position;
+    return SYSTEM_OK;
+}
+
+SystemError_t position_control_set_profile_setpoint(uint8_t motor_id,
+                                                   int32_t position,
+                                                   int32_t speed) {
+    setpoint[motor_id] = position;
+    velocity[motor_id] = speed;
+    return SYSTEM_OK;
+}
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    (void)motor_id;
+}
+
+/* Motion profile and PVT stubs: profiles finish as soon as started */
+
+SystemError_t motion_profile_start(uint8_t motor_id, MotionProfile_t *profile) {
+    (void)motor_id;
+    (void)profile;
+    return SYSTEM_OK;
+}
+
+SystemError_t motion_profile_start_synchronized(const MotionSyncAxis_t *axes,
+                                                uint8_t axis_count) {
+    (void)axes;
+    (void)axis_count;
+    return SYSTEM_OK;
+}
+
+SystemError_t motion_profile_stop(uint8_t motor_id) {
+    (void)motor_id;
+    return SYSTEM_OK;
+}
+
+bool motion_profile_is_active(uint8_t motor_id) {
+    (void)motor_id;
+    return false;
+}
+
+void motion_pvt_abort(uint8_t motor_id) {
+    (void)motor_id;
+}
+
+/* Safety, fault monitor and communication stubs */
+
+SystemError_t
+position_safety_validate_target(uint8_t motor_id, float target_position_deg,
+                                PositionValidationResult_t *result) {
+    // Half a step of margin against the float conversion
+    float limit_deg = ((float)soft_limit + 0.5f) * STEPS_TO_DEGREES;
+    (void)motor_id;
+    memset(result, 0, sizeof(*result));
+    result->soft_limit_ok = target_position_deg <= limit_deg &&
+                            target_position_deg >= -limit_deg;
+    result->position_valid = result->soft_limit_ok;
+    return SYSTEM_OK;
+}
+
+SystemError_t fault_monitor_report_fault(uint8_t motor_id,
+                                         MotorFaultType_t fault_type) {
+    (void)motor_id;
+    if (fault_type == FAULT_SYNCHRONIZATION_ERROR) {
+        sync_faults++;
+    }
+    return SYSTEM_OK;
+}
+
+void safety_log_event(SafetyEventType_t event, uint8_t motor_id,
+                      uint32_t additional_data) {
+    (void)motor_id;
+    (void)additional_data;
+    if (event == SAFETY_EVENT_LIMIT_VIOLATION) {
+        limit_events++;
+    }
+}
+
+void comm_cancel_pending_batch(void) {
+}
@@ -0,0 +1,398 @@
+/**
+ * @file test_real_time_control.c
+ * @brief Unit tests for the real-time task scheduler
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ *
+ * @note Runs controllers/real_time_control.c on the mock HAL clock. The
+ * lockstep scenario drives the real timer handlers and the motor simulation
+ * plant from the virtual-time kernel; the motion and control modules the
+ * default tasks call into are stubbed below. The dispatch tests add their
+ * own tasks and call the control loop handler at chosen clock values.
+ */
+
+#include "controllers/real_time_control.h"
+#include "mock_hal_abstraction.h"
+#include "safety/fault_monitor.h"
+#include "simulation/motor_simulation.h"
+#include "simulation/virtual_time.h"
+#include "unity.h"
+#include <string.h>
+
+// Default task ids, in creation order (create_default_tasks)
+#define TASK_POSITION_CONTROL 1U
+#define TASK_SAFETY_MONITOR 3U
+
+#define LOCKSTEP_SAFETY_PERIOD_US 100U
+#define LOCKSTEP_CONTROL_PERIOD_US 1000U
+#define LOCKSTEP_MOVE_US 6000000ULL // Time per target
+#define LOCKSTEP_TARGET 400         // Steps
+#define LOCKSTEP_SPEED 1500U        // Steps/s: one step per plant tick
+
+uint32_t SystemCoreClock = 480000000U;
+
+static int32_t control_target;      ///< Position control stub target
+static uint32_t control_updates;    ///< position_control_update() calls
+static uint32_t safety_checks;      ///< fault_monitor_check() calls
+static uint32_t system_faults;      ///< Faults raised by the safety task
+
+static uint8_t release_log[16];     ///< Custom task ids in execution order
+static uint8_t release_log_count;
+
+void setUp(void) {
+    MockHAL_Reset();
+    MockHAL_SetVirtualTime(0);
+    control_target = 0;
+    control_updates = 0;
+    safety_checks = 0;
+    system_faults = 0;
+    release_log_count = 0;
+
+    motor_simulation_reset();
+    TEST_ASSERT_TRUE(motor_simulation_init(SIM_MODE_REALISTIC));
+    TEST_ASSERT_TRUE(l6470_sim_init(0));
+    TEST_ASSERT_EQUAL(SYSTEM_OK, rt_control_init());
+}
+
+void tearDown(void) {
+    virtual_time_set_clock_sink(NULL);
+}
+
+/* Virtual-time tasks standing in for TIM3, TIM2 and the motor */
+
+static void lockstep_safety_timer(void *context) {
+    (void)context;
+    rt_safety_monitor_handler();
+}
+
+static void lockstep_control_timer(void *context) {
+    (void)context;
+    rt_control_loop_handler();
+}
+
+static void lockstep_plant(void *context) {
+    (void)context;
+    motor_simulation_update(LOCKSTEP_CONTROL_PERIOD_US / 1000U);
+}
+
+static void start_lockstep(void) {
+    virtual_time_set_clock_sink(MockHAL_SetVirtualTime);
+    virtual_time_reset();
+    TEST_ASSERT_TRUE(virtual_time_add_task("safety",
+                                           LOCKSTEP_SAFETY_PERIOD_US, 0,
+                                           lockstep_safety_timer, NULL) >= 0);
+    TEST_ASSERT_TRUE(virtual_time_add_task("control",
+                                           LOCKSTEP_CONTROL_PERIOD_US, 0,
+                                           lockstep_control_timer,
+                                           NULL) >= 0);
+    TEST_ASSERT_TRUE(virtual_time_add_task("plant",
+                                           LOCKSTEP_CONTROL_PERIOD_US, 0,
+                                           lockstep_plant, NULL) >= 0);
+}
+
+static RTTaskStats_t task_stats(uint8_t task_id) {
+    RTTaskStats_t stats;
+    TEST_ASSERT_EQUAL(SYSTEM_OK, rt_control_get_task_stats(task_id, &stats));
+    return stats;
+}
+
+void test_lockstep_moves_the_simulated_motor(void) {
+    start_lockstep();
+
+    control_target = LOCKSTEP_TARGET;
+    virtual_time_run_until(LOCKSTEP_MOVE_US - 1U);
+    TEST_ASSERT_EQUAL_INT32(LOCKSTEP_TARGET, l6470_sim_get_position(0));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, l6470_sim_get_speed(0));
+
+    // Back to zero; the run crosses the 32-bit cycle counter wrap at 8.9 s
+    control_target = 0;
+    virtual_time_run_until(2U * LOCKSTEP_MOVE_US);
+    TEST_ASSERT_EQUAL_INT32(0, l6470_sim_get_position(0));
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, l6470_sim_get_speed(0));
+    TEST_ASSERT_EQUAL_UINT32(12000U, HAL_Abstraction_GetTick());
+}
+
+void test_lockstep_releases_every_task_period(void) {
+    start_lockstep();
+    virtual_time_run_until(2U * LOCKSTEP_MOVE_US);
+
+    // Releases at t = 0 inclusive, none missed across the counter wrap
+    RTTaskStats_t control = task_stats(TASK_POSITION_CONTROL);
+    TEST_ASSERT_EQUAL_UINT32(12001U, control.execution_count);
+    TEST_ASSERT_EQUAL_UINT32(0U, control.missed_deadlines);
+    TEST_ASSERT_EQUAL_UINT32(0U, control.max_release_jitter);
+    TEST_ASSERT_EQUAL_UINT32(12001U, control_updates);
+
+    RTTaskStats_t safety = task_stats(TASK_SAFETY_MONITOR);
+    TEST_ASSERT_EQUAL_UINT32(120001U, safety.execution_count);
+    TEST_ASSERT_EQUAL_UINT32(0U, safety.missed_deadlines);
+    TEST_ASSERT_EQUAL_UINT32(120001U, safety_checks);
+    TEST_ASSERT_EQUAL_UINT32(0U, system_faults);
+}
+
+/* Custom tasks dispatched by calling the timer handlers directly */
+
+static void record_release(void *context) {
+    if (release_log_count < sizeof(release_log)) {
+        release_log[release_log_count++] = *(const uint8_t *)context;
+    }
+}
+
+static uint8_t create_task_at(uint32_t time_us, uint32_t period_us,
+                              uint32_t deadline_us) {
+    static uint8_t ids[RT_MAX_TASKS];
+    static uint8_t created;
+    uint8_t *id = &ids[created++ % RT_MAX_TASKS];
+    RTTaskConfig_t config = {.name = "Custom",
+                             .priority = RT_PRIORITY_NORMAL,
+                             .period_us = period_us,
+                             .deadline_us = deadline_us,
+                             .function = record_release,
+                             .context = id};
+
+    // The task first runs on a later dispatch, after *id is filled in
+    MockHAL_SetVirtualTime(time_us);
+    TEST_ASSERT_EQUAL(SYSTEM_OK, rt_control_create_task(&config, id));
+    return *id;
+}
+
+static void dispatch_at(uint32_t time_us) {
+    MockHAL_SetVirtualTime(time_us);
+    release_log_count = 0;
+    rt_control_loop_handler();
+}
+
+void test_create_task_rejects_an_unknown_priority(void) {
+    RTTaskConfig_t config = {.name = "Orphan",
+                             .priority = RT_PRIORITY_COUNT,
+                             .period_us = 1000,
+                             .deadline_us = 1000,
+                             .function = record_release,
+                             .context = NULL};
+    uint8_t task_id = 0xFF;
+
+    TEST_ASSERT_EQUAL(ERROR_INVALID_PARAMETER,
+                      rt_control_create_task(&config, &task_id));
+    TEST_ASSERT_EQUAL_HEX8(0xFF, task_id);
+
+    // No slot was taken: the next task gets the first free one
+    TEST_ASSERT_EQUAL_UINT8(4U, create_task_at(0, 1000, 1000));
+}
+
+void test_tasks_run_in_release_order_then_by_id(void) {
+    uint8_t a = create_task_at(0, 1000, 1000);
+    uint8_t b = create_task_at(0, 400, 400);
+    uint8_t c = create_task_at(250, 1000, 1000); // Offset by 250 us
+
+    // Equal releases at 0 run by id, then the later one
+    dispatch_at(250);
+    TEST_ASSERT_EQUAL_UINT8(3U, release_log_count);
+    TEST_ASSERT_EQUAL_UINT8(a, release_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(b, release_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(c, release_log[2]);
+
+    // Releases at 400 (b), 1000 (a) and 1250 (c): release order, not id
+    dispatch_at(1300);
+    TEST_ASSERT_EQUAL_UINT8(3U, release_log_count);
+    TEST_ASSERT_EQUAL_UINT8(b, release_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(a, release_log[1]);
+    TEST_ASSERT_EQUAL_UINT8(c, release_log[2]);
+
+    // Nothing released before b's next release at 1600
+    dispatch_at(1599);
+    TEST_ASSERT_EQUAL_UINT8(0U, release_log_count);
+    dispatch_at(1600);
+    TEST_ASSERT_EQUAL_UINT8(1U, release_log_count);
+    TEST_ASSERT_EQUAL_UINT8(b, release_log[0]);
+
+    // b is now due at 2000 with a: the lower id goes first
+    dispatch_at(2000);
+    TEST_ASSERT_EQUAL_UINT8(2U, release_log_count);
+    TEST_ASSERT_EQUAL_UINT8(a, release_log[0]);
+    TEST_ASSERT_EQUAL_UINT8(b, release_log[1]);
+}
+
+void test_skipped_periods_count_as_missed_releases(void) {
+    uint8_t task = create_task_at(0, 1000, 1000);
+
+    dispatch_at(0);
+    TEST_ASSERT_EQUAL_UINT32(0U, task_stats(task).missed_deadlines);
+
+    // The release at 1000 runs 2500 us late and those at 2000 and 3000
+    // are skipped: one missed deadline plus two missed releases
+    dispatch_at(3500);
+    RTTaskStats_t stats = task_stats(task);
+    TEST_ASSERT_EQUAL_UINT32(2U, stats.execution_count);
+    TEST_ASSERT_EQUAL_UINT32(3U, stats.missed_deadlines);
+    TEST_ASSERT_EQUAL_UINT32(2500U, stats.max_release_jitter);
+
+    // Back on the fixed-rate grid at 4000
+    dispatch_at(3999);
+    TEST_ASSERT_EQUAL_UINT8(0U, release_log_count);
+    dispatch_at(4000);
+    TEST_ASSERT_EQUAL_UINT8(1U, release_log_count);
+    stats = task_stats(task);
+    TEST_ASSERT_EQUAL_UINT32(3U, stats.execution_count);
+    TEST_ASSERT_EQUAL_UINT32(3U, stats.missed_deadlines);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_lockstep_moves_the_simulated_motor);
+    RUN_TEST(test_lockstep_releases_every_task_period);
+    RUN_TEST(test_create_task_rejects_an_unknown_priority);
+    RUN_TEST(test_tasks_run_in_release_order_then_by_id);
+    RUN_TEST(test_skipped_periods_count_as_missed_releases);
+    return UNITY_END();
+}
+
+/* Timer stubs */
+
+HAL_StatusTypeDef HAL_TIM_Base_Init(TIM_HandleTypeDef *htim) {
+    (void)htim;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Start_IT(TIM_HandleTypeDef *htim) {
+    (void)htim;
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef HAL_TIM_Base_Stop_IT(TIM_HandleTypeDef *htim) {
+    (void)htim;
+    return HAL_OK;
+}
+
+/* Position control stub: bang-bang speed control of simulated motor 0 */
+
+bool position_control_is_enabled(uint8_t motor_id) {
+    return motor_id == 0;
+}
+
+SystemError_t position_control_update(uint8_t motor_id, uint32_t dt_ms) {
+    (void)dt_ms;
+    int32_t error = control_target - l6470_sim_get_position(motor_id);
+
+    control_updates++;
+    if (error == 0) {
+        l6470_sim_execute_command(motor_id, L6470_CMD_HARD_STOP, 0);
+    } else {
+        l6470_sim_execute_command(
+            motor_id, (uint8_t)(L6470_CMD_RUN | (error > 0 ? 1U : 0U)),
+            l6470_speed_encode(LOCKSTEP_SPEED * 1000U));
+    }
+    return SYSTEM_OK;
+}
+
+SystemError_t position_control_set_profile_setpoint(uint8_t motor_id,
+                                                   int32_t position,
+                                                   int32_t velocity) {
+    (void)motor_id;
+    (void)position;
+    (void)velocity;
+    return SYSTEM_OK;
+}
+
+void position_control_clear_feedforward(uint8_t motor_id) {
+    (void)motor_id;
+}
+
+SystemError_t get_motor_position(uint8_t motor_id, float *position_deg) {
+    (void)motor_id;
+    (void)position_deg;
+    return ERROR_NOT_INITIALIZED;
+}
+
+/* Motion source stubs: no profile, stream or path is running */
+
+bool motion_profile_is_active(uint8_t motor_id) {
+    (void)motor_id;
+    return false;
+}
+
+SystemError_t motion_profile_update(uint8_t motor_id, int32_t *target_pos,
+                                    int32_t *target_vel) {
+    (void)motor_id;
+    (void)target_pos;
+    (void)target_vel;
+    return ERROR_INVALID_STATE;
+}
+
+SystemError_t motion_pvt_init(void) {
+    return SYSTEM_OK;
+}
+
+bool motion_pvt_is_active(uint8_t motor_id) {
+    (void)motor_id;
+    return false;
+}
+
+SystemError_t motion_pvt_update(uint8_t motor_id, uint32_t dt_ms,
+                                int32_t *target_pos, int32_t *target_vel) {
+    (void)motor_id;
+    (void)dt_ms;
+    (void)target_pos;
+    (void)target_vel;
+    return ERROR_INVALID_STATE;
+}
+
+bool motion_lookahead_is_active(void) {
+    return false;
+}
+
+SystemError_t motion_lookahead_update(uint32_t dt_ms,
+                                      int32_t target_pos[MAX_MOTORS],
+                                      int32_t target_vel[MAX_MOTORS]) {
+    (void)dt_ms;
+    (void)target_pos;
+    (void)target_vel;
+    return ERROR_INVALID_STATE;
+}
+
+SystemError_t multi_motor_update(uint32_t dt_ms) {
+    (void)dt_ms;
+    return SYSTEM_OK;
+}
+
+SystemError_t multi_motor_follow_update(uint32_t dt_ms) {
+    (void)dt_ms;
+    return SYSTEM_OK;
+}
+
+void comm_apply_pending_batch(void) {
+}
+
+/* Safety stubs */
+
+SystemError_t position_safety_init(void) {
+    return SYSTEM_OK;
+}
+
+SystemError_t position_safety_update(uint8_t motor_id, float position_deg) {
+    (void)motor_id;
+    (void)position_deg;
+    return SYSTEM_OK;
+}
+
+SystemError_t fault_monitor_check(void) {
+    safety_checks++;
+    return SYSTEM_OK;
+}
+
+SystemError_t fault_monitor_record_system_fault(SystemFaultType_t fault_type,
+                                                FaultSeverity_t severity,
+                                                uint32_t additional_data) {
+    (void)fault_type;
+    (void)severity;
+    (void)additional_data;
+    system_faults++;
+    return SYSTEM_OK;
+}
+
+/* Register model helper declared by the generated header */
+
+bool l6470_validate_register_value(uint8_t reg_addr, uint32_t value) {
+    (void)reg_addr;
+    (void)value;
+    return true;
+}
@@ -0,0 +1,98 @@
+/**
+ * @file test_rt_histogram.c
+ * @brief Unit tests for the log-bucketed RT latency histogram
+ * @author STM32H753ZI Project Team
+ * @date 2025-08-05
+ */
+
+#include "controllers/rt_histogram.h"
+#include "unity.h"
+
+static RTHistogram_t histogram;
+
+void setUp(void) {
+    rt_histogram_reset(&histogram);
+}
+
+void tearDown(void) {
+}
+
+void test_small_values_are_exact(void) {
+    for (uint32_t value = 0; value < RT_HISTOGRAM_SUB_BUCKETS; value++) {
+        uint32_t index = rt_histogram_bucket_index(value);
+        TEST_ASSERT_EQUAL_UINT32(value, index);
+        TEST_ASSERT_EQUAL_UINT32(value, rt_histogram_bucket_upper(index));
+    }
+}
+
+void test_bucket_bounds_contain_value(void) {
+    const uint32_t values[] = {4U,          5U,          7U,
+                               8U,          1000U,       480000U,
+                               4800000U,    0x7FFFFFFFU, 0x80000000U,
+                               0xFFFFFFFFU};
+
+    for (uint32_t i = 0; i < sizeof(values) / sizeof(values[0]); i++) {
+        uint32_t index = rt_histogram_bucket_index(values[i]);
+        TEST_ASSERT_LESS_THAN_UINT32(RT_HISTOGRAM_BUCKETS, index);
+        TEST_ASSERT_GREATER_OR_EQUAL_UINT32(values[i],
+                                            rt_histogram_bucket_upper(index));
+        if (index > 0) {
+            TEST_ASSERT_LESS_THAN_UINT32(
+                values[i], rt_histogram_bucket_upper(index - 1U));
+        }
+    }
+}
+
+void test_relative_error_bounded(void) {
+    // Upper bound is within 1/SUB_BUCKETS of the recorded value
+    for (uint32_t value = 4; value < 1000000U; value = value * 3U + 1U) {
+        uint32_t upper =
+            rt_histogram_bucket_upper(rt_histogram_bucket_index(value));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(
+            value + value / RT_HISTOGRAM_SUB_BUCKETS, upper);
+    }
+}
+
+void test_percentiles_track_tail(void) {
+    // 999 fast samples and a single slow outlier
+    for (uint32_t i = 0; i < 999; i++) {
+        rt_histogram_record(&histogram, 480U);
+    }
+    rt_histogram_record(&histogram, 48000U);
+
+    TEST_ASSERT_EQUAL_UINT32(1000U, histogram.total);
+    TEST_ASSERT_EQUAL_UINT32(48000U, histogram.max);
+
+    uint32_t p50 = rt_histogram_percentile(&histogram, RT_PERCENTILE_P50);
+    uint32_t p99 = rt_histogram_percentile(&histogram, RT_PERCENTILE_P99);
+    uint32_t p999 = rt_histogram_percentile(&histogram, RT_PERCENTILE_P999);
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(480U, p50);
+    TEST_ASSERT_LESS_THAN_UINT32(600U, p50);
+    TEST_ASSERT_EQUAL_UINT32(p50, p99);
+    TEST_ASSERT_EQUAL_UINT32(p50, p999);
+    TEST_ASSERT_EQUAL_UINT32(
+        48000U, rt_histogram_percentile(&histogram, 100000U));
+}
+
+void test_percentile_clamped_to_max(void) {
+    rt_histogram_record(&histogram, 1000U);
+    TEST_ASSERT_EQUAL_UINT32(
+        1000U, rt_histogram_percentile(&histogram, RT_PERCENTILE_P50));
+}
+
+void test_empty_histogram_returns_zero(void) {
+    TEST_ASSERT_EQUAL_UINT32(
+        0U, rt_histogram_percentile(&histogram, RT_PERCENTILE_P999));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_small_values_are_exact);
+    RUN_TEST(test_bucket_bounds_contain_value);
+    RUN_TEST(test_relative_error_bounded);
+    RUN_TEST(test_percentiles_track_tail);
+    RUN_TEST(test_percentile_clamped_to_max);
+    RUN_TEST(test_empty_histogram_returns_zero);
+    return UNITY_END();
+}